@@ -0,0 +1,604 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+// Headless hair geometry analysis: loads a scene without a graphics device, tessellates its hair into every representation
+// and writes per mesh element counts, attribute stream sizes and tessellation times as JSON. With -bvh a CPU binned SAH build
+// estimates the BLAS of every representation, with -keyframes the morph target keyframes are encoded in every keyframe format.
+// -blasBuildEstimatedScratchBudget schedules the hair BLAS builds of every representation within a per frame budget of estimated scratch bytes.
+// -keyframeStreaming simulates the streamed keyframe window of every morph target mesh and reads its keyframes back from a keyframe file.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+#include <donut/core/json.h>
+#include <donut/core/log.h>
+#include <donut/core/vfs/VFS.h>
+#include <donut/engine/GltfImporter.h>
+#include <donut/engine/Scene.h>
+#include <donut/engine/SceneGraph.h>
+#include <donut/engine/TextureCache.h>
+#include <json/value.h>
+#include <json/writer.h>
+
+#include "AccelStruct/BlasBuildScheduler.h"
+#include "AccelStruct/BlasBuildSchedulerSimulation.h"
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "Curve/MorphTargetKeyframeEncoder.h"
+#include "Curve/MorphTargetKeyframeStreaming.h"
+#include "Curve/MorphTargetKeyframeStreamingSimulation.h"
+#include "Curve/MorphTargetRefitEstimator.h"
+
+using namespace donut;
+using namespace donut::engine;
+
+static void printUsage()
+{
+    std::fprintf(stderr,
+        "Usage: hairanalysis <scene.scene.json | model.gltf> [options]\n"
+        "  -output <file>                   Write the report to a file instead of stdout\n"
+        "  -hairRadiusScale <scale>\n"
+        "  -hairResegmentationError <error>\n"
+        "  -hairStrandReorder <0|1>\n"
+        "  -hairPolytubeOrder <order>       2 to 8, 0 falls back to the default order without a camera\n"
+        "  -hairTessellationThreads <count>\n"
+        "  -hairSimdTessellation <0|1>\n"
+        "  -hairLssSuccessiveImplicit <0|1>\n"
+        "  -hairLodLevels <count>\n"
+        "  -bvh                             Estimate the BLAS of every mesh and representation\n"
+        "  -bvhBins <count>                 SAH bins per axis, 2 to 32\n"
+        "  -bvhMaxLeafPrimitives <count>\n"
+        "  -blasBuildEstimatedScratchBudget <MB>\n"
+        "                                   Schedule the hair BLAS builds of every representation within an estimated scratch budget per frame\n"
+        "  -blasBuildPrimitiveBudget <count>\n"
+        "  -keyframes                       Encode the morph target keyframes in every keyframe format and estimate their refit growth\n"
+        "  -keyframePcaError <error>        Relative RMS error target of the PCA keyframe format\n"
+        "  -keyframeStreaming <slots>       Simulate streaming the morph target keyframes through a window of slots\n"
+        "  -verbose                         Print the tessellation log\n");
+}
+
+// Loads the models of a scene file, or a single glTF file, into a scene graph. Only the CPU side of the meshes is loaded,
+// the scene graph of the scene file isn't instantiated, every model is attached once under the root.
+static std::shared_ptr<SceneGraph> loadSceneGraph(const std::shared_ptr<vfs::IFileSystem>& fs, const std::filesystem::path& sceneFileName)
+{
+    std::vector<std::filesystem::path> modelFileNames;
+    if (sceneFileName.extension() == ".json")
+    {
+        Json::Value documentRoot;
+        if (!json::LoadFromFile(*fs, sceneFileName, documentRoot) || !documentRoot.isObject())
+        {
+            log::error("Couldn't read scene file %s", sceneFileName.generic_string().c_str());
+            return nullptr;
+        }
+
+        for (const auto& model : documentRoot["models"])
+        {
+            if (model.isString())
+            {
+                modelFileNames.push_back(sceneFileName.parent_path() / model.asString());
+            }
+        }
+    }
+    else
+    {
+        modelFileNames.push_back(sceneFileName);
+    }
+
+    // engine::Scene needs a device, the importer and the texture cache only touch it once textures are uploaded
+    auto textureCache = std::make_shared<TextureCache>(nullptr, fs, nullptr);
+    const GltfImporter importer(fs, std::make_shared<SceneTypeFactory>());
+
+    auto sceneGraph = std::make_shared<SceneGraph>();
+    auto rootNode = std::make_shared<SceneGraphNode>();
+    sceneGraph->SetRootNode(rootNode);
+    for (const auto& modelFileName : modelFileNames)
+    {
+        SceneLoadingStats stats;
+        SceneImportResult result;
+        if (!importer.Load(modelFileName, *textureCache, stats, nullptr, result))
+        {
+            log::error("Couldn't load model %s", modelFileName.generic_string().c_str());
+            return nullptr;
+        }
+        sceneGraph->Attach(rootNode, result.rootNode);
+    }
+    sceneGraph->Refresh(0);
+
+    return sceneGraph;
+}
+
+static Json::Value getCurveMeshStatsJson(const CurveTessellation::CurveMeshStats& stats)
+{
+    Json::Value statsJson;
+    statsJson["vertices"] = stats.numVertices;
+    statsJson["indices"] = stats.numIndices;
+    statsJson["primitives"] = stats.numPrimitives;
+
+    Json::Value& bytesJson = statsJson["bytes"];
+    bytesJson["index"] = Json::UInt64(stats.indexBytes);
+    bytesJson["position"] = Json::UInt64(stats.positionBytes);
+    bytesJson["normal"] = Json::UInt64(stats.normalBytes);
+    bytesJson["tangent"] = Json::UInt64(stats.tangentBytes);
+    bytesJson["texCoord"] = Json::UInt64(stats.texCoordBytes);
+    bytesJson["radius"] = Json::UInt64(stats.radiusBytes);
+    bytesJson["total"] = Json::UInt64(stats.indexBytes + stats.positionBytes + stats.normalBytes +
+                                      stats.tangentBytes + stats.texCoordBytes + stats.radiusBytes);
+    return statsJson;
+}
+
+static Json::Value getCurveBvhStatsJson(const CurveBvhStats& stats)
+{
+    Json::Value statsJson;
+    statsJson["nodes"] = stats.numNodes;
+    statsJson["leaves"] = stats.numLeaves;
+    statsJson["maxDepth"] = stats.maxDepth;
+    statsJson["sahCost"] = stats.sahCost;
+    statsJson["leafOverlap"] = stats.leafOverlap;
+    statsJson["siblingOverlap"] = stats.siblingOverlap;
+    statsJson["estimatedBytes"] = Json::UInt64(stats.estimatedBytes);
+    statsJson["buildTimeMs"] = stats.buildTimeMs;
+    return statsJson;
+}
+
+static Json::Value getBlasBuildScheduleJson(const BlasBuildScheduleStats& stats)
+{
+    Json::Value scheduleJson;
+    scheduleJson["builds"] = stats.numRequests;
+    scheduleJson["frames"] = stats.numFrames;
+    scheduleJson["maxBuildsPerFrame"] = stats.maxBuildsPerFrame;
+    scheduleJson["maxEstimatedScratchBytesPerFrame"] = Json::UInt64(stats.maxScratchBytesPerFrame);
+    scheduleJson["maxPrimitivesPerFrame"] = stats.maxPrimitivesPerFrame;
+    scheduleJson["overBudgetFrames"] = stats.numOverBudgetFrames;
+    scheduleJson["maxWaitFrames"] = stats.maxWaitFrames;
+    scheduleJson["valid"] = stats.valid;
+    return scheduleJson;
+}
+
+static Json::Value getEncodedKeyframesJson(const MorphTargetKeyframeEncoder::EncodedKeyframes& encodedKeyframes)
+{
+    Json::Value formatJson;
+    formatJson["bytes"] = Json::UInt64(encodedKeyframes.getByteSize() + encodedKeyframes.getParameterByteSize());
+    formatJson["readBytesPerFrame"] = Json::UInt64(encodedKeyframes.getReadBytesPerFrame());
+    formatJson["maxPositionError"] = encodedKeyframes.maxPositionError;
+    formatJson["rmsPositionError"] = encodedKeyframes.rmsPositionError;
+    formatJson["encodeTimeMs"] = encodedKeyframes.encodeTimeMs;
+    if (encodedKeyframes.format == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_PCA)
+    {
+        formatJson["components"] = encodedKeyframes.componentCount;
+    }
+    return formatJson;
+}
+
+// Memory, bytes the animation reads per frame and largest position error of every morph target keyframe format
+static Json::Value getKeyframeStatsJson(const BufferGroup& buffers, const MorphTargetPcaSettings& pcaSettings)
+{
+    const uint64_t keyframeVertexCount = buffers.morphTargetBufferRange.empty() ? 0 : buffers.morphTargetBufferRange[0].byteSize / sizeof(float4);
+
+    Json::Value keyframesJson;
+    keyframesJson["keyframes"] = Json::UInt64(buffers.morphTargetBufferRange.size());
+    keyframesJson["strandPoints"] = Json::UInt64(keyframeVertexCount);
+    for (uint32_t format = 0; format < RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_COUNT; ++format)
+    {
+        MorphTargetKeyframeEncoder::EncodedKeyframes encodedKeyframes;
+        MorphTargetKeyframeEncoder::encode(buffers.morphTargetData, buffers.morphTargetBufferRange, format, encodedKeyframes, pcaSettings);
+
+        // The PCA format falls back to the full format for keyframes of different sizes
+        if (encodedKeyframes.format == format)
+        {
+            keyframesJson["formats"][MorphTargetKeyframeEncoder::getFormatName(format)] = getEncodedKeyframesJson(encodedKeyframes);
+        }
+    }
+    return keyframesJson;
+}
+
+// Growth of the estimated BLAS bounds when the BLAS built at one keyframe is refit to the others, from the first keyframe
+// and between the smallest and the largest keyframe
+static Json::Value getKeyframeRefitGrowthJson(const std::vector<rtxcr::geometry::LineSegment>& lineSegments, const BufferGroup& buffers)
+{
+    const auto startTime = std::chrono::high_resolution_clock::now();
+    const std::vector<float> keyframeSurfaceAreas =
+        MorphTargetRefitEstimator::computeKeyframeSurfaceAreas(lineSegments, buffers.morphTargetData, buffers.morphTargetBufferRange);
+    const std::chrono::duration<double, std::milli> estimationTime = std::chrono::high_resolution_clock::now() - startTime;
+
+    Json::Value growthJson;
+    if (keyframeSurfaceAreas.empty() || keyframeSurfaceAreas[0] <= 0.0f)
+    {
+        return growthJson;
+    }
+
+    const auto minMax = std::minmax_element(keyframeSurfaceAreas.begin(), keyframeSurfaceAreas.end());
+    growthJson["firstKeyframeMaxGrowth"] = *minMax.second / keyframeSurfaceAreas[0] - 1.0f;
+    growthJson["maxGrowth"] = *minMax.second / *minMax.first - 1.0f;
+    growthJson["estimationTimeMs"] = estimationTime.count();
+    return growthJson;
+}
+
+// Streamed keyframe window of a morph target mesh, played back with a simulated clock, and a round trip of the half format
+// keyframes through a keyframe file and the background reader
+static Json::Value getKeyframeStreamingJson(const BufferGroup& buffers, const uint32_t meshIndex, const uint32_t slotCount)
+{
+    MorphTargetKeyframeStreamingSimulationSettings simulationSettings;
+    simulationSettings.keyframeCount = (uint32_t)buffers.morphTargetBufferRange.size();
+    simulationSettings.slotCount = slotCount;
+    simulationSettings.frameCount = std::max(simulationSettings.frameCount, 4 * simulationSettings.keyframeCount);
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    const MorphTargetKeyframeStreamingSimulationStats simulationStats = MorphTargetKeyframeStreaming::simulate(simulationSettings);
+    const std::chrono::duration<double, std::milli> simulationTime = std::chrono::high_resolution_clock::now() - startTime;
+
+    Json::Value streamingJson;
+    streamingJson["slots"] = std::min(std::max(slotCount, 2u), simulationSettings.keyframeCount);
+    streamingJson["frames"] = simulationSettings.frameCount;
+    streamingJson["keyframesPerFrame"] = simulationSettings.keyframesPerFrame;
+    streamingJson["readLatencyFrames"] = simulationSettings.readLatencyFrames;
+    streamingJson["loads"] = simulationStats.numLoads;
+    streamingJson["requiredLoads"] = simulationStats.numRequiredLoads;
+    streamingJson["staleLoads"] = simulationStats.numStaleLoads;
+    streamingJson["maxPendingLoads"] = simulationStats.maxPendingLoads;
+    streamingJson["valid"] = simulationStats.valid;
+    streamingJson["simulationTimeMs"] = simulationTime.count();
+
+    MorphTargetKeyframeEncoder::EncodedKeyframes encodedKeyframes;
+    MorphTargetKeyframeEncoder::encode(buffers.morphTargetData, buffers.morphTargetBufferRange, RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_HALF, encodedKeyframes);
+
+    const std::filesystem::path filePath = std::filesystem::temp_directory_path() / ("hairanalysis_mesh" + std::to_string(meshIndex) + ".keyframes");
+    startTime = std::chrono::high_resolution_clock::now();
+    std::shared_ptr<const MorphTargetKeyframeFile> file;
+    if (MorphTargetKeyframeFile::store(filePath, encodedKeyframes))
+    {
+        file = MorphTargetKeyframeFile::load(filePath);
+    }
+
+    uint32_t numMismatches = 0;
+    if (file)
+    {
+        // Every keyframe goes through the background reader once, the window only decides the order in the renderer
+        MorphTargetKeyframeReader reader(file);
+        for (uint32_t keyframeIndex = 0; keyframeIndex < file->getKeyframeCount(); ++keyframeIndex)
+        {
+            MorphTargetKeyframeWindow::Load load;
+            load.keyframe = keyframeIndex;
+            load.slot = 0;
+            reader.request(load);
+        }
+
+        std::vector<MorphTargetKeyframeReader::Completed> completed;
+        while (completed.size() < file->getKeyframeCount())
+        {
+            reader.collect(completed);
+            std::this_thread::yield();
+        }
+
+        const uint64_t keyframeByteSize = file->getKeyframeByteSize();
+        for (const auto& read : completed)
+        {
+            const uint8_t* const expected = (const uint8_t*)encodedKeyframes.data.data() + encodedKeyframes.keyframeRanges[read.load.keyframe].byteOffset;
+            if (read.data.size() != keyframeByteSize || memcmp(read.data.data(), expected, keyframeByteSize) != 0)
+            {
+                ++numMismatches;
+            }
+        }
+    }
+    const std::chrono::duration<double, std::milli> roundTripTime = std::chrono::high_resolution_clock::now() - startTime;
+
+    const bool loaded = (file != nullptr);
+    file = nullptr;
+    std::error_code error;
+    std::filesystem::remove(filePath, error);
+
+    Json::Value& roundTripJson = streamingJson["fileRoundTrip"];
+    roundTripJson["format"] = MorphTargetKeyframeEncoder::getFormatName(RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_HALF);
+    roundTripJson["loaded"] = loaded;
+    roundTripJson["mismatchedKeyframes"] = numMismatches;
+    roundTripJson["timeMs"] = roundTripTime.count();
+    return streamingJson;
+}
+
+static bool writeReport(const Json::Value& report, const std::filesystem::path& outputFileName)
+{
+    Json::StreamWriterBuilder writerBuilder;
+    writerBuilder["indentation"] = "    ";
+    const std::unique_ptr<Json::StreamWriter> writer(writerBuilder.newStreamWriter());
+    if (outputFileName.empty())
+    {
+        writer->write(report, &std::cout);
+        std::cout << std::endl;
+        return true;
+    }
+
+    std::ofstream outputFile(outputFileName);
+    if (!outputFile)
+    {
+        log::error("Couldn't write %s", outputFileName.generic_string().c_str());
+        return false;
+    }
+    writer->write(report, &outputFile);
+    outputFile << std::endl;
+    return true;
+}
+
+int main(int argc, const char* const* argv)
+{
+    if (argc < 2 || argv[1][0] == '-')
+    {
+        printUsage();
+        return 1;
+    }
+
+    const std::filesystem::path sceneFileName = argv[1];
+    std::filesystem::path outputFileName;
+    bool verbose = false;
+    bool estimateBvh = false;
+    bool analyzeKeyframes = false;
+    uint32_t keyframeStreamingSlots = 0;
+    CurveBvhSettings bvhSettings;
+    BlasBuildBudget blasBuildBudget;
+    MorphTargetPcaSettings pcaSettings;
+
+    // Every representation is built in turn, only the one being measured stays resident
+    CurveTessellationSettings settings;
+    settings.hairTessellationCacheBudgetMB = 1;
+
+    for (int n = 2; n < argc; n++)
+    {
+        const char* arg = argv[n];
+        const bool hasValue = (n + 1 < argc);
+
+        if (!strcmp(arg, "-verbose"))
+        {
+            verbose = true;
+        }
+        else if (!strcmp(arg, "-bvh"))
+        {
+            estimateBvh = true;
+        }
+        else if (!strcmp(arg, "-keyframes"))
+        {
+            analyzeKeyframes = true;
+        }
+        else if (!hasValue)
+        {
+            printUsage();
+            return 1;
+        }
+        else if (!strcmp(arg, "-output"))
+        {
+            outputFileName = argv[++n];
+        }
+        else if (!strcmp(arg, "-hairRadiusScale"))
+        {
+            settings.hairRadiusScale = (float)atof(argv[++n]);
+        }
+        else if (!strcmp(arg, "-hairResegmentationError"))
+        {
+            settings.hairResegmentationError = (float)atof(argv[++n]);
+        }
+        else if (!strcmp(arg, "-hairStrandReorder"))
+        {
+            settings.enableHairStrandReorder = (bool)atoi(argv[++n]);
+        }
+        else if (!strcmp(arg, "-hairPolytubeOrder"))
+        {
+            settings.hairPolyTubeOrder = atoi(argv[++n]);
+        }
+        else if (!strcmp(arg, "-hairTessellationThreads"))
+        {
+            settings.hairTessellationThreadCount = atoi(argv[++n]);
+        }
+        else if (!strcmp(arg, "-hairSimdTessellation"))
+        {
+            settings.enableSimdHairTessellation = (bool)atoi(argv[++n]);
+        }
+        else if (!strcmp(arg, "-hairLssSuccessiveImplicit"))
+        {
+            settings.enableLssSuccessiveImplicit = (bool)atoi(argv[++n]);
+        }
+        else if (!strcmp(arg, "-hairLodLevels"))
+        {
+            settings.hairLodLevels = atoi(argv[++n]);
+        }
+        else if (!strcmp(arg, "-bvhBins"))
+        {
+            bvhSettings.numBins = atoi(argv[++n]);
+        }
+        else if (!strcmp(arg, "-bvhMaxLeafPrimitives"))
+        {
+            bvhSettings.maxLeafPrimitives = atoi(argv[++n]);
+        }
+        else if (!strcmp(arg, "-blasBuildEstimatedScratchBudget"))
+        {
+            blasBuildBudget.maxScratchBytes = (uint64_t)std::max(atoi(argv[++n]), 0) * 1024 * 1024;
+        }
+        else if (!strcmp(arg, "-blasBuildPrimitiveBudget"))
+        {
+            blasBuildBudget.maxPrimitives = (uint32_t)std::max(atoi(argv[++n]), 0);
+        }
+        else if (!strcmp(arg, "-keyframePcaError"))
+        {
+            pcaSettings.maxRelativeError = (float)atof(argv[++n]);
+        }
+        else if (!strcmp(arg, "-keyframeStreaming"))
+        {
+            keyframeStreamingSlots = (uint32_t)std::max(atoi(argv[++n]), 0);
+        }
+        else
+        {
+            printUsage();
+            return 1;
+        }
+    }
+
+    // Keeps stdout clean for the report
+    log::SetMinSeverity(verbose ? log::Severity::Info : log::Severity::Warning);
+
+    auto fs = std::make_shared<vfs::NativeFileSystem>();
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    const auto sceneGraph = loadSceneGraph(fs, sceneFileName);
+    if (!sceneGraph)
+    {
+        return 1;
+    }
+    const std::chrono::duration<double, std::milli> loadTime = std::chrono::high_resolution_clock::now() - startTime;
+
+    const auto& meshInstances = sceneGraph->GetMeshInstances();
+
+    startTime = std::chrono::high_resolution_clock::now();
+    CurveTessellation curveTessellation(meshInstances, settings);
+    const std::chrono::duration<double, std::milli> extractionTime = std::chrono::high_resolution_clock::now() - startTime;
+
+    // No camera, auto order falls back to the default order
+    curveTessellation.selectPolyTubeOrders(meshInstances, CurveTessellation::loadScenePolyTubeOrders(*fs, sceneFileName), float3(0.0f), 0.0f);
+
+    Json::Value report;
+    report["scene"] = sceneFileName.generic_string();
+    report["loadTimeMs"] = loadTime.count();
+    report["extractionTimeMs"] = extractionTime.count();
+
+    Json::Value& settingsJson = report["settings"];
+    settingsJson["radiusScale"] = settings.hairRadiusScale;
+    settingsJson["resegmentationError"] = settings.hairResegmentationError;
+    settingsJson["strandReorder"] = settings.enableHairStrandReorder;
+    settingsJson["polytubeOrder"] = settings.hairPolyTubeOrder;
+    settingsJson["tessellationThreads"] = settings.hairTessellationThreadCount;
+    settingsJson["simdTessellation"] = settings.enableSimdHairTessellation;
+    settingsJson["lssSuccessiveImplicit"] = settings.enableLssSuccessiveImplicit;
+    settingsJson["lodLevels"] = settings.hairLodLevels;
+    if (analyzeKeyframes)
+    {
+        settingsJson["keyframePcaError"] = pcaSettings.maxRelativeError;
+    }
+    if (keyframeStreamingSlots > 0)
+    {
+        settingsJson["keyframeStreamingSlots"] = keyframeStreamingSlots;
+    }
+    if (estimateBvh)
+    {
+        settingsJson["bvhBins"] = bvhSettings.numBins;
+        settingsJson["bvhMaxLeafPrimitives"] = bvhSettings.maxLeafPrimitives;
+    }
+    const bool scheduleBlasBuilds = (blasBuildBudget.maxScratchBytes > 0 || blasBuildBudget.maxPrimitives > 0);
+    if (scheduleBlasBuilds)
+    {
+        settingsJson["blasBuildEstimatedScratchBudgetBytes"] = Json::UInt64(blasBuildBudget.maxScratchBytes);
+        settingsJson["blasBuildPrimitiveBudget"] = blasBuildBudget.maxPrimitives;
+    }
+
+    Json::Value meshesJson(Json::arrayValue);
+    std::vector<uint32_t> curveMeshIndices;
+    for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
+    {
+        const auto& mesh = meshInstances[meshIndex]->GetMesh();
+        if (!mesh->IsCurve())
+        {
+            continue;
+        }
+
+        Json::Value meshJson;
+        meshJson["name"] = mesh->name;
+        meshJson["geometries"] = Json::UInt64(mesh->geometries.size());
+        meshJson["lineSegments"] = Json::UInt64(curveTessellation.GetCurvesLineSegments(mesh->name).size());
+        meshJson["polytubeOrder"] = curveTessellation.GetCurvePolyTubeOrder(mesh->name);
+        meshJson["morphTargetAnimation"] = mesh->isMorphTargetAnimationMesh;
+        if (analyzeKeyframes && mesh->isMorphTargetAnimationMesh && !mesh->buffers->morphTargetData.empty())
+        {
+            meshJson["keyframes"] = getKeyframeStatsJson(*mesh->buffers, pcaSettings);
+            meshJson["keyframes"]["refitGrowth"] = getKeyframeRefitGrowthJson(curveTessellation.GetCurvesLineSegments(mesh->name), *mesh->buffers);
+        }
+        if (keyframeStreamingSlots > 0 && mesh->isMorphTargetAnimationMesh && mesh->buffers->morphTargetBufferRange.size() >= 2)
+        {
+            meshJson["keyframeStreaming"] = getKeyframeStreamingJson(*mesh->buffers, meshIndex, keyframeStreamingSlots);
+        }
+        meshesJson.append(meshJson);
+
+        curveMeshIndices.push_back(meshIndex);
+    }
+
+    Json::Value& tessellationJson = report["tessellation"];
+    for (uint32_t type = 0; type < (uint32_t)TessellationType::Count; ++type)
+    {
+        const TessellationType tessellationType = (TessellationType)type;
+        const char* const typeName = getTessellationTypeName(tessellationType);
+
+        startTime = std::chrono::high_resolution_clock::now();
+        curveTessellation.requestTessellation(tessellationType, meshInstances);
+        const std::chrono::duration<double, std::milli> tessellationTime = std::chrono::high_resolution_clock::now() - startTime;
+
+        CurveTessellation::CurveMeshStats totalStats;
+        CurveBvhStats totalBvhStats;
+        std::vector<BlasBuildRequest> blasBuildRequests;
+        for (uint32_t curveIndex = 0; curveIndex < curveMeshIndices.size(); ++curveIndex)
+        {
+            CurveTessellation::CurveMeshStats stats;
+            if (!curveTessellation.getCurveMeshStats(tessellationType, meshInstances, curveMeshIndices[curveIndex], stats))
+            {
+                continue;
+            }
+            Json::Value& meshTypeJson = meshesJson[curveIndex]["tessellation"][typeName];
+            meshTypeJson = getCurveMeshStatsJson(stats);
+
+            CurveBvhStats bvhStats;
+            if (estimateBvh && curveTessellation.estimateCurveMeshBvh(tessellationType, meshInstances, curveMeshIndices[curveIndex], bvhStats, bvhSettings))
+            {
+                meshTypeJson["bvh"] = getCurveBvhStatsJson(bvhStats);
+
+                totalBvhStats.numNodes += bvhStats.numNodes;
+                totalBvhStats.estimatedBytes += bvhStats.estimatedBytes;
+                totalBvhStats.buildTimeMs += bvhStats.buildTimeMs;
+            }
+
+            BlasBuildRequest blasBuildRequest;
+            blasBuildRequest.key = curveIndex;
+            blasBuildRequest.primitiveCount = stats.numPrimitives;
+            blasBuildRequest.scratchBytes = BlasBuildScheduler::estimateScratchBytes(stats.numPrimitives);
+            blasBuildRequests.push_back(blasBuildRequest);
+
+            totalStats.numLineSegments += stats.numLineSegments;
+            totalStats.numVertices += stats.numVertices;
+            totalStats.numIndices += stats.numIndices;
+            totalStats.numPrimitives += stats.numPrimitives;
+            totalStats.indexBytes += stats.indexBytes;
+            totalStats.positionBytes += stats.positionBytes;
+            totalStats.normalBytes += stats.normalBytes;
+            totalStats.tangentBytes += stats.tangentBytes;
+            totalStats.texCoordBytes += stats.texCoordBytes;
+            totalStats.radiusBytes += stats.radiusBytes;
+        }
+
+        Json::Value typeJson = getCurveMeshStatsJson(totalStats);
+        typeJson["lineSegments"] = totalStats.numLineSegments;
+        typeJson["wallTimeMs"] = tessellationTime.count();
+        typeJson["cacheBytes"] = Json::UInt64(curveTessellation.getTessellationCacheBytes(tessellationType));
+        if (estimateBvh)
+        {
+            // SAH costs and overlaps are relative to each mesh's root bounds and don't add up across meshes
+            Json::Value& bvhJson = typeJson["bvh"];
+            bvhJson["nodes"] = totalBvhStats.numNodes;
+            bvhJson["estimatedBytes"] = Json::UInt64(totalBvhStats.estimatedBytes);
+            bvhJson["buildTimeMs"] = totalBvhStats.buildTimeMs;
+        }
+        if (scheduleBlasBuilds)
+        {
+            // A tessellation switch requests every hair BLAS in the same frame
+            const std::vector<uint32_t> arrivalFrames(blasBuildRequests.size(), 0);
+            typeJson["blasBuildSchedule"] = getBlasBuildScheduleJson(BlasBuildScheduling::simulate(blasBuildRequests, arrivalFrames, blasBuildBudget));
+        }
+        tessellationJson[typeName] = typeJson;
+    }
+    report["meshes"] = meshesJson;
+
+    return writeReport(report, outputFileName) ? 0 : 1;
+}
@@ -261,6 +261,12 @@ GeometrySample getGeometryFromHit(
     }
     else
     {
+        // Successive implicit LSS geometries store the first vertex of every segment in the index buffer,
+        // list geometries have no index buffer and store 2 vertices per segment
+        const uint lssFirstVertex = (gs.geometry.numIndices > 0) ?
+            indexBuffer.Load(gs.geometry.indexOffset + primitiveIndex * 4) : primitiveIndex * 2;
+        const uint2 indices = uint2(lssFirstVertex, lssFirstVertex + 1);
+
 #if API_DX12 == 1
         const float3 p0 = lssObjectPositionAndRadius0.xyz;
         const float3 p1 = lssObjectPositionAndRadius1.xyz;
@@ -268,7 +274,6 @@ GeometrySample getGeometryFromHit(
         const float r0 = lssObjectPositionAndRadius0.w;
         const float r1 = lssObjectPositionAndRadius1.w;
 #else
-        const uint2 indices = uint2(primitiveIndex * 2, primitiveIndex * 2 + 1);
         const float3 p0 = asfloat(vertexBuffer.Load3(gs.geometry.positionOffset + indices.x * c_SizeOfPosition));
         const float3 p1 = asfloat(vertexBuffer.Load3(gs.geometry.positionOffset + indices.y * c_SizeOfPosition));
 
@@ -296,8 +301,8 @@ GeometrySample getGeometryFromHit(
         if (isMorphTarget)
         {
             ByteAddressBuffer prevVertexBuffer = t_BindlessBuffers[NonUniformResourceIndex(gs.geometry.vertexBufferIndex + ((g_Global.frameIndex + 1) % 2))];
-            const float3 p0Prev = asfloat(prevVertexBuffer.Load3(gs.geometry.positionOffset + (2 * primitiveIndex) * c_SizeOfPosition));
-            const float3 p1Prev = asfloat(prevVertexBuffer.Load3(gs.geometry.positionOffset + (2 * primitiveIndex + 1) * c_SizeOfPosition));
+            const float3 p0Prev = asfloat(prevVertexBuffer.Load3(gs.geometry.positionOffset + indices.x * c_SizeOfPosition));
+            const float3 p1Prev = asfloat(prevVertexBuffer.Load3(gs.geometry.positionOffset + indices.y * c_SizeOfPosition));
             const float3 prevPos = lerp(p0Prev, p1Prev, u);
 
             gs.curveObjectSpacePosition = p;
@@ -9,16 +9,65 @@
  */
 
 #include <shared/shared.h>
+#include <shared/lineSegmentEncoding.h>
+#include <shared/keyframeEncoding.h>
 
 #include <rtxcr/utils/RtxcrMath.hlsli>
 
+#if RTXCR_MORPH_TARGET_BATCHED
+#include <donut/shaders/binding_helpers.hlsli>
+#endif
+
 #pragma pack_matrix(row_major)
 
+// One strand point of a keyframe in the format of RTXCR_MORPH_TARGET_KEYFRAME_FORMAT
+#if RTXCR_MORPH_TARGET_KEYFRAME_FORMAT == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_HALF
+#define KEYFRAME_TYPE uint2
+#elif RTXCR_MORPH_TARGET_KEYFRAME_FORMAT == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_UNORM10
+#define KEYFRAME_TYPE uint
+#else
+#define KEYFRAME_TYPE float4
+#endif
+
+// Per keyframe parameters of the compressed formats: the quantization of the keyframe, or its PCA coefficients
+#if RTXCR_MORPH_TARGET_KEYFRAME_FORMAT == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_PCA
+#define KEYFRAME_PARAMETER_TYPE float
+#else
+#define KEYFRAME_PARAMETER_TYPE KeyframeQuantization
+#endif
+
+#if RTXCR_MORPH_TARGET_BATCHED
+
+// All animated meshes in one dispatch: the mesh table maps the dispatch threads to the meshes,
+// the resources of every mesh are reached through the batch descriptor table of MorphTargetAnimationPass.
+ConstantBuffer<MorphTargetBatchConstants>                 g_BatchConstants                 : register(b0);
+StructuredBuffer<MorphTargetBatchMesh>                    t_BatchMeshes                    : register(t0);
+
+VK_BINDING(0, 1) StructuredBuffer<KEYFRAME_TYPE>          t_BatchKeyframeData[]            : register(t0, space1);
+VK_BINDING(1, 1) StructuredBuffer<LineSegment>            t_BatchLineSegments[]            : register(t0, space2);
+VK_BINDING(2, 1) StructuredBuffer<CompactLineSegment>     t_BatchCompactLineSegments[]     : register(t0, space3);
+VK_BINDING(3, 1) StructuredBuffer<LineSegmentBounds>      t_BatchLineSegmentBounds[]       : register(t0, space4);
+VK_BINDING(4, 1) RWByteAddressBuffer                      u_BatchVertexBuffers[]           : register(u0, space5);
+VK_BINDING(5, 1) StructuredBuffer<KEYFRAME_PARAMETER_TYPE> t_BatchKeyframeParameters[]     : register(t0, space6);
+
+// Mesh of the current thread, set once in main_cs
+static MorphTargetBatchMesh s_BatchMesh;
+
+#else
+
 ConstantBuffer<MorphTargetConstants> g_Constants                   : register(b0);
 
-StructuredBuffer<float4>             t_MorphTargetKeyframeData     : register(t0);
-StructuredBuffer<float4>             t_MorphTargetNextKeyframeData : register(t1);
+StructuredBuffer<KEYFRAME_TYPE>      t_MorphTargetKeyframeData     : register(t0);
+StructuredBuffer<KEYFRAME_TYPE>      t_MorphTargetNextKeyframeData : register(t1);
+#if RTXCR_MORPH_TARGET_KEYFRAME_FORMAT != RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_FULL
+StructuredBuffer<KEYFRAME_PARAMETER_TYPE> t_KeyframeParameters    : register(t5);
+#endif
+#if RTXCR_COMPACT_LINE_SEGMENTS
+StructuredBuffer<CompactLineSegment> t_LineSegments                : register(t2);
+StructuredBuffer<LineSegmentBounds>  t_LineSegmentBounds           : register(t4);
+#else
 StructuredBuffer<LineSegment>        t_LineSegments                : register(t2);
+#endif
 
 #if RTXCR_CURVE_TESSELLATION_TYPE != RTXCR_CURVE_TESSELLATION_TYPE_LSS
 Buffer<uint>                         t_MeshIndexBuffer             : register(t3);
@@ -28,12 +77,14 @@ RWByteAddressBuffer                  u_MorphTargetPosition         : register(u0
 RWStructuredBuffer<uint>             u_MorphTargetNormal           : register(u1);
 RWStructuredBuffer<uint>             u_MorphTargetTangent          : register(u2);
 
+#endif // RTXCR_MORPH_TARGET_BATCHED
+
 #define VERTEX_PER_FACE 6
 
 #define FLOAT3_SIZE_IN_BYTE 12
 
-// Polytube
-#define POLY_TUBE_ORDER 3
+// Polytube, every mesh has its own order
+#define POLY_TUBE_ORDER getPolyTubeOrder()
 #define POLY_TUBE_TOTAL_VERTEX_PER_STRAND_SEGMENT (POLY_TUBE_ORDER * VERTEX_PER_FACE)
 
 // DOTS
@@ -48,6 +99,205 @@ static uint polyTubeVMapping[VERTEX_PER_FACE] = { 0, 1, 0, 0, 1, 1 };
 static float dotsNormalSignMapping[VERTEX_PER_FACE] = { 1.0f, -1.0f, 1.0f, 1.0f, -1.0f, -1.0f };
 #endif
 
+// Per mesh state and resources, from the mesh table in the batched variant
+
+int getVertexCount()
+{
+#if RTXCR_MORPH_TARGET_BATCHED
+    return s_BatchMesh.vertexCount;
+#else
+    return g_Constants.vertexCount;
+#endif
+}
+
+uint getPolyTubeOrder()
+{
+#if RTXCR_MORPH_TARGET_BATCHED
+    return s_BatchMesh.polyTubeOrder;
+#else
+    return g_Constants.polyTubeOrder;
+#endif
+}
+
+bool isLssSuccessiveImplicit()
+{
+#if RTXCR_MORPH_TARGET_BATCHED
+    return s_BatchMesh.lssSuccessiveImplicit != 0;
+#else
+    return g_Constants.lssSuccessiveImplicit != 0;
+#endif
+}
+
+#if RTXCR_MORPH_TARGET_KEYFRAME_FORMAT != RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_FULL
+KEYFRAME_PARAMETER_TYPE loadKeyframeParameter(const uint parameterIndex)
+{
+#if RTXCR_MORPH_TARGET_BATCHED
+    return t_BatchKeyframeParameters[NonUniformResourceIndex(s_BatchMesh.keyframeParameterDescriptorIndex)][parameterIndex];
+#else
+    return t_KeyframeParameters[parameterIndex];
+#endif
+}
+#endif
+
+#if RTXCR_MORPH_TARGET_KEYFRAME_FORMAT == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_HALF || RTXCR_MORPH_TARGET_KEYFRAME_FORMAT == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_UNORM10
+float3 decodeKeyframe(const KEYFRAME_TYPE keyframe, const uint keyframeIndex)
+{
+    const KeyframeQuantization quantization = loadKeyframeParameter(keyframeIndex);
+
+#if RTXCR_MORPH_TARGET_KEYFRAME_FORMAT == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_HALF
+    return decodeKeyframeHalf(keyframe, quantization);
+#else
+    return decodeKeyframeUnorm10(keyframe, quantization);
+#endif
+}
+#endif
+
+// Offset of strand point keyframeVertexIndex, interpolated between keyframe N and N + 1
+float3 loadMorphTargetOffset(const uint keyframeVertexIndex)
+{
+#if RTXCR_MORPH_TARGET_KEYFRAME_FORMAT == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_PCA
+    // The keyframe buffer is the basis of MorphTargetPca, the basis vectors of a strand point are contiguous.
+    // Interpolating the coefficients is the same as interpolating the reconstructed keyframes.
+#if RTXCR_MORPH_TARGET_BATCHED
+    const StructuredBuffer<KEYFRAME_TYPE> basis = t_BatchKeyframeData[NonUniformResourceIndex(s_BatchMesh.keyframeDescriptorIndex)];
+    const uint componentCount = s_BatchMesh.keyframeComponentCount;
+    const uint firstBasisVector = s_BatchMesh.keyframeOffset + keyframeVertexIndex * componentCount;
+    const uint keyframeIndex = s_BatchMesh.keyframeIndex;
+    const uint nextKeyframeIndex = s_BatchMesh.nextKeyframeIndex;
+    const float lerpWeight = s_BatchMesh.lerpWeight;
+#else
+    const uint componentCount = g_Constants.keyframeComponentCount;
+    const uint firstBasisVector = keyframeVertexIndex * componentCount;
+    const uint keyframeIndex = g_Constants.keyframeIndex;
+    const uint nextKeyframeIndex = g_Constants.nextKeyframeIndex;
+    const float lerpWeight = g_Constants.lerpWeight;
+#endif
+
+    float3 offset = float3(0.0f, 0.0f, 0.0f);
+    for (uint component = 0; component < componentCount; ++component)
+    {
+        const float coefficient = lerp(loadKeyframeParameter(keyframeIndex * componentCount + component),
+                                       loadKeyframeParameter(nextKeyframeIndex * componentCount + component), lerpWeight);
+#if RTXCR_MORPH_TARGET_BATCHED
+        offset += coefficient * basis[firstBasisVector + component].xyz;
+#else
+        offset += coefficient * t_MorphTargetKeyframeData[firstBasisVector + component].xyz;
+#endif
+    }
+    return offset;
+#else
+#if RTXCR_MORPH_TARGET_BATCHED
+    const StructuredBuffer<KEYFRAME_TYPE> keyframeData = t_BatchKeyframeData[NonUniformResourceIndex(s_BatchMesh.keyframeDescriptorIndex)];
+    const KEYFRAME_TYPE keyframe = keyframeData[s_BatchMesh.keyframeOffset + keyframeVertexIndex];
+    const KEYFRAME_TYPE nextKeyframe = keyframeData[s_BatchMesh.nextKeyframeOffset + keyframeVertexIndex];
+    const uint keyframeIndex = s_BatchMesh.keyframeIndex;
+    const uint nextKeyframeIndex = s_BatchMesh.nextKeyframeIndex;
+    const float lerpWeight = s_BatchMesh.lerpWeight;
+#else
+    const KEYFRAME_TYPE keyframe = t_MorphTargetKeyframeData[keyframeVertexIndex];
+    const KEYFRAME_TYPE nextKeyframe = t_MorphTargetNextKeyframeData[keyframeVertexIndex];
+    const uint keyframeIndex = g_Constants.keyframeIndex;
+    const uint nextKeyframeIndex = g_Constants.nextKeyframeIndex;
+    const float lerpWeight = g_Constants.lerpWeight;
+#endif
+
+#if RTXCR_MORPH_TARGET_KEYFRAME_FORMAT != RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_FULL
+    return lerp(decodeKeyframe(keyframe, keyframeIndex), decodeKeyframe(nextKeyframe, nextKeyframeIndex), lerpWeight);
+#else
+    return lerp(keyframe, nextKeyframe, lerpWeight).xyz;
+#endif
+#endif
+}
+
+void storeVertexPosition(const uint index, const float3 position)
+{
+#if RTXCR_MORPH_TARGET_BATCHED
+    u_BatchVertexBuffers[NonUniformResourceIndex(s_BatchMesh.vertexBufferDescriptorIndex)].Store3(
+        s_BatchMesh.positionByteOffset + index * FLOAT3_SIZE_IN_BYTE, asuint(position));
+#else
+    u_MorphTargetPosition.Store3(index * FLOAT3_SIZE_IN_BYTE, asuint(position));
+#endif
+}
+
+void storeVertexNormalTangent(const uint index, const uint normal, const uint tangent)
+{
+#if RTXCR_MORPH_TARGET_BATCHED
+    const RWByteAddressBuffer vertexBuffer = u_BatchVertexBuffers[NonUniformResourceIndex(s_BatchMesh.vertexBufferDescriptorIndex)];
+    vertexBuffer.Store(s_BatchMesh.normalByteOffset + index * 4, normal);
+    vertexBuffer.Store(s_BatchMesh.tangentByteOffset + index * 4, tangent);
+#else
+    u_MorphTargetNormal[index] = normal;
+    u_MorphTargetTangent[index] = tangent;
+#endif
+}
+
+#if RTXCR_MORPH_TARGET_BATCHED
+
+LineSegment loadLineSegment(const uint lineSegmentIndex)
+{
+    if (s_BatchMesh.compactLineSegments != 0)
+    {
+        const CompactLineSegment compactLineSegment =
+            t_BatchCompactLineSegments[NonUniformResourceIndex(s_BatchMesh.lineSegmentsDescriptorIndex)][lineSegmentIndex];
+        return decodeLineSegment(compactLineSegment,
+            t_BatchLineSegmentBounds[NonUniformResourceIndex(s_BatchMesh.lineSegmentBoundsDescriptorIndex)][getCompactLineSegmentBoundsIndex(compactLineSegment)]);
+    }
+    return t_BatchLineSegments[NonUniformResourceIndex(s_BatchMesh.lineSegmentsDescriptorIndex)][lineSegmentIndex];
+}
+
+int loadLineSegmentGeometryIndex(const uint lineSegmentIndex)
+{
+    if (s_BatchMesh.compactLineSegments != 0)
+    {
+        return (int)getCompactLineSegmentStrandIndex(t_BatchCompactLineSegments[NonUniformResourceIndex(s_BatchMesh.lineSegmentsDescriptorIndex)][lineSegmentIndex]);
+    }
+    return t_BatchLineSegments[NonUniformResourceIndex(s_BatchMesh.lineSegmentsDescriptorIndex)][lineSegmentIndex].geometryIndex;
+}
+
+// Mesh table entry of a dispatch thread: the last entry with firstThread <= threadIndex, see MorphTargetBatch::findMesh
+uint findBatchMesh(const uint threadIndex)
+{
+    uint first = 0;
+    uint count = g_BatchConstants.numMeshes;
+    while (count > 0)
+    {
+        const uint step = count / 2;
+        if (t_BatchMeshes[first + step].firstThread <= threadIndex)
+        {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+    return first - 1;
+}
+
+#else
+
+LineSegment loadLineSegment(const uint lineSegmentIndex)
+{
+#if RTXCR_COMPACT_LINE_SEGMENTS
+    const CompactLineSegment compactLineSegment = t_LineSegments[lineSegmentIndex];
+    return decodeLineSegment(compactLineSegment, t_LineSegmentBounds[getCompactLineSegmentBoundsIndex(compactLineSegment)]);
+#else
+    return t_LineSegments[lineSegmentIndex];
+#endif
+}
+
+int loadLineSegmentGeometryIndex(const uint lineSegmentIndex)
+{
+#if RTXCR_COMPACT_LINE_SEGMENTS
+    return (int)getCompactLineSegmentStrandIndex(t_LineSegments[lineSegmentIndex]);
+#else
+    return t_LineSegments[lineSegmentIndex].geometryIndex;
+#endif
+}
+
+#endif // RTXCR_MORPH_TARGET_BATCHED
+
 uint vectorToSnorm8(in const float3 v)
 {
     float scale = 127.0f / sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
@@ -95,145 +345,264 @@ float3 getUnitCircleCoords(in const float3 xAxis, in const float3 yAxis, in cons
     return cos(adjustedAngleRadians) * xAxis + sin(adjustedAngleRadians) * yAxis;
 }
 
-#if RTXCR_CURVE_TESSELLATION_TYPE == RTXCR_CURVE_TESSELLATION_TYPE_POLYTUBE
-
-// SIMD version of convertToTrianglePolyTubes in CurveTessellation.cpp
+#if RTXCR_CURVE_TESSELLATION_TYPE != RTXCR_CURVE_TESSELLATION_TYPE_LSS
 
-void convertToTrianglePolyTubes(const uint index)
+// A line segment moved to the interpolated keyframe pose, with its frame. Shared by all vertices of the segment.
+struct MorphedLineSegment
+{
+    float3 position[2];
+    float radius[2];
+    float3 forward;
+    float3 s;
+    float3 t;
+};
+
+MorphedLineSegment morphLineSegment(const uint lineSegmentIndex)
 {
-    uint lineSegmentIndex = index / POLY_TUBE_TOTAL_VERTEX_PER_STRAND_SEGMENT;
-    const LineSegment lineSegment = t_LineSegments[lineSegmentIndex];
-    lineSegmentIndex += lineSegment.geometryIndex;
+    const LineSegment lineSegment = loadLineSegment(lineSegmentIndex);
+    const uint keyframeIndex = lineSegmentIndex + lineSegment.geometryIndex;
 
+    // Get the line vertex position of 2 keyframes and do interpolation:
+    //   loadMorphTargetOffset reads the morph target line vertex buffers of keyframe N and N + 1,
+    //   With keyframeIndex and keyframeIndex + 1 we get start and end vertex of the line for both these 2 keyframes,
+    //   then we just simply do lerp to get the interpolated line.
     const float3 morphTargetLerpData[2] =
     {
-        lerp(t_MorphTargetKeyframeData[lineSegmentIndex], t_MorphTargetNextKeyframeData[lineSegmentIndex], g_Constants.lerpWeight).xyz,
-        lerp(t_MorphTargetKeyframeData[lineSegmentIndex + 1], t_MorphTargetNextKeyframeData[lineSegmentIndex + 1], g_Constants.lerpWeight).xyz
+        loadMorphTargetOffset(keyframeIndex),
+        loadMorphTargetOffset(keyframeIndex + 1)
     };
 
-    const float3 morphTargetPosition[2] =
-    {
-        lineSegment.point0 + morphTargetLerpData[0],
-        lineSegment.point1 + morphTargetLerpData[1]
-    };
+    MorphedLineSegment morphedLineSegment;
+    morphedLineSegment.position[0] = lineSegment.point0 + morphTargetLerpData[0];
+    morphedLineSegment.position[1] = lineSegment.point1 + morphTargetLerpData[1];
+    morphedLineSegment.radius[0] = lineSegment.radius0;
+    morphedLineSegment.radius[1] = lineSegment.radius1;
 
     // Build the initial frame
-    float3 fwd, s, t;
-    fwd = normalize(morphTargetPosition[1] - morphTargetPosition[0]);
-    buildFrame(fwd, s, t);
-    const uint tangent = vectorToSnorm8(fwd);
+    morphedLineSegment.forward = normalize(morphedLineSegment.position[1] - morphedLineSegment.position[0]);
+    buildFrame(morphedLineSegment.forward, morphedLineSegment.s, morphedLineSegment.t);
 
-    const uint face = (index % POLY_TUBE_TOTAL_VERTEX_PER_STRAND_SEGMENT) / VERTEX_PER_FACE;
-    const uint mappingIndex = (index % POLY_TUBE_TOTAL_VERTEX_PER_STRAND_SEGMENT) % VERTEX_PER_FACE;
+    return morphedLineSegment;
+}
 
-    const uint vIndex = polyTubeVMapping[mappingIndex];
-    const float angleRadians = (RTXCR_TWO_PI * (float)(face + vIndex) / POLY_TUBE_ORDER);
-    const float3 v = getUnitCircleCoords(s, t, angleRadians);
+#endif
 
-    const float r[2] = { lineSegment.radius0, lineSegment.radius1 };
+#if RTXCR_CURVE_TESSELLATION_TYPE == RTXCR_CURVE_TESSELLATION_TYPE_POLYTUBE
 
+// SIMD version of convertToTrianglePolyTubes in CurveTessellation.cpp
+
+// Direction of ring vertex ringIndex of the cross section, ring vertex POLY_TUBE_ORDER wraps around to ring vertex 0
+float3 getPolyTubeRingDirection(in const MorphedLineSegment morphedLineSegment, const uint ringIndex)
+{
+    const float angleRadians = (RTXCR_TWO_PI * (float)ringIndex / POLY_TUBE_ORDER);
+    return getUnitCircleCoords(morphedLineSegment.s, morphedLineSegment.t, angleRadians);
+}
+
+void storePolyTubeVertex(
+    const uint index,
+    in const MorphedLineSegment morphedLineSegment,
+    const uint mappingIndex,
+    in const float3 v,
+    const uint normal,
+    const uint tangent)
+{
     const uint morphTargetPositionIndex = morphTargetPositionIndexMapping[mappingIndex];
 
     // Necessary to make up for lost volume of PolyTube approximation of a circular tube
 
     // Position
     const float polyTubesVolumeCompensationScale = 1.0f / (sin(RTXCR_PI / POLY_TUBE_ORDER) / (RTXCR_PI / POLY_TUBE_ORDER));
-    const float3 vertexPosition = morphTargetPosition[morphTargetPositionIndex] + r[morphTargetPositionIndex] * v * polyTubesVolumeCompensationScale;
-    u_MorphTargetPosition.Store3(index * FLOAT3_SIZE_IN_BYTE, asuint(vertexPosition));
+    const float3 vertexPosition = morphedLineSegment.position[morphTargetPositionIndex] +
+                                  morphedLineSegment.radius[morphTargetPositionIndex] * v * polyTubesVolumeCompensationScale;
+    storeVertexPosition(index, vertexPosition);
 
-    // Normal
-    u_MorphTargetNormal[index] = vectorToSnorm8(v);
-
-    // Tangent
-    u_MorphTargetTangent[index] = tangent;
+    // Normal and tangent
+    storeVertexNormalTangent(index, normal, tangent);
 }
 
-#elif RTXCR_CURVE_TESSELLATION_TYPE == RTXCR_CURVE_TESSELLATION_TYPE_DOTS
-
-// SIMD version of convertToDisjointOrthogonalTriangleStrips in CurveTessellation.cpp
-void convertToDisjointOrthogonalTriangleStrips(const uint index)
+// One thread per output vertex
+void convertToTrianglePolyTubes(const uint index)
 {
-    uint lineSegmentIndex = index / DOTS_TOTAL_VERTEX_PER_STRAND_SEGMENT;
-    const LineSegment lineSegment = t_LineSegments[lineSegmentIndex];
-    lineSegmentIndex += lineSegment.geometryIndex;
+    const uint lineSegmentIndex = index / POLY_TUBE_TOTAL_VERTEX_PER_STRAND_SEGMENT;
+    const MorphedLineSegment morphedLineSegment = morphLineSegment(lineSegmentIndex);
 
-    // Get the line vertex position of 2 keyframes and do interpolation:
-    //   t_MorphTargetKeyframeData is the morph target line vertex buffer of keyframe N,
-    //   t_MorphTargetNextKeyframeData is the morph target line vertex buffer of keyframe N + 1
-    //   With lineSegmentIndex and lineSegmentIndex + 1 we get start and end vertex of the line for both these 2 keyframes,
-    //   then we just simply do lerp to get the interpolated line.
-    const float3 morphTargetLerpData[2] =
+    const uint face = (index % POLY_TUBE_TOTAL_VERTEX_PER_STRAND_SEGMENT) / VERTEX_PER_FACE;
+    const uint mappingIndex = (index % POLY_TUBE_TOTAL_VERTEX_PER_STRAND_SEGMENT) % VERTEX_PER_FACE;
+
+    const float3 v = getPolyTubeRingDirection(morphedLineSegment, face + polyTubeVMapping[mappingIndex]);
+    storePolyTubeVertex(index, morphedLineSegment, mappingIndex, v, vectorToSnorm8(v), vectorToSnorm8(morphedLineSegment.forward));
+}
+
+// One thread per line segment: the segment is interpolated and framed once, every ring direction is computed once for both segment ends
+void convertToTrianglePolyTubesPerSegment(const uint lineSegmentIndex)
+{
+    const MorphedLineSegment morphedLineSegment = morphLineSegment(lineSegmentIndex);
+    const uint tangent = vectorToSnorm8(morphedLineSegment.forward);
+
+    // Unrolled to the maximum order so the ring stays in registers
+    float3 ringDirection[RTXCR_CURVE_POLYTUBE_MAX_ORDER + 1];
+    uint ringNormal[RTXCR_CURVE_POLYTUBE_MAX_ORDER + 1];
+    [unroll]
+    for (uint ringIndex = 0; ringIndex <= RTXCR_CURVE_POLYTUBE_MAX_ORDER; ++ringIndex)
     {
-        lerp(t_MorphTargetKeyframeData[lineSegmentIndex], t_MorphTargetNextKeyframeData[lineSegmentIndex], g_Constants.lerpWeight).xyz,
-        lerp(t_MorphTargetKeyframeData[lineSegmentIndex + 1], t_MorphTargetNextKeyframeData[lineSegmentIndex + 1], g_Constants.lerpWeight).xyz
-    };
+        if (ringIndex <= POLY_TUBE_ORDER)
+        {
+            ringDirection[ringIndex] = getPolyTubeRingDirection(morphedLineSegment, ringIndex);
+            ringNormal[ringIndex] = vectorToSnorm8(ringDirection[ringIndex]);
+        }
+    }
 
-    const float3 morphTargetPosition[DOTS_FACE_ORDER] =
+    const uint firstVertexIndex = lineSegmentIndex * POLY_TUBE_TOTAL_VERTEX_PER_STRAND_SEGMENT;
+    [unroll]
+    for (uint face = 0; face < RTXCR_CURVE_POLYTUBE_MAX_ORDER; ++face)
     {
-        lineSegment.point0 + morphTargetLerpData[0],
-        lineSegment.point1 + morphTargetLerpData[1]
-    };
+        if (face < POLY_TUBE_ORDER)
+        {
+            [unroll]
+            for (uint mappingIndex = 0; mappingIndex < VERTEX_PER_FACE; ++mappingIndex)
+            {
+                const uint ringIndex = face + polyTubeVMapping[mappingIndex];
+                storePolyTubeVertex(firstVertexIndex + face * VERTEX_PER_FACE + mappingIndex,
+                    morphedLineSegment, mappingIndex, ringDirection[ringIndex], ringNormal[ringIndex], tangent);
+            }
+        }
+    }
+}
 
-    // Build the initial frame
-    float3 fwd, s, t;
-    fwd = normalize(morphTargetPosition[1] - morphTargetPosition[0]);
-    buildFrame(fwd, s, t);
+#elif RTXCR_CURVE_TESSELLATION_TYPE == RTXCR_CURVE_TESSELLATION_TYPE_DOTS
 
-    const float3 v[DOTS_FACE_ORDER] = { s, t };
+// SIMD version of convertToDisjointOrthogonalTriangleStrips in CurveTessellation.cpp
+
+void storeDisjointOrthogonalTriangleStripVertex(
+    const uint index,
+    in const MorphedLineSegment morphedLineSegment,
+    const uint face,
+    const uint mappingIndex,
+    const uint normal,
+    const uint tangent)
+{
+    const float3 v[DOTS_FACE_ORDER] = { morphedLineSegment.s, morphedLineSegment.t };
 
     const float weight[VERTEX_PER_FACE] = {
-        lineSegment.radius0, -lineSegment.radius1,  lineSegment.radius1,
-        lineSegment.radius0, -lineSegment.radius0, -lineSegment.radius1 };
-    const uint mappingIndex = (index % DOTS_TOTAL_VERTEX_PER_STRAND_SEGMENT) % VERTEX_PER_FACE;
+        morphedLineSegment.radius[0], -morphedLineSegment.radius[1],  morphedLineSegment.radius[1],
+        morphedLineSegment.radius[0], -morphedLineSegment.radius[0], -morphedLineSegment.radius[1] };
 
     const uint morphTargetPositionIndex = morphTargetPositionIndexMapping[mappingIndex];
 
-    const uint face = (index % DOTS_TOTAL_VERTEX_PER_STRAND_SEGMENT) / VERTEX_PER_FACE;
-
     // Necessary to make up for lost volume of PolyTube approximation of a circular tube
 
     // Position
     const float dotsVolumeCompensationScale = 1.0f / (sin(RTXCR_PI / 4.0f) / (RTXCR_PI / 4.0f));
-    const float3 vertexPosition = morphTargetPosition[morphTargetPositionIndex] + weight[mappingIndex] * v[face] * dotsVolumeCompensationScale;
-    u_MorphTargetPosition.Store3(index * FLOAT3_SIZE_IN_BYTE, asuint(vertexPosition));
+    const float3 vertexPosition = morphedLineSegment.position[morphTargetPositionIndex] + weight[mappingIndex] * v[face] * dotsVolumeCompensationScale;
+    storeVertexPosition(index, vertexPosition);
+
+    // Normal and tangent
+    storeVertexNormalTangent(index, normal, tangent);
+}
 
-    // Normal
+uint getDisjointOrthogonalTriangleStripNormal(in const MorphedLineSegment morphedLineSegment, const uint face, const uint mappingIndex)
+{
+    const float3 v = (face == 0) ? morphedLineSegment.s : morphedLineSegment.t;
     const float normalSign = dotsNormalSignMapping[mappingIndex];
-    const uint normalPacked = vectorToSnorm8(normalSign.xxx * v[face]);
-    u_MorphTargetNormal[index] = normalPacked;
+    return vectorToSnorm8(normalSign.xxx * v);
+}
 
-    // Tangent
-    const uint tangentPacked = vectorToSnorm8(fwd);
-    u_MorphTargetTangent[index] = tangentPacked;
+// One thread per output vertex
+void convertToDisjointOrthogonalTriangleStrips(const uint index)
+{
+    const uint lineSegmentIndex = index / DOTS_TOTAL_VERTEX_PER_STRAND_SEGMENT;
+    const MorphedLineSegment morphedLineSegment = morphLineSegment(lineSegmentIndex);
+
+    const uint mappingIndex = (index % DOTS_TOTAL_VERTEX_PER_STRAND_SEGMENT) % VERTEX_PER_FACE;
+    const uint face = (index % DOTS_TOTAL_VERTEX_PER_STRAND_SEGMENT) / VERTEX_PER_FACE;
+
+    storeDisjointOrthogonalTriangleStripVertex(index, morphedLineSegment, face, mappingIndex,
+        getDisjointOrthogonalTriangleStripNormal(morphedLineSegment, face, mappingIndex), vectorToSnorm8(morphedLineSegment.forward));
+}
+
+// One thread per line segment: the segment is interpolated and framed once for all 12 vertices of its 2 faces
+void convertToDisjointOrthogonalTriangleStripsPerSegment(const uint lineSegmentIndex)
+{
+    const MorphedLineSegment morphedLineSegment = morphLineSegment(lineSegmentIndex);
+    const uint tangent = vectorToSnorm8(morphedLineSegment.forward);
+
+    const uint firstVertexIndex = lineSegmentIndex * DOTS_TOTAL_VERTEX_PER_STRAND_SEGMENT;
+    [unroll]
+    for (uint face = 0; face < DOTS_FACE_ORDER; ++face)
+    {
+        [unroll]
+        for (uint mappingIndex = 0; mappingIndex < VERTEX_PER_FACE; ++mappingIndex)
+        {
+            storeDisjointOrthogonalTriangleStripVertex(firstVertexIndex + face * VERTEX_PER_FACE + mappingIndex, morphedLineSegment, face, mappingIndex,
+                getDisjointOrthogonalTriangleStripNormal(morphedLineSegment, face, mappingIndex), tangent);
+        }
+    }
 }
 
 #elif RTXCR_CURVE_TESSELLATION_TYPE == RTXCR_CURVE_TESSELLATION_TYPE_LSS
 
 void convertToLinearSweptSpheres(const uint globalIndex)
 {
-    // TODO: Provide Index buffer support for LSS
-    const uint index = globalIndex;
-    const uint nextIndex = globalIndex + 1;
+    // One thread per segment end point
+    const uint lineSegmentIndex = globalIndex / 2;
+    const uint endPoint = globalIndex % 2;
+    const LineSegment lineSegment = loadLineSegment(lineSegmentIndex);
 
-    uint lineSegmentIndex = globalIndex / 2;
-    const LineSegment lineSegment = t_LineSegments[lineSegmentIndex];
-    lineSegmentIndex += lineSegment.geometryIndex;
+    // Strands are stored contiguously in the keyframes, so the end point's source vertex is offset by the strand index
+    const uint morphTargetVertexIndex = lineSegmentIndex + lineSegment.geometryIndex + endPoint;
 
-    const uint morphTargetVertexIndex = (globalIndex % 2 == 0) ? lineSegmentIndex : lineSegmentIndex + 1;
+    uint index = globalIndex;
+    if (isLssSuccessiveImplicit())
+    {
+        // One vertex per strand point, laid out like the keyframes.
+        // Interior points are shared with the next segment of the strand, which writes them as its start point.
+        const bool isLastSegmentOfStrand = (lineSegmentIndex + 1 >= (uint)getVertexCount() / 2) ||
+                                           (loadLineSegmentGeometryIndex(lineSegmentIndex + 1) != lineSegment.geometryIndex);
+        if (endPoint == 1 && !isLastSegmentOfStrand)
+        {
+            return;
+        }
+        index = morphTargetVertexIndex;
+    }
 
-    const float3 morphTargetLerpData = lerp(t_MorphTargetKeyframeData[morphTargetVertexIndex], t_MorphTargetNextKeyframeData[morphTargetVertexIndex], g_Constants.lerpWeight).xyz;
-    const float3 vertexPosition = (globalIndex % 2 == 0 ? lineSegment.point0 : lineSegment.point1) + morphTargetLerpData;
+    const float3 morphTargetLerpData = loadMorphTargetOffset(morphTargetVertexIndex);
+    const float3 vertexPosition = (endPoint == 0 ? lineSegment.point0 : lineSegment.point1) + morphTargetLerpData;
 
     // Position
-    u_MorphTargetPosition.Store3(index * FLOAT3_SIZE_IN_BYTE, asuint(vertexPosition));
+    storeVertexPosition(index, vertexPosition);
 }
 
 #endif // RTXCR_CURVE_TESSELLATION_TYPE
 
-[numthreads(64, 1, 1)]
-void main_cs(in int globalIndex : SV_DispatchThreadID)
+[numthreads(RTXCR_MORPH_TARGET_THREAD_GROUP_SIZE, 1, 1)]
+void main_cs(in int dispatchThreadIndex : SV_DispatchThreadID)
 {
-    if (globalIndex >= g_Constants.vertexCount)
+#if RTXCR_MORPH_TARGET_BATCHED
+    if ((uint)dispatchThreadIndex >= g_BatchConstants.numThreads)
+    {
+        return;
+    }
+    s_BatchMesh = t_BatchMeshes[findBatchMesh(dispatchThreadIndex)];
+    // Index of the thread in the unbatched dispatch of its mesh
+    const int globalIndex = dispatchThreadIndex - (int)s_BatchMesh.firstThread;
+#else
+    const int globalIndex = dispatchThreadIndex;
+#endif
+
+#if RTXCR_MORPH_TARGET_PER_SEGMENT && RTXCR_CURVE_TESSELLATION_TYPE == RTXCR_CURVE_TESSELLATION_TYPE_POLYTUBE
+    if (globalIndex >= getVertexCount() / POLY_TUBE_TOTAL_VERTEX_PER_STRAND_SEGMENT)
+    {
+        return;
+    }
+    convertToTrianglePolyTubesPerSegment(globalIndex);
+#elif RTXCR_MORPH_TARGET_PER_SEGMENT && RTXCR_CURVE_TESSELLATION_TYPE == RTXCR_CURVE_TESSELLATION_TYPE_DOTS
+    if (globalIndex >= getVertexCount() / DOTS_TOTAL_VERTEX_PER_STRAND_SEGMENT)
+    {
+        return;
+    }
+    convertToDisjointOrthogonalTriangleStripsPerSegment(globalIndex);
+#else
+    if (globalIndex >= getVertexCount())
     {
         return;
     }
@@ -247,4 +616,5 @@ void main_cs(in int globalIndex : SV_DispatchThreadID)
 #elif RTXCR_TRIANGLES == RTXCR_CURVE_TESSELLATION_TYPE_TRIANGLE
     // TODO: Debug Triangles
 #endif
+#endif // RTXCR_MORPH_TARGET_PER_SEGMENT
 }
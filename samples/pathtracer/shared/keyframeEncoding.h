@@ -0,0 +1,180 @@
+/*
+* Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include "shared.h"
+
+#ifdef __cplusplus
+#include <cstring>
+#endif
+
+// Morph target keyframe encoding, shared by the CPU encoder and the morph target animation shader.
+// A keyframe holds one offset per strand point. The compressed formats quantize the offsets against the bounds of their keyframe,
+// one KeyframeQuantization entry per keyframe. The PCA format replaces the keyframes with a basis shared by all keyframes
+// and one coefficient per keyframe and basis vector, see MorphTargetPca.h.
+
+#define RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_FULL    0 // float4, 16 bytes per strand point
+#define RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_HALF    1 // Half floats relative to the center of the keyframe bounds, 8 bytes
+#define RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_UNORM10 2 // 10/10/10 bit unorm against the keyframe bounds, 4 bytes
+#define RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_PCA     3 // float4 basis vectors, 16 bytes per strand point and basis vector
+#define RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_COUNT   4
+
+struct KeyframeQuantization
+{
+    float3 origin;
+    uint pad0;
+
+    float3 extent;
+    uint pad1;
+};
+
+#ifdef __cplusplus
+// HLSL intrinsics, round to nearest even
+inline uint f32tof16(const float value)
+{
+    uint bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint sign = (bits >> 16) & 0x8000u;
+    const uint exponent = (bits >> 23) & 0xffu;
+    uint mantissa = bits & 0x7fffffu;
+    if (exponent == 0xffu)
+    {
+        return sign | 0x7c00u | (mantissa != 0 ? 0x200u : 0u);
+    }
+
+    const int halfExponent = (int)exponent - 127 + 15;
+    if (halfExponent >= 31)
+    {
+        return sign | 0x7c00u;
+    }
+    if (halfExponent <= 0)
+    {
+        if (halfExponent < -10)
+        {
+            return sign;
+        }
+        // Subnormal half
+        mantissa |= 0x800000u;
+        const uint shift = (uint)(14 - halfExponent);
+        uint halfMantissa = mantissa >> shift;
+        const uint remainder = mantissa & ((1u << shift) - 1u);
+        const uint halfway = 1u << (shift - 1u);
+        if (remainder > halfway || (remainder == halfway && (halfMantissa & 1u) != 0))
+        {
+            ++halfMantissa;
+        }
+        return sign | halfMantissa;
+    }
+
+    // A carry out of the mantissa increments the exponent, which is the correctly rounded result
+    uint half = sign | ((uint)halfExponent << 10) | (mantissa >> 13);
+    const uint remainder = mantissa & 0x1fffu;
+    if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u) != 0))
+    {
+        ++half;
+    }
+    return half;
+}
+
+inline float f16tof32(const uint value)
+{
+    const uint sign = (value & 0x8000u) << 16;
+    const uint exponent = (value >> 10) & 0x1fu;
+    const uint mantissa = value & 0x3ffu;
+    uint bits = 0;
+    if (exponent == 0)
+    {
+        // Zero and subnormals are exact in float
+        const float magnitude = (float)mantissa * (1.0f / 16777216.0f);
+        std::memcpy(&bits, &magnitude, sizeof(bits));
+        bits |= sign;
+    }
+    else if (exponent == 31)
+    {
+        bits = sign | 0x7f800000u | (mantissa << 13);
+    }
+    else
+    {
+        bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+    }
+
+    float result = 0.0f;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+#endif
+
+// Bytes per strand point
+inline uint getKeyframeStride(const uint keyframeFormat)
+{
+    return keyframeFormat == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_HALF    ? 8 :
+           keyframeFormat == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_UNORM10 ? 4 : 16;
+}
+
+// Half: the offset relative to the center of the bounds, divided by the half extent, so every component is in [-1, 1]
+inline float getKeyframeHalfScale(const float extent)
+{
+    return extent > 0.0f ? 2.0f / extent : 0.0f;
+}
+
+inline uint2 encodeKeyframeHalf(const float3 offset, const KeyframeQuantization quantization)
+{
+    const float3 center = quantization.origin + quantization.extent * 0.5f;
+    const float3 normalized = float3((offset.x - center.x) * getKeyframeHalfScale(quantization.extent.x),
+                                     (offset.y - center.y) * getKeyframeHalfScale(quantization.extent.y),
+                                     (offset.z - center.z) * getKeyframeHalfScale(quantization.extent.z));
+    return uint2(f32tof16(normalized.x) | (f32tof16(normalized.y) << 16), f32tof16(normalized.z));
+}
+
+inline float3 decodeKeyframeHalf(const uint2 packed, const KeyframeQuantization quantization)
+{
+    const float3 center = quantization.origin + quantization.extent * 0.5f;
+    const float3 normalized = float3(f16tof32(packed.x & 0xffffu), f16tof32(packed.x >> 16), f16tof32(packed.y & 0xffffu));
+    return center + normalized * (quantization.extent * 0.5f);
+}
+
+inline uint quantizeUnorm10(const float value, const float origin, const float extent)
+{
+    const float normalized = extent > 0.0f ? saturate((value - origin) / extent) : 0.0f;
+    return (uint)(normalized * 1023.0f + 0.5f);
+}
+
+inline float dequantizeUnorm10(const uint value, const float origin, const float extent)
+{
+    return origin + (float)(value & 0x3ffu) * (extent / 1023.0f);
+}
+
+inline uint encodeKeyframeUnorm10(const float3 offset, const KeyframeQuantization quantization)
+{
+    return quantizeUnorm10(offset.x, quantization.origin.x, quantization.extent.x) |
+           (quantizeUnorm10(offset.y, quantization.origin.y, quantization.extent.y) << 10) |
+           (quantizeUnorm10(offset.z, quantization.origin.z, quantization.extent.z) << 20);
+}
+
+inline float3 decodeKeyframeUnorm10(const uint packed, const KeyframeQuantization quantization)
+{
+    return float3(dequantizeUnorm10(packed, quantization.origin.x, quantization.extent.x),
+                  dequantizeUnorm10(packed >> 10, quantization.origin.y, quantization.extent.y),
+                  dequantizeUnorm10(packed >> 20, quantization.origin.z, quantization.extent.z));
+}
@@ -0,0 +1,107 @@
+/*
+* Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+* DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "shared.h"
+
+// Compact line segment encoding, shared by the CPU encoder and the morph target animation shader.
+// End points are 16 bit unorm against the bounds of the segment's geometry, radii are 16 bit unorm against the largest
+// radius of the geometry. The strand index (LineSegment::geometryIndex) and the bounds index share one 32 bit word.
+
+#define RTXCR_COMPACT_LINE_SEGMENT_STRAND_INDEX_BITS 24
+#define RTXCR_COMPACT_LINE_SEGMENT_MAX_STRAND_INDEX  ((1u << RTXCR_COMPACT_LINE_SEGMENT_STRAND_INDEX_BITS) - 1u)
+// Geometries past the last bounds index share its bounds
+#define RTXCR_COMPACT_LINE_SEGMENT_MAX_BOUNDS_COUNT  (1u << (32 - RTXCR_COMPACT_LINE_SEGMENT_STRAND_INDEX_BITS))
+
+struct CompactLineSegment
+{
+    uint packedGeometryIndex; // Strand index in the low 24 bits, bounds index in the high 8 bits
+    uint point0XY;
+    uint point0ZRadius0;
+    uint point1XY;
+    uint point1ZRadius1;
+};
+
+struct LineSegmentBounds
+{
+    float3 origin;
+    float maxRadius;
+
+    float3 extent;
+    uint pad0;
+};
+
+inline uint quantizeUnorm16(const float value, const float origin, const float extent)
+{
+    const float normalized = extent > 0.0f ? saturate((value - origin) / extent) : 0.0f;
+    return (uint)(normalized * 65535.0f + 0.5f);
+}
+
+inline float dequantizeUnorm16(const uint value, const float origin, const float extent)
+{
+    return origin + (float)(value & 0xffffu) * (extent / 65535.0f);
+}
+
+inline uint getCompactLineSegmentStrandIndex(const CompactLineSegment segment)
+{
+    return segment.packedGeometryIndex & RTXCR_COMPACT_LINE_SEGMENT_MAX_STRAND_INDEX;
+}
+
+inline uint getCompactLineSegmentBoundsIndex(const CompactLineSegment segment)
+{
+    return segment.packedGeometryIndex >> RTXCR_COMPACT_LINE_SEGMENT_STRAND_INDEX_BITS;
+}
+
+// strandIndex must not exceed RTXCR_COMPACT_LINE_SEGMENT_MAX_STRAND_INDEX and boundsIndex must be below RTXCR_COMPACT_LINE_SEGMENT_MAX_BOUNDS_COUNT
+inline CompactLineSegment encodeLineSegment(const LineSegment segment, const uint boundsIndex, const LineSegmentBounds bounds)
+{
+    CompactLineSegment compactSegment;
+    compactSegment.packedGeometryIndex = ((uint)segment.geometryIndex & RTXCR_COMPACT_LINE_SEGMENT_MAX_STRAND_INDEX) |
+                                         (boundsIndex << RTXCR_COMPACT_LINE_SEGMENT_STRAND_INDEX_BITS);
+    compactSegment.point0XY = quantizeUnorm16(segment.point0.x, bounds.origin.x, bounds.extent.x) |
+                              (quantizeUnorm16(segment.point0.y, bounds.origin.y, bounds.extent.y) << 16);
+    compactSegment.point0ZRadius0 = quantizeUnorm16(segment.point0.z, bounds.origin.z, bounds.extent.z) |
+                                    (quantizeUnorm16(segment.radius0, 0.0f, bounds.maxRadius) << 16);
+    compactSegment.point1XY = quantizeUnorm16(segment.point1.x, bounds.origin.x, bounds.extent.x) |
+                              (quantizeUnorm16(segment.point1.y, bounds.origin.y, bounds.extent.y) << 16);
+    compactSegment.point1ZRadius1 = quantizeUnorm16(segment.point1.z, bounds.origin.z, bounds.extent.z) |
+                                    (quantizeUnorm16(segment.radius1, 0.0f, bounds.maxRadius) << 16);
+    return compactSegment;
+}
+
+// bounds must be the entry of getCompactLineSegmentBoundsIndex(compactSegment)
+inline LineSegment decodeLineSegment(const CompactLineSegment compactSegment, const LineSegmentBounds bounds)
+{
+    LineSegment segment;
+    segment.geometryIndex = (int)getCompactLineSegmentStrandIndex(compactSegment);
+    segment.pad0 = float3(0.0f, 0.0f, 0.0f);
+    segment.point0 = float3(dequantizeUnorm16(compactSegment.point0XY, bounds.origin.x, bounds.extent.x),
+                            dequantizeUnorm16(compactSegment.point0XY >> 16, bounds.origin.y, bounds.extent.y),
+                            dequantizeUnorm16(compactSegment.point0ZRadius0, bounds.origin.z, bounds.extent.z));
+    segment.radius0 = dequantizeUnorm16(compactSegment.point0ZRadius0 >> 16, 0.0f, bounds.maxRadius);
+    segment.point1 = float3(dequantizeUnorm16(compactSegment.point1XY, bounds.origin.x, bounds.extent.x),
+                            dequantizeUnorm16(compactSegment.point1XY >> 16, bounds.origin.y, bounds.extent.y),
+                            dequantizeUnorm16(compactSegment.point1ZRadius1, bounds.origin.z, bounds.extent.z));
+    segment.radius1 = dequantizeUnorm16(compactSegment.point1ZRadius1 >> 16, 0.0f, bounds.maxRadius);
+    return segment;
+}
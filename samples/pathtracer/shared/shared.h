@@ -30,7 +30,13 @@
 #define RTXCR_CURVE_TESSELLATION_TYPE_LSS      2
 #define RTXCR_CURVE_TESSELLATION_TYPE_TRIANGLE 3
 
+// Default polytube order, every curve mesh can use its own order in [MIN_ORDER, MAX_ORDER]
 #define RTXCR_CURVE_POLYTUBE_ORDER 3
+#define RTXCR_CURVE_POLYTUBE_MIN_ORDER 2
+#define RTXCR_CURVE_POLYTUBE_MAX_ORDER 8
+
+// Threads per group of morphTargetAnimation.cs.hlsl, a thread writes one vertex, or one line segment with RTXCR_MORPH_TARGET_PER_SEGMENT
+#define RTXCR_MORPH_TARGET_THREAD_GROUP_SIZE 64
 #define PI 3.141593f
 #define TWO_PI 6.283185f
 
@@ -103,5 +109,48 @@ struct MorphTargetConstants
     int vertexCount;
     float lerpWeight;
     float prevLerpWeight;
-    float pad0;
+    uint lssSuccessiveImplicit; // LSS only: 1 when the mesh stores one vertex per strand point
+
+    uint polyTubeOrder;         // Polytube only: faces per segment of the mesh
+    uint keyframeIndex;         // Compressed keyframe formats only: quantization entries, or PCA coefficients, of keyframe N and N + 1
+    uint nextKeyframeIndex;
+    uint keyframeComponentCount; // PCA only: basis vectors per strand point, including the mean
+};
+
+// One animated mesh of the batched morph target dispatch (RTXCR_MORPH_TARGET_BATCHED), see MorphTargetBatch.h.
+// Descriptor indices refer to the batch descriptor table of MorphTargetAnimationPass.
+struct MorphTargetBatchMesh
+{
+    uint firstThread;                      // The table is sorted by firstThread, the thread ranges of the meshes are contiguous
+    uint numThreads;
+    int vertexCount;                       // As MorphTargetConstants::vertexCount
+    uint polyTubeOrder;
+
+    uint keyframeOffset;                   // First strand point of keyframe N in the keyframe buffer of the mesh
+    uint nextKeyframeOffset;               // First strand point of keyframe N + 1
+    float lerpWeight;
+    uint lssSuccessiveImplicit;
+
+    uint keyframeDescriptorIndex;
+    uint lineSegmentsDescriptorIndex;
+    uint lineSegmentBoundsDescriptorIndex; // Compact line segments only
+    uint compactLineSegments;
+
+    uint vertexBufferDescriptorIndex;
+    uint positionByteOffset;               // Vertex attribute ranges in the vertex buffer of the mesh
+    uint normalByteOffset;
+    uint tangentByteOffset;
+
+    uint keyframeIndex;                    // Compressed keyframe formats only: quantization entries, or PCA coefficients, of keyframe N and N + 1
+    uint nextKeyframeIndex;
+    uint keyframeParameterDescriptorIndex; // Quantization entries, or PCA coefficients
+    uint keyframeComponentCount;           // PCA only
+};
+
+struct MorphTargetBatchConstants
+{
+    uint numMeshes;
+    uint numThreads;
+    uint pad0;
+    uint pad1;
 };
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <cassert>
+
+#include "AccelStructScratchPool.h"
+
+namespace
+{
+    inline uint64_t alignUp(const uint64_t value, const uint64_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+}
+
+void AccelStructScratchPool::reset(const uint64_t capacity)
+{
+    m_capacity = capacity;
+    m_frameStart = kInvalidOffset;
+    m_blocks.clear();
+    m_liveRequestedBytes = 0;
+    m_stats.capacity = capacity;
+}
+
+void AccelStructScratchPool::beginFrame(const uint64_t frame, const uint32_t framesInFlight)
+{
+    assert(frame >= m_frame);
+
+    while (!m_blocks.empty() && m_blocks.front().frame + framesInFlight < frame)
+    {
+        m_liveRequestedBytes -= m_blocks.front().size;
+        m_blocks.pop_front();
+    }
+    m_frame = frame;
+    m_frameStart = kInvalidOffset;
+}
+
+uint64_t AccelStructScratchPool::getRingDistance(const uint64_t from, const uint64_t to) const
+{
+    return (to >= from) ? (to - from) : (m_capacity - from + to);
+}
+
+uint64_t AccelStructScratchPool::getUsedBytes() const
+{
+    if (m_blocks.empty())
+    {
+        return 0;
+    }
+
+    // The blocks cover the ring from the start of the oldest to the end of the newest, a full ring ends where it starts
+    const uint64_t usedBytes = getRingDistance(m_blocks.front().start, m_blocks.back().end);
+    return (usedBytes == 0) ? m_capacity : usedBytes;
+}
+
+uint64_t AccelStructScratchPool::allocate(const uint64_t size, const uint64_t alignment)
+{
+    assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+    const uint64_t allocationSize = std::max(size, (uint64_t)1);
+    const uint64_t usedBytes = getUsedBytes();
+
+    // Free space runs from the head to the start of the oldest block, possibly across the end of the ring
+    const uint64_t head = m_blocks.empty() ? 0 : m_blocks.back().end;
+    const uint64_t tail = m_blocks.empty() ? m_capacity : m_blocks.front().start;
+    const bool isWrapped = !m_blocks.empty() && head < tail;
+
+    uint64_t offset = kInvalidOffset;
+    bool isRingEndSkipped = false;
+    if (usedBytes < m_capacity)
+    {
+        const uint64_t alignedHead = alignUp(head, alignment);
+        const uint64_t headLimit = isWrapped ? tail : m_capacity;
+        if (alignedHead + allocationSize <= headLimit)
+        {
+            offset = alignedHead;
+        }
+        else if (!isWrapped && head > 0 && allocationSize <= (m_blocks.empty() ? m_capacity : tail))
+        {
+            offset = 0;
+            isRingEndSkipped = true;
+        }
+    }
+
+    const uint64_t frameStart = (m_frameStart == kInvalidOffset) ? head : m_frameStart;
+    if (offset == kInvalidOffset)
+    {
+        // The batch of this frame would have needed at least this much
+        const uint64_t frameBytes = m_blocks.empty() || m_frameStart == kInvalidOffset ? 0 : getRingDistance(frameStart, head);
+        m_stats.peakBatchBytes = std::max(m_stats.peakBatchBytes, frameBytes + allocationSize + alignment - 1);
+        ++m_stats.numFailedAllocations;
+        return kInvalidOffset;
+    }
+
+    Block block;
+    block.frame = m_frame;
+    block.start = head;
+    block.offset = offset;
+    block.end = offset + allocationSize;
+    block.size = allocationSize;
+    m_blocks.push_back(block);
+    m_liveRequestedBytes += allocationSize;
+    m_frameStart = frameStart;
+
+    if (isRingEndSkipped)
+    {
+        m_stats.wrapWasteBytes += m_capacity - head;
+    }
+    else
+    {
+        m_stats.alignmentWasteBytes += offset - head;
+    }
+    ++m_stats.numAllocations;
+
+    const uint64_t newUsedBytes = getUsedBytes();
+    if (newUsedBytes > m_stats.peakUsedBytes)
+    {
+        m_stats.peakUsedBytes = newUsedBytes;
+        m_stats.peakWastedBytes = newUsedBytes - m_liveRequestedBytes;
+    }
+    m_stats.peakRequestedBytes = std::max(m_stats.peakRequestedBytes, m_liveRequestedBytes);
+
+    uint64_t frameBytes = getRingDistance(m_frameStart, block.end);
+    if (frameBytes == 0)
+    {
+        frameBytes = m_capacity;
+    }
+    m_stats.peakBatchBytes = std::max(m_stats.peakBatchBytes, frameBytes);
+
+    return offset;
+}
+
+uint64_t AccelStructScratchPool::getRecommendedCapacity(const uint32_t framesInFlight, const uint64_t granularity) const
+{
+    const uint64_t capacity = m_stats.peakBatchBytes * (framesInFlight + 2);
+    return (granularity > 0) ? (capacity + granularity - 1) / granularity * granularity : capacity;
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+
+struct AccelStructScratchPoolStats
+{
+    uint64_t capacity = 0;
+    uint64_t peakUsedBytes = 0;         // Largest span of live allocations, including their padding
+    uint64_t peakRequestedBytes = 0;    // Largest sum of live allocation sizes
+    uint64_t peakWastedBytes = 0;       // Alignment padding and skipped ring end at the peak span
+    uint64_t peakBatchBytes = 0;        // Largest span allocated in one frame, or that a failed allocation asked for
+    uint64_t alignmentWasteBytes = 0;   // All padding so far
+    uint64_t wrapWasteBytes = 0;        // All ring ends skipped so far
+    uint32_t numAllocations = 0;
+    uint32_t numFailedAllocations = 0;
+};
+
+// Ring sub-allocator for the scratch memory of acceleration structure builds. Allocations belong to the frame they
+// were made in and are released together once that frame completed on the GPU, so a frame reuses the scratch of the
+// frames before it. Only offsets are handed out, the pool owns no memory and needs no device.
+// Not used by the sample: nvrhi takes no scratch buffer, its builds sub-allocate from the command list's scratch chunks.
+class AccelStructScratchPool
+{
+public:
+    static constexpr uint64_t kInvalidOffset = ~0ull;
+    // D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT, also enough for the scratch offset alignment of Vulkan drivers
+    static constexpr uint64_t kDefaultAlignment = 256;
+
+    // Drops every allocation and keeps the statistics
+    void reset(const uint64_t capacity);
+
+    // Starts a frame: releases the allocations of the frames more than framesInFlight frames before it,
+    // the GPU is done with those. Frames are increasing.
+    void beginFrame(const uint64_t frame, const uint32_t framesInFlight);
+
+    // Offset of size bytes in the current frame, kInvalidOffset when it doesn't fit. alignment is a power of 2.
+    uint64_t allocate(const uint64_t size, const uint64_t alignment = kDefaultAlignment);
+
+    inline uint64_t getCapacity() const { return m_capacity; }
+    uint64_t getUsedBytes() const;
+    inline uint32_t getLiveAllocationCount() const { return (uint32_t)m_blocks.size(); }
+    inline const AccelStructScratchPoolStats& getStats() const { return m_stats; }
+
+    // Capacity for the largest batch so far in the current frame and every frame in flight, plus one more batch for
+    // a skipped ring end. Rounded up to granularity.
+    uint64_t getRecommendedCapacity(const uint32_t framesInFlight, const uint64_t granularity) const;
+
+private:
+    struct Block
+    {
+        uint64_t frame = 0;
+        uint64_t start = 0;     // Head before the allocation, the padding and a skipped ring end belong to the block
+        uint64_t offset = 0;
+        uint64_t end = 0;
+        uint64_t size = 0;
+    };
+
+    uint64_t getRingDistance(const uint64_t from, const uint64_t to) const;
+
+    uint64_t m_capacity = 0;
+    uint64_t m_frame = 0;
+    uint64_t m_frameStart = kInvalidOffset;     // Head at the first allocation of the frame
+    std::deque<Block> m_blocks;                 // Oldest first
+    uint64_t m_liveRequestedBytes = 0;
+    AccelStructScratchPoolStats m_stats;
+};
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+
+#include "BlasBuildScheduler.h"
+
+uint64_t BlasBuildScheduler::estimateScratchBytes(const uint32_t primitiveCount)
+{
+    return kEstimatedScratchBaseBytes + (uint64_t)primitiveCount * kEstimatedScratchBytesPerPrimitive;
+}
+
+bool BlasBuildScheduler::isBefore(const Pending& a, const Pending& b, const uint32_t agingFrames)
+{
+    // Waiting agingFrames frames is worth one priority level
+    const uint64_t orderA = a.enqueueFrame + (uint64_t)(kMaxPriority - a.request.priority) * agingFrames;
+    const uint64_t orderB = b.enqueueFrame + (uint64_t)(kMaxPriority - b.request.priority) * agingFrames;
+    if (orderA != orderB)
+    {
+        return orderA < orderB;
+    }
+    if (a.request.primitiveCount != b.request.primitiveCount)
+    {
+        return a.request.primitiveCount < b.request.primitiveCount;
+    }
+    return a.sequence < b.sequence;
+}
+
+void BlasBuildScheduler::enqueue(const BlasBuildRequest& request)
+{
+    BlasBuildRequest clampedRequest = request;
+    clampedRequest.priority = std::min(request.priority, kMaxPriority);
+
+    const auto [it, isNew] = m_pendingIndices.try_emplace(request.key, m_pending.size());
+    if (!isNew)
+    {
+        // Keeps the age, and never lowers the priority, so that repeated requests can't starve a BLAS
+        Pending& pending = m_pending[it->second];
+        clampedRequest.priority = std::max(clampedRequest.priority, pending.request.priority);
+        pending.request = clampedRequest;
+        return;
+    }
+
+    Pending pending;
+    pending.request = clampedRequest;
+    pending.enqueueFrame = m_frame;
+    pending.sequence = m_nextSequence++;
+    m_pending.push_back(pending);
+}
+
+void BlasBuildScheduler::clear()
+{
+    m_pending.clear();
+    m_pendingIndices.clear();
+}
+
+bool BlasBuildScheduler::isPending(const uint64_t key) const
+{
+    return m_pendingIndices.find(key) != m_pendingIndices.end();
+}
+
+void BlasBuildScheduler::schedule(std::vector<BlasBuildRequest>& builds)
+{
+    m_frameStats = {};
+
+    const uint32_t agingFrames = std::max(m_budget.agingFrames, 1u);
+    std::sort(m_pending.begin(), m_pending.end(),
+              [agingFrames](const Pending& a, const Pending& b) { return isBefore(a, b, agingFrames); });
+
+    // The first request is always built, the others only while they fit
+    size_t numKept = 0;
+    for (size_t pendingIndex = 0; pendingIndex < m_pending.size(); ++pendingIndex)
+    {
+        const Pending& pending = m_pending[pendingIndex];
+        const uint64_t scratchBytes = m_frameStats.scratchBytes + pending.request.scratchBytes;
+        const uint64_t primitives = (uint64_t)m_frameStats.primitives + pending.request.primitiveCount;
+        const bool fits = (m_budget.maxScratchBytes == 0 || scratchBytes <= m_budget.maxScratchBytes) &&
+                          (m_budget.maxPrimitives == 0 || primitives <= m_budget.maxPrimitives);
+        if (m_frameStats.numBuilds > 0 && !fits)
+        {
+            m_pending[numKept++] = pending;
+            continue;
+        }
+
+        builds.push_back(pending.request);
+        m_frameStats.overBudget |= !fits;
+        m_frameStats.scratchBytes = scratchBytes;
+        m_frameStats.primitives = (uint32_t)primitives;
+        m_frameStats.maxWaitFrames = std::max(m_frameStats.maxWaitFrames, (uint32_t)(m_frame - pending.enqueueFrame));
+        ++m_frameStats.numBuilds;
+    }
+    m_pending.resize(numKept);
+    m_frameStats.numPending = numKept;
+
+    // The sort moved the requests that wait
+    m_pendingIndices.clear();
+    for (size_t pendingIndex = 0; pendingIndex < m_pending.size(); ++pendingIndex)
+    {
+        m_pendingIndices.emplace(m_pending[pendingIndex].request.key, pendingIndex);
+    }
+
+    ++m_frame;
+}
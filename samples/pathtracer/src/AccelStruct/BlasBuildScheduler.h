@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Limits of the BLAS builds submitted in one frame, 0 is unlimited
+struct BlasBuildBudget
+{
+    uint64_t maxScratchBytes = 0;   // Bounds the scratchBytes of the requests, estimated unless the owner knows the sizes
+    uint32_t maxPrimitives = 0;
+    // A request gains one priority level every agingFrames frames it waits
+    uint32_t agingFrames = 8;
+};
+
+struct BlasBuildRequest
+{
+    uint64_t key = 0;           // Identifies the BLAS, a request for a pending key replaces the pending request
+    uint32_t primitiveCount = 0;
+    uint64_t scratchBytes = 0;  // BlasBuildScheduler::estimateScratchBytes unless the size is known
+    uint32_t priority = 0;      // Clamped to kMaxPriority
+};
+
+// Orders pending BLAS builds and picks the ones that fit the budget of a frame. It only sees keys and sizes,
+// the owner creates and builds the acceleration structures of the picked requests.
+//
+// A request waiting since frame t with priority p is ordered by t - p * agingFrames, ties go to the smaller build.
+// The order of two pending requests never changes while they wait, so a request is only ever overtaken by requests
+// that arrived less than kMaxPriority * agingFrames frames after it. The first request in order is built every frame,
+// also when it alone exceeds the budget, which keeps every request from starving. The other picks fill up the budget.
+class BlasBuildScheduler
+{
+public:
+    static constexpr uint32_t kMaxPriority = 3;
+
+    struct FrameStats
+    {
+        uint32_t numBuilds = 0;
+        uint32_t numPending = 0;        // Left for later frames
+        uint32_t primitives = 0;
+        uint64_t scratchBytes = 0;
+        uint32_t maxWaitFrames = 0;     // Longest wait of the builds of this frame
+        bool overBudget = false;        // A single build larger than the budget
+    };
+
+    // Estimates, not device sizes: nvrhi builds from its command list's scratch chunks and doesn't report the prebuild info
+    // of the driver. A binned SAH build holds a primitive reference with its float bounds and centroid (32 B) and, as a tree
+    // of N primitives has fewer than N internal nodes, at most one node of bounds and child links (32 B) per primitive.
+    // The base covers the bins and the build stack of small BLAS.
+    static constexpr uint64_t kEstimatedScratchBytesPerPrimitive = 64;
+    static constexpr uint64_t kEstimatedScratchBaseBytes = 64 * 1024;
+    static uint64_t estimateScratchBytes(const uint32_t primitiveCount);
+
+    inline void setBudget(const BlasBuildBudget& budget) { m_budget = budget; }
+    inline const BlasBuildBudget& getBudget() const { return m_budget; }
+
+    // A pending request with the same key keeps its place in the order
+    void enqueue(const BlasBuildRequest& request);
+    void clear();
+
+    // Advances a frame and appends the builds of this frame in order, they are no longer pending afterwards
+    void schedule(std::vector<BlasBuildRequest>& builds);
+
+    bool isPending(const uint64_t key) const;
+    inline uint32_t getPendingCount() const { return (uint32_t)m_pending.size(); }
+    inline const FrameStats& getFrameStats() const { return m_frameStats; }
+
+private:
+    struct Pending
+    {
+        BlasBuildRequest request;
+        uint64_t enqueueFrame = 0;
+        uint64_t sequence = 0;      // Enqueue order, the last tie breaker
+    };
+
+    static bool isBefore(const Pending& a, const Pending& b, const uint32_t agingFrames);
+
+    BlasBuildBudget m_budget;
+    std::vector<Pending> m_pending;
+    std::unordered_map<uint64_t, size_t> m_pendingIndices;  // Key to its m_pending index
+    uint64_t m_frame = 0;
+    uint64_t m_nextSequence = 0;
+    FrameStats m_frameStats;
+};
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <unordered_map>
+
+#include "AccelStruct/BlasBuildSchedulerSimulation.h"
+
+BlasBuildScheduleStats BlasBuildScheduling::simulate(
+    const std::vector<BlasBuildRequest>& requests,
+    const std::vector<uint32_t>& arrivalFrames,
+    const BlasBuildBudget& budget)
+{
+    assert(requests.size() == arrivalFrames.size());
+
+    BlasBuildScheduleStats stats;
+    stats.numRequests = (uint32_t)requests.size();
+
+    std::vector<uint32_t> arrivalOrder(requests.size());
+    std::iota(arrivalOrder.begin(), arrivalOrder.end(), 0u);
+    std::stable_sort(arrivalOrder.begin(), arrivalOrder.end(),
+                     [&arrivalFrames](const uint32_t a, const uint32_t b) { return arrivalFrames[a] < arrivalFrames[b]; });
+    const uint32_t lastArrivalFrame = arrivalOrder.empty() ? 0 : arrivalFrames[arrivalOrder.back()];
+
+    BlasBuildScheduler scheduler;
+    scheduler.setBudget(budget);
+
+    // Every key must be built once after its last request
+    std::unordered_map<uint64_t, bool> needsBuild;
+    std::vector<BlasBuildRequest> builds;
+    size_t nextArrival = 0;
+    for (uint32_t frame = 0; nextArrival < arrivalOrder.size() || scheduler.getPendingCount() > 0; ++frame)
+    {
+        // Every frame builds at least one pending request
+        if (frame > lastArrivalFrame + stats.numRequests)
+        {
+            stats.valid = false;
+            break;
+        }
+
+        for (; nextArrival < arrivalOrder.size() && arrivalFrames[arrivalOrder[nextArrival]] == frame; ++nextArrival)
+        {
+            const BlasBuildRequest& request = requests[arrivalOrder[nextArrival]];
+            scheduler.enqueue(request);
+            needsBuild[request.key] = true;
+        }
+
+        builds.clear();
+        scheduler.schedule(builds);
+        for (const auto& build : builds)
+        {
+            auto it = needsBuild.find(build.key);
+            stats.valid &= (it != needsBuild.end() && it->second);
+            if (it != needsBuild.end())
+            {
+                it->second = false;
+            }
+        }
+
+        const BlasBuildScheduler::FrameStats& frameStats = scheduler.getFrameStats();
+        stats.valid &= (frameStats.numBuilds <= 1 || !frameStats.overBudget);
+        stats.valid &= (frameStats.numBuilds > 0 || scheduler.getPendingCount() == 0);
+        stats.numFrames = frame + 1;
+        stats.maxBuildsPerFrame = std::max(stats.maxBuildsPerFrame, frameStats.numBuilds);
+        stats.maxScratchBytesPerFrame = std::max(stats.maxScratchBytesPerFrame, frameStats.scratchBytes);
+        stats.maxPrimitivesPerFrame = std::max(stats.maxPrimitivesPerFrame, frameStats.primitives);
+        stats.numOverBudgetFrames += frameStats.overBudget ? 1 : 0;
+        stats.maxWaitFrames = std::max(stats.maxWaitFrames, frameStats.maxWaitFrames);
+    }
+
+    for (const auto& keyNeedsBuild : needsBuild)
+    {
+        stats.valid &= !keyNeedsBuild.second;
+    }
+    return stats;
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "AccelStruct/BlasBuildScheduler.h"
+
+// BLAS build requests run through the scheduler of the path tracer frame by frame, for the tests, the benchmarks and hairanalysis
+
+struct BlasBuildScheduleStats
+{
+    uint32_t numRequests = 0;
+    uint32_t numFrames = 0;             // Frames until every request was built
+    uint32_t maxBuildsPerFrame = 0;
+    uint64_t maxScratchBytesPerFrame = 0;
+    uint32_t maxPrimitivesPerFrame = 0;
+    uint32_t numOverBudgetFrames = 0;   // Frames with a single build larger than the budget
+    uint32_t maxWaitFrames = 0;
+    bool valid = true;                  // Every frame within the budget or a single build, every request built once
+};
+
+namespace BlasBuildScheduling
+{
+    // Runs the scheduler until every request is built. requests[i] arrives at frame arrivalFrames[i],
+    // a request for a key that is still pending replaces it as it would in the renderer.
+    BlasBuildScheduleStats simulate(
+        const std::vector<BlasBuildRequest>& requests,
+        const std::vector<uint32_t>& arrivalFrames,
+        const BlasBuildBudget& budget);
+}
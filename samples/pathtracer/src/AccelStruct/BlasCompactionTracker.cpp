@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <cassert>
+
+#include "BlasCompactionTracker.h"
+
+const char* getBlasCompactionStateName(const BlasCompactionState state)
+{
+    switch (state)
+    {
+    case BlasCompactionState::Unbuilt:
+        return "Unbuilt";
+    case BlasCompactionState::Built:
+        return "Built";
+    case BlasCompactionState::Compacted:
+        return "Compacted";
+    case BlasCompactionState::RebuildDue:
+        return "Rebuild Due";
+    }
+    return "";
+}
+
+BlasCompactionState BlasCompactionTracker::getState(const uint64_t key) const
+{
+    const Entry* const entry = getEntry(key);
+    return entry ? entry->state : BlasCompactionState::Unbuilt;
+}
+
+const BlasCompactionTracker::Entry* BlasCompactionTracker::getEntry(const uint64_t key) const
+{
+    const auto it = m_entries.find(key);
+    return (it != m_entries.end()) ? &it->second : nullptr;
+}
+
+bool BlasCompactionTracker::needsBuild(const uint64_t key) const
+{
+    const BlasCompactionState state = getState(key);
+    return state == BlasCompactionState::Unbuilt || state == BlasCompactionState::RebuildDue;
+}
+
+bool BlasCompactionTracker::isRefittable(const uint64_t key) const
+{
+    return getState(key) != BlasCompactionState::Unbuilt;
+}
+
+bool BlasCompactionTracker::isCompactionPending(const uint64_t key) const
+{
+    const Entry* const entry = getEntry(key);
+    return entry && entry->state == BlasCompactionState::Built && entry->compactable &&
+           m_frame - entry->buildFrame < m_policy.maxCompactionWaitFrames;
+}
+
+bool BlasCompactionTracker::hasPendingCompactions() const
+{
+    return std::any_of(m_entries.begin(), m_entries.end(),
+                       [this](const auto& keyEntry) { return isCompactionPending(keyEntry.first); });
+}
+
+void BlasCompactionTracker::onBuilt(const uint64_t key, const uint64_t builtBytes, const bool compactable)
+{
+    Entry& entry = m_entries[key];
+    entry.state = BlasCompactionState::Built;
+    entry.compactable = compactable;
+    entry.builtBytes = builtBytes;
+    entry.compactedBytes = 0;
+    entry.buildFrame = m_frame;
+    entry.refitsSinceBuild = 0;
+    ++entry.numBuilds;
+}
+
+void BlasCompactionTracker::onRefit(const uint64_t key)
+{
+    const auto it = m_entries.find(key);
+    assert(it != m_entries.end() && it->second.state != BlasCompactionState::Unbuilt);
+    if (it != m_entries.end())
+    {
+        ++it->second.refitsSinceBuild;
+    }
+}
+
+void BlasCompactionTracker::requestRebuild(const uint64_t key)
+{
+    const auto it = m_entries.find(key);
+    assert(it == m_entries.end() || !isCompactionPending(key));
+    if (it != m_entries.end() && it->second.state != BlasCompactionState::Unbuilt)
+    {
+        it->second.state = BlasCompactionState::RebuildDue;
+    }
+}
+
+bool BlasCompactionTracker::onCompacted(const uint64_t key, const uint64_t compactedBytes)
+{
+    const auto it = m_entries.find(key);
+    if (it == m_entries.end() || it->second.state != BlasCompactionState::Built || !it->second.compactable)
+    {
+        return false;
+    }
+
+    Entry& entry = it->second;
+    entry.state = BlasCompactionState::Compacted;
+    entry.compactedBytes = compactedBytes;
+    ++entry.numCompactions;
+    return true;
+}
+
+void BlasCompactionTracker::invalidate(const uint64_t key)
+{
+    const auto it = m_entries.find(key);
+    if (it != m_entries.end())
+    {
+        it->second.state = BlasCompactionState::Unbuilt;
+    }
+}
+
+void BlasCompactionTracker::remove(const uint64_t key)
+{
+    m_entries.erase(key);
+}
+
+void BlasCompactionTracker::clear()
+{
+    m_entries.clear();
+}
+
+BlasCompactionMemoryStats BlasCompactionTracker::getMemoryStats() const
+{
+    BlasCompactionMemoryStats stats;
+    for (const auto& keyEntry : m_entries)
+    {
+        const Entry& entry = keyEntry.second;
+        stats.builtBytes += entry.builtBytes;
+        stats.currentBytes += (entry.compactedBytes > 0) ? entry.compactedBytes : entry.builtBytes;
+        stats.numCompacted += (entry.compactedBytes > 0) ? 1 : 0;
+        stats.numPendingCompactions += isCompactionPending(keyEntry.first) ? 1 : 0;
+        ++stats.numBlas;
+    }
+    return stats;
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+
+// Lifecycle of a BLAS:
+//   Unbuilt -> Built          built into a new BLAS, with AllowCompaction or not
+//   Built -> Compacted        the build completed on the GPU and the BLAS was compacted in place
+//   Built/Compacted -> RebuildDue   the owner requested a rebuild, its tree has drifted from the geometry
+//   RebuildDue -> Built       rebuilt into a new BLAS, compacted again once that build completes
+//   any -> Unbuilt            the geometry changed, the BLAS can't be refit anymore
+// A BLAS in Built, Compacted or RebuildDue is refit in place, RebuildDue keeps refitting until its rebuild.
+enum class BlasCompactionState : uint8_t
+{
+    Unbuilt,
+    Built,
+    Compacted,
+    RebuildDue,
+};
+
+const char* getBlasCompactionStateName(const BlasCompactionState state);
+
+struct BlasCompactionPolicy
+{
+    // Frames a compactable BLAS waits for its compaction before it's no longer reported as pending,
+    // for backends that never compact
+    uint32_t maxCompactionWaitFrames = 16;
+};
+
+struct BlasCompactionMemoryStats
+{
+    uint64_t builtBytes = 0;        // Every tracked BLAS as built
+    uint64_t currentBytes = 0;      // Every tracked BLAS as it is now, compacted or not
+    uint32_t numBlas = 0;
+    uint32_t numCompacted = 0;      // Compacted, including the ones with a rebuild due
+    uint32_t numPendingCompactions = 0;
+};
+
+// Tracks the build, compaction and refit lifecycle of BLAS by key, the owner builds, compacts and refits them and
+// reports what it did. The tracker knows when a BLAS must be built and keeps the sizes for the memory report.
+class BlasCompactionTracker
+{
+public:
+    struct Entry
+    {
+        BlasCompactionState state = BlasCompactionState::Unbuilt;
+        bool compactable = false;
+        uint64_t builtBytes = 0;        // Size of the last build
+        uint64_t compactedBytes = 0;    // Size after the last compaction, 0 until compacted
+        uint64_t buildFrame = 0;
+        uint32_t refitsSinceBuild = 0;
+        uint32_t numBuilds = 0;
+        uint32_t numCompactions = 0;
+    };
+
+    inline void setPolicy(const BlasCompactionPolicy& policy) { m_policy = policy; }
+    inline const BlasCompactionPolicy& getPolicy() const { return m_policy; }
+
+    // Advances a frame, compaction waits are counted in frames
+    inline void beginFrame() { ++m_frame; }
+
+    // Unbuilt for unknown keys
+    BlasCompactionState getState(const uint64_t key) const;
+    // Null for unknown keys
+    const Entry* getEntry(const uint64_t key) const;
+    // Unbuilt or RebuildDue
+    bool needsBuild(const uint64_t key) const;
+    // Built, Compacted or RebuildDue
+    bool isRefittable(const uint64_t key) const;
+    // Built, compactable and waiting less than maxCompactionWaitFrames
+    bool isCompactionPending(const uint64_t key) const;
+    bool hasPendingCompactions() const;
+
+    void onBuilt(const uint64_t key, const uint64_t builtBytes, const bool compactable);
+    void onRefit(const uint64_t key);
+    // Rebuilds a refittable BLAS and keeps refitting it until then. A BLAS waiting for its compaction should not be
+    // rebuilt, the compaction would be thrown away.
+    void requestRebuild(const uint64_t key);
+    // Returns false when the BLAS wasn't waiting for a compaction
+    bool onCompacted(const uint64_t key, const uint64_t compactedBytes);
+    // The BLAS is replaced or its geometry changed, the last sizes stay in the report until the next build
+    void invalidate(const uint64_t key);
+    void remove(const uint64_t key);
+    void clear();
+
+    BlasCompactionMemoryStats getMemoryStats() const;
+
+private:
+    BlasCompactionPolicy m_policy;
+    std::unordered_map<uint64_t, Entry> m_entries;
+    uint64_t m_frame = 0;
+};
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+
+#include "BlasRefitPolicy.h"
+
+void BlasRefitCounters::accumulate(const BlasRefitCounters& other)
+{
+    numRefits += other.numRefits;
+    numGrowthRebuilds += other.numGrowthRebuilds;
+    numRefitCountRebuilds += other.numRefitCountRebuilds;
+    numDeferredRebuilds += other.numDeferredRebuilds;
+    maxSurfaceAreaGrowth = std::max(maxSurfaceAreaGrowth, other.maxSurfaceAreaGrowth);
+}
+
+float BlasRefitPolicy::getGrowth(const Entry& entry)
+{
+    return (entry.builtSurfaceArea > 0.0f) ? std::max(entry.surfaceArea / entry.builtSurfaceArea - 1.0f, 0.0f) : 0.0f;
+}
+
+void BlasRefitPolicy::beginFrame()
+{
+    m_frameCounters = {};
+    m_candidates.clear();
+}
+
+void BlasRefitPolicy::onBuilt(const uint64_t key, const float surfaceArea)
+{
+    Entry& entry = m_entries[key];
+    entry.builtSurfaceArea = surfaceArea;
+    entry.surfaceArea = surfaceArea;
+    entry.refitsSinceBuild = 0;
+    entry.dueFrames = 0;
+}
+
+void BlasRefitPolicy::onRefit(const uint64_t key, const float surfaceArea, const bool canRebuild)
+{
+    const auto inserted = m_entries.try_emplace(key);
+    Entry& entry = inserted.first->second;
+    if (inserted.second)
+    {
+        entry.builtSurfaceArea = surfaceArea;
+    }
+    entry.surfaceArea = surfaceArea;
+    ++entry.refitsSinceBuild;
+
+    const float growth = getGrowth(entry);
+    ++m_frameCounters.numRefits;
+    m_frameCounters.maxSurfaceAreaGrowth = std::max(m_frameCounters.maxSurfaceAreaGrowth, growth);
+
+    if (!canRebuild)
+    {
+        return;
+    }
+
+    const float growthOverLimit = (m_settings.maxSurfaceAreaGrowth > 0.0f) ? growth / m_settings.maxSurfaceAreaGrowth : 0.0f;
+    const float refitsOverLimit = (m_settings.maxRefits > 0) ? (float)entry.refitsSinceBuild / (float)m_settings.maxRefits : 0.0f;
+    const float overLimit = std::max(growthOverLimit, refitsOverLimit);
+    if (overLimit < 1.0f)
+    {
+        entry.dueFrames = 0;
+        return;
+    }
+
+    Candidate candidate;
+    candidate.key = key;
+    candidate.priority = overLimit + (float)entry.dueFrames;
+    candidate.isGrowth = (growthOverLimit >= refitsOverLimit);
+    m_candidates.push_back(candidate);
+    ++entry.dueFrames;
+}
+
+void BlasRefitPolicy::selectRebuilds(std::vector<uint64_t>& rebuilds)
+{
+    std::sort(m_candidates.begin(), m_candidates.end(), [](const Candidate& a, const Candidate& b)
+    {
+        return (a.priority != b.priority) ? (a.priority > b.priority) : (a.key < b.key);
+    });
+
+    const size_t numRebuilds = (m_settings.maxRebuildsPerFrame > 0) ?
+        std::min(m_candidates.size(), (size_t)m_settings.maxRebuildsPerFrame) : m_candidates.size();
+    for (size_t candidateIndex = 0; candidateIndex < numRebuilds; ++candidateIndex)
+    {
+        const Candidate& candidate = m_candidates[candidateIndex];
+        rebuilds.push_back(candidate.key);
+        ++(candidate.isGrowth ? m_frameCounters.numGrowthRebuilds : m_frameCounters.numRefitCountRebuilds);
+    }
+    m_frameCounters.numDeferredRebuilds = (uint32_t)(m_candidates.size() - numRebuilds);
+    m_candidates.clear();
+
+    m_totalCounters.accumulate(m_frameCounters);
+}
+
+float BlasRefitPolicy::getSurfaceAreaGrowth(const uint64_t key) const
+{
+    const auto it = m_entries.find(key);
+    return (it != m_entries.end()) ? getGrowth(it->second) : 0.0f;
+}
+
+uint32_t BlasRefitPolicy::getRefitCount(const uint64_t key) const
+{
+    const auto it = m_entries.find(key);
+    return (it != m_entries.end()) ? it->second.refitsSinceBuild : 0;
+}
+
+void BlasRefitPolicy::remove(const uint64_t key)
+{
+    m_entries.erase(key);
+}
+
+void BlasRefitPolicy::clear()
+{
+    m_entries.clear();
+    m_candidates.clear();
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+struct BlasRefitPolicySettings
+{
+    // Rebuild once the bounds of a refit BLAS grew by this fraction over its bounds at the build, 0 disables
+    float maxSurfaceAreaGrowth = 0.5f;
+    // Rebuild after this many refits, 0 disables
+    uint32_t maxRefits = 600;
+    // Rebuilds started per frame, the most degraded BLAS first, 0 is unlimited. The others stay due and wait for a later frame.
+    uint32_t maxRebuildsPerFrame = 1;
+};
+
+// What the policy chose, per frame or in total
+struct BlasRefitCounters
+{
+    uint32_t numRefits = 0;
+    uint32_t numGrowthRebuilds = 0;     // Rebuilds because the bounds grew too much
+    uint32_t numRefitCountRebuilds = 0; // Rebuilds because of maxRefits
+    uint32_t numDeferredRebuilds = 0;   // Due but left for a later frame by maxRebuildsPerFrame
+    float maxSurfaceAreaGrowth = 0.0f;  // Largest growth of a refit BLAS
+
+    inline uint32_t getRebuildCount() const { return numGrowthRebuilds + numRefitCountRebuilds; }
+    void accumulate(const BlasRefitCounters& other);
+};
+
+// Decides per frame which refit BLAS to rebuild. The owner reports the builds and refits with an estimate of the surface
+// area of the BLAS bounds, MorphTargetRefitEstimator for animated hair, and rebuilds the BLAS that are picked.
+// The growth of a BLAS is its surface area over the surface area at its build, minus 1. A BLAS is due when its growth or its
+// refit count reaches the limit. Due BLAS are ordered by how far past the limit they are plus the frames they have been due,
+// so a burst of due BLAS, as when all meshes of the same animation degrade together, is spread over frames, the worst ones
+// go first and a waiting BLAS isn't overtaken forever.
+class BlasRefitPolicy
+{
+public:
+    inline void setSettings(const BlasRefitPolicySettings& settings) { m_settings = settings; }
+    inline const BlasRefitPolicySettings& getSettings() const { return m_settings; }
+
+    // Starts a frame, resets the frame counters
+    void beginFrame();
+
+    // surfaceArea is the estimate for the pose the BLAS was built in, 0 without an estimate
+    void onBuilt(const uint64_t key, const float surfaceArea);
+
+    // A refit of key to a pose with surfaceArea. canRebuild is false while a rebuild would be wasted or is already requested,
+    // such as before the BLAS was compacted. A BLAS refit before its first onBuilt measures its growth from this pose.
+    void onRefit(const uint64_t key, const float surfaceArea, const bool canRebuild);
+
+    // Ends the frame: appends the keys to rebuild, most degraded first
+    void selectRebuilds(std::vector<uint64_t>& rebuilds);
+
+    float getSurfaceAreaGrowth(const uint64_t key) const;
+    uint32_t getRefitCount(const uint64_t key) const;
+
+    void remove(const uint64_t key);
+    void clear();
+
+    inline const BlasRefitCounters& getFrameCounters() const { return m_frameCounters; }
+    inline const BlasRefitCounters& getTotalCounters() const { return m_totalCounters; }
+
+private:
+    struct Entry
+    {
+        float builtSurfaceArea = 0.0f;
+        float surfaceArea = 0.0f;
+        uint32_t refitsSinceBuild = 0;
+        uint32_t dueFrames = 0;     // Frames the BLAS was due without being picked
+    };
+
+    struct Candidate
+    {
+        uint64_t key = 0;
+        float priority = 0.0f;      // Growth or refit count relative to its limit, 1 and above is due, plus the due frames
+        bool isGrowth = false;
+    };
+
+    static float getGrowth(const Entry& entry);
+
+    BlasRefitPolicySettings m_settings;
+    std::unordered_map<uint64_t, Entry> m_entries;
+    std::vector<Candidate> m_candidates;
+    BlasRefitCounters m_frameCounters;
+    BlasRefitCounters m_totalCounters;
+};
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "TlasInstanceTable.h"
+
+void TlasInstanceTable::resize(const uint32_t instanceCount)
+{
+    const uint32_t previousCount = (uint32_t)m_instances.size();
+    if (instanceCount == previousCount)
+    {
+        return;
+    }
+
+    m_instances.resize(instanceCount);
+    m_isDirty.resize(instanceCount, 0);
+    m_isInputChanged.resize(instanceCount, 0);
+    if (instanceCount < previousCount)
+    {
+        const auto isRemoved = [instanceCount](const uint32_t instanceIndex) { return instanceIndex >= instanceCount; };
+        m_dirtyInstances.erase(std::remove_if(m_dirtyInstances.begin(), m_dirtyInstances.end(), isRemoved), m_dirtyInstances.end());
+        m_changedInputs.erase(std::remove_if(m_changedInputs.begin(), m_changedInputs.end(), isRemoved), m_changedInputs.end());
+        return;
+    }
+
+    for (uint32_t instanceIndex = previousCount; instanceIndex < instanceCount; ++instanceIndex)
+    {
+        markDirty(instanceIndex);
+        markInputChanged(instanceIndex);
+    }
+}
+
+void TlasInstanceTable::invalidate()
+{
+    for (uint32_t instanceIndex = 0; instanceIndex < m_instances.size(); ++instanceIndex)
+    {
+        markDirty(instanceIndex);
+    }
+}
+
+void TlasInstanceTable::clear()
+{
+    m_instances.clear();
+    m_isDirty.clear();
+    m_dirtyInstances.clear();
+    m_isInputChanged.clear();
+    m_changedInputs.clear();
+    m_isAllInputsChanged = false;
+    m_frameStats = {};
+}
+
+void TlasInstanceTable::markDirty(const uint32_t instanceIndex)
+{
+    if (!m_isDirty[instanceIndex])
+    {
+        m_isDirty[instanceIndex] = 1;
+        m_dirtyInstances.push_back(instanceIndex);
+    }
+}
+
+void TlasInstanceTable::markInputChanged(const uint32_t instanceIndex)
+{
+    if (!m_isAllInputsChanged && !m_isInputChanged[instanceIndex])
+    {
+        m_isInputChanged[instanceIndex] = 1;
+        m_changedInputs.push_back(instanceIndex);
+    }
+}
+
+void TlasInstanceTable::markAllInputsChanged()
+{
+    m_isAllInputsChanged = true;
+}
+
+void TlasInstanceTable::collectChangedInputs(std::vector<uint32_t>& instances)
+{
+    if (m_isAllInputsChanged)
+    {
+        for (uint32_t instanceIndex = 0; instanceIndex < m_instances.size(); ++instanceIndex)
+        {
+            instances.push_back(instanceIndex);
+        }
+    }
+    else
+    {
+        instances.insert(instances.end(), m_changedInputs.begin(), m_changedInputs.end());
+    }
+
+    for (const uint32_t instanceIndex : m_changedInputs)
+    {
+        m_isInputChanged[instanceIndex] = 0;
+    }
+    m_changedInputs.clear();
+    m_isAllInputsChanged = false;
+}
+
+void TlasInstanceTable::setInstance(const uint32_t instanceIndex, const nvrhi::rt::InstanceDesc& instance)
+{
+    nvrhi::rt::InstanceDesc& current = m_instances[instanceIndex];
+
+    const bool isTransformChanged = memcmp(current.transform, instance.transform, sizeof(instance.transform)) != 0;
+    const bool isMaskChanged = current.instanceMask != instance.instanceMask;
+    const bool isFlagChanged = current.flags != instance.flags || current.instanceID != instance.instanceID ||
+                               current.instanceContributionToHitGroupIndex != instance.instanceContributionToHitGroupIndex;
+    const bool isBlasChanged = current.blasDeviceAddress != instance.blasDeviceAddress;
+    if (!isTransformChanged && !isMaskChanged && !isFlagChanged && !isBlasChanged)
+    {
+        return;
+    }
+
+    m_frameStats.numTransformChanges += isTransformChanged ? 1 : 0;
+    m_frameStats.numMaskChanges += isMaskChanged ? 1 : 0;
+    m_frameStats.numFlagChanges += isFlagChanged ? 1 : 0;
+    m_frameStats.numBlasChanges += isBlasChanged ? 1 : 0;
+    current = instance;
+    markDirty(instanceIndex);
+}
+
+void TlasInstanceTable::collectDirtyRanges(std::vector<TlasInstanceRange>& ranges)
+{
+    std::sort(m_dirtyInstances.begin(), m_dirtyInstances.end());
+
+    m_stats = m_frameStats;
+    m_stats.numInstances = (uint32_t)m_instances.size();
+    m_stats.numDirtyInstances = (uint32_t)m_dirtyInstances.size();
+
+    const size_t firstRange = ranges.size();
+    for (const uint32_t instanceIndex : m_dirtyInstances)
+    {
+        m_isDirty[instanceIndex] = 0;
+
+        // A few clean instances cost less to upload than another copy
+        if (ranges.size() > firstRange)
+        {
+            TlasInstanceRange& range = ranges.back();
+            if (instanceIndex - (range.firstInstance + range.numInstances) <= kMaxRangeGap)
+            {
+                range.numInstances = instanceIndex - range.firstInstance + 1;
+                continue;
+            }
+        }
+        ranges.push_back({ instanceIndex, 1 });
+    }
+    mergeRanges(ranges, firstRange, kMaxRanges);
+
+    for (size_t rangeIndex = firstRange; rangeIndex < ranges.size(); ++rangeIndex)
+    {
+        ++m_stats.numRanges;
+        m_stats.numUploadedInstances += ranges[rangeIndex].numInstances;
+    }
+
+    m_dirtyInstances.clear();
+    m_frameStats = {};
+}
+
+void TlasInstanceTable::mergeRanges(std::vector<TlasInstanceRange>& ranges, const size_t firstRange, const uint32_t maxRanges)
+{
+    const size_t numRanges = ranges.size() - firstRange;
+    if (numRanges <= maxRanges || maxRanges == 0)
+    {
+        return;
+    }
+
+    // The gap that merges enough ranges, ranges separated by a smaller one are merged and so are as many as still needed
+    // of the ranges separated by exactly this gap
+    m_rangeGaps.clear();
+    for (size_t rangeIndex = firstRange + 1; rangeIndex < ranges.size(); ++rangeIndex)
+    {
+        m_rangeGaps.push_back(ranges[rangeIndex].firstInstance - (ranges[rangeIndex - 1].firstInstance + ranges[rangeIndex - 1].numInstances));
+    }
+    const size_t numMerges = numRanges - maxRanges;
+    std::nth_element(m_rangeGaps.begin(), m_rangeGaps.begin() + (numMerges - 1), m_rangeGaps.end());
+    const uint32_t maxGap = m_rangeGaps[numMerges - 1];
+    size_t numMaxGapMerges = numMerges - std::count_if(m_rangeGaps.begin(), m_rangeGaps.end(), [maxGap](const uint32_t gap) { return gap < maxGap; });
+
+    size_t lastRange = firstRange;
+    for (size_t rangeIndex = firstRange + 1; rangeIndex < ranges.size(); ++rangeIndex)
+    {
+        TlasInstanceRange& range = ranges[lastRange];
+        const uint32_t gap = ranges[rangeIndex].firstInstance - (range.firstInstance + range.numInstances);
+        if (gap < maxGap || (gap == maxGap && numMaxGapMerges > 0))
+        {
+            numMaxGapMerges -= (gap == maxGap) ? 1 : 0;
+            range.numInstances = ranges[rangeIndex].firstInstance + ranges[rangeIndex].numInstances - range.firstInstance;
+            continue;
+        }
+        ranges[++lastRange] = ranges[rangeIndex];
+    }
+    ranges.resize(lastRange + 1);
+}
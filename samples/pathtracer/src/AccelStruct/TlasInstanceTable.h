@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <nvrhi/nvrhi.h>
+
+// Instances of one upload, a range of the instance buffer
+struct TlasInstanceRange
+{
+    uint32_t firstInstance = 0;
+    uint32_t numInstances = 0;
+};
+
+// Changes since the last collectDirtyRanges, an instance can count in several
+struct TlasInstanceTableStats
+{
+    uint32_t numInstances = 0;
+    uint32_t numDirtyInstances = 0;
+    uint32_t numTransformChanges = 0;
+    uint32_t numMaskChanges = 0;
+    uint32_t numFlagChanges = 0;        // Instance flags, ID or hit group contribution
+    uint32_t numBlasChanges = 0;        // BLAS address, a new build or a compaction
+    uint32_t numRanges = 0;
+    uint32_t numUploadedInstances = 0;  // Dirty instances and the clean ones between them
+};
+
+// Instance descs of the TLAS as the instance buffer on the GPU holds them, one slot per scene instance. Setting an
+// instance compares it with the slot and marks the slot dirty when it changed, collecting the dirty ranges ends the
+// frame: only those are uploaded, and a frame without dirty instances and without BLAS changes needs no TLAS build.
+// BLAS are referenced by device address, an instance without a BLAS is inactive with address 0 and mask 0.
+// The owner marks the instances whose inputs changed where the change happens (a transform, a material, a BLAS or a
+// setting of the mask) and only sets those, so a frame costs the changed instances and not the scene.
+class TlasInstanceTable
+{
+public:
+    // Clean instances between two dirty ones that are uploaded with them instead of starting another range
+    static constexpr uint32_t kMaxRangeGap = 8;
+    // Ranges of one frame, beyond this the ranges with the smallest gaps between them are merged, as every range is a copy
+    static constexpr uint32_t kMaxRanges = 64;
+
+    // Instances added by growing the table are inactive, dirty and have changed inputs
+    void resize(const uint32_t instanceCount);
+    // Every instance is uploaded with the next ranges, for a new instance buffer
+    void invalidate();
+    void clear();
+
+    void setInstance(const uint32_t instanceIndex, const nvrhi::rt::InstanceDesc& instance);
+
+    void markInputChanged(const uint32_t instanceIndex);
+    void markAllInputsChanged();
+    // Appends the instances marked since the last call in no particular order and clears the marks
+    void collectChangedInputs(std::vector<uint32_t>& instances);
+
+    // Appends the dirty ranges in instance order and clears the dirty state and the statistics of the frame
+    void collectDirtyRanges(std::vector<TlasInstanceRange>& ranges);
+
+    inline bool isDirty() const { return !m_dirtyInstances.empty(); }
+    inline uint32_t getInstanceCount() const { return (uint32_t)m_instances.size(); }
+    inline const nvrhi::rt::InstanceDesc* getInstances() const { return m_instances.data(); }
+    // Statistics of the last collectDirtyRanges
+    inline const TlasInstanceTableStats& getStats() const { return m_stats; }
+
+private:
+    void markDirty(const uint32_t instanceIndex);
+    void mergeRanges(std::vector<TlasInstanceRange>& ranges, const size_t firstRange, const uint32_t maxRanges);
+
+    std::vector<nvrhi::rt::InstanceDesc> m_instances;
+    std::vector<uint8_t> m_isDirty;
+    std::vector<uint32_t> m_dirtyInstances;
+    std::vector<uint32_t> m_rangeGaps;
+    std::vector<uint8_t> m_isInputChanged;
+    std::vector<uint32_t> m_changedInputs;
+    bool m_isAllInputsChanged = false;
+    TlasInstanceTableStats m_frameStats;
+    TlasInstanceTableStats m_stats;
+};
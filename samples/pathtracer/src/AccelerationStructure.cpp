@@ -8,18 +8,21 @@
  * license agreement from NVIDIA CORPORATION is strictly prohibited.
  */
 
+#include <algorithm>
 #include <nvrhi/utils.h>
 #include <donut/app/ApplicationBase.h>
 
 #include "Ui/PathtracerUi.h"
 #include "SampleScene.h"
 #include "AccelerationStructure.h"
+#include "Curve/MorphTargetRefitEstimator.h"
 #include "ScopeMarker.h"
 
-AccelerationStructure::AccelerationStructure(nvrhi::IDevice* const device, std::shared_ptr<SampleScene> scene, UIData& ui)
+AccelerationStructure::AccelerationStructure(nvrhi::IDevice* const device, std::shared_ptr<SampleScene> scene, UIData& ui, const uint32_t framesInFlight)
     : m_device(device)
     , m_scene(scene)
     , m_ui(ui)
+    , m_framesInFlight(framesInFlight)
 {
 }
 
@@ -28,7 +31,8 @@ void GetMeshBlasDesc(
     nvrhi::rt::AccelStructDesc& blasDesc,
     const bool skipTransmissiveMaterials,
     const uint32_t frameIndex,
-    const bool isUpdate)
+    const bool isUpdate,
+    const bool compactAnimatedBlas)
 {
     using namespace donut::math;
 
@@ -61,13 +65,17 @@ void GetMeshBlasDesc(
         else
         {
             auto& lss = geometryDesc.geometryData.lss;
-            // TODO: Add support for for implicit successive indexing format
-            // Until then, the index buffer related fields can stay at default values
-            //lss.indexBuffer = mesh.buffers->indexBuffer;
-            //lss.indexOffset = (mesh.indexOffset + geometry->indexOffsetInMesh) * sizeof(uint32_t);
-            //lss.indexFormat = geometry->numIndices > 0 ? nvrhi::Format::R32_UINT : nvrhi::Format::UNKNOWN;
-            //lss.indexStride = sizeof(uint32_t);
-            //lss.indexCount = geometry->numIndices;
+            // Successive implicit geometries index the first vertex of every segment, the segment ends at the next vertex.
+            // List geometries have no index buffer and store 2 vertices per segment.
+            const bool isSuccessiveImplicit = geometry->numIndices > 0;
+            if (isSuccessiveImplicit)
+            {
+                lss.indexBuffer = mesh.buffers->indexBuffer;
+                lss.indexOffset = (mesh.indexOffset + geometry->indexOffsetInMesh) * sizeof(uint32_t);
+                lss.indexFormat = nvrhi::Format::R32_UINT;
+                lss.indexStride = sizeof(uint32_t);
+                lss.indexCount = geometry->numIndices;
+            }
             lss.vertexBuffer = mesh.buffers->vertexBuffer;
             lss.vertexPositionOffset = (mesh.vertexOffset + geometry->vertexOffsetInMesh) * sizeof(float3) +
                 mesh.buffers->getVertexBufferRange(donut::engine::VertexAttribute::Position).byteOffset;
@@ -77,9 +85,12 @@ void GetMeshBlasDesc(
                 mesh.buffers->getVertexBufferRange(donut::engine::VertexAttribute::CurveRadius).byteOffset;
             lss.vertexRadiusFormat = nvrhi::Format::R32_FLOAT;
             lss.vertexRadiusStride = sizeof(float);
-            lss.primitiveCount = geometry->numVertices / 2;
+            lss.primitiveCount = isSuccessiveImplicit ? geometry->numIndices : geometry->numVertices / 2;
             lss.vertexCount = geometry->numVertices;
-            lss.primitiveFormat = nvrhi::rt::GeometryLssPrimitiveFormat::List;
+            lss.primitiveFormat = isSuccessiveImplicit ?
+                nvrhi::rt::GeometryLssPrimitiveFormat::SuccessiveImplicit : nvrhi::rt::GeometryLssPrimitiveFormat::List;
+            // No endcaps in either format, so both encodings produce the same swept surface.
+            // Chained endcaps would only add sphere caps at the ends of the successive chains.
             lss.endcapMode = nvrhi::rt::GeometryLssEndcapMode::None;
             geometryDesc.geometryType = nvrhi::rt::GeometryType::Lss;
         }
@@ -104,6 +115,12 @@ void GetMeshBlasDesc(
             blasDesc.buildFlags = nvrhi::rt::AccelStructBuildFlags::AllowUpdate
                 | nvrhi::rt::AccelStructBuildFlags::PreferFastTrace;
         }
+
+        // A refit must use the flags of the build, the compacted copy keeps AllowUpdate
+        if (compactAnimatedBlas)
+        {
+            blasDesc.buildFlags = blasDesc.buildFlags | nvrhi::rt::AccelStructBuildFlags::AllowCompaction;
+        }
     }
     else if (mesh.skinPrototype)
     {
@@ -115,40 +132,161 @@ void GetMeshBlasDesc(
     }
 }
 
+static uint32_t GetBlasPrimitiveCount(const nvrhi::rt::AccelStructDesc& blasDesc)
+{
+    uint32_t primitiveCount = 0;
+    for (const auto& geometryDesc : blasDesc.bottomLevelGeometries)
+    {
+        if (geometryDesc.geometryType == nvrhi::rt::GeometryType::Lss)
+        {
+            primitiveCount += geometryDesc.geometryData.lss.primitiveCount;
+        }
+        else
+        {
+            const auto& triangles = geometryDesc.geometryData.triangles;
+            primitiveCount += (triangles.indexBuffer ? triangles.indexCount : triangles.vertexCount) / 3;
+        }
+    }
+    return primitiveCount;
+}
+
+static uint64_t GetBlasKey(const donut::engine::MeshInfo& mesh)
+{
+    return (uint64_t)(uintptr_t)&mesh;
+}
+
+void AccelerationStructure::SetCompactAnimatedBlas(const bool compactAnimatedBlas)
+{
+    if (m_compactAnimatedBlas == compactAnimatedBlas)
+    {
+        return;
+    }
+
+    m_compactAnimatedBlas = compactAnimatedBlas;
+    for (const auto& mesh : m_scene->GetNativeScene()->GetSceneGraph()->GetMeshes())
+    {
+        if (mesh->isMorphTargetAnimationMesh)
+        {
+            RequestBlasRebuild(mesh.get());
+        }
+    }
+}
+
+float AccelerationStructure::GetMeshSurfaceArea(const donut::engine::MeshInfo& mesh)
+{
+    const auto keyframePosition = m_keyframePositions.find(&mesh);
+    if (keyframePosition == m_keyframePositions.end())
+    {
+        return 0.0f;
+    }
+
+    auto keyframeSurfaceAreas = m_keyframeSurfaceAreas.find(&mesh);
+    if (keyframeSurfaceAreas == m_keyframeSurfaceAreas.end())
+    {
+        keyframeSurfaceAreas = m_keyframeSurfaceAreas.emplace(&mesh, MorphTargetRefitEstimator::computeKeyframeSurfaceAreas(
+            m_scene->GetCurveTessellation()->GetCurvesLineSegments(mesh.name),
+            mesh.buffers->morphTargetData,
+            mesh.buffers->morphTargetBufferRange)).first;
+    }
+    return MorphTargetRefitEstimator::getSurfaceArea(keyframeSurfaceAreas->second, keyframePosition->second);
+}
+
+void AccelerationStructure::EnqueueBlasBuild(const std::shared_ptr<donut::engine::MeshInfo>& mesh, const nvrhi::rt::AccelStructDesc& blasDesc, const uint32_t priority)
+{
+    BlasBuildRequest request;
+    request.key = GetBlasKey(*mesh);
+    request.primitiveCount = GetBlasPrimitiveCount(blasDesc);
+    request.scratchBytes = BlasBuildScheduler::estimateScratchBytes(request.primitiveCount);
+    request.priority = priority;
+    m_blasBuildScheduler.enqueue(request);
+    m_pendingBlasMeshes[request.key] = mesh;
+}
+
 void AccelerationStructure::CreateAccelerationStructures(nvrhi::CommandListHandle commandList, const uint32_t frameIndex)
 {
     assert(!m_rebuildAS || !m_updateAS);
 
     ScopedMarker scopedMarker(commandList, "BLAS Updates");
 
+    m_blasCompaction.beginFrame();
+
+    BlasRefitPolicySettings refitPolicySettings;
+    refitPolicySettings.maxSurfaceAreaGrowth = std::max(m_ui.animatedBlasMaxGrowth, 0.0f);
+    refitPolicySettings.maxRefits = (uint32_t)std::max(m_ui.animatedBlasRebuildInterval, 0);
+    refitPolicySettings.maxRebuildsPerFrame = (uint32_t)std::max(m_ui.animatedBlasRebuildsPerFrame, 0);
+    m_blasRefitPolicy.setSettings(refitPolicySettings);
+    m_blasRefitPolicy.beginFrame();
+    m_refitBlasMeshes.clear();
+
     for (const auto& mesh : m_scene->GetNativeScene()->GetSceneGraph()->GetMeshes())
     {
-        if ((m_updateAS && !mesh->isMorphTargetAnimationMesh) ||
+        const bool isRebuildRequested = m_blasRebuildRequests.find(mesh.get()) != m_blasRebuildRequests.end();
+        if ((m_updateAS && !mesh->isMorphTargetAnimationMesh && !isRebuildRequested) ||
+            (!m_rebuildAS && !m_updateAS && !isRebuildRequested) ||
             mesh->buffers->hasAttribute(donut::engine::VertexAttribute::JointWeights))
         {
             // skip when:
             // 1. The skinning prototypes
             // 2. Static Mesh request update
+            // 3. Mesh not requested by a per mesh rebuild
             continue;
         }
 
+        const bool isUpdate = m_updateAS && !isRebuildRequested;
         nvrhi::rt::AccelStructDesc blasDesc;
-        GetMeshBlasDesc(*mesh, blasDesc, !m_ui.enableTransmission, frameIndex, m_updateAS);
+        GetMeshBlasDesc(*mesh, blasDesc, !m_ui.enableTransmission, frameIndex, isUpdate, m_compactAnimatedBlas);
 
-        if (m_rebuildAS || !mesh->isMorphTargetAnimationMesh || !mesh->accelStruct)
+        const uint64_t blasKey = GetBlasKey(*mesh);
+        if (m_rebuildAS || isRebuildRequested || !mesh->isMorphTargetAnimationMesh || !mesh->accelStruct)
         {
-            const nvrhi::rt::AccelStructHandle accelStruct = m_device->createAccelStruct(blasDesc);
-            if (!mesh->skinPrototype)
+            // Skinned meshes are built with the TLAS every frame
+            if (mesh->skinPrototype)
+            {
+                mesh->accelStruct = m_device->createAccelStruct(blasDesc);
+                MarkTlasInstancesChanged(*mesh);
+                continue;
+            }
+
+            // A full rebuild changes the geometry, the mesh leaves the TLAS until its new BLAS is built.
+            // A per mesh rebuild keeps tracing the previous BLAS meanwhile, but no longer refits it.
+            if (m_rebuildAS)
             {
-                nvrhi::utils::BuildBottomLevelAccelStruct(commandList, accelStruct, blasDesc);
+                mesh->accelStruct = nullptr;
+                MarkTlasInstancesChanged(*mesh);
             }
-            mesh->accelStruct = accelStruct;
+            m_blasCompaction.invalidate(blasKey);
+
+            EnqueueBlasBuild(mesh, blasDesc, isRebuildRequested ? 1 : 0);
         }
-        else
+        else if (!m_blasBuildScheduler.isPending(blasKey) || m_blasCompaction.isRefittable(blasKey))
         {
+            // Refits aren't budgeted, a mesh with a pending build picks up its vertices when it is built.
+            // A BLAS waiting for its rebuild is still refit until then.
             nvrhi::utils::BuildBottomLevelAccelStruct(commandList, mesh->accelStruct, blasDesc);
+            m_blasCompaction.onRefit(blasKey);
+            m_isBlasChanged = true;
+
+            // A rebuild before the compaction of the last build would throw the compaction away
+            const bool canRebuild = !m_blasBuildScheduler.isPending(blasKey) && !m_blasCompaction.isCompactionPending(blasKey);
+            m_blasRefitPolicy.onRefit(blasKey, GetMeshSurfaceArea(*mesh), canRebuild);
+            m_refitBlasMeshes[blasKey] = mesh;
         }
     }
+    m_blasRebuildRequests.clear();
+
+    // The most degraded animated BLAS are rebuilt within the build budget, the others keep being refit meanwhile
+    m_blasRefitRebuilds.clear();
+    m_blasRefitPolicy.selectRebuilds(m_blasRefitRebuilds);
+    for (const uint64_t blasKey : m_blasRefitRebuilds)
+    {
+        const std::shared_ptr<donut::engine::MeshInfo>& mesh = m_refitBlasMeshes[blasKey];
+        nvrhi::rt::AccelStructDesc blasDesc;
+        GetMeshBlasDesc(*mesh, blasDesc, !m_ui.enableTransmission, frameIndex, false, m_compactAnimatedBlas);
+        m_blasCompaction.requestRebuild(blasKey);
+        EnqueueBlasBuild(mesh, blasDesc, 0);
+    }
+
+    BuildScheduledBlas(commandList, frameIndex);
 
     size_t tlasInstanceCount = m_scene->GetNativeScene()->GetSceneGraph()->GetMeshInstances().size();
 
@@ -159,41 +297,84 @@ void AccelerationStructure::CreateAccelerationStructures(nvrhi::CommandListHandl
         tlasDesc.topLevelMaxInstances = tlasInstanceCount;
         tlasDesc.debugName = "Top Level Acceleration Struct";
         m_tlas = m_device->createAccelStruct(tlasDesc);
+        m_isTlasBuilt = false;
     }
 }
 
-void AccelerationStructure::BuildTLAS(nvrhi::CommandListHandle commandList)
+void AccelerationStructure::BuildScheduledBlas(nvrhi::CommandListHandle commandList, const uint32_t frameIndex)
 {
+    constexpr uint64_t kBytesPerMB = 1024 * 1024;
+
+    BlasBuildBudget budget;
+    budget.maxScratchBytes = (uint64_t)std::max(m_ui.blasBuildEstimatedScratchBudgetMB, 0) * kBytesPerMB;
+    budget.maxPrimitives = (uint32_t)std::max(m_ui.blasBuildPrimitiveBudget, 0);
+    m_blasBuildScheduler.setBudget(budget);
+
+    m_scheduledBlasBuilds.clear();
+    m_blasBuildScheduler.schedule(m_scheduledBlasBuilds);
+    for (const auto& build : m_scheduledBlasBuilds)
     {
-        ScopedMarker scopedMarker(commandList, "Skinned BLAS Updates");
+        const auto it = m_pendingBlasMeshes.find(build.key);
+        assert(it != m_pendingBlasMeshes.end());
+        const std::shared_ptr<donut::engine::MeshInfo> mesh = it->second;
+        m_pendingBlasMeshes.erase(it);
 
-        // Transition all the buffers to their necessary states before building the BLAS'es to allow BLAS batching
-        for (const auto& skinnedInstance : m_scene->GetNativeScene()->GetSceneGraph()->GetSkinnedMeshInstances())
+        // The buffers of the mesh may have changed since the request
+        nvrhi::rt::AccelStructDesc blasDesc;
+        GetMeshBlasDesc(*mesh, blasDesc, !m_ui.enableTransmission, frameIndex, false, m_compactAnimatedBlas);
+        const nvrhi::rt::AccelStructHandle accelStruct = m_device->createAccelStruct(blasDesc);
+        nvrhi::utils::BuildBottomLevelAccelStruct(commandList, accelStruct, blasDesc);
+        mesh->accelStruct = accelStruct;
+        MarkTlasInstancesChanged(*mesh);
+        m_isBlasChanged = true;
+
+        const bool isCompactable = (blasDesc.buildFlags & nvrhi::rt::AccelStructBuildFlags::AllowCompaction) != 0;
+        m_blasCompaction.onBuilt(build.key, m_device->getAccelStructMemoryRequirements(accelStruct).size, isCompactable);
+        if (mesh->isMorphTargetAnimationMesh)
         {
-            commandList->setAccelStructState(skinnedInstance->GetMesh()->accelStruct, nvrhi::ResourceStates::AccelStructWrite);
-            commandList->setBufferState(skinnedInstance->GetMesh()->buffers->vertexBuffer, nvrhi::ResourceStates::AccelStructBuildInput);
+            m_blasRefitPolicy.onBuilt(build.key, GetMeshSurfaceArea(*mesh));
         }
-        commandList->commitBarriers();
+    }
+}
 
-        // Build BLAS instances
-        for (const auto& skinnedInstance : m_scene->GetNativeScene()->GetSceneGraph()->GetSkinnedMeshInstances())
+void AccelerationStructure::UpdateBlasCompaction()
+{
+    // nvrhi compacts a BLAS in place once its build completed on the GPU, the handle stays the same
+    for (const auto& mesh : m_scene->GetNativeScene()->GetSceneGraph()->GetMeshes())
+    {
+        const uint64_t blasKey = GetBlasKey(*mesh);
+        if (mesh->accelStruct && m_blasCompaction.getState(blasKey) == BlasCompactionState::Built && mesh->accelStruct->isCompacted())
         {
-            nvrhi::rt::AccelStructDesc blasDesc;
-            blasDesc.debugName = "Bottom Level Acceleration Struct";
-            GetMeshBlasDesc(*skinnedInstance->GetMesh(), blasDesc, !m_ui.enableTransmission, 0, false);
+            m_blasCompaction.onCompacted(blasKey, m_device->getAccelStructMemoryRequirements(mesh->accelStruct).size);
+            // The compacted copy has a new address
+            MarkTlasInstancesChanged(*mesh);
+        }
+    }
+}
 
-            nvrhi::utils::BuildBottomLevelAccelStruct(commandList, skinnedInstance->GetMesh()->accelStruct, blasDesc);
+void AccelerationStructure::GetBlasMemoryReport(std::vector<BlasMemoryReportEntry>& report) const
+{
+    for (const auto& mesh : m_scene->GetNativeScene()->GetSceneGraph()->GetMeshes())
+    {
+        const BlasCompactionTracker::Entry* const entry = m_blasCompaction.getEntry(GetBlasKey(*mesh));
+        if (entry)
+        {
+            report.push_back({ mesh->name, *entry });
         }
     }
+}
 
-    std::vector<nvrhi::rt::InstanceDesc> instances;
-    for (const auto& instance : m_scene->GetNativeScene()->GetSceneGraph()->GetMeshInstances())
+nvrhi::rt::InstanceDesc AccelerationStructure::GetTlasInstanceDesc(const donut::engine::MeshInstance& instance) const
+{
+    nvrhi::rt::InstanceDesc instanceDesc;
+    instanceDesc.instanceID = instance.GetInstanceIndex();
+
+    // Meshes whose BLAS is still waiting for its build aren't traceable yet, their instance stays inactive
+    if (instance.GetMesh()->accelStruct)
     {
-        nvrhi::rt::InstanceDesc instanceDesc;
-        instanceDesc.bottomLevelAS = instance->GetMesh()->accelStruct;
-        assert(instanceDesc.bottomLevelAS);
-        const float3& emissiveColor = instance->GetMesh()->geometries[0]->material->emissiveColor;
-        const float roughness = instance->GetMesh()->geometries[0]->material->roughness;
+        instanceDesc.blasDeviceAddress = instance.GetMesh()->accelStruct->getDeviceAddress();
+        const float3& emissiveColor = instance.GetMesh()->geometries[0]->material->emissiveColor;
+        const float roughness = instance.GetMesh()->geometries[0]->material->roughness;
         if (roughness == 0)
         {
             instanceDesc.instanceMask = 4;
@@ -206,23 +387,180 @@ void AccelerationStructure::BuildTLAS(nvrhi::CommandListHandle commandList)
         {
             instanceDesc.instanceMask = 1;
         }
-        instanceDesc.instanceID = instance->GetInstanceIndex();
 
-        if (instance->GetMesh()->type == MeshType::CurveDisjointOrthogonalTriangleStrips)
+        if (instance.GetMesh()->type == MeshType::CurveDisjointOrthogonalTriangleStrips)
         {
             instanceDesc.setFlags(nvrhi::rt::InstanceFlags::TriangleCullDisable);
         }
 
-        auto node = instance->GetNode();
+        auto node = instance.GetNode();
         assert(node);
         dm::affineToColumnMajor(node->GetLocalToWorldTransformFloat(), instanceDesc.transform);
+    }
+    return instanceDesc;
+}
+
+void AccelerationStructure::UpdateTlasInstanceSources()
+{
+    const auto& sceneGraph = m_scene->GetNativeScene()->GetSceneGraph();
+
+    // Materials only change with a scene load, which rebuilds the AS and finds the sources again
+    std::unordered_set<const donut::engine::SceneGraphNode*> animatedNodes;
+    for (const auto& animation : sceneGraph->GetAnimations())
+    {
+        for (const auto& channel : animation->GetChannels())
+        {
+            const auto targetNode = channel->GetTargetNode();
+            if (targetNode)
+            {
+                animatedNodes.insert(targetNode.get());
+            }
+        }
+    }
+
+    m_meshTlasInstances.clear();
+    m_animatedTlasInstances.clear();
+    const auto& meshInstances = sceneGraph->GetMeshInstances();
+    for (uint32_t instanceIndex = 0; instanceIndex < meshInstances.size(); ++instanceIndex)
+    {
+        const auto& instance = meshInstances[instanceIndex];
+        m_meshTlasInstances[instance->GetMesh().get()].push_back(instanceIndex);
+        for (const donut::engine::SceneGraphNode* node = instance->GetNode(); node; node = node->GetParent())
+        {
+            if (animatedNodes.find(node) != animatedNodes.end())
+            {
+                m_animatedTlasInstances.push_back(instanceIndex);
+                break;
+            }
+        }
+    }
+
+    m_tlasInstances.resize((uint32_t)meshInstances.size());
+    m_tlasInstances.markAllInputsChanged();
+    m_tlasShowEmissiveSurfaces = m_ui.showEmissiveSurfaces;
+    m_isTlasInstanceSourcesValid = true;
+}
+
+void AccelerationStructure::MarkTlasInstancesChanged(const donut::engine::MeshInfo& mesh)
+{
+    const auto it = m_meshTlasInstances.find(&mesh);
+    if (it != m_meshTlasInstances.end())
+    {
+        for (const uint32_t instanceIndex : it->second)
+        {
+            m_tlasInstances.markInputChanged(instanceIndex);
+        }
+    }
+}
+
+void AccelerationStructure::MarkAnimatedTlasInstancesChanged()
+{
+    for (const uint32_t instanceIndex : m_animatedTlasInstances)
+    {
+        m_tlasInstances.markInputChanged(instanceIndex);
+    }
+}
+
+void AccelerationStructure::BuildTLAS(nvrhi::CommandListHandle commandList)
+{
+    {
+        ScopedMarker scopedMarker(commandList, "Skinned BLAS Updates");
+
+        // Transition all the buffers to their necessary states before building the BLAS'es to allow BLAS batching
+        for (const auto& skinnedInstance : m_scene->GetNativeScene()->GetSceneGraph()->GetSkinnedMeshInstances())
+        {
+            commandList->setAccelStructState(skinnedInstance->GetMesh()->accelStruct, nvrhi::ResourceStates::AccelStructWrite);
+            commandList->setBufferState(skinnedInstance->GetMesh()->buffers->vertexBuffer, nvrhi::ResourceStates::AccelStructBuildInput);
+        }
+        commandList->commitBarriers();
 
-        instances.push_back(instanceDesc);
+        // Build BLAS instances
+        for (const auto& skinnedInstance : m_scene->GetNativeScene()->GetSceneGraph()->GetSkinnedMeshInstances())
+        {
+            nvrhi::rt::AccelStructDesc blasDesc;
+            blasDesc.debugName = "Bottom Level Acceleration Struct";
+            GetMeshBlasDesc(*skinnedInstance->GetMesh(), blasDesc, !m_ui.enableTransmission, 0, false, false);
+
+            nvrhi::utils::BuildBottomLevelAccelStruct(commandList, skinnedInstance->GetMesh()->accelStruct, blasDesc);
+            m_isBlasChanged = true;
+        }
     }
 
-    // Compact acceleration structures that are tagged for compaction and have finished executing the original build
+    // Compact acceleration structures that are tagged for compaction and have finished executing the original build.
+    // A compacted BLAS has a new address, so this comes before the instances.
     commandList->compactBottomLevelAccelStructs();
+    UpdateBlasCompaction();
+
+    // Only the instances marked where their inputs changed are set again
+    const auto& meshInstances = m_scene->GetNativeScene()->GetSceneGraph()->GetMeshInstances();
+    if (!m_isTlasInstanceSourcesValid || meshInstances.size() != m_tlasInstances.getInstanceCount())
+    {
+        UpdateTlasInstanceSources();
+    }
+    if (m_tlasShowEmissiveSurfaces != m_ui.showEmissiveSurfaces)
+    {
+        // The mask of the emissive instances
+        m_tlasShowEmissiveSurfaces = m_ui.showEmissiveSurfaces;
+        m_tlasInstances.markAllInputsChanged();
+    }
+
+    m_changedTlasInstances.clear();
+    m_tlasInstances.collectChangedInputs(m_changedTlasInstances);
+    for (const uint32_t instanceIndex : m_changedTlasInstances)
+    {
+        m_tlasInstances.setInstance(instanceIndex, GetTlasInstanceDesc(*meshInstances[instanceIndex]));
+    }
+
+    const uint32_t instanceCount = m_tlasInstances.getInstanceCount();
+    if (!m_tlasInstanceBuffer || m_tlasInstanceBuffer->getDesc().byteSize < instanceCount * sizeof(nvrhi::rt::InstanceDesc))
+    {
+        nvrhi::BufferDesc instanceBufferDesc;
+        instanceBufferDesc.byteSize = (uint64_t)std::max(instanceCount, 1u) * sizeof(nvrhi::rt::InstanceDesc);
+        instanceBufferDesc.debugName = "TLAS Instances";
+        instanceBufferDesc.isAccelStructBuildInput = true;
+        instanceBufferDesc.initialState = nvrhi::ResourceStates::AccelStructBuildInput;
+        instanceBufferDesc.keepInitialState = true;
+        m_tlasInstanceBuffer = m_device->createBuffer(instanceBufferDesc);
+        m_tlasInstances.invalidate();
+    }
+
+    m_tlasInstanceRanges.clear();
+    m_tlasInstances.collectDirtyRanges(m_tlasInstanceRanges);
+
+    // The last TLAS still matches its instances and BLAS
+    m_isTlasBuildSkipped = m_isTlasBuilt && !m_isBlasChanged && m_tlasInstanceRanges.empty();
+    if (m_isTlasBuildSkipped)
+    {
+        return;
+    }
 
     ScopedMarker scopedMarker(commandList, "TLAS Update");
-    commandList->buildTopLevelAccelStruct(m_tlas, instances.data(), instances.size());
+
+    for (const TlasInstanceRange& range : m_tlasInstanceRanges)
+    {
+        commandList->writeBuffer(m_tlasInstanceBuffer, m_tlasInstances.getInstances() + range.firstInstance,
+                                 range.numInstances * sizeof(nvrhi::rt::InstanceDesc), range.firstInstance * sizeof(nvrhi::rt::InstanceDesc));
+    }
+
+    // Without instance descs nvrhi neither orders the BLAS builds before the TLAS build nor keeps the BLAS alive.
+    // The BLAS of a TLAS build are kept until as many builds as frames in flight followed it.
+    std::vector<nvrhi::rt::AccelStructHandle> blasReferences;
+    for (const auto& mesh : m_scene->GetNativeScene()->GetSceneGraph()->GetMeshes())
+    {
+        if (mesh->accelStruct)
+        {
+            commandList->setAccelStructState(mesh->accelStruct, nvrhi::ResourceStates::AccelStructBuildBlas);
+            blasReferences.push_back(mesh->accelStruct);
+        }
+    }
+    commandList->commitBarriers();
+    m_tlasBlasReferences.push_back(std::move(blasReferences));
+    while (m_tlasBlasReferences.size() > m_framesInFlight + 1)
+    {
+        m_tlasBlasReferences.pop_front();
+    }
+
+    commandList->buildTopLevelAccelStructFromBuffer(m_tlas, m_tlasInstanceBuffer, 0, instanceCount);
+    m_isTlasBuilt = true;
+    m_isBlasChanged = false;
 }
@@ -8,26 +8,60 @@
  * license agreement from NVIDIA CORPORATION is strictly prohibited.
  */
 
+#include <deque>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include <nvrhi/nvrhi.h>
 
+#include "AccelStruct/BlasBuildScheduler.h"
+#include "AccelStruct/BlasCompactionTracker.h"
+#include "AccelStruct/BlasRefitPolicy.h"
+#include "AccelStruct/TlasInstanceTable.h"
+
+namespace donut::engine
+{
+    struct MeshInfo;
+    class MeshInstance;
+    class SceneGraphNode;
+}
 class SampleScene;
 struct UIData;
 
+struct BlasMemoryReportEntry
+{
+    std::string meshName;
+    BlasCompactionTracker::Entry blas;
+};
+
 class AccelerationStructure
 {
 public:
-    AccelerationStructure(nvrhi::IDevice* const device, std::shared_ptr<SampleScene> scene, UIData& ui);
+    AccelerationStructure(nvrhi::IDevice* const device, std::shared_ptr<SampleScene> scene, UIData& ui, const uint32_t framesInFlight);
     ~AccelerationStructure() = default;
 
     void CreateAccelerationStructures(nvrhi::CommandListHandle commandList, const uint32_t frameIndex);
     void BuildTLAS(nvrhi::CommandListHandle commandList);
 
-    // Force rebuild the AS, ignore the update AS commands
+    // Force rebuild the AS, ignore the update AS commands. The BLAS builds still pending are dropped, every mesh is requested again.
     inline void SetRebuildAS(const bool rebuildAS)
     {
         m_rebuildAS = rebuildAS;
         m_updateAS = false;
+        if (rebuildAS)
+        {
+            m_blasBuildScheduler.clear();
+            m_pendingBlasMeshes.clear();
+            m_blasCompaction.clear();
+            m_blasRefitPolicy.clear();
+            m_keyframeSurfaceAreas.clear();
+            m_keyframePositions.clear();
+            m_meshTlasInstances.clear();
+            m_animatedTlasInstances.clear();
+            m_isTlasInstanceSourcesValid = false;
+        }
     }
 
     inline void SetUpdateAS(const bool updateAS)
@@ -36,12 +70,63 @@ public:
         m_updateAS = !m_rebuildAS ? updateAS : false;
     }
 
+    // Rebuilds only this mesh's BLAS with the next AS build, for meshes whose vertices changed in place
+    inline void RequestBlasRebuild(const donut::engine::MeshInfo* mesh)
+    {
+        m_blasRebuildRequests.insert(mesh);
+        m_keyframeSurfaceAreas.erase(mesh);
+    }
+
+    // Keyframe positions of the morph target animated meshes in their vertex buffers, by the last morph target dispatch.
+    // Animated BLAS are rebuilt instead of refit when the bounds estimated for the pose grew too much since their build.
+    inline void SetMorphTargetKeyframePositions(const std::unordered_map<const donut::engine::MeshInfo*, float>& keyframePositions)
+    {
+        m_keyframePositions = keyframePositions;
+    }
+
     inline void ClearTLAS() { m_tlas = nullptr; }
 
+    // The TLAS instances persist in a buffer that only gets the instances that changed, and the TLAS is only rebuilt
+    // when an instance or a BLAS changed
+    inline const TlasInstanceTableStats& GetTlasInstanceStats() const { return m_tlasInstances.getStats(); }
+    // Instances below an animated node have new transforms after the scene graph refresh, the next TLAS build sets them
+    void MarkAnimatedTlasInstancesChanged();
+    inline const bool IsTlasBuildSkipped() const { return m_isTlasBuildSkipped; }
+
+    // Morph target animated BLAS are built with AllowCompaction, compacted once their build completed and then refit
+    // in their compacted copy. Switching rebuilds every animated BLAS, the refits must use the flags of the build.
+    void SetCompactAnimatedBlas(const bool compactAnimatedBlas);
+    inline const bool IsCompactingAnimatedBlas() const { return m_compactAnimatedBlas; }
+
     inline const nvrhi::rt::AccelStructHandle GetTLAS() const { return m_tlas; }
     inline const bool IsRebuildAS() const { return m_rebuildAS; }
     inline const bool IsUpdateAS() const { return m_updateAS; }
+    inline const bool IsBlasRebuildRequested() const { return !m_blasRebuildRequests.empty(); }
+    // Compactions happen with the TLAS build, which also picks up the new addresses of the compacted BLAS
+    inline const bool HasPendingBlasCompactions() const { return m_blasCompaction.hasPendingCompactions(); }
+    // BLAS builds are spread over frames within the BLAS build budget of the UI, a mesh is left out of the TLAS until
+    // its BLAS is built. Refits of animated meshes aren't budgeted.
+    inline const bool HasPendingBlasBuilds() const { return m_blasBuildScheduler.getPendingCount() > 0; }
+    inline const BlasBuildScheduler::FrameStats& GetBlasBuildStats() const { return m_blasBuildScheduler.getFrameStats(); }
+
+    // Sizes of every BLAS as built and after its compaction, skinned BLAS aren't tracked
+    inline BlasCompactionMemoryStats GetBlasMemoryStats() const { return m_blasCompaction.getMemoryStats(); }
+    void GetBlasMemoryReport(std::vector<BlasMemoryReportEntry>& report) const;
+
+    inline const BlasRefitCounters& GetBlasRefitFrameCounters() const { return m_blasRefitPolicy.getFrameCounters(); }
+    inline const BlasRefitCounters& GetBlasRefitTotalCounters() const { return m_blasRefitPolicy.getTotalCounters(); }
 private:
+    void EnqueueBlasBuild(const std::shared_ptr<donut::engine::MeshInfo>& mesh, const nvrhi::rt::AccelStructDesc& blasDesc, const uint32_t priority);
+    void UpdateBlasCompaction();
+    // Estimated surface area of the mesh in its vertex buffers, 0 without an estimate
+    float GetMeshSurfaceArea(const donut::engine::MeshInfo& mesh);
+    void BuildScheduledBlas(nvrhi::CommandListHandle commandList, const uint32_t frameIndex);
+    nvrhi::rt::InstanceDesc GetTlasInstanceDesc(const donut::engine::MeshInstance& instance) const;
+    // Finds the instances of every mesh and the animated ones, every instance is set with the next TLAS build
+    void UpdateTlasInstanceSources();
+    // A new BLAS address of the mesh
+    void MarkTlasInstancesChanged(const donut::engine::MeshInfo& mesh);
+
     nvrhi::IDevice* const m_device;
 
     std::shared_ptr<SampleScene> m_scene;
@@ -49,6 +134,40 @@ private:
     nvrhi::rt::AccelStructHandle m_tlas;
     bool m_rebuildAS;
     bool m_updateAS;
+    std::unordered_set<const donut::engine::MeshInfo*> m_blasRebuildRequests;
+
+    BlasBuildScheduler m_blasBuildScheduler;
+    // Meshes of the pending builds by scheduler key
+    std::unordered_map<uint64_t, std::shared_ptr<donut::engine::MeshInfo>> m_pendingBlasMeshes;
+    std::vector<BlasBuildRequest> m_scheduledBlasBuilds;
+
+    BlasCompactionTracker m_blasCompaction;
+    bool m_compactAnimatedBlas = false;
+
+    BlasRefitPolicy m_blasRefitPolicy;
+    // Meshes refit this frame by key, the policy picks the ones to rebuild among them
+    std::unordered_map<uint64_t, std::shared_ptr<donut::engine::MeshInfo>> m_refitBlasMeshes;
+    std::vector<uint64_t> m_blasRefitRebuilds;
+    // Estimated surface area of every keyframe, computed when a mesh is first refit
+    std::unordered_map<const donut::engine::MeshInfo*, std::vector<float>> m_keyframeSurfaceAreas;
+    std::unordered_map<const donut::engine::MeshInfo*, float> m_keyframePositions;
+
+    TlasInstanceTable m_tlasInstances;
+    // Scene instances of every mesh and the ones below an animated node, found again after every AS rebuild
+    std::unordered_map<const donut::engine::MeshInfo*, std::vector<uint32_t>> m_meshTlasInstances;
+    std::vector<uint32_t> m_animatedTlasInstances;
+    bool m_isTlasInstanceSourcesValid = false;
+    bool m_tlasShowEmissiveSurfaces = false;
+    std::vector<uint32_t> m_changedTlasInstances;
+    nvrhi::BufferHandle m_tlasInstanceBuffer;
+    std::vector<TlasInstanceRange> m_tlasInstanceRanges;
+    // BLAS referenced by the last TLAS builds, the instance buffer holds addresses and nvrhi doesn't keep those BLAS alive
+    std::deque<std::vector<nvrhi::rt::AccelStructHandle>> m_tlasBlasReferences;
+    bool m_isTlasBuilt = false;
+    bool m_isBlasChanged = false;       // A BLAS was built or refit since the last TLAS build
+    bool m_isTlasBuildSkipped = false;
+
+    const uint32_t m_framesInFlight;
 
     UIData& m_ui;
 };
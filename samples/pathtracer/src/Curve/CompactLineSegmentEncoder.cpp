@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <limits>
+
+#include "CompactLineSegmentEncoder.h"
+
+namespace CompactLineSegmentEncoder
+{
+bool encode(
+    const std::vector<LineSegment>& lineSegments,
+    const std::vector<uint32_t>& geometrySegmentCounts,
+    std::vector<CompactLineSegment>& compactLineSegments,
+    std::vector<LineSegmentBounds>& lineSegmentBounds)
+{
+    for (const auto& segment : lineSegments)
+    {
+        if (segment.geometryIndex < 0 || (uint32_t)segment.geometryIndex > RTXCR_COMPACT_LINE_SEGMENT_MAX_STRAND_INDEX)
+        {
+            return false;
+        }
+    }
+
+    // Bounds index of every segment, geometries past the last bounds entry share it.
+    // Fall back to a single entry if the geometry segment counts don't describe the segments.
+    std::vector<uint32_t> segmentBoundsIndices(lineSegments.size(), 0);
+    uint32_t boundsCount = 1;
+    size_t totalGeometrySegmentCount = 0;
+    for (const uint32_t geometrySegmentCount : geometrySegmentCounts)
+    {
+        totalGeometrySegmentCount += geometrySegmentCount;
+    }
+    if (totalGeometrySegmentCount == lineSegments.size() && !geometrySegmentCounts.empty())
+    {
+        boundsCount = std::min((uint32_t)geometrySegmentCounts.size(), RTXCR_COMPACT_LINE_SEGMENT_MAX_BOUNDS_COUNT);
+        uint32_t segmentIndex = 0;
+        for (uint32_t geometryIndex = 0; geometryIndex < geometrySegmentCounts.size(); ++geometryIndex)
+        {
+            const uint32_t boundsIndex = std::min(geometryIndex, boundsCount - 1);
+            for (uint32_t i = 0; i < geometrySegmentCounts[geometryIndex]; ++i)
+            {
+                segmentBoundsIndices[segmentIndex++] = boundsIndex;
+            }
+        }
+    }
+
+    std::vector<float3> boundsMin(boundsCount, float3(std::numeric_limits<float>::max()));
+    std::vector<float3> boundsMax(boundsCount, float3(std::numeric_limits<float>::lowest()));
+    lineSegmentBounds.assign(boundsCount, LineSegmentBounds{});
+    for (size_t segmentIndex = 0; segmentIndex < lineSegments.size(); ++segmentIndex)
+    {
+        const auto& segment = lineSegments[segmentIndex];
+        const uint32_t boundsIndex = segmentBoundsIndices[segmentIndex];
+        boundsMin[boundsIndex] = min(boundsMin[boundsIndex], min(segment.point0, segment.point1));
+        boundsMax[boundsIndex] = max(boundsMax[boundsIndex], max(segment.point0, segment.point1));
+        lineSegmentBounds[boundsIndex].maxRadius = std::max(lineSegmentBounds[boundsIndex].maxRadius, std::max(segment.radius0, segment.radius1));
+    }
+    for (uint32_t boundsIndex = 0; boundsIndex < boundsCount; ++boundsIndex)
+    {
+        // Entries without segments only exist in a mesh with empty geometries, any value decodes nothing
+        const bool isEmpty = boundsMin[boundsIndex].x > boundsMax[boundsIndex].x;
+        lineSegmentBounds[boundsIndex].origin = isEmpty ? float3(0.0f) : boundsMin[boundsIndex];
+        lineSegmentBounds[boundsIndex].extent = isEmpty ? float3(0.0f) : boundsMax[boundsIndex] - boundsMin[boundsIndex];
+    }
+
+    compactLineSegments.resize(lineSegments.size());
+    for (size_t segmentIndex = 0; segmentIndex < lineSegments.size(); ++segmentIndex)
+    {
+        const uint32_t boundsIndex = segmentBoundsIndices[segmentIndex];
+        compactLineSegments[segmentIndex] = encodeLineSegment(lineSegments[segmentIndex], boundsIndex, lineSegmentBounds[boundsIndex]);
+    }
+
+    return true;
+}
+} // namespace CompactLineSegmentEncoder
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <donut/core/math/math.h>
+
+#include "lineSegmentEncoding.h"
+
+// CPU encoder of the compact line segment format of lineSegmentEncoding.h, with one quantization bounds entry per curve geometry
+namespace CompactLineSegmentEncoder
+{
+    // Encodes the line segments of one mesh. Geometries past the last bounds entry share it, a single entry is used
+    // if the geometry segment counts don't describe the segments.
+    // Returns false if a strand index doesn't fit into the compact format, the mesh keeps the full format then.
+    bool encode(
+        const std::vector<LineSegment>& lineSegments,
+        const std::vector<uint32_t>& geometrySegmentCounts,
+        std::vector<CompactLineSegment>& compactLineSegments,
+        std::vector<LineSegmentBounds>& lineSegmentBounds);
+}
@@ -0,0 +1,472 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <chrono>
+
+#include "CurveBvhEstimator.h"
+
+using namespace donut::math;
+
+namespace
+{
+    // Nodes above this size are split by all workers together, smaller ones become subtrees built on a single worker
+    constexpr uint32_t kSubtreePrimitives = 16 * 1024;
+    // Fixed chunking keeps the parallel binning reduction order, and with it the tree, independent of the thread count
+    constexpr uint32_t kPrimitivesPerChunk = 16 * 1024;
+
+    struct BuildNode
+    {
+        uint32_t begin = 0;
+        uint32_t end = 0;
+        uint32_t depth = 0;
+        box3 bounds = box3::empty();
+        box3 centroidBounds = box3::empty();
+    };
+
+    // Primitives are partitioned by value rather than through an index array, so the binning passes read them sequentially
+    struct PrimitiveReference
+    {
+        box3 bounds;
+        float3 centroid;
+        uint32_t primitiveIndex = 0;
+    };
+
+    struct Bin
+    {
+        box3 bounds = box3::empty();
+        box3 centroidBounds = box3::empty();
+        uint32_t count = 0;
+    };
+
+    using AxisBins = std::array<std::array<Bin, CurveBvhEstimator::kMaxBins>, 3>;
+
+    struct Split
+    {
+        uint32_t axis = 0;
+        uint32_t bin = 0; // Bins [0, bin] go left
+        float cost = 0.0f;
+        bool isValid = false;
+    };
+
+    // Tree statistics as areas, divided by the root area at the end
+    struct BuildTotals
+    {
+        double innerArea = 0.0;
+        double leafPrimitiveArea = 0.0;
+        double leafArea = 0.0;
+        double siblingOverlapArea = 0.0;
+        uint32_t numInnerNodes = 0;
+        uint32_t numLeaves = 0;
+        uint32_t numLeafPrimitives = 0;
+        uint32_t maxDepth = 0;
+
+        void add(const BuildTotals& other)
+        {
+            innerArea += other.innerArea;
+            leafPrimitiveArea += other.leafPrimitiveArea;
+            leafArea += other.leafArea;
+            siblingOverlapArea += other.siblingOverlapArea;
+            numInnerNodes += other.numInnerNodes;
+            numLeaves += other.numLeaves;
+            numLeafPrimitives += other.numLeafPrimitives;
+            maxDepth = std::max(maxDepth, other.maxDepth);
+        }
+    };
+
+    float getSurfaceArea(const box3& bounds)
+    {
+        if (bounds.isempty())
+        {
+            return 0.0f;
+        }
+        const float3 extent = bounds.diagonal();
+        return 2.0f * (extent.x * extent.y + extent.y * extent.z + extent.z * extent.x);
+    }
+
+    class BvhBuilder
+    {
+    public:
+        BvhBuilder(const std::vector<box3>& primitiveBounds, ThreadPool& threadPool, const CurveBvhSettings& settings)
+            : m_primitiveBounds(primitiveBounds)
+            , m_threadPool(threadPool)
+            , m_numBins(std::clamp(settings.numBins, 2u, CurveBvhEstimator::kMaxBins))
+            , m_maxLeafPrimitives(std::max(settings.maxLeafPrimitives, 1u))
+        {
+        }
+
+        BuildTotals build(box3& rootBounds)
+        {
+            const uint32_t numPrimitives = static_cast<uint32_t>(m_primitiveBounds.size());
+            m_primitives.resize(numPrimitives);
+
+            // Pass 1 (parallel): centroids and root bounds, reduced per chunk in chunk order
+            const uint32_t numChunks = (numPrimitives + kPrimitivesPerChunk - 1) / kPrimitivesPerChunk;
+            std::vector<BuildNode> chunkNodes(numChunks);
+            m_threadPool.ParallelFor(numChunks, [&](const uint32_t chunkIndex)
+            {
+                BuildNode& chunkNode = chunkNodes[chunkIndex];
+                const uint32_t chunkEnd = std::min((chunkIndex + 1) * kPrimitivesPerChunk, numPrimitives);
+                for (uint32_t primitiveIndex = chunkIndex * kPrimitivesPerChunk; primitiveIndex < chunkEnd; ++primitiveIndex)
+                {
+                    PrimitiveReference& primitive = m_primitives[primitiveIndex];
+                    primitive.bounds = m_primitiveBounds[primitiveIndex];
+                    primitive.centroid = primitive.bounds.center();
+                    primitive.primitiveIndex = primitiveIndex;
+                    chunkNode.bounds |= primitive.bounds;
+                    chunkNode.centroidBounds |= primitive.centroid;
+                }
+            });
+
+            BuildNode root;
+            root.end = numPrimitives;
+            for (const BuildNode& chunkNode : chunkNodes)
+            {
+                root.bounds |= chunkNode.bounds;
+                root.centroidBounds |= chunkNode.centroidBounds;
+            }
+            rootBounds = root.bounds;
+
+            // Pass 2 (serial over nodes, parallel within a node): split the top levels until every node fits a subtree
+            BuildTotals totals;
+            std::vector<BuildNode> frontier = { root };
+            std::vector<BuildNode> subtreeRoots;
+            while (!frontier.empty())
+            {
+                const BuildNode node = frontier.back();
+                frontier.pop_back();
+
+                if (node.end - node.begin <= kSubtreePrimitives)
+                {
+                    subtreeRoots.push_back(node);
+                    continue;
+                }
+
+                BuildNode left;
+                BuildNode right;
+                splitNode(node, true, left, right);
+                addInnerNode(node, left, right, totals);
+                frontier.push_back(right);
+                frontier.push_back(left);
+            }
+
+            // Pass 3 (parallel): every subtree is built on one worker, the totals are summed in subtree order
+            std::vector<BuildTotals> subtreeTotals(subtreeRoots.size());
+            m_threadPool.ParallelFor(static_cast<uint32_t>(subtreeRoots.size()), [&](const uint32_t subtreeIndex)
+            {
+                buildSubtree(subtreeRoots[subtreeIndex], subtreeTotals[subtreeIndex]);
+            });
+            for (const BuildTotals& subtreeTotal : subtreeTotals)
+            {
+                totals.add(subtreeTotal);
+            }
+
+            return totals;
+        }
+
+    private:
+        uint32_t getBinIndex(const BuildNode& node, const uint32_t axis, const float3& centroid) const
+        {
+            const float extent = node.centroidBounds.m_maxs[axis] - node.centroidBounds.m_mins[axis];
+            const float binScale = float(m_numBins) / extent;
+            const float binPosition = (centroid[axis] - node.centroidBounds.m_mins[axis]) * binScale;
+            return std::min(m_numBins - 1, static_cast<uint32_t>(std::max(binPosition, 0.0f)));
+        }
+
+        void binPrimitives(const BuildNode& node, const uint32_t begin, const uint32_t end, AxisBins& bins) const
+        {
+            // A single pass fills all 3 axes, every primitive's bounds are read once
+            bool isAxisSplittable[3];
+            for (uint32_t axis = 0; axis < 3; ++axis)
+            {
+                isAxisSplittable[axis] = node.centroidBounds.m_maxs[axis] > node.centroidBounds.m_mins[axis];
+            }
+
+            for (uint32_t index = begin; index < end; ++index)
+            {
+                const PrimitiveReference& primitive = m_primitives[index];
+                for (uint32_t axis = 0; axis < 3; ++axis)
+                {
+                    if (isAxisSplittable[axis])
+                    {
+                        Bin& bin = bins[axis][getBinIndex(node, axis, primitive.centroid)];
+                        bin.bounds |= primitive.bounds;
+                        bin.centroidBounds |= primitive.centroid;
+                        ++bin.count;
+                    }
+                }
+            }
+        }
+
+        // Sweeps the bins of every axis, the cost of a split is SA(left) * N(left) + SA(right) * N(right)
+        Split findBestSplit(const BuildNode& node, const AxisBins& bins) const
+        {
+            Split bestSplit;
+            for (uint32_t axis = 0; axis < 3; ++axis)
+            {
+                if (node.centroidBounds.m_maxs[axis] <= node.centroidBounds.m_mins[axis])
+                {
+                    continue;
+                }
+
+                std::array<float, CurveBvhEstimator::kMaxBins> rightCosts = {};
+                box3 rightBounds = box3::empty();
+                uint32_t rightCount = 0;
+                for (uint32_t binIndex = m_numBins - 1; binIndex > 0; --binIndex)
+                {
+                    rightBounds |= bins[axis][binIndex].bounds;
+                    rightCount += bins[axis][binIndex].count;
+                    rightCosts[binIndex - 1] = (rightCount > 0) ? getSurfaceArea(rightBounds) * float(rightCount) : -1.0f;
+                }
+
+                box3 leftBounds = box3::empty();
+                uint32_t leftCount = 0;
+                for (uint32_t binIndex = 0; binIndex + 1 < m_numBins; ++binIndex)
+                {
+                    leftBounds |= bins[axis][binIndex].bounds;
+                    leftCount += bins[axis][binIndex].count;
+                    if (leftCount == 0 || rightCosts[binIndex] < 0.0f)
+                    {
+                        continue;
+                    }
+
+                    const float cost = getSurfaceArea(leftBounds) * float(leftCount) + rightCosts[binIndex];
+                    if (!bestSplit.isValid || cost < bestSplit.cost)
+                    {
+                        bestSplit = { axis, binIndex, cost, true };
+                    }
+                }
+            }
+            return bestSplit;
+        }
+
+        void splitNode(const BuildNode& node, const bool isParallel, BuildNode& left, BuildNode& right)
+        {
+            const uint32_t numPrimitives = node.end - node.begin;
+            const uint32_t numChunks = isParallel ? (numPrimitives + kPrimitivesPerChunk - 1) / kPrimitivesPerChunk : 1;
+
+            AxisBins bins = {};
+            if (numChunks > 1)
+            {
+                std::vector<AxisBins> chunkBins(numChunks);
+                m_threadPool.ParallelFor(numChunks, [&](const uint32_t chunkIndex)
+                {
+                    const uint32_t chunkBegin = node.begin + chunkIndex * kPrimitivesPerChunk;
+                    binPrimitives(node, chunkBegin, std::min(chunkBegin + kPrimitivesPerChunk, node.end), chunkBins[chunkIndex]);
+                });
+                for (const AxisBins& chunkBin : chunkBins)
+                {
+                    for (uint32_t axis = 0; axis < 3; ++axis)
+                    {
+                        for (uint32_t binIndex = 0; binIndex < m_numBins; ++binIndex)
+                        {
+                            Bin& bin = bins[axis][binIndex];
+                            bin.bounds |= chunkBin[axis][binIndex].bounds;
+                            bin.centroidBounds |= chunkBin[axis][binIndex].centroidBounds;
+                            bin.count += chunkBin[axis][binIndex].count;
+                        }
+                    }
+                }
+            }
+            else
+            {
+                binPrimitives(node, node.begin, node.end, bins);
+            }
+
+            left.depth = node.depth + 1;
+            right.depth = node.depth + 1;
+
+            const Split split = findBestSplit(node, bins);
+            if (!split.isValid)
+            {
+                // All centroids coincide, split the range in the middle
+                const uint32_t middle = node.begin + numPrimitives / 2;
+                left.begin = node.begin;
+                left.end = middle;
+                right.begin = middle;
+                right.end = node.end;
+                for (uint32_t index = node.begin; index < node.end; ++index)
+                {
+                    BuildNode& child = (index < middle) ? left : right;
+                    child.bounds |= m_primitives[index].bounds;
+                    child.centroidBounds |= m_primitives[index].centroid;
+                }
+                return;
+            }
+
+            for (uint32_t binIndex = 0; binIndex < m_numBins; ++binIndex)
+            {
+                BuildNode& child = (binIndex <= split.bin) ? left : right;
+                child.bounds |= bins[split.axis][binIndex].bounds;
+                child.centroidBounds |= bins[split.axis][binIndex].centroidBounds;
+            }
+
+            const auto isLeft = [&](const PrimitiveReference& primitive)
+            {
+                return getBinIndex(node, split.axis, primitive.centroid) <= split.bin;
+            };
+
+            uint32_t numLeft = 0;
+            if (numChunks > 1)
+            {
+                // Stable partition: count per chunk, scatter to the chunk's prefix offsets, copy back
+                std::vector<uint32_t> chunkLeftCounts(numChunks, 0);
+                m_threadPool.ParallelFor(numChunks, [&](const uint32_t chunkIndex)
+                {
+                    const uint32_t chunkBegin = node.begin + chunkIndex * kPrimitivesPerChunk;
+                    const uint32_t chunkEnd = std::min(chunkBegin + kPrimitivesPerChunk, node.end);
+                    for (uint32_t index = chunkBegin; index < chunkEnd; ++index)
+                    {
+                        chunkLeftCounts[chunkIndex] += isLeft(m_primitives[index]) ? 1 : 0;
+                    }
+                });
+
+                std::vector<uint32_t> chunkLeftOffsets(numChunks);
+                std::vector<uint32_t> chunkRightOffsets(numChunks);
+                for (uint32_t chunkIndex = 0; chunkIndex < numChunks; ++chunkIndex)
+                {
+                    chunkLeftOffsets[chunkIndex] = numLeft;
+                    numLeft += chunkLeftCounts[chunkIndex];
+                }
+                uint32_t numRight = 0;
+                for (uint32_t chunkIndex = 0; chunkIndex < numChunks; ++chunkIndex)
+                {
+                    const uint32_t chunkSize = std::min(kPrimitivesPerChunk, node.end - (node.begin + chunkIndex * kPrimitivesPerChunk));
+                    chunkRightOffsets[chunkIndex] = numLeft + numRight;
+                    numRight += chunkSize - chunkLeftCounts[chunkIndex];
+                }
+
+                std::vector<PrimitiveReference> partitionedPrimitives(numPrimitives);
+                m_threadPool.ParallelFor(numChunks, [&](const uint32_t chunkIndex)
+                {
+                    const uint32_t chunkBegin = node.begin + chunkIndex * kPrimitivesPerChunk;
+                    const uint32_t chunkEnd = std::min(chunkBegin + kPrimitivesPerChunk, node.end);
+                    uint32_t leftOffset = chunkLeftOffsets[chunkIndex];
+                    uint32_t rightOffset = chunkRightOffsets[chunkIndex];
+                    for (uint32_t index = chunkBegin; index < chunkEnd; ++index)
+                    {
+                        partitionedPrimitives[isLeft(m_primitives[index]) ? leftOffset++ : rightOffset++] = m_primitives[index];
+                    }
+                });
+                m_threadPool.ParallelFor(numChunks, [&](const uint32_t chunkIndex)
+                {
+                    const uint32_t chunkBegin = chunkIndex * kPrimitivesPerChunk;
+                    const uint32_t chunkEnd = std::min(chunkBegin + kPrimitivesPerChunk, numPrimitives);
+                    std::copy(partitionedPrimitives.begin() + chunkBegin, partitionedPrimitives.begin() + chunkEnd,
+                              m_primitives.begin() + node.begin + chunkBegin);
+                });
+            }
+            else
+            {
+                const auto middle = std::partition(m_primitives.begin() + node.begin, m_primitives.begin() + node.end, isLeft);
+                numLeft = static_cast<uint32_t>(middle - (m_primitives.begin() + node.begin));
+            }
+
+            left.begin = node.begin;
+            left.end = node.begin + numLeft;
+            right.begin = left.end;
+            right.end = node.end;
+        }
+
+        void buildSubtree(const BuildNode& subtreeRoot, BuildTotals& totals)
+        {
+            std::vector<BuildNode> stack = { subtreeRoot };
+            while (!stack.empty())
+            {
+                const BuildNode node = stack.back();
+                stack.pop_back();
+
+                const uint32_t numPrimitives = node.end - node.begin;
+                if (numPrimitives <= m_maxLeafPrimitives)
+                {
+                    addLeaf(node, totals);
+                    continue;
+                }
+
+                BuildNode left;
+                BuildNode right;
+                splitNode(node, false, left, right);
+                addInnerNode(node, left, right, totals);
+                stack.push_back(right);
+                stack.push_back(left);
+            }
+        }
+
+        static void addInnerNode(const BuildNode& node, const BuildNode& left, const BuildNode& right, BuildTotals& totals)
+        {
+            totals.innerArea += getSurfaceArea(node.bounds);
+            totals.siblingOverlapArea += getSurfaceArea(left.bounds & right.bounds);
+            ++totals.numInnerNodes;
+        }
+
+        void addLeaf(const BuildNode& node, BuildTotals& totals) const
+        {
+            const float area = getSurfaceArea(node.bounds);
+            totals.leafPrimitiveArea += double(area) * (node.end - node.begin);
+            totals.leafArea += area;
+            totals.numLeafPrimitives += node.end - node.begin;
+            ++totals.numLeaves;
+            totals.maxDepth = std::max(totals.maxDepth, node.depth);
+
+#ifndef NDEBUG
+            for (uint32_t index = node.begin; index < node.end; ++index)
+            {
+                assert(all(m_primitives[index].bounds.m_mins >= node.bounds.m_mins) && all(m_primitives[index].bounds.m_maxs <= node.bounds.m_maxs));
+            }
+#endif
+        }
+
+        const std::vector<box3>& m_primitiveBounds;
+        ThreadPool& m_threadPool;
+        const uint32_t m_numBins;
+        const uint32_t m_maxLeafPrimitives;
+
+        std::vector<PrimitiveReference> m_primitives;
+    };
+}
+
+CurveBvhStats CurveBvhEstimator::build(
+    const std::vector<box3>& primitiveBounds,
+    const size_t primitiveBytes,
+    ThreadPool& threadPool,
+    const CurveBvhSettings& settings)
+{
+    CurveBvhStats stats;
+    stats.numPrimitives = static_cast<uint32_t>(primitiveBounds.size());
+    if (primitiveBounds.empty())
+    {
+        return stats;
+    }
+
+    const auto startTime = std::chrono::high_resolution_clock::now();
+
+    box3 rootBounds;
+    BvhBuilder builder(primitiveBounds, threadPool, settings);
+    const BuildTotals totals = builder.build(rootBounds);
+
+    const double rootArea = getSurfaceArea(rootBounds);
+    const double areaScale = (rootArea > 0.0) ? 1.0 / rootArea : 0.0;
+    stats.numNodes = totals.numInnerNodes + totals.numLeaves;
+    stats.numLeaves = totals.numLeaves;
+    stats.maxDepth = totals.maxDepth;
+    stats.sahCost = float((settings.traversalCost * totals.innerArea + settings.intersectionCost * totals.leafPrimitiveArea) * areaScale);
+    stats.leafOverlap = float(totals.leafArea * areaScale);
+    stats.siblingOverlap = float(totals.siblingOverlapArea * areaScale);
+    stats.estimatedBytes = stats.numNodes * kNodeBytes + stats.numPrimitives * (primitiveBytes + sizeof(uint32_t));
+
+    const std::chrono::duration<double, std::milli> buildTime = std::chrono::high_resolution_clock::now() - startTime;
+    stats.buildTimeMs = buildTime.count();
+
+    assert(totals.numLeafPrimitives == stats.numPrimitives);
+
+    return stats;
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <donut/core/math/math.h>
+
+#include "ThreadPool.h"
+
+struct CurveBvhSettings
+{
+    uint32_t numBins = 16; // Clamped to [2, CurveBvhEstimator::kMaxBins]
+    uint32_t maxLeafPrimitives = 4;
+    float traversalCost = 1.0f; // Cost of an inner node visit
+    float intersectionCost = 1.0f; // Cost of a primitive test
+};
+
+struct CurveBvhStats
+{
+    uint32_t numPrimitives = 0;
+    uint32_t numNodes = 0; // Inner nodes and leaves
+    uint32_t numLeaves = 0;
+    uint32_t maxDepth = 0;
+    // Expected cost of a ray through the root bounds under the surface area heuristic
+    float sahCost = 0.0f;
+    // Summed leaf surface area relative to the root, the expected number of leaves a ray through the root bounds enters
+    float leafOverlap = 0.0f;
+    // Summed surface area of the intersections of sibling nodes relative to the root, rays through them visit both subtrees
+    float siblingOverlap = 0.0f;
+    size_t estimatedBytes = 0;
+    double buildTimeMs = 0.0;
+};
+
+// CPU estimate of the BVH the driver builds over the primitives of one hair representation.
+// Binned SAH build, only the statistics of the tree are kept. Absolute numbers differ from the driver's BVH,
+// they are meant to compare the representations and LODs of the same hair against each other.
+namespace CurveBvhEstimator
+{
+    constexpr uint32_t kMaxBins = 32;
+
+    // Binary node: bounds plus a child or primitive range
+    constexpr size_t kNodeBytes = 32;
+    // Primitive data kept by the acceleration structure: 3 vertices per triangle, 2 end points with their radius per LSS segment
+    constexpr size_t kTriangleBytes = 3 * 3 * sizeof(float);
+    constexpr size_t kLinearSweptSphereBytes = 2 * 4 * sizeof(float);
+
+    // The top levels bin and partition in parallel, subtrees below the threshold are built on one worker each.
+    // The result doesn't depend on the thread count.
+    CurveBvhStats build(
+        const std::vector<donut::math::box3>& primitiveBounds,
+        const size_t primitiveBytes,
+        ThreadPool& threadPool,
+        const CurveBvhSettings& settings = {});
+}
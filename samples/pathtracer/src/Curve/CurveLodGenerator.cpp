@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+
+#include "CurveLodGenerator.h"
+
+namespace CurveLodGenerator
+{
+namespace
+{
+    // Uniform value in [0, 1) per strand, 64-bit finalizer of (seed, strand index)
+    float getStrandRandom(const uint32_t strandIndex, const uint32_t seed)
+    {
+        uint64_t x = (uint64_t(seed) << 32) | strandIndex;
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdull;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ull;
+        x ^= x >> 33;
+        return float(x >> 40) * (1.0f / float(1u << 24));
+    }
+
+    float getSegmentLength(const rtxcr::geometry::LineSegment& segment)
+    {
+        const float dx = segment.vertices[1].position[0] - segment.vertices[0].position[0];
+        const float dy = segment.vertices[1].position[1] - segment.vertices[0].position[1];
+        const float dz = segment.vertices[1].position[2] - segment.vertices[0].position[2];
+        return sqrtf(dx * dx + dy * dy + dz * dz);
+    }
+
+    float getSegmentArea(const rtxcr::geometry::LineVertex& v0, const rtxcr::geometry::LineVertex& v1, const float length)
+    {
+        return (v0.radius + v1.radius) * length;
+    }
+
+    // Keeps every step-th point of the strand plus its last one. Besides the keep fraction compensation the radius is widened
+    // by the ratio of the strand's projected area to the one of its coarser polyline, the chords are shorter than curved strands.
+    void appendStrand(
+        const rtxcr::geometry::LineSegment* strand,
+        const uint32_t numStrandSegments,
+        const uint32_t step,
+        const float radiusScale,
+        std::vector<rtxcr::geometry::LineSegment>& lodLineSegments)
+    {
+        const size_t strandLodStart = lodLineSegments.size();
+        float strandArea = 0.0f;
+        float lodStrandArea = 0.0f;
+        for (uint32_t first = 0; first < numStrandSegments; first += step)
+        {
+            const uint32_t last = std::min(first + step, numStrandSegments) - 1;
+            for (uint32_t segmentIndex = first; segmentIndex <= last; ++segmentIndex)
+            {
+                strandArea += getSegmentArea(strand[segmentIndex].vertices[0], strand[segmentIndex].vertices[1], getSegmentLength(strand[segmentIndex]));
+            }
+
+            rtxcr::geometry::LineSegment& segment = lodLineSegments.emplace_back(strand[first]);
+            segment.vertices[1] = strand[last].vertices[1];
+            lodStrandArea += getSegmentArea(segment.vertices[0], segment.vertices[1], getSegmentLength(segment));
+        }
+
+        const float strandRadiusScale = radiusScale * ((lodStrandArea > 0.0f) ? strandArea / lodStrandArea : 1.0f);
+        for (size_t segmentIndex = strandLodStart; segmentIndex < lodLineSegments.size(); ++segmentIndex)
+        {
+            lodLineSegments[segmentIndex].vertices[0].radius *= strandRadiusScale;
+            lodLineSegments[segmentIndex].vertices[1].radius *= strandRadiusScale;
+        }
+    }
+} // namespace
+
+void generateLevel(
+    const std::vector<rtxcr::geometry::LineSegment>& lineSegments,
+    const std::vector<uint32_t>& geometrySegmentCounts,
+    const float strandKeepRatio,
+    const uint32_t level,
+    const uint32_t seed,
+    std::vector<rtxcr::geometry::LineSegment>& lodLineSegments,
+    std::vector<uint32_t>& lodGeometrySegmentCounts)
+{
+    const float keepFraction = getStrandKeepFraction(strandKeepRatio, level);
+    const float radiusScale = 1.0f / keepFraction;
+    const uint32_t step = 1u << std::min(level, 31u);
+
+    lodLineSegments.clear();
+    lodGeometrySegmentCounts.assign(geometrySegmentCounts.size(), 0);
+
+    // Fallback if no strand passes, the strand with the lowest random value is the one every finer level keeps too
+    uint32_t fallbackGeometry = 0;
+    uint32_t fallbackStart = 0;
+    uint32_t fallbackEnd = 0;
+    float fallbackRandom = 1.0f;
+
+    uint32_t strandIndex = 0;
+    uint32_t geometryStart = 0;
+    for (uint32_t geometryIndex = 0; geometryIndex < geometrySegmentCounts.size(); ++geometryIndex)
+    {
+        const uint32_t geometryEnd = geometryStart + geometrySegmentCounts[geometryIndex];
+        const size_t geometryLodStart = lodLineSegments.size();
+
+        uint32_t strandStart = geometryStart;
+        while (strandStart < geometryEnd)
+        {
+            uint32_t strandEnd = strandStart + 1;
+            while (strandEnd < geometryEnd && lineSegments[strandEnd].geometryIndex == lineSegments[strandStart].geometryIndex)
+            {
+                ++strandEnd;
+            }
+
+            const float random = getStrandRandom(strandIndex++, seed);
+            if (random < keepFraction)
+            {
+                appendStrand(lineSegments.data() + strandStart, strandEnd - strandStart, step, radiusScale, lodLineSegments);
+            }
+            else if (random < fallbackRandom)
+            {
+                fallbackGeometry = geometryIndex;
+                fallbackStart = strandStart;
+                fallbackEnd = strandEnd;
+                fallbackRandom = random;
+            }
+
+            strandStart = strandEnd;
+        }
+
+        lodGeometrySegmentCounts[geometryIndex] = static_cast<uint32_t>(lodLineSegments.size() - geometryLodStart);
+        geometryStart = geometryEnd;
+    }
+
+    if (lodLineSegments.empty() && fallbackEnd > fallbackStart)
+    {
+        appendStrand(lineSegments.data() + fallbackStart, fallbackEnd - fallbackStart, step, radiusScale, lodLineSegments);
+        lodGeometrySegmentCounts[fallbackGeometry] = static_cast<uint32_t>(lodLineSegments.size());
+    }
+}
+
+double getProjectedArea(const std::vector<rtxcr::geometry::LineSegment>& lineSegments)
+{
+    double area = 0.0;
+    for (const auto& segment : lineSegments)
+    {
+        area += double(segment.vertices[0].radius + segment.vertices[1].radius) * getSegmentLength(segment);
+    }
+    return area;
+}
+
+float getAverageRadius(const std::vector<rtxcr::geometry::LineSegment>& lineSegments)
+{
+    if (lineSegments.empty())
+    {
+        return 0.0f;
+    }
+
+    double radiusSum = 0.0;
+    for (const auto& segment : lineSegments)
+    {
+        radiusSum += double(segment.vertices[0].radius) + segment.vertices[1].radius;
+    }
+    return float(radiusSum / (2.0 * lineSegments.size()));
+}
+} // namespace CurveLodGenerator
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <rtxcr/geometry/include/CurveTessellation.h>
+
+// Distance based hair level of detail.
+// Level l keeps a strandKeepRatio^l fraction of the strands, and every kept strand keeps every (2^l)-th point plus its last point.
+// Kept strands are widened by the inverse of the keep fraction and by the area lost to the shorter coarse polyline,
+// so the projected strand area (and with it the coverage of optically thin hair) is preserved.
+namespace CurveLodGenerator
+{
+    inline float getStrandKeepFraction(const float strandKeepRatio, const uint32_t level)
+    {
+        return powf(strandKeepRatio, float(level));
+    }
+
+    // Builds LOD level (>= 1) of one mesh from its LOD0 segments. A strand is kept if the hash of its index in the mesh is below
+    // the keep fraction, so coarser levels are subsets of finer ones and the result only depends on the input and the seed.
+    // Strands are split at geometry boundaries and geometry index changes, kept segments keep their geometry index.
+    // At least one strand is kept per mesh, fully dropped geometries get a segment count of 0.
+    void generateLevel(
+        const std::vector<rtxcr::geometry::LineSegment>& lineSegments,
+        const std::vector<uint32_t>& geometrySegmentCounts,
+        const float strandKeepRatio,
+        const uint32_t level,
+        const uint32_t seed,
+        std::vector<rtxcr::geometry::LineSegment>& lodLineSegments,
+        std::vector<uint32_t>& lodGeometrySegmentCounts);
+
+    // Sum of 2 * radius * length over all segments, the silhouette area of the strands
+    double getProjectedArea(const std::vector<rtxcr::geometry::LineSegment>& lineSegments);
+
+    // Average end point radius, 0 for an empty mesh
+    float getAverageRadius(const std::vector<rtxcr::geometry::LineSegment>& lineSegments);
+}
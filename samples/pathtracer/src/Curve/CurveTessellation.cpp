@@ -8,17 +8,35 @@
  * license agreement from NVIDIA CORPORATION is strictly prohibited.
  */
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cfloat>
+#include <cstdio>
+#include <cstring>
+
 #include <donut/core/math/math.h>
+#include <donut/core/log.h>
+#include <donut/core/json.h>
+#include <json/value.h>
 
 #include "shared.h"
 #include "CurveTessellation.h"
-#include "../Ui/PathtracerUi.h"
+#include "CurveLodGenerator.h"
+#include "CurveTessellationKernels.h"
+#include "CurveTessellationSettings.h"
 
 #include <nvrhi/common/misc.h>
 
-CurveTessellation::CurveTessellation(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances, const UIData& ui)
-: m_curveOriginalGeometryInfoCache(meshInstances.size())
-, m_ui(ui)
+CurveTessellation::CurveTessellation(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances, const CurveTessellationSettings& settings)
+: m_curvePolyTubeOrder(meshInstances.size(), RTXCR_CURVE_POLYTUBE_ORDER)
+, m_curveOriginalGeometryInfoCache(meshInstances.size())
+, m_curveOriginalVertexBufferRanges(meshInstances.size())
+, m_segmentsPerTask(static_cast<uint32_t>(std::max(settings.hairTessellationSegmentsPerTask, 1)))
+, m_threadPool(std::make_unique<ThreadPool>(static_cast<uint32_t>(std::max(settings.hairTessellationThreadCount, 0))))
+, m_settings(settings)
 {
     for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
     {
@@ -27,208 +45,89 @@ CurveTessellation::CurveTessellation(const std::vector<std::shared_ptr<MeshInsta
         {
             m_curveOriginalGeometryInfoCache[meshIndex].push_back(*geometry);
         }
-    }
-
-    convertCurveLineStripsToLineSegments(meshInstances);
-}
-
-void CurveTessellation::convertToTrianglePolyTubes(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
-{
-    for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
-    {
-        auto& mesh = meshInstances[meshIndex]->GetMesh();
-        auto& meshBuffers = mesh->buffers;
+        m_curveOriginalVertexBufferRanges[meshIndex] = mesh->buffers->vertexBufferRanges;
 
         if (mesh->IsCurve())
         {
-            mesh->type = MeshType::CurvePolytubes;
-
-            // RTXCR_CURVE_POLYTUBE_ORDER faces with 2 triangles (3 vertices each)
-            const uint32_t numVerticesPerSegment = RTXCR_CURVE_POLYTUBE_ORDER * 2 * 3;
-            // Assumption: All curve geometries in same mesh have same primitive type, so we just check the type of first geometry
-            const uint32_t totalIndices = m_curvesLineSegments[meshIndex].size() * numVerticesPerSegment;
-            const uint32_t totalVertices = m_curvesLineSegments[meshIndex].size() * numVerticesPerSegment;
-
-            meshBuffers->indexData.resize(totalIndices);
-            meshBuffers->positionData.resize(totalVertices);
-            meshBuffers->normalData.resize(totalVertices);
-            meshBuffers->tangentData.resize(totalVertices);
-            meshBuffers->texcoord1Data.resize(totalVertices);
-            meshBuffers->radiusData.resize(totalVertices);
-
-            const auto& meshGeometryCache = m_curveOriginalGeometryInfoCache[meshIndex];
-            const auto& lineSegments = m_curvesLineSegments[meshIndex];
-            uint32_t indexOffsetInMesh = 0;
-            uint32_t vertexOffsetInMesh = 0;
-            uint32_t globalIndex = 0;
-
-            for (uint32_t geometryIndex = 0; geometryIndex < mesh->geometries.size(); ++geometryIndex)
-            {
-                const auto& geometryCache = meshGeometryCache[geometryIndex];
-                auto& geometry = mesh->geometries[geometryIndex];
-
-                const uint32_t indexSize = (geometry->type == MeshGeometryPrimitiveType::Lines) ?
-                    geometryCache.numIndices / 2 : geometryCache.numIndices - 1;
-                const uint32_t vertexSize = (geometry->type == MeshGeometryPrimitiveType::Lines) ?
-                    geometryCache.numVertices / 2 : geometryCache.numVertices - 1;
-
-                const uint32_t geometryNumIndices = indexSize * numVerticesPerSegment;
-                const uint32_t geometryNumVertices = vertexSize * numVerticesPerSegment;
-                geometry->numIndices = geometryNumIndices;
-                geometry->numVertices = geometryNumVertices;
-                geometry->indexOffsetInMesh = indexOffsetInMesh;
-                geometry->vertexOffsetInMesh = vertexOffsetInMesh;
-                geometry->globalGeometryIndex = geometryIndex;
-
-                globalIndex = rtxcr::geometry::convertToTrianglePolyTubes(
-                    lineSegments,
-                    indexSize,
-                    meshBuffers->indexData.data(),
-                    (float*)(meshBuffers->positionData.data()),
-                    meshBuffers->normalData.data(),
-                    meshBuffers->tangentData.data(),
-                    (float*)meshBuffers->texcoord1Data.data(),
-                    meshBuffers->radiusData.data(),
-                    globalIndex);
-
-                indexOffsetInMesh += geometryNumIndices;
-                vertexOffsetInMesh += geometryNumVertices;
-            }
-
-            copyToMeshBuffersCache(TessellationType::Polytube, meshBuffers, mesh->geometries);
+            m_curveMeshSceneLod.push_back(0);
         }
     }
-}
 
-void CurveTessellation::convertToDisjointOrthogonalTriangleStrips(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
-{
-    for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
+    // The source buffers are hashed before the first representation replaces them in the scene
+    if (m_settings.enableHairTessellationDiskCache)
     {
-        auto& mesh = meshInstances[meshIndex]->GetMesh();
-        auto& meshBuffers = mesh->buffers;
-
-        if (mesh->IsCurve())
-        {
-            mesh->type = MeshType::CurveDisjointOrthogonalTriangleStrips;
-
-            // 4 triangles (3 vertices each)
-            const uint32_t numVerticesPerSegment = 4 * 3;
-            // Assumption: All curve geometries in same mesh have same primitive type, so we just check the type of first geometry
-            const uint32_t totalIndices = m_curvesLineSegments[meshIndex].size() * numVerticesPerSegment;
-            const uint32_t totalVertices = m_curvesLineSegments[meshIndex].size() * numVerticesPerSegment;
-
-            meshBuffers->indexData.resize(totalIndices);
-            meshBuffers->positionData.resize(totalVertices);
-            meshBuffers->normalData.resize(totalVertices);
-            meshBuffers->tangentData.resize(totalVertices);
-            meshBuffers->texcoord1Data.resize(totalVertices);
-            meshBuffers->radiusData.resize(totalVertices);
-
-            const auto& meshGeometryCache = m_curveOriginalGeometryInfoCache[meshIndex];
-            const auto& lineSegments = m_curvesLineSegments[meshIndex];
-            uint32_t indexOffsetInMesh = 0;
-            uint32_t vertexOffsetInMesh = 0;
-            uint32_t globalIndex = 0;
-
-            for (uint32_t geometryIndex = 0; geometryIndex < mesh->geometries.size(); ++geometryIndex)
-            {
-                const auto& geometryCache = meshGeometryCache[geometryIndex];
-                auto& geometry = mesh->geometries[geometryIndex];
-
-                const uint32_t indexSize = (geometry->type == MeshGeometryPrimitiveType::Lines) ?
-                    geometryCache.numIndices / 2 : geometryCache.numIndices - 1;
-                const uint32_t vertexSize = (geometry->type == MeshGeometryPrimitiveType::Lines) ?
-                    geometryCache.numVertices / 2 : geometryCache.numVertices - 1;
+        m_curveSourceGeometryHash = hashCurveSourceGeometry(meshInstances);
+        m_diskCache = std::make_unique<CurveTessellationDiskCache>(m_settings.hairTessellationDiskCacheDirectory);
+    }
 
-                const uint32_t geometryNumIndices = indexSize * numVerticesPerSegment;
-                const uint32_t geometryNumVertices = vertexSize * numVerticesPerSegment;
-                geometry->numIndices = geometryNumIndices;
-                geometry->numVertices = geometryNumVertices;
-                geometry->indexOffsetInMesh = indexOffsetInMesh;
-                geometry->vertexOffsetInMesh = vertexOffsetInMesh;
-                geometry->globalGeometryIndex = geometryIndex;
+    convertCurveLineStripsToLineSegments(meshInstances);
 
-                globalIndex = rtxcr::geometry::convertToDisjointOrthogonalTriangleStrips(
-                    lineSegments,
-                    indexSize,
-                    meshBuffers->indexData.data(),
-                    (float*)(meshBuffers->positionData.data()),
-                    meshBuffers->normalData.data(),
-                    meshBuffers->tangentData.data(),
-                    (float*)meshBuffers->texcoord1Data.data(),
-                    meshBuffers->radiusData.data(),
-                    globalIndex);
+    if (m_settings.enableHairStrandReorder)
+    {
+        reorderCurveStrands(meshInstances);
+    }
 
-                indexOffsetInMesh += geometryNumIndices;
-                vertexOffsetInMesh += geometryNumVertices;
-            }
+    if (m_settings.hairResegmentationError > 0.0f)
+    {
+        resegmentCurveLineSegments(meshInstances);
+    }
 
-            copyToMeshBuffersCache(TessellationType::DisjointOrthogonalTriangleStrip, meshBuffers, mesh->geometries);
-        }
+    if (m_settings.hairLodLevels > 1)
+    {
+        generateCurveLods(meshInstances);
     }
 }
 
-void CurveTessellation::convertToLinearSweptSpheres(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
+void CurveTessellation::convertToTrianglePolyTubes(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
 {
-    for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
-    {
-        // TODO: Add support for implicit successive indexing format
-        // LSS list format
-        auto& mesh = meshInstances[meshIndex]->GetMesh();
-        auto& meshBuffers = mesh->buffers;
-
-        if (mesh->IsCurve())
-        {
-            mesh->type = MeshType::CurveLinearSweptSpheres;
-
-            const uint32_t totalVertices = m_curvesLineSegments[meshIndex].size() * 2;
+    tessellateCurveMeshes(TessellationType::Polytube, meshInstances);
+}
 
-            meshBuffers->indexData.resize(0);
-            meshBuffers->positionData.resize(totalVertices);
-            meshBuffers->normalData.resize(0);
-            meshBuffers->tangentData.resize(0);
-            meshBuffers->texcoord1Data.resize(0);
-            meshBuffers->radiusData.resize(totalVertices);
+void CurveTessellation::convertToDisjointOrthogonalTriangleStrips(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
+{
+    tessellateCurveMeshes(TessellationType::DisjointOrthogonalTriangleStrip, meshInstances);
+}
 
-            const auto& meshGeometryCache = m_curveOriginalGeometryInfoCache[meshIndex];
-            const auto& lineSegments = m_curvesLineSegments[meshIndex];
+void CurveTessellation::convertToLinearSweptSpheres(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
+{
+    tessellateCurveMeshes(TessellationType::LinearSweptSphere, meshInstances);
+}
 
-            uint32_t vertexOffsetInMesh = 0;
-            uint32_t globalIndex = 0;
+void CurveTessellation::requestTessellation(const TessellationType tessellationType, const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
+{
+    if (!isTessellationCached(tessellationType))
+    {
+        tessellateCurveMeshes(tessellationType, meshInstances);
+    }
 
-            for (uint32_t geometryIndex = 0; geometryIndex < mesh->geometries.size(); ++geometryIndex)
-            {
-                const auto& geometryCache = meshGeometryCache[geometryIndex];
-                auto& geometry = mesh->geometries[geometryIndex];
+    m_curveMeshBuffersCacheLastUse[(uint32_t)tessellationType] = ++m_tessellationRequestCounter;
 
-                const uint32_t numLineSegments = (geometry->type == MeshGeometryPrimitiveType::Lines) ?
-                    geometryCache.numIndices / 2 : geometryCache.numIndices - 1;
-                const uint32_t geometryNumVertices = numLineSegments * 2;
+    evictTessellationCache(tessellationType);
+}
 
-                geometry->numIndices = 0;
-                geometry->numVertices = geometryNumVertices;
-                geometry->indexOffsetInMesh = 0;
-                geometry->vertexOffsetInMesh = vertexOffsetInMesh;
-                geometry->globalGeometryIndex = geometryIndex;
+void CurveTessellation::replacingSceneMesh(nvrhi::IDevice* device, donut::engine::DescriptorTableManager* descriptorTable, const TessellationType tessellationType, const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
+{
+    if (tessellationType == m_sceneTessellationType)
+    {
+        // The scene already owns this representation's data
+        return;
+    }
 
-                globalIndex = rtxcr::geometry::convertToLinearSweptSpheres(
-                    lineSegments,
-                    numLineSegments,
-                    (float*)meshBuffers->positionData.data(),
-                    (float*)meshBuffers->radiusData.data(),
-                    globalIndex);
+    const auto startTime = std::chrono::high_resolution_clock::now();
 
-                vertexOffsetInMesh += geometryNumVertices;
-            }
+    // The attribute vectors are handed over by swapping them between the cache and the scene's buffer group, so switching
+    // representation is O(meshes). The previously displayed representation goes back to its cache slot if it is still cached.
+    const TessellationType prevTessellationType = m_sceneTessellationType;
+    const bool returnPrevToCache = (prevTessellationType != TessellationType::Count) && isTessellationCached(prevTessellationType);
 
-            copyToMeshBuffersCache(TessellationType::LinearSweptSphere, meshBuffers, mesh->geometries);
-        }
+    // Reduced LODs of the previous representation go back to their slots first, so the scene holds its LOD0 data again
+    if (returnPrevToCache)
+    {
+        resetCurveLods(meshInstances);
     }
-}
+    std::fill(m_curveMeshSceneLod.begin(), m_curveMeshSceneLod.end(), 0);
 
-void CurveTessellation::replacingSceneMesh(nvrhi::IDevice* device, donut::engine::DescriptorTableManager* descriptorTable, const TessellationType tessellationType, const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
-{
-    const auto& currentCurveMeshBuffers = m_curveMeshBuffersCache[(uint32_t)tessellationType];
+    auto& currentCurveMeshBuffers = m_curveMeshBuffersCache[(uint32_t)tessellationType];
     uint32_t curveIndex = 0;
     for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
     {
@@ -255,14 +154,20 @@ void CurveTessellation::replacingSceneMesh(nvrhi::IDevice* device, donut::engine
                 mesh->type = MeshType::CurveLinearSweptSpheres;
             }
 
-            const auto& srcBuffers = currentCurveMeshBuffers[curveIndex].buffers;
+            // After the swap the cache slot holds the data the scene displayed until now
+            auto& srcBuffers = currentCurveMeshBuffers[curveIndex].buffers;
             meshBuffers->vertexBufferRanges = srcBuffers->vertexBufferRanges;
-            meshBuffers->indexData = srcBuffers->indexData;
-            meshBuffers->positionData = srcBuffers->positionData;
-            meshBuffers->normalData = srcBuffers->normalData;
-            meshBuffers->tangentData = srcBuffers->tangentData;
-            meshBuffers->texcoord1Data = srcBuffers->texcoord1Data;
-            meshBuffers->radiusData = srcBuffers->radiusData;
+            swapCurveMeshData(*meshBuffers, *srcBuffers);
+
+            if (returnPrevToCache)
+            {
+                swapCurveMeshData(*srcBuffers, *m_curveMeshBuffersCache[(uint32_t)prevTessellationType][curveIndex].buffers);
+            }
+            else
+            {
+                BufferGroup releasedBuffers;
+                swapCurveMeshData(*srcBuffers, releasedBuffers);
+            }
 
             meshBuffers->indexBuffer = nullptr;
             meshBuffers->vertexBuffer = nullptr;
@@ -276,6 +181,12 @@ void CurveTessellation::replacingSceneMesh(nvrhi::IDevice* device, donut::engine
             ++curveIndex;
         }
     }
+
+    m_sceneTessellationType = tessellationType;
+
+    const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+    donut::log::info("Curve scene mesh switch (%s): %u meshes in %.3f ms",
+        getTessellationTypeName(tessellationType), curveIndex, elapsedTime.count());
 }
 
 void CurveTessellation::swapDynamicVertexBuffer()
@@ -292,114 +203,2112 @@ void CurveTessellation::swapDynamicVertexBuffer()
     }
 }
 
+void CurveTessellation::swapCurveMeshData(BufferGroup& lhs, BufferGroup& rhs)
+{
+    lhs.indexData.swap(rhs.indexData);
+    lhs.positionData.swap(rhs.positionData);
+    lhs.normalData.swap(rhs.normalData);
+    lhs.tangentData.swap(rhs.tangentData);
+    lhs.texcoord1Data.swap(rhs.texcoord1Data);
+    lhs.radiusData.swap(rhs.radiusData);
+}
+
 void CurveTessellation::convertCurveLineStripsToLineSegments(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
 {
+    const auto startTime = std::chrono::high_resolution_clock::now();
+
     m_curvesLineSegments.resize(meshInstances.size());
+    m_curveGeometrySegmentCounts.resize(meshInstances.size());
+
+    // A contiguous range of line segments of one geometry
+    struct ExtractionTask
+    {
+        uint32_t meshIndex = 0;
+        uint32_t geometryIndex = 0;
+        uint32_t firstSegmentInGeometry = 0;
+        uint32_t firstSegmentInMesh = 0;
+        uint32_t numLineSegments = 0;
+        bool isLines = false;
+    };
 
+    // Pass 1 (serial, O(geometries)): the segment count of every geometry follows from its index count,
+    // so every mesh's segment array is allocated once and each task knows where its segments go.
+    std::vector<ExtractionTask> tasks;
+    uint32_t totalLineSegments = 0;
     for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
     {
         const auto& mesh = meshInstances[meshIndex]->GetMesh();
 
-        if (mesh->IsCurve())
+        if (!mesh->IsCurve())
         {
-            const auto& indices = mesh->buffers->indexData;
-            const auto& positions = mesh->buffers->positionData;
-            const auto& radius = mesh->buffers->radiusData;
-            const auto& texCoord1 = mesh->buffers->texcoord1Data;
-            const auto& geometries = mesh->geometries;
+            continue;
+        }
 
-            const auto& meshGeometryCache = m_curveOriginalGeometryInfoCache[meshIndex];
-            uint32_t virtualGeometryIndex = 0;
-            for (uint32_t geometryIndex = 0; geometryIndex < mesh->geometries.size(); ++geometryIndex)
+        const auto& meshGeometryCache = m_curveOriginalGeometryInfoCache[meshIndex];
+        auto& geometrySegmentCounts = m_curveGeometrySegmentCounts[meshIndex];
+        geometrySegmentCounts.resize(meshGeometryCache.size());
+
+        uint32_t segmentOffsetInMesh = 0;
+        for (uint32_t geometryIndex = 0; geometryIndex < meshGeometryCache.size(); ++geometryIndex)
+        {
+            const auto& geometryCache = meshGeometryCache[geometryIndex];
+
+            const bool isLines = (geometryCache.type == MeshGeometryPrimitiveType::Lines);
+            const uint32_t numLineSegments = isLines ? geometryCache.numIndices / 2 :
+                (geometryCache.numIndices > 0 ? geometryCache.numIndices - 1 : 0);
+            geometrySegmentCounts[geometryIndex] = numLineSegments;
+
+            for (uint32_t segmentOffset = 0; segmentOffset < numLineSegments; segmentOffset += m_segmentsPerTask)
+            {
+                ExtractionTask task;
+                task.meshIndex = meshIndex;
+                task.geometryIndex = geometryIndex;
+                task.firstSegmentInGeometry = segmentOffset;
+                task.firstSegmentInMesh = segmentOffsetInMesh + segmentOffset;
+                task.numLineSegments = std::min(m_segmentsPerTask, numLineSegments - segmentOffset);
+                task.isLines = isLines;
+                tasks.push_back(task);
+            }
+
+            segmentOffsetInMesh += numLineSegments;
+        }
+
+        m_curvesLineSegments[meshIndex].resize(segmentOffsetInMesh);
+        m_curvesLineSegmentsIndexMap[mesh->name] = meshIndex;
+        totalLineSegments += segmentOffsetInMesh;
+    }
+
+    // Pass 2 (parallel): fill the segments, radius scaling is applied here
+    const float radiusScale = m_settings.hairRadiusScale;
+    m_lineSegmentsRadiusScale = radiusScale;
+    // Fresh segments, a later rescale keeps their radii as its base again
+    std::vector<std::vector<std::vector<float2>>>().swap(m_curvesLineSegmentsBaseRadius);
+    m_threadPool->ParallelFor(static_cast<uint32_t>(tasks.size()), [&](const uint32_t taskIndex)
+    {
+        const ExtractionTask& task = tasks[taskIndex];
+        const auto& meshBuffers = meshInstances[task.meshIndex]->GetMesh()->buffers;
+        const auto& indices = meshBuffers->indexData;
+        const auto& positions = meshBuffers->positionData;
+        const auto& radius = meshBuffers->radiusData;
+        const auto& texCoord1 = meshBuffers->texcoord1Data;
+        const auto& geometryCache = m_curveOriginalGeometryInfoCache[task.meshIndex][task.geometryIndex];
+        auto* lineSegments = m_curvesLineSegments[task.meshIndex].data() + task.firstSegmentInMesh;
+
+        const uint32_t indexStep = task.isLines ? 2 : 1;
+        for (uint32_t segmentIndex = 0; segmentIndex < task.numLineSegments; ++segmentIndex)
+        {
+            const uint32_t index = (task.firstSegmentInGeometry + segmentIndex) * indexStep + geometryCache.indexOffsetInMesh;
+            const uint32_t lineIndexStart = indices[index] + geometryCache.indexOffsetInMesh;
+            const uint32_t lineIndexEnd = indices[index + 1] + geometryCache.indexOffsetInMesh;
+
+            const auto& posStart = positions[lineIndexStart];
+            const auto& posEnd = positions[lineIndexEnd];
+
+            rtxcr::geometry::LineSegment& segment = lineSegments[segmentIndex];
+            segment.vertices[0].position[0] = posStart.x;
+            segment.vertices[0].position[1] = posStart.y;
+            segment.vertices[0].position[2] = posStart.z;
+            segment.vertices[0].radius = radius[lineIndexStart] * radiusScale;
+            segment.vertices[1].position[0] = posEnd.x;
+            segment.vertices[1].position[1] = posEnd.y;
+            segment.vertices[1].position[2] = posEnd.z;
+            segment.vertices[1].radius = radius[lineIndexEnd] * radiusScale;
+
+            // UVs
+            if (texCoord1.data())
             {
-                const auto& geometryCache = meshGeometryCache[geometryIndex];
-                auto& geometry = mesh->geometries[geometryIndex];
+                const auto& uvStart = texCoord1[lineIndexStart];
+                const auto& uvEnd = texCoord1[lineIndexEnd];
+                segment.vertices[0].texCoord[0] = uvStart.x;
+                segment.vertices[0].texCoord[1] = uvStart.y;
+                segment.vertices[1].texCoord[0] = uvEnd.x;
+                segment.vertices[1].texCoord[1] = uvEnd.y;
+            }
+
+            // Virtual geometry indices of line lists are resolved in the passes below
+            segment.geometryIndex = task.isLines ? 0 : task.geometryIndex;
+        }
+    });
+
+    // Pass 3 (parallel): detect line-segment geometry indices of line lists.
+    // If a segment's start vertex differs from the previous segment's end vertex it starts a new geometry group,
+    // each task counts its group starts locally so the running index becomes a prefix sum over the tasks.
+    std::vector<uint32_t> taskGroupStarts(tasks.size(), 0);
+    m_threadPool->ParallelFor(static_cast<uint32_t>(tasks.size()), [&](const uint32_t taskIndex)
+    {
+        const ExtractionTask& task = tasks[taskIndex];
+        if (!task.isLines)
+        {
+            return;
+        }
 
-                const uint32_t indexStep = (geometry->type == MeshGeometryPrimitiveType::Lines) ? 2 : 1;
-                for (uint32_t index = 0; index < geometryCache.numIndices - 1; index += indexStep)
+        auto* lineSegments = m_curvesLineSegments[task.meshIndex].data();
+        uint32_t groupStarts = 0;
+        for (uint32_t segmentIndex = task.firstSegmentInMesh; segmentIndex < task.firstSegmentInMesh + task.numLineSegments; ++segmentIndex)
+        {
+            if (segmentIndex > 0)
+            {
+                const auto& segmentStartVertex = lineSegments[segmentIndex].vertices[0];
+                const auto& prevSegmentEndVertex = lineSegments[segmentIndex - 1].vertices[1];
+                if (!isnear(segmentStartVertex.position[0], prevSegmentEndVertex.position[0]) ||
+                    !isnear(segmentStartVertex.position[1], prevSegmentEndVertex.position[1]) ||
+                    !isnear(segmentStartVertex.position[2], prevSegmentEndVertex.position[2]))
                 {
-                    const uint32_t lineIndexStart = indices[index + geometryCache.indexOffsetInMesh] + geometryCache.indexOffsetInMesh;
-                    const uint32_t lineIndexEnd = indices[index + 1 + geometryCache.indexOffsetInMesh] + geometryCache.indexOffsetInMesh;
-
-                    const auto& posStart = positions[lineIndexStart];
-                    const auto& posEnd = positions[lineIndexEnd];
-                    const float radiusStart = radius[lineIndexStart];
-                    const float radiusEnd = radius[lineIndexEnd];
-
-                    rtxcr::geometry::LineSegment segment;
-                    segment.vertices[0].position[0] = posStart.x;
-                    segment.vertices[0].position[1] = posStart.y;
-                    segment.vertices[0].position[2] = posStart.z;
-                    segment.vertices[0].radius = radiusStart * m_ui.hairRadiusScale;
-                    segment.vertices[1].position[0] = posEnd.x;
-                    segment.vertices[1].position[1] = posEnd.y;
-                    segment.vertices[1].position[2] = posEnd.z;
-                    segment.vertices[1].radius = radiusEnd * m_ui.hairRadiusScale;
-
-                    // UVs
-                    if (texCoord1.data())
-                    {
-                        const auto& uvStart = texCoord1[lineIndexStart];
-                        const auto& uvEnd = texCoord1[lineIndexEnd];
-                        segment.vertices[0].texCoord[0] = uvStart.x;
-                        segment.vertices[0].texCoord[1] = uvStart.y;
-                        segment.vertices[1].texCoord[0] = uvEnd.x;
-                        segment.vertices[1].texCoord[1] = uvEnd.y;
-                    }
+                    ++groupStarts;
+                }
+            }
+            lineSegments[segmentIndex].geometryIndex = groupStarts;
+        }
+        taskGroupStarts[taskIndex] = groupStarts;
+    });
+
+    // Pass 4 (serial, O(tasks)): exclusive prefix sum of the group starts within each mesh
+    std::vector<uint32_t> taskVirtualGeometryIndexBase(tasks.size(), 0);
+    uint32_t virtualGeometryIndex = 0;
+    for (uint32_t taskIndex = 0; taskIndex < tasks.size(); ++taskIndex)
+    {
+        if (taskIndex > 0 && tasks[taskIndex].meshIndex != tasks[taskIndex - 1].meshIndex)
+        {
+            virtualGeometryIndex = 0;
+        }
+        taskVirtualGeometryIndexBase[taskIndex] = virtualGeometryIndex;
+        virtualGeometryIndex += taskGroupStarts[taskIndex];
+    }
+
+    // Pass 5 (parallel): offset the local indices by the running index of the preceding tasks
+    m_threadPool->ParallelFor(static_cast<uint32_t>(tasks.size()), [&](const uint32_t taskIndex)
+    {
+        const ExtractionTask& task = tasks[taskIndex];
+        const uint32_t virtualGeometryIndexBase = taskVirtualGeometryIndexBase[taskIndex];
+        if (!task.isLines || virtualGeometryIndexBase == 0)
+        {
+            return;
+        }
+
+        auto* lineSegments = m_curvesLineSegments[task.meshIndex].data() + task.firstSegmentInMesh;
+        for (uint32_t segmentIndex = 0; segmentIndex < task.numLineSegments; ++segmentIndex)
+        {
+            lineSegments[segmentIndex].geometryIndex += virtualGeometryIndexBase;
+        }
+    });
+
+    const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+    donut::log::info("Curve line segment extraction: %u segments, %u tasks on %u threads in %.2f ms",
+        totalLineSegments, static_cast<uint32_t>(tasks.size()), m_threadPool->GetThreadCount(), elapsedTime.count());
+}
+
+namespace
+{
+    // Upper bound of the surface deviation when the strand point (position, radius) is replaced by the merged segment (p0, p1):
+    // distance to the segment axis plus the radius error at the projected point
+    float getResegmentationError(const rtxcr::geometry::LineVertex& point, const rtxcr::geometry::LineVertex& v0, const rtxcr::geometry::LineVertex& v1)
+    {
+        const float3 p0 = float3(v0.position);
+        const float3 p1 = float3(v1.position);
+        const float3 p = float3(point.position);
+
+        const float3 axis = p1 - p0;
+        const float axisLengthSquared = dot(axis, axis);
+        const float t = (axisLengthSquared > 0.0f) ? saturate(dot(p - p0, axis) / axisLengthSquared) : 0.0f;
+
+        const float distance = length(p - (p0 + t * axis));
+        const float radiusError = abs(point.radius - lerp(v0.radius, v1.radius, t));
+        return distance + radiusError;
+    }
+}
+
+void CurveTessellation::resegmentCurveLineSegments(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
+{
+    const auto startTime = std::chrono::high_resolution_clock::now();
+
+    // Upper bound of the original segments merged into one, keeps the greedy search below O(n)
+    constexpr uint32_t kMaxMergedSegments = 64;
+    const float maxError = m_settings.hairResegmentationError;
+    m_lineSegmentsResegmentationError = maxError;
+
+    // A chunk of one geometry's segments, the task owns every strand starting in the chunk
+    struct ResegmentationTask
+    {
+        uint32_t meshIndex = 0;
+        uint32_t geometryIndex = 0;
+        uint32_t geometryFirstSegment = 0;
+        uint32_t geometryEndSegment = 0;
+        uint32_t firstSegment = 0;
+        uint32_t endSegment = 0;
+        std::vector<rtxcr::geometry::LineSegment> lineSegments;
+    };
+
+    std::vector<ResegmentationTask> tasks;
+    for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
+    {
+        const auto& mesh = meshInstances[meshIndex]->GetMesh();
+
+        // Morph target keyframes are stored per source strand point, animated meshes keep every segment
+        if (!mesh->IsCurve() || mesh->isMorphTargetAnimationMesh)
+        {
+            continue;
+        }
 
-                    // Detect line-segment geometry indices dynamically at runtime
-                    if (geometry->type == MeshGeometryPrimitiveType::Lines)
+        uint32_t segmentOffsetInMesh = 0;
+        for (uint32_t geometryIndex = 0; geometryIndex < m_curveGeometrySegmentCounts[meshIndex].size(); ++geometryIndex)
+        {
+            const uint32_t numLineSegments = m_curveGeometrySegmentCounts[meshIndex][geometryIndex];
+            for (uint32_t segmentOffset = 0; segmentOffset < numLineSegments; segmentOffset += m_segmentsPerTask)
+            {
+                ResegmentationTask& task = tasks.emplace_back();
+                task.meshIndex = meshIndex;
+                task.geometryIndex = geometryIndex;
+                task.geometryFirstSegment = segmentOffsetInMesh;
+                task.geometryEndSegment = segmentOffsetInMesh + numLineSegments;
+                task.firstSegment = segmentOffsetInMesh + segmentOffset;
+                task.endSegment = std::min(segmentOffsetInMesh + segmentOffset + m_segmentsPerTask, task.geometryEndSegment);
+            }
+            segmentOffsetInMesh += numLineSegments;
+        }
+    }
+
+    // Pass 1 (parallel): greedily merge every strand's segments as long as all skipped strand points stay within the error bound
+    m_threadPool->ParallelFor(static_cast<uint32_t>(tasks.size()), [&](const uint32_t taskIndex)
+    {
+        ResegmentationTask& task = tasks[taskIndex];
+        const auto& lineSegments = m_curvesLineSegments[task.meshIndex];
+
+        const auto isStrandStart = [&](const uint32_t segmentIndex)
+        {
+            return segmentIndex == task.geometryFirstSegment ||
+                   lineSegments[segmentIndex].geometryIndex != lineSegments[segmentIndex - 1].geometryIndex;
+        };
+
+        uint32_t strandStart = task.firstSegment;
+        while (strandStart < task.endSegment && !isStrandStart(strandStart))
+        {
+            ++strandStart;
+        }
+
+        while (strandStart < task.endSegment)
+        {
+            // Strands starting in this chunk are processed completely, even past the end of the chunk
+            uint32_t strandEnd = strandStart + 1;
+            while (strandEnd < task.geometryEndSegment && !isStrandStart(strandEnd))
+            {
+                ++strandEnd;
+            }
+
+            uint32_t first = strandStart;
+            while (first < strandEnd)
+            {
+                // Segments [first, last] are merged into (first.vertices[0], last.vertices[1])
+                uint32_t last = first;
+                while (last + 1 < strandEnd && last + 1 - first < kMaxMergedSegments)
+                {
+                    const auto& v0 = lineSegments[first].vertices[0];
+                    const auto& v1 = lineSegments[last + 1].vertices[1];
+
+                    bool isWithinBound = true;
+                    for (uint32_t pointIndex = first + 1; isWithinBound && pointIndex <= last + 1; ++pointIndex)
                     {
-                        if (!m_curvesLineSegments[meshIndex].empty())
-                        {
-                            const auto& prevSegmentEndVertex = m_curvesLineSegments[meshIndex].back().vertices[1];
-                            // If the current segment's start vertex differs from the previous segment's end vertex,
-                            // it indicates the start of a new geometry group
-                            if (!isnear(posStart.x, prevSegmentEndVertex.position[0]) ||
-                                !isnear(posStart.y, prevSegmentEndVertex.position[1]) ||
-                                !isnear(posStart.z, prevSegmentEndVertex.position[2]))
-                            {
-                                ++virtualGeometryIndex;
-                            }
-                        }
-
-                        segment.geometryIndex = virtualGeometryIndex;
+                        isWithinBound = getResegmentationError(lineSegments[pointIndex].vertices[0], v0, v1) <= maxError;
                     }
-                    else
+
+                    if (!isWithinBound)
                     {
-                        segment.geometryIndex = geometryIndex;
+                        break;
                     }
+                    ++last;
+                }
+
+                rtxcr::geometry::LineSegment& segment = task.lineSegments.emplace_back(lineSegments[first]);
+                segment.vertices[1] = lineSegments[last].vertices[1];
+                first = last + 1;
+            }
+
+            strandStart = strandEnd;
+        }
+    });
+
+    // Pass 2 (serial, O(tasks)): new segment counts and offsets, tasks are ordered by mesh, geometry and chunk
+    std::vector<uint32_t> taskSegmentOffsets(tasks.size(), 0);
+    std::vector<uint32_t> meshNumLineSegments(meshInstances.size(), 0);
+    for (uint32_t taskIndex = 0; taskIndex < tasks.size(); ++taskIndex)
+    {
+        const ResegmentationTask& task = tasks[taskIndex];
+        if (task.firstSegment == task.geometryFirstSegment)
+        {
+            m_curveGeometrySegmentCounts[task.meshIndex][task.geometryIndex] = 0;
+        }
+        taskSegmentOffsets[taskIndex] = meshNumLineSegments[task.meshIndex];
+        meshNumLineSegments[task.meshIndex] += static_cast<uint32_t>(task.lineSegments.size());
+        m_curveGeometrySegmentCounts[task.meshIndex][task.geometryIndex] += static_cast<uint32_t>(task.lineSegments.size());
+    }
+
+    std::vector<std::vector<rtxcr::geometry::LineSegment>> resegmentedLineSegments(meshInstances.size());
+    for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
+    {
+        resegmentedLineSegments[meshIndex].resize(meshNumLineSegments[meshIndex]);
+    }
+
+    // Pass 3 (parallel): gather the merged segments
+    m_threadPool->ParallelFor(static_cast<uint32_t>(tasks.size()), [&](const uint32_t taskIndex)
+    {
+        const ResegmentationTask& task = tasks[taskIndex];
+        std::copy(task.lineSegments.begin(), task.lineSegments.end(), resegmentedLineSegments[task.meshIndex].begin() + taskSegmentOffsets[taskIndex]);
+    });
+
+    uint32_t totalOriginalSegments = 0;
+    uint32_t totalSegments = 0;
+    constexpr double kBytesToMB = 1.0 / (1024.0 * 1024.0);
+    // Primitives and attribute stream bytes of a mesh in a representation, from the mesh's current segments
+    struct RepresentationSize
+    {
+        uint32_t numPrimitives = 0;
+        size_t bytes = 0;
+    };
+    auto getRepresentationSizes = [this](const uint32_t meshIndex)
+    {
+        std::array<RepresentationSize, (size_t)TessellationType::Count> sizes;
+        for (uint32_t type = 0; type < (uint32_t)TessellationType::Count; ++type)
+        {
+            const TessellationType tessellationType = (TessellationType)type;
+            uint32_t numIndices = 0;
+            uint32_t numVertices = 0;
+            uint32_t numAttributes = 0;
+            getTessellatedMeshCounts(tessellationType, meshIndex, numIndices, numVertices, numAttributes);
+            sizes[type].numPrimitives = (tessellationType == TessellationType::LinearSweptSphere) ?
+                static_cast<uint32_t>(m_curvesLineSegments[meshIndex].size()) : numIndices / 3;
+            sizes[type].bytes = numIndices * sizeof(decltype(BufferGroup::indexData)::value_type) +
+                numVertices * (sizeof(decltype(BufferGroup::positionData)::value_type) + sizeof(decltype(BufferGroup::radiusData)::value_type)) +
+                numAttributes * (sizeof(decltype(BufferGroup::normalData)::value_type) + sizeof(decltype(BufferGroup::tangentData)::value_type) +
+                    sizeof(decltype(BufferGroup::texcoord1Data)::value_type));
+        }
+        return sizes;
+    };
+
+    for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
+    {
+        const auto& mesh = meshInstances[meshIndex]->GetMesh();
+        if (!mesh->IsCurve() || mesh->isMorphTargetAnimationMesh)
+        {
+            continue;
+        }
+
+        const uint32_t numOriginalSegments = static_cast<uint32_t>(m_curvesLineSegments[meshIndex].size());
+        const uint32_t numSegments = meshNumLineSegments[meshIndex];
+        const auto originalSizes = getRepresentationSizes(meshIndex);
+        m_curvesLineSegments[meshIndex].swap(resegmentedLineSegments[meshIndex]);
+        const auto sizes = getRepresentationSizes(meshIndex);
 
-                    m_curvesLineSegments[meshIndex].push_back(segment);
+        if (numOriginalSegments > 0)
+        {
+            donut::log::info("Curve resegmentation (%s): %u -> %u segments (-%.1f%%), line segments %.2f -> %.2f MB",
+                mesh->name.c_str(), numOriginalSegments, numSegments, 100.0 * (1.0 - double(numSegments) / numOriginalSegments),
+                numOriginalSegments * sizeof(rtxcr::geometry::LineSegment) * kBytesToMB, numSegments * sizeof(rtxcr::geometry::LineSegment) * kBytesToMB);
+            // Polytube at the mesh's current order, selectPolyTubeOrders may pick another one from the camera later
+            for (uint32_t type = 0; type < (uint32_t)TessellationType::Count; ++type)
+            {
+                char representationName[64];
+                if ((TessellationType)type == TessellationType::Polytube)
+                {
+                    snprintf(representationName, sizeof(representationName), "Polytube order %u", m_curvePolyTubeOrder[meshIndex]);
+                }
+                else
+                {
+                    snprintf(representationName, sizeof(representationName), "%s", getTessellationTypeName((TessellationType)type));
                 }
+                donut::log::info("Curve resegmentation (%s, %s): %u -> %u primitives, %.2f -> %.2f MB (%.2f MB saved)",
+                    mesh->name.c_str(), representationName, originalSizes[type].numPrimitives, sizes[type].numPrimitives,
+                    originalSizes[type].bytes * kBytesToMB, sizes[type].bytes * kBytesToMB, (double(originalSizes[type].bytes) - double(sizes[type].bytes)) * kBytesToMB);
             }
-            m_curvesLineSegmentsIndexMap[mesh->name] = meshIndex;
         }
+
+        totalOriginalSegments += numOriginalSegments;
+        totalSegments += numSegments;
     }
+
+    const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+    donut::log::info("Curve resegmentation: %u -> %u segments with error bound %f in %.2f ms",
+        totalOriginalSegments, totalSegments, maxError, elapsedTime.count());
 }
 
-void CurveTessellation::copyToMeshBuffersCache(
-    const TessellationType tessellationType,
-    std::shared_ptr<BufferGroup> meshBuffers,
-    const std::vector<std::shared_ptr<MeshGeometry>>& geometries)
+namespace
+{
+    // Spreads the low 21 bits of v to every third bit
+    uint64_t expandMortonBits(uint64_t v)
+    {
+        v &= 0x1fffff;
+        v = (v | (v << 32)) & 0x1f00000000ffffull;
+        v = (v | (v << 16)) & 0x1f0000ff0000ffull;
+        v = (v | (v << 8)) & 0x100f00f00f00f00full;
+        v = (v | (v << 4)) & 0x10c30c30c30c30c3ull;
+        v = (v | (v << 2)) & 0x1249249249249249ull;
+        return v;
+    }
+
+    // 63-bit Morton code of a point quantized to 21 bits per axis within the bounds
+    uint64_t getMortonCode(const float3& position, const float3& boundsMin, const float3& boundsScale)
+    {
+        constexpr float kMaxCoord = float((1 << 21) - 1);
+        const float3 coord = clamp((position - boundsMin) * boundsScale, float3(0.0f), float3(kMaxCoord));
+        return expandMortonBits(uint64_t(coord.x)) | (expandMortonBits(uint64_t(coord.y)) << 1) | (expandMortonBits(uint64_t(coord.z)) << 2);
+    }
+}
+
+void CurveTessellation::reorderCurveStrands(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
 {
-    CurveMeshBuffersCache meshBuffersCache;
-    meshBuffersCache.buffers = std::make_shared<BufferGroup>();
-    meshBuffersCache.buffers->vertexBufferRanges = meshBuffers->vertexBufferRanges;
-    meshBuffersCache.buffers->indexData = meshBuffers->indexData;
-    meshBuffersCache.buffers->positionData = meshBuffers->positionData;
-    meshBuffersCache.buffers->normalData = meshBuffers->normalData;
-    meshBuffersCache.buffers->tangentData = meshBuffers->tangentData;
-    meshBuffersCache.buffers->texcoord1Data = meshBuffers->texcoord1Data;
-    meshBuffersCache.buffers->radiusData = meshBuffers->radiusData;
+    const auto startTime = std::chrono::high_resolution_clock::now();
+
+    // A line list geometry, strip geometries hold a single strand and keep their order.
+    // Geometries are never reordered themselves, they map to BLAS geometries and materials.
+    struct ReorderTask
+    {
+        uint32_t meshIndex = 0;
+        uint32_t firstSegment = 0;
+        uint32_t endSegment = 0;
+        // Where every strand moved, in the new order
+        std::vector<StrandMove> strandMoves;
+        double centerDistanceBefore = 0.0;
+        double centerDistanceAfter = 0.0;
+    };
 
-    meshBuffersCache.geometries.reserve(geometries.size());
-    for (const auto geometry : geometries)
+    std::vector<ReorderTask> tasks;
+    for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
     {
-        meshBuffersCache.geometries.push_back(*geometry);
+        if (!meshInstances[meshIndex]->GetMesh()->IsCurve())
+        {
+            continue;
+        }
+
+        uint32_t segmentOffsetInMesh = 0;
+        for (uint32_t geometryIndex = 0; geometryIndex < m_curveGeometrySegmentCounts[meshIndex].size(); ++geometryIndex)
+        {
+            const uint32_t numLineSegments = m_curveGeometrySegmentCounts[meshIndex][geometryIndex];
+            if (m_curveOriginalGeometryInfoCache[meshIndex][geometryIndex].type == MeshGeometryPrimitiveType::Lines && numLineSegments > 1)
+            {
+                ReorderTask& task = tasks.emplace_back();
+                task.meshIndex = meshIndex;
+                task.firstSegment = segmentOffsetInMesh;
+                task.endSegment = segmentOffsetInMesh + numLineSegments;
+            }
+            segmentOffsetInMesh += numLineSegments;
+        }
     }
 
-    m_curveMeshBuffersCache[(uint32_t)tessellationType].push_back(meshBuffersCache);
+    // Pass 1 (parallel): sort the strands of every geometry by the Morton code of their center within the geometry bounds,
+    // ties keep asset order. Strand indices are a contiguous range per geometry, the sorted strands take them in order.
+    m_threadPool->ParallelFor(static_cast<uint32_t>(tasks.size()), [&](const uint32_t taskIndex)
+    {
+        ReorderTask& task = tasks[taskIndex];
+        auto& lineSegments = m_curvesLineSegments[task.meshIndex];
+
+        struct Strand
+        {
+            uint64_t mortonCode = 0;
+            float3 center = float3(0.0f);
+            uint32_t firstSegment = 0;
+            uint32_t numSegments = 0;
+            uint32_t geometryIndex = 0;
+        };
+
+        std::vector<Strand> strands;
+        float3 boundsMin = float3(FLT_MAX);
+        float3 boundsMax = float3(-FLT_MAX);
+        for (uint32_t segmentIndex = task.firstSegment; segmentIndex < task.endSegment; ++segmentIndex)
+        {
+            const auto& segment = lineSegments[segmentIndex];
+            if (segmentIndex == task.firstSegment || segment.geometryIndex != lineSegments[segmentIndex - 1].geometryIndex)
+            {
+                Strand& strand = strands.emplace_back();
+                strand.firstSegment = segmentIndex;
+                strand.geometryIndex = segment.geometryIndex;
+            }
+            ++strands.back().numSegments;
+
+            boundsMin = min(boundsMin, min(float3(segment.vertices[0].position), float3(segment.vertices[1].position)));
+            boundsMax = max(boundsMax, max(float3(segment.vertices[0].position), float3(segment.vertices[1].position)));
+        }
+
+        const float3 extent = boundsMax - boundsMin;
+        const float3 boundsScale = float3(
+            extent.x > 0.0f ? float((1 << 21) - 1) / extent.x : 0.0f,
+            extent.y > 0.0f ? float((1 << 21) - 1) / extent.y : 0.0f,
+            extent.z > 0.0f ? float((1 << 21) - 1) / extent.z : 0.0f);
+
+        for (uint32_t strandIndex = 0; strandIndex < strands.size(); ++strandIndex)
+        {
+            Strand& strand = strands[strandIndex];
+            float3 strandMin = float3(FLT_MAX);
+            float3 strandMax = float3(-FLT_MAX);
+            for (uint32_t segmentIndex = strand.firstSegment; segmentIndex < strand.firstSegment + strand.numSegments; ++segmentIndex)
+            {
+                const auto& segment = lineSegments[segmentIndex];
+                strandMin = min(strandMin, min(float3(segment.vertices[0].position), float3(segment.vertices[1].position)));
+                strandMax = max(strandMax, max(float3(segment.vertices[0].position), float3(segment.vertices[1].position)));
+            }
+            strand.center = (strandMin + strandMax) * 0.5f;
+            strand.mortonCode = getMortonCode(strand.center, boundsMin, boundsScale);
+
+            if (strandIndex > 0)
+            {
+                task.centerDistanceBefore += length(strand.center - strands[strandIndex - 1].center);
+            }
+        }
+
+        std::vector<uint32_t> order(strands.size());
+        for (uint32_t strandIndex = 0; strandIndex < order.size(); ++strandIndex)
+        {
+            order[strandIndex] = strandIndex;
+        }
+        std::stable_sort(order.begin(), order.end(), [&](const uint32_t lhs, const uint32_t rhs)
+        {
+            return strands[lhs].mortonCode < strands[rhs].mortonCode;
+        });
+
+        const std::vector<rtxcr::geometry::LineSegment> geometryLineSegments(lineSegments.begin() + task.firstSegment, lineSegments.begin() + task.endSegment);
+        task.strandMoves.resize(order.size());
+        uint32_t newFirstSegment = task.firstSegment;
+        for (uint32_t rank = 0; rank < order.size(); ++rank)
+        {
+            const Strand& strand = strands[order[rank]];
+            const uint32_t newGeometryIndex = strands[rank].geometryIndex;
+
+            StrandMove& move = task.strandMoves[rank];
+            move.oldFirstSegment = strand.firstSegment;
+            move.newFirstSegment = newFirstSegment;
+            move.numSegments = strand.numSegments;
+            move.oldGeometryIndex = strand.geometryIndex;
+            move.newGeometryIndex = newGeometryIndex;
+
+            for (uint32_t segmentOffset = 0; segmentOffset < strand.numSegments; ++segmentOffset)
+            {
+                rtxcr::geometry::LineSegment& segment = lineSegments[newFirstSegment + segmentOffset];
+                segment = geometryLineSegments[strand.firstSegment - task.firstSegment + segmentOffset];
+                segment.geometryIndex = newGeometryIndex;
+            }
+            newFirstSegment += strand.numSegments;
+
+            if (rank > 0)
+            {
+                task.centerDistanceAfter += length(strand.center - strands[order[rank - 1]].center);
+            }
+        }
+    });
+
+    // Pass 2 (parallel): keyframe point p of a strand lives at (first segment + strand index + p), move every keyframe's points along
+    std::vector<uint32_t> morphTaskIndices;
+    for (uint32_t taskIndex = 0; taskIndex < tasks.size(); ++taskIndex)
+    {
+        if (!meshInstances[tasks[taskIndex].meshIndex]->GetMesh()->buffers->morphTargetData.empty())
+        {
+            morphTaskIndices.push_back(taskIndex);
+        }
+    }
+
+    // Geometries of a mesh own disjoint point ranges of its keyframes, so their tasks can move points concurrently
+    m_threadPool->ParallelFor(static_cast<uint32_t>(morphTaskIndices.size()), [&](const uint32_t morphTaskIndex)
+    {
+        const ReorderTask& task = tasks[morphTaskIndices[morphTaskIndex]];
+        applyStrandMovesToKeyframes(*meshInstances[task.meshIndex]->GetMesh()->buffers, task.strandMoves, false);
+    });
+
+    m_lineSegmentsMortonOrdered = true;
+
+    double centerDistanceBefore = 0.0;
+    double centerDistanceAfter = 0.0;
+    uint32_t numStrands = 0;
+    for (const ReorderTask& task : tasks)
+    {
+        centerDistanceBefore += task.centerDistanceBefore;
+        centerDistanceAfter += task.centerDistanceAfter;
+        numStrands += static_cast<uint32_t>(task.strandMoves.size());
+    }
+
+    const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+    donut::log::info("Curve strand reorder: %u strands of %u geometries in %.2f ms, mean distance between consecutive strands %.4f -> %.4f",
+        numStrands, static_cast<uint32_t>(tasks.size()), elapsedTime.count(),
+        numStrands > 1 ? centerDistanceBefore / (numStrands - 1) : 0.0, numStrands > 1 ? centerDistanceAfter / (numStrands - 1) : 0.0);
+}
+
+void CurveTessellation::applyStrandMovesToKeyframes(BufferGroup& meshBuffers, const std::vector<StrandMove>& strandMoves, const bool isInverse)
+{
+    if (strandMoves.empty())
+    {
+        return;
+    }
+
+    // The moves permute the points of one geometry, a contiguous range of every keyframe
+    uint32_t firstPoint = UINT32_MAX;
+    uint32_t endPoint = 0;
+    for (const StrandMove& move : strandMoves)
+    {
+        firstPoint = std::min(firstPoint, move.oldFirstSegment + move.oldGeometryIndex);
+        endPoint = std::max(endPoint, move.oldFirstSegment + move.oldGeometryIndex + move.numSegments + 1);
+    }
+
+    std::vector<float4> points(endPoint - firstPoint);
+    for (const auto& keyframeRange : meshBuffers.morphTargetBufferRange)
+    {
+        float4* keyframe = meshBuffers.morphTargetData.data() + keyframeRange.byteOffset / sizeof(float4);
+        assert(keyframeRange.byteOffset / sizeof(float4) + endPoint <= meshBuffers.morphTargetData.size());
+
+        std::copy(keyframe + firstPoint, keyframe + endPoint, points.begin());
+        for (const StrandMove& move : strandMoves)
+        {
+            const uint32_t oldFirstPoint = move.oldFirstSegment + move.oldGeometryIndex;
+            const uint32_t newFirstPoint = move.newFirstSegment + move.newGeometryIndex;
+            const uint32_t srcFirstPoint = isInverse ? newFirstPoint : oldFirstPoint;
+            const uint32_t dstFirstPoint = isInverse ? oldFirstPoint : newFirstPoint;
+            std::copy_n(points.begin() + (srcFirstPoint - firstPoint), move.numSegments + 1, keyframe + dstFirstPoint);
+        }
+    }
+}
+
+void CurveTessellation::generateCurveLods(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
+{
+    const auto startTime = std::chrono::high_resolution_clock::now();
+
+    // Fixed seed, the same scene always produces the same LOD chain
+    constexpr uint32_t kLodSeed = 0x9e3779b9u;
+    const uint32_t numLods = static_cast<uint32_t>(std::min(m_settings.hairLodLevels, 8));
+    m_curveLodStrandKeepRatio = clamp(m_settings.hairLodStrandKeepRatio, 0.05f, 0.95f);
+
+    m_curvesLodLineSegments.assign(numLods - 1, std::vector<std::vector<rtxcr::geometry::LineSegment>>(meshInstances.size()));
+    m_curveLodGeometrySegmentCounts.assign(numLods - 1, std::vector<std::vector<uint32_t>>(meshInstances.size()));
+    m_curveLodStrandRadius.assign(meshInstances.size(), 0.0f);
+
+    // One task per (mesh, LOD), every level is generated from LOD0 so the tasks are independent
+    std::vector<uint32_t> lodMeshIndices;
+    for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
+    {
+        const auto& mesh = meshInstances[meshIndex]->GetMesh();
+
+        // Morph target keyframes are stored per source strand point, animated meshes always render LOD0
+        if (!mesh->IsCurve() || mesh->isMorphTargetAnimationMesh || m_curvesLineSegments[meshIndex].empty())
+        {
+            continue;
+        }
+
+        lodMeshIndices.push_back(meshIndex);
+        m_curveLodStrandRadius[meshIndex] = CurveLodGenerator::getAverageRadius(m_curvesLineSegments[meshIndex]);
+    }
+
+    m_threadPool->ParallelFor(static_cast<uint32_t>(lodMeshIndices.size() * (numLods - 1)), [&](const uint32_t taskIndex)
+    {
+        const uint32_t meshIndex = lodMeshIndices[taskIndex % lodMeshIndices.size()];
+        const uint32_t lod = taskIndex / static_cast<uint32_t>(lodMeshIndices.size()) + 1;
+        CurveLodGenerator::generateLevel(
+            m_curvesLineSegments[meshIndex],
+            m_curveGeometrySegmentCounts[meshIndex],
+            m_curveLodStrandKeepRatio,
+            lod,
+            kLodSeed,
+            m_curvesLodLineSegments[lod - 1][meshIndex],
+            m_curveLodGeometrySegmentCounts[lod - 1][meshIndex]);
+    });
+
+    for (const uint32_t meshIndex : lodMeshIndices)
+    {
+        const auto& mesh = meshInstances[meshIndex]->GetMesh();
+        const double projectedArea = CurveLodGenerator::getProjectedArea(m_curvesLineSegments[meshIndex]);
+        for (uint32_t lod = 1; lod < numLods; ++lod)
+        {
+            const auto& lodLineSegments = m_curvesLodLineSegments[lod - 1][meshIndex];
+            const double areaRatio = (projectedArea > 0.0) ? CurveLodGenerator::getProjectedArea(lodLineSegments) / projectedArea : 1.0;
+            donut::log::info("Curve LOD %u (%s): %u -> %u segments, projected area %.1f%% of LOD0",
+                lod, mesh->name.c_str(), static_cast<uint32_t>(m_curvesLineSegments[meshIndex].size()),
+                static_cast<uint32_t>(lodLineSegments.size()), 100.0 * areaRatio);
+
+        }
+    }
+
+    const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+    donut::log::info("Curve LOD generation: %u levels of %u meshes, strand keep ratio %.2f in %.2f ms",
+        numLods, static_cast<uint32_t>(lodMeshIndices.size()), m_curveLodStrandKeepRatio, elapsedTime.count());
+}
+
+void CurveTessellation::tessellateCurveMeshes(
+    const TessellationType tessellationType,
+    const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
+{
+    const auto startTime = std::chrono::high_resolution_clock::now();
+
+    // Re-tessellating a representation replaces its cached copy.
+    // If the scene is displaying the old copy it is released on the next replacingSceneMesh.
+    auto& curveMeshBuffersCache = m_curveMeshBuffersCache[(uint32_t)tessellationType];
+    std::vector<CurveMeshBuffersCache>().swap(curveMeshBuffersCache);
+    std::vector<std::vector<CurveMeshBuffersCache>>().swap(m_curveLodMeshBuffersCache[(uint32_t)tessellationType]);
+    m_curveMeshBuffersCacheBytes[(uint32_t)tessellationType] = 0;
+    if (m_sceneTessellationType == tessellationType)
+    {
+        m_sceneTessellationType = TessellationType::Count;
+        std::fill(m_curveMeshSceneLod.begin(), m_curveMeshSceneLod.end(), 0);
+    }
+
+    if (m_diskCache && loadTessellationFromDiskCache(tessellationType, meshInstances))
+    {
+        tessellateCurveLods(tessellationType, meshInstances);
+        commitTessellationCache(tessellationType);
+
+        const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+        donut::log::info("Curve tessellation (%s): loaded from disk cache in %.2f ms, %.2f MB cached",
+            getTessellationTypeName(tessellationType), elapsedTime.count(), getTessellationCacheBytes(tessellationType) / (1024.0 * 1024.0));
+        return;
+    }
+
+    if (tessellationType == TessellationType::LinearSweptSphere && m_settings.enableLssSuccessiveImplicit)
+    {
+        const uint32_t numVertices = tessellateLinearSweptSpheresSuccessive(meshInstances);
+        tessellateCurveLods(tessellationType, meshInstances);
+        commitTessellationCache(tessellationType);
+
+        const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+        donut::log::info("Curve tessellation (%s, successive implicit): %u vertices on %u threads in %.2f ms, %.2f MB cached",
+            getTessellationTypeName(tessellationType), numVertices, m_threadPool->GetThreadCount(), elapsedTime.count(),
+            getTessellationCacheBytes(tessellationType) / (1024.0 * 1024.0));
+
+        if (m_diskCache)
+        {
+            storeTessellationToDiskCache(tessellationType);
+        }
+        return;
+    }
+
+    const uint32_t numTasks = buildCurveMeshBuffers(tessellationType, meshInstances, m_curvesLineSegments, m_curveGeometrySegmentCounts,
+        m_lineSegmentsResegmentationError > 0.0f, curveMeshBuffersCache);
+
+    const bool useSimdKernels = useSimdTessellationKernels(tessellationType);
+
+    tessellateCurveLods(tessellationType, meshInstances);
+    commitTessellationCache(tessellationType);
+
+    const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+    donut::log::info("Curve tessellation (%s, %s kernels): %u tasks on %u threads in %.2f ms, %.2f MB cached",
+        getTessellationTypeName(tessellationType), useSimdKernels ? getCurveTessellationKernelIsaName(CurveTessellationKernels::getSupportedIsa()) : "library",
+        numTasks, m_threadPool->GetThreadCount(), elapsedTime.count(),
+        getTessellationCacheBytes(tessellationType) / (1024.0 * 1024.0));
+
+    if (m_diskCache)
+    {
+        storeTessellationToDiskCache(tessellationType);
+    }
+}
+
+namespace
+{
+    // Tessellates numLineSegments segments with the geometry library into the buffers, starting at output vertex globalIndex.
+    // Returns the vertex following the last one written.
+    uint32_t tessellateWithGeometryLibrary(
+        const TessellationType tessellationType,
+        const std::vector<rtxcr::geometry::LineSegment>& lineSegments,
+        const uint32_t numLineSegments,
+        BufferGroup& meshBuffers,
+        const uint32_t globalIndex)
+    {
+        switch (tessellationType)
+        {
+        case TessellationType::Polytube:
+            return rtxcr::geometry::convertToTrianglePolyTubes(
+                lineSegments,
+                numLineSegments,
+                meshBuffers.indexData.data(),
+                (float*)(meshBuffers.positionData.data()),
+                meshBuffers.normalData.data(),
+                meshBuffers.tangentData.data(),
+                (float*)meshBuffers.texcoord1Data.data(),
+                meshBuffers.radiusData.data(),
+                globalIndex);
+        case TessellationType::DisjointOrthogonalTriangleStrip:
+            return rtxcr::geometry::convertToDisjointOrthogonalTriangleStrips(
+                lineSegments,
+                numLineSegments,
+                meshBuffers.indexData.data(),
+                (float*)(meshBuffers.positionData.data()),
+                meshBuffers.normalData.data(),
+                meshBuffers.tangentData.data(),
+                (float*)meshBuffers.texcoord1Data.data(),
+                meshBuffers.radiusData.data(),
+                globalIndex);
+        case TessellationType::LinearSweptSphere:
+            return rtxcr::geometry::convertToLinearSweptSpheres(
+                lineSegments,
+                numLineSegments,
+                (float*)meshBuffers.positionData.data(),
+                (float*)meshBuffers.radiusData.data(),
+                globalIndex);
+        default:
+            return globalIndex;
+        }
+    }
+}
+
+bool CurveTessellation::useSimdTessellationKernels(const TessellationType tessellationType) const
+{
+    // The SIMD kernels only cover the triangle representations, LSS is a plain copy of the segment end points
+    return m_settings.enableSimdHairTessellation && (tessellationType != TessellationType::LinearSweptSphere);
+}
+
+uint32_t CurveTessellation::buildCurveMeshBuffers(
+    const TessellationType tessellationType,
+    const std::vector<std::shared_ptr<MeshInstance>>& meshInstances,
+    const std::vector<std::vector<rtxcr::geometry::LineSegment>>& curvesLineSegments,
+    const std::vector<std::vector<uint32_t>>& curveGeometrySegmentCounts,
+    const bool useSegmentVertexCounts,
+    std::vector<CurveMeshBuffersCache>& curveMeshBuffersCache)
+{
+    uint32_t numVerticesPerSegment = 0;
+    switch (tessellationType)
+    {
+    case TessellationType::Polytube:
+        // The mesh's polytube order of faces with 2 triangles (3 vertices each), set per mesh below
+        break;
+    case TessellationType::DisjointOrthogonalTriangleStrip:
+        // 4 triangles (3 vertices each)
+        numVerticesPerSegment = 4 * 3;
+        break;
+    case TessellationType::LinearSweptSphere:
+        // LSS list format, 2 vertices per linear segment.
+        // The successive implicit format is built by tessellateLinearSweptSpheresSuccessive.
+        numVerticesPerSegment = 2;
+        break;
+    default:
+        assert(!"Unknown curve tessellation type");
+        return 0;
+    }
+    const bool hasIndexBuffer = (tessellationType != TessellationType::LinearSweptSphere);
+
+    // Pass 1 (serial, O(geometries)): size the output buffers and compute every geometry's output offsets up front,
+    // so the tessellation tasks below are fully independent and write directly into the pre-sized cache vectors.
+    std::vector<TessellationTask> tasks;
+    for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
+    {
+        const auto& mesh = meshInstances[meshIndex]->GetMesh();
+
+        if (!mesh->IsCurve())
+        {
+            continue;
+        }
+
+        const uint32_t curveIndex = static_cast<uint32_t>(curveMeshBuffersCache.size());
+        auto& meshBuffersCache = curveMeshBuffersCache.emplace_back();
+
+        const auto& meshGeometryCache = m_curveOriginalGeometryInfoCache[meshIndex];
+        if (curveGeometrySegmentCounts[meshIndex].size() != meshGeometryCache.size())
+        {
+            continue;
+        }
+
+        if (tessellationType == TessellationType::Polytube)
+        {
+            numVerticesPerSegment = CurveTessellationKernels::getPolyTubeVerticesPerSegment(m_curvePolyTubeOrder[meshIndex]);
+        }
+
+        meshBuffersCache.buffers = std::make_shared<BufferGroup>();
+        meshBuffersCache.buffers->vertexBufferRanges = m_curveOriginalVertexBufferRanges[meshIndex];
+        meshBuffersCache.geometries = meshGeometryCache;
+
+        auto& meshBuffers = meshBuffersCache.buffers;
+        const uint32_t totalVertices = curvesLineSegments[meshIndex].size() * numVerticesPerSegment;
+        const uint32_t totalIndices = hasIndexBuffer ? totalVertices : 0;
+        const uint32_t totalAttributes = hasIndexBuffer ? totalVertices : 0;
+
+        meshBuffers->indexData.resize(totalIndices);
+        meshBuffers->positionData.resize(totalVertices);
+        meshBuffers->normalData.resize(totalAttributes);
+        meshBuffers->tangentData.resize(totalAttributes);
+        meshBuffers->texcoord1Data.resize(totalAttributes);
+        meshBuffers->radiusData.resize(totalVertices);
+
+        // Resegmented and LOD geometries no longer follow the source vertex count
+        const bool isResegmented = useSegmentVertexCounts && !mesh->isMorphTargetAnimationMesh;
+        uint32_t indexOffsetInMesh = 0;
+        uint32_t vertexOffsetInMesh = 0;
+        uint32_t segmentOffsetInMesh = 0;
+
+        for (uint32_t geometryIndex = 0; geometryIndex < meshGeometryCache.size(); ++geometryIndex)
+        {
+            const auto& geometryCache = meshGeometryCache[geometryIndex];
+            auto& geometry = meshBuffersCache.geometries[geometryIndex];
+
+            const bool isLines = (geometryCache.type == MeshGeometryPrimitiveType::Lines);
+            const uint32_t numLineSegments = curveGeometrySegmentCounts[meshIndex][geometryIndex];
+            const uint32_t vertexSize = (hasIndexBuffer && !isResegmented) ?
+                (isLines ? geometryCache.numVertices / 2 : geometryCache.numVertices - 1) : numLineSegments;
+
+            const uint32_t geometryNumIndices = hasIndexBuffer ? numLineSegments * numVerticesPerSegment : 0;
+            const uint32_t geometryNumVertices = vertexSize * numVerticesPerSegment;
+            geometry.numIndices = geometryNumIndices;
+            geometry.numVertices = geometryNumVertices;
+            geometry.indexOffsetInMesh = indexOffsetInMesh;
+            geometry.vertexOffsetInMesh = vertexOffsetInMesh;
+            geometry.globalGeometryIndex = geometryIndex;
+
+            // Split large geometries so a single huge groom still spreads over all workers.
+            // The geometry library advances its globalIndex by one per emitted vertex, so each chunk's start is a prefix sum.
+            for (uint32_t segmentOffset = 0; segmentOffset < numLineSegments; segmentOffset += m_segmentsPerTask)
+            {
+                TessellationTask task;
+                task.meshIndex = meshIndex;
+                task.curveIndex = curveIndex;
+                task.numLineSegments = std::min(m_segmentsPerTask, numLineSegments - segmentOffset);
+                task.numVerticesPerSegment = numVerticesPerSegment;
+                task.globalIndex = (segmentOffsetInMesh + segmentOffset) * numVerticesPerSegment;
+                tasks.push_back(task);
+            }
+
+            indexOffsetInMesh += geometryNumIndices;
+            vertexOffsetInMesh += geometryNumVertices;
+            segmentOffsetInMesh += numLineSegments;
+        }
+
+        assert(segmentOffsetInMesh == curvesLineSegments[meshIndex].size());
+    }
+
+    const bool useSimdKernels = useSimdTessellationKernels(tessellationType);
+
+    // Pass 2 (parallel): every task owns a disjoint range of the output vectors
+    m_threadPool->ParallelFor(static_cast<uint32_t>(tasks.size()), [&](const uint32_t taskIndex)
+    {
+        const TessellationTask& task = tasks[taskIndex];
+        const auto& lineSegments = curvesLineSegments[task.meshIndex];
+        auto& meshBuffers = curveMeshBuffersCache[task.curveIndex].buffers;
+        const uint32_t polyTubeOrder = m_curvePolyTubeOrder[task.meshIndex];
+
+        uint32_t globalIndexEnd = 0;
+        // The geometry library only builds the default polytube order, the other orders always use the local kernels
+        if (useSimdKernels || (tessellationType == TessellationType::Polytube && polyTubeOrder != RTXCR_CURVE_POLYTUBE_ORDER))
+        {
+            CurveTessellationOutput output;
+            output.indices = meshBuffers->indexData.data();
+            output.positions = meshBuffers->positionData.data();
+            output.normals = meshBuffers->normalData.data();
+            output.tangents = meshBuffers->tangentData.data();
+            output.texCoords = meshBuffers->texcoord1Data.data();
+            output.radius = meshBuffers->radiusData.data();
+
+            const rtxcr::geometry::LineSegment* firstLineSegment = lineSegments.data() + task.globalIndex / task.numVerticesPerSegment;
+            if (tessellationType == TessellationType::Polytube)
+            {
+                const auto tessellatePolyTubes = useSimdKernels ?
+                    CurveTessellationKernels::tessellatePolyTubes :
+                    CurveTessellationKernels::tessellatePolyTubesScalar;
+                globalIndexEnd = tessellatePolyTubes(firstLineSegment, task.numLineSegments, polyTubeOrder, output, task.globalIndex);
+            }
+            else
+            {
+                globalIndexEnd = CurveTessellationKernels::tessellateDisjointOrthogonalTriangleStrips(
+                    firstLineSegment, task.numLineSegments, output, task.globalIndex);
+            }
+        }
+        else
+        {
+            // The library reads segment globalIndex / numVerticesPerSegment of the full list
+            globalIndexEnd = tessellateWithGeometryLibrary(tessellationType, lineSegments, task.numLineSegments, *meshBuffers, task.globalIndex);
+        }
+
+        assert(globalIndexEnd == task.globalIndex + task.numLineSegments * task.numVerticesPerSegment);
+        (void)globalIndexEnd;
+    });
+
+    return static_cast<uint32_t>(tasks.size());
+}
+
+void CurveTessellation::tessellateCurveLods(const TessellationType tessellationType, const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
+{
+    auto& curveLodMeshBuffersCache = m_curveLodMeshBuffersCache[(uint32_t)tessellationType];
+    curveLodMeshBuffersCache.resize(m_curvesLodLineSegments.size());
+    for (uint32_t lod = 1; lod <= m_curvesLodLineSegments.size(); ++lod)
+    {
+        buildCurveMeshBuffers(tessellationType, meshInstances, m_curvesLodLineSegments[lod - 1], m_curveLodGeometrySegmentCounts[lod - 1],
+            true, curveLodMeshBuffersCache[lod - 1]);
+    }
+}
+
+void CurveTessellation::commitTessellationCache(const TessellationType tessellationType)
+{
+    m_curveMeshBuffersCacheBytes[(uint32_t)tessellationType] = 0;
+    for (const auto& meshBuffersCache : m_curveMeshBuffersCache[(uint32_t)tessellationType])
+    {
+        m_curveMeshBuffersCacheBytes[(uint32_t)tessellationType] += getMeshBuffersCacheBytes(*meshBuffersCache.buffers);
+    }
+    for (const auto& lodMeshBuffersCache : m_curveLodMeshBuffersCache[(uint32_t)tessellationType])
+    {
+        for (const auto& meshBuffersCache : lodMeshBuffersCache)
+        {
+            if (meshBuffersCache.buffers)
+            {
+                m_curveMeshBuffersCacheBytes[(uint32_t)tessellationType] += getMeshBuffersCacheBytes(*meshBuffersCache.buffers);
+            }
+        }
+    }
+
+    m_curveMeshBuffersCacheValid[(uint32_t)tessellationType] = true;
+    m_curveMeshBuffersCachePeakBytes = std::max(m_curveMeshBuffersCachePeakBytes, getTessellationCacheTotalBytes());
+}
+
+uint64_t CurveTessellation::hashCurveSourceGeometry(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
+{
+    uint64_t hash = 0;
+    for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
+    {
+        const auto& mesh = meshInstances[meshIndex]->GetMesh();
+        if (!mesh->IsCurve())
+        {
+            continue;
+        }
+
+        hash = CurveTessellationDiskCache::hashBytes(&meshIndex, sizeof(meshIndex), hash);
+        for (const auto& geometry : mesh->geometries)
+        {
+            const uint32_t geometryInfo[] = {
+                (uint32_t)geometry->type, geometry->numIndices, geometry->numVertices, geometry->indexOffsetInMesh, geometry->vertexOffsetInMesh };
+            hash = CurveTessellationDiskCache::hashBytes(geometryInfo, sizeof(geometryInfo), hash);
+        }
+
+        const auto& meshBuffers = mesh->buffers;
+        hash = CurveTessellationDiskCache::hashBytes(meshBuffers->indexData.data(), meshBuffers->indexData.size() * sizeof(uint32_t), hash);
+        hash = CurveTessellationDiskCache::hashBytes(meshBuffers->positionData.data(), meshBuffers->positionData.size() * sizeof(float3), hash);
+        hash = CurveTessellationDiskCache::hashBytes(meshBuffers->radiusData.data(), meshBuffers->radiusData.size() * sizeof(float), hash);
+        hash = CurveTessellationDiskCache::hashBytes(meshBuffers->texcoord1Data.data(), meshBuffers->texcoord1Data.size() * sizeof(float2), hash);
+    }
+    return hash;
+}
+
+CurveTessellationDiskCache::Key CurveTessellation::getDiskCacheKey(const TessellationType tessellationType) const
+{
+    CurveTessellationDiskCache::Key key;
+    key.sourceGeometryHash = m_curveSourceGeometryHash;
+    key.tessellationType = (uint32_t)tessellationType;
+    key.polyTubeOrders = (tessellationType == TessellationType::Polytube) ? static_cast<uint32_t>(CurveTessellationDiskCache::hashBytes(
+        m_curvePolyTubeOrder.data(), m_curvePolyTubeOrder.size() * sizeof(uint32_t), RTXCR_CURVE_POLYTUBE_ORDER)) : 0;
+    key.radiusScale = m_lineSegmentsRadiusScale;
+    key.resegmentationError = m_lineSegmentsResegmentationError;
+    key.strandOrder = m_lineSegmentsMortonOrdered ? 1 : 0;
+    key.lssSuccessiveImplicit = (tessellationType == TessellationType::LinearSweptSphere && m_settings.enableLssSuccessiveImplicit) ? 1 : 0;
+    key.kernels = useSimdTessellationKernels(tessellationType) ? 1 + static_cast<uint32_t>(CurveTessellationKernels::getSupportedIsa()) : 0;
+    return key;
+}
+
+bool CurveTessellation::loadTessellationFromDiskCache(
+    const TessellationType tessellationType,
+    const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
+{
+    const std::unique_ptr<CurveTessellationDiskCache::Entry> entry = m_diskCache->load(getDiskCacheKey(tessellationType));
+    if (!entry)
+    {
+        return false;
+    }
+
+    // Check the entry against the scene before touching the cache slot, a mismatch falls back to tessellating
+    const auto& meshes = entry->getMeshes();
+    std::vector<uint32_t> curveMeshIndices;
+    for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
+    {
+        if (!meshInstances[meshIndex]->GetMesh()->IsCurve())
+        {
+            continue;
+        }
+
+        const uint32_t curveIndex = static_cast<uint32_t>(curveMeshIndices.size());
+        curveMeshIndices.push_back(meshIndex);
+        if (curveIndex >= meshes.size())
+        {
+            break;
+        }
+
+        const auto& mesh = meshes[curveIndex];
+        uint32_t numIndices = 0;
+        uint32_t numVertices = 0;
+        uint32_t numAttributes = 0;
+        getTessellatedMeshCounts(tessellationType, meshIndex, numIndices, numVertices, numAttributes);
+        bool isValid = (mesh.numGeometries == m_curveOriginalGeometryInfoCache[meshIndex].size()) &&
+                       (mesh.numVertices == numVertices) &&
+                       (mesh.numIndices == numIndices) &&
+                       (mesh.numAttributes == numAttributes);
+        for (uint32_t geometryIndex = 0; isValid && geometryIndex < mesh.numGeometries; ++geometryIndex)
+        {
+            const auto& geometry = mesh.geometries[geometryIndex];
+            isValid = (uint64_t(geometry.indexOffsetInMesh) + geometry.numIndices <= mesh.numIndices) &&
+                      (uint64_t(geometry.vertexOffsetInMesh) + geometry.numVertices <= mesh.numVertices);
+        }
+
+        if (!isValid)
+        {
+            donut::log::warning("Curve tessellation disk cache: %s does not match the scene, rebuilding",
+                m_diskCache->getEntryPath(getDiskCacheKey(tessellationType)).string().c_str());
+            return false;
+        }
+    }
+
+    if (curveMeshIndices.size() != meshes.size())
+    {
+        donut::log::warning("Curve tessellation disk cache: %s does not match the scene, rebuilding",
+            m_diskCache->getEntryPath(getDiskCacheKey(tessellationType)).string().c_str());
+        return false;
+    }
+
+    auto& curveMeshBuffersCache = m_curveMeshBuffersCache[(uint32_t)tessellationType];
+    curveMeshBuffersCache.resize(meshes.size());
+    m_threadPool->ParallelFor(static_cast<uint32_t>(meshes.size()), [&](const uint32_t curveIndex)
+    {
+        const uint32_t meshIndex = curveMeshIndices[curveIndex];
+        const auto& mesh = meshes[curveIndex];
+        auto& meshBuffersCache = curveMeshBuffersCache[curveIndex];
+
+        meshBuffersCache.geometries = m_curveOriginalGeometryInfoCache[meshIndex];
+        for (uint32_t geometryIndex = 0; geometryIndex < mesh.numGeometries; ++geometryIndex)
+        {
+            auto& geometry = meshBuffersCache.geometries[geometryIndex];
+            geometry.numIndices = mesh.geometries[geometryIndex].numIndices;
+            geometry.numVertices = mesh.geometries[geometryIndex].numVertices;
+            geometry.indexOffsetInMesh = mesh.geometries[geometryIndex].indexOffsetInMesh;
+            geometry.vertexOffsetInMesh = mesh.geometries[geometryIndex].vertexOffsetInMesh;
+            geometry.globalGeometryIndex = geometryIndex;
+        }
+
+        // BufferGroup owns its attributes in std::vectors, so the mapped streams are copied once
+        auto meshBuffers = std::make_shared<BufferGroup>();
+        meshBuffers->vertexBufferRanges = m_curveOriginalVertexBufferRanges[meshIndex];
+        meshBuffers->indexData.assign(mesh.indices, mesh.indices + mesh.numIndices);
+        meshBuffers->positionData.assign(mesh.positions, mesh.positions + mesh.numVertices);
+        meshBuffers->radiusData.assign(mesh.radius, mesh.radius + mesh.numVertices);
+        meshBuffers->normalData.assign(mesh.normals, mesh.normals + mesh.numAttributes);
+        meshBuffers->tangentData.assign(mesh.tangents, mesh.tangents + mesh.numAttributes);
+        meshBuffers->texcoord1Data.assign(mesh.texCoords, mesh.texCoords + mesh.numAttributes);
+        meshBuffersCache.buffers = std::move(meshBuffers);
+    });
+
+    return true;
+}
+
+void CurveTessellation::storeTessellationToDiskCache(const TessellationType tessellationType)
+{
+    const auto startTime = std::chrono::high_resolution_clock::now();
+
+    const auto& curveMeshBuffersCache = m_curveMeshBuffersCache[(uint32_t)tessellationType];
+    std::vector<std::vector<CurveTessellationDiskCache::GeometryRecord>> geometryRecords(curveMeshBuffersCache.size());
+    std::vector<CurveTessellationDiskCache::MeshView> meshes(curveMeshBuffersCache.size());
+    for (uint32_t curveIndex = 0; curveIndex < curveMeshBuffersCache.size(); ++curveIndex)
+    {
+        const auto& meshBuffersCache = curveMeshBuffersCache[curveIndex];
+        const auto& meshBuffers = meshBuffersCache.buffers;
+
+        for (const auto& geometry : meshBuffersCache.geometries)
+        {
+            auto& record = geometryRecords[curveIndex].emplace_back();
+            record.numIndices = geometry.numIndices;
+            record.numVertices = geometry.numVertices;
+            record.indexOffsetInMesh = geometry.indexOffsetInMesh;
+            record.vertexOffsetInMesh = geometry.vertexOffsetInMesh;
+        }
+
+        auto& mesh = meshes[curveIndex];
+        mesh.geometries = geometryRecords[curveIndex].data();
+        mesh.numGeometries = static_cast<uint32_t>(geometryRecords[curveIndex].size());
+        mesh.indices = meshBuffers->indexData.data();
+        mesh.numIndices = static_cast<uint32_t>(meshBuffers->indexData.size());
+        mesh.positions = meshBuffers->positionData.data();
+        mesh.radius = meshBuffers->radiusData.data();
+        mesh.numVertices = static_cast<uint32_t>(meshBuffers->positionData.size());
+        mesh.normals = meshBuffers->normalData.data();
+        mesh.tangents = meshBuffers->tangentData.data();
+        mesh.texCoords = meshBuffers->texcoord1Data.data();
+        mesh.numAttributes = static_cast<uint32_t>(meshBuffers->normalData.size());
+    }
+
+    if (m_diskCache->store(getDiskCacheKey(tessellationType), meshes))
+    {
+        const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+        donut::log::info("Curve tessellation (%s): written to disk cache in %.2f ms",
+            getTessellationTypeName(tessellationType), elapsedTime.count());
+    }
+}
+
+bool CurveTessellation::getLssSuccessiveVertexCount(const uint32_t meshIndex, uint32_t& numVertices) const
+{
+    // Segment s of the mesh starts at vertex (s + strand index), the strand index is the segment's (virtual) geometry index.
+    // The layout is only valid if strand indices never decrease along the mesh, otherwise strands would overlap,
+    // and if consecutive segments of a strand share their joint exactly. Line list strands joined within isnear() don't.
+    const auto& lineSegments = m_curvesLineSegments[meshIndex];
+    numVertices = 0;
+    for (uint32_t segmentIndex = 1; segmentIndex < lineSegments.size(); ++segmentIndex)
+    {
+        const auto& prevSegment = lineSegments[segmentIndex - 1];
+        const auto& segment = lineSegments[segmentIndex];
+        if (segment.geometryIndex < prevSegment.geometryIndex)
+        {
+            return false;
+        }
+
+        if (segment.geometryIndex == prevSegment.geometryIndex &&
+            (memcmp(segment.vertices[0].position, prevSegment.vertices[1].position, sizeof(segment.vertices[0].position)) != 0 ||
+             segment.vertices[0].radius != prevSegment.vertices[1].radius))
+        {
+            return false;
+        }
+    }
+
+    if (!lineSegments.empty())
+    {
+        const uint32_t lastSegmentIndex = static_cast<uint32_t>(lineSegments.size()) - 1;
+        numVertices = lastSegmentIndex + lineSegments[lastSegmentIndex].geometryIndex + 2;
+    }
+    return true;
+}
+
+void CurveTessellation::getTessellatedMeshCounts(
+    const TessellationType tessellationType,
+    const uint32_t meshIndex,
+    uint32_t& numIndices,
+    uint32_t& numVertices,
+    uint32_t& numAttributes) const
+{
+    const uint32_t numLineSegments = static_cast<uint32_t>(m_curvesLineSegments[meshIndex].size());
+    switch (tessellationType)
+    {
+    case TessellationType::Polytube:
+        numVertices = numLineSegments * CurveTessellationKernels::getPolyTubeVerticesPerSegment(m_curvePolyTubeOrder[meshIndex]);
+        numIndices = numVertices;
+        numAttributes = numVertices;
+        break;
+    case TessellationType::DisjointOrthogonalTriangleStrip:
+        numVertices = numLineSegments * 4 * 3;
+        numIndices = numVertices;
+        numAttributes = numVertices;
+        break;
+    case TessellationType::LinearSweptSphere:
+        numAttributes = 0;
+        if (m_settings.enableLssSuccessiveImplicit && getLssSuccessiveVertexCount(meshIndex, numVertices))
+        {
+            numIndices = numLineSegments;
+        }
+        else
+        {
+            numVertices = numLineSegments * 2;
+            numIndices = 0;
+        }
+        break;
+    default:
+        numIndices = 0;
+        numVertices = 0;
+        numAttributes = 0;
+        break;
+    }
+}
+
+uint32_t CurveTessellation::tessellateLinearSweptSpheresSuccessive(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
+{
+    auto& curveMeshBuffersCache = m_curveMeshBuffersCache[(uint32_t)TessellationType::LinearSweptSphere];
+
+    struct SuccessiveTask
+    {
+        uint32_t meshIndex = 0;
+        uint32_t curveIndex = 0;
+        uint32_t firstSegment = 0;
+        uint32_t numLineSegments = 0;
+        bool isSuccessive = false;
+    };
+
+    // Pass 1 (serial, O(geometries)): size the buffers and compute the geometry ranges.
+    // Every strand point is stored once and the index buffer holds the first vertex of every segment, relative to its geometry.
+    std::vector<SuccessiveTask> tasks;
+    uint32_t totalVertices = 0;
+    for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
+    {
+        if (!meshInstances[meshIndex]->GetMesh()->IsCurve())
+        {
+            continue;
+        }
+
+        const auto& lineSegments = m_curvesLineSegments[meshIndex];
+        uint32_t numIndices = 0;
+        uint32_t numVertices = 0;
+        uint32_t numAttributes = 0;
+        getTessellatedMeshCounts(TessellationType::LinearSweptSphere, meshIndex, numIndices, numVertices, numAttributes);
+        const bool isSuccessive = (numIndices > 0) || lineSegments.empty();
+        if (!isSuccessive)
+        {
+            donut::log::warning("Curve tessellation (LSS): strands of mesh %s are not contiguous, keeping the list format",
+                meshInstances[meshIndex]->GetMesh()->name.c_str());
+        }
+
+        const uint32_t curveIndex = static_cast<uint32_t>(curveMeshBuffersCache.size());
+        auto& meshBuffersCache = curveMeshBuffersCache.emplace_back();
+        meshBuffersCache.buffers = std::make_shared<BufferGroup>();
+        meshBuffersCache.buffers->vertexBufferRanges = m_curveOriginalVertexBufferRanges[meshIndex];
+        meshBuffersCache.geometries = m_curveOriginalGeometryInfoCache[meshIndex];
+
+        auto& meshBuffers = meshBuffersCache.buffers;
+        meshBuffers->indexData.resize(numIndices);
+        meshBuffers->positionData.resize(numVertices);
+        meshBuffers->radiusData.resize(numVertices);
+        totalVertices += numVertices;
+
+        uint32_t segmentOffsetInMesh = 0;
+        for (uint32_t geometryIndex = 0; geometryIndex < meshBuffersCache.geometries.size(); ++geometryIndex)
+        {
+            auto& geometry = meshBuffersCache.geometries[geometryIndex];
+            const uint32_t numLineSegments = m_curveGeometrySegmentCounts[meshIndex][geometryIndex];
+
+            geometry.globalGeometryIndex = geometryIndex;
+            if (isSuccessive)
+            {
+                const uint32_t lastSegmentIndex = segmentOffsetInMesh + numLineSegments - 1;
+                geometry.indexOffsetInMesh = segmentOffsetInMesh;
+                geometry.numIndices = numLineSegments;
+                geometry.vertexOffsetInMesh = (numLineSegments > 0) ?
+                    segmentOffsetInMesh + lineSegments[segmentOffsetInMesh].geometryIndex : 0;
+                geometry.numVertices = (numLineSegments > 0) ?
+                    lastSegmentIndex + lineSegments[lastSegmentIndex].geometryIndex + 2 - geometry.vertexOffsetInMesh : 0;
+            }
+            else
+            {
+                geometry.indexOffsetInMesh = 0;
+                geometry.numIndices = 0;
+                geometry.vertexOffsetInMesh = segmentOffsetInMesh * 2;
+                geometry.numVertices = numLineSegments * 2;
+            }
+
+            for (uint32_t segmentOffset = 0; segmentOffset < numLineSegments; segmentOffset += m_segmentsPerTask)
+            {
+                SuccessiveTask task;
+                task.meshIndex = meshIndex;
+                task.curveIndex = curveIndex;
+                task.firstSegment = segmentOffsetInMesh + segmentOffset;
+                task.numLineSegments = std::min(m_segmentsPerTask, numLineSegments - segmentOffset);
+                task.isSuccessive = isSuccessive;
+                tasks.push_back(task);
+            }
+
+            segmentOffsetInMesh += numLineSegments;
+        }
+    }
+
+    // Pass 2 (parallel): a segment writes its start point, and its end point only if it is the last segment of its strand,
+    // so every vertex has exactly one writer
+    m_threadPool->ParallelFor(static_cast<uint32_t>(tasks.size()), [&](const uint32_t taskIndex)
+    {
+        const SuccessiveTask& task = tasks[taskIndex];
+        const auto& lineSegments = m_curvesLineSegments[task.meshIndex];
+        const auto& meshBuffersCache = curveMeshBuffersCache[task.curveIndex];
+        auto& meshBuffers = *meshBuffersCache.buffers;
+
+        for (uint32_t segmentIndex = task.firstSegment; segmentIndex < task.firstSegment + task.numLineSegments; ++segmentIndex)
+        {
+            const auto& segment = lineSegments[segmentIndex];
+            if (!task.isSuccessive)
+            {
+                for (uint32_t endPoint = 0; endPoint < 2; ++endPoint)
+                {
+                    meshBuffers.positionData[segmentIndex * 2 + endPoint] = float3(segment.vertices[endPoint].position);
+                    meshBuffers.radiusData[segmentIndex * 2 + endPoint] = segment.vertices[endPoint].radius;
+                }
+                continue;
+            }
+
+            const uint32_t vertexIndex = segmentIndex + segment.geometryIndex;
+            meshBuffers.positionData[vertexIndex] = float3(segment.vertices[0].position);
+            meshBuffers.radiusData[vertexIndex] = segment.vertices[0].radius;
+
+            const bool isLastSegmentOfStrand = (segmentIndex + 1 == lineSegments.size()) ||
+                                               (lineSegments[segmentIndex + 1].geometryIndex != segment.geometryIndex);
+            if (isLastSegmentOfStrand)
+            {
+                meshBuffers.positionData[vertexIndex + 1] = float3(segment.vertices[1].position);
+                meshBuffers.radiusData[vertexIndex + 1] = segment.vertices[1].radius;
+            }
+        }
+
+        if (task.isSuccessive)
+        {
+            // Index data is geometry relative, matching the per geometry vertex offset of the BLAS input
+            uint32_t geometryIndex = 0;
+            while (meshBuffersCache.geometries[geometryIndex].indexOffsetInMesh + meshBuffersCache.geometries[geometryIndex].numIndices <= task.firstSegment)
+            {
+                ++geometryIndex;
+            }
+            const uint32_t geometryVertexOffset = meshBuffersCache.geometries[geometryIndex].vertexOffsetInMesh;
+            for (uint32_t segmentIndex = task.firstSegment; segmentIndex < task.firstSegment + task.numLineSegments; ++segmentIndex)
+            {
+                meshBuffers.indexData[segmentIndex] = segmentIndex + lineSegments[segmentIndex].geometryIndex - geometryVertexOffset;
+            }
+        }
+    });
+
+
+    return totalVertices;
+}
+
+uint32_t CurveTessellation::GetCurvePolyTubeOrder(const std::string& meshName) const
+{
+    auto it = m_curvesLineSegmentsIndexMap.find(meshName);
+    if (it != m_curvesLineSegmentsIndexMap.end()) {
+        return m_curvePolyTubeOrder[it->second];
+    }
+    return RTXCR_CURVE_POLYTUBE_ORDER;
+}
+
+bool CurveTessellation::getCurveMeshStats(
+    const TessellationType tessellationType,
+    const std::vector<std::shared_ptr<MeshInstance>>& meshInstances,
+    const uint32_t meshIndex,
+    CurveMeshStats& stats) const
+{
+    const BufferGroup* meshBuffers = getCurveMeshLod0Buffers(tessellationType, meshInstances, meshIndex);
+    if (!meshBuffers)
+    {
+        return false;
+    }
+
+    stats = {};
+    stats.numLineSegments = static_cast<uint32_t>(m_curvesLineSegments[meshIndex].size());
+    stats.numVertices = static_cast<uint32_t>(meshBuffers->positionData.size());
+    stats.numIndices = static_cast<uint32_t>(meshBuffers->indexData.size());
+    if (tessellationType == TessellationType::LinearSweptSphere)
+    {
+        // The successive implicit layout has one index per segment, the list layout 2 vertices per segment
+        stats.numPrimitives = meshBuffers->indexData.empty() ? stats.numVertices / 2 : stats.numIndices;
+    }
+    else
+    {
+        stats.numPrimitives = stats.numIndices / 3;
+    }
+    stats.indexBytes = meshBuffers->indexData.size() * sizeof(meshBuffers->indexData[0]);
+    stats.positionBytes = meshBuffers->positionData.size() * sizeof(meshBuffers->positionData[0]);
+    stats.normalBytes = meshBuffers->normalData.size() * sizeof(meshBuffers->normalData[0]);
+    stats.tangentBytes = meshBuffers->tangentData.size() * sizeof(meshBuffers->tangentData[0]);
+    stats.texCoordBytes = meshBuffers->texcoord1Data.size() * sizeof(meshBuffers->texcoord1Data[0]);
+    stats.radiusBytes = meshBuffers->radiusData.size() * sizeof(meshBuffers->radiusData[0]);
+    return true;
+}
+
+bool CurveTessellation::estimateCurveMeshBvh(
+    const TessellationType tessellationType,
+    const std::vector<std::shared_ptr<MeshInstance>>& meshInstances,
+    const uint32_t meshIndex,
+    CurveBvhStats& stats,
+    const CurveBvhSettings& settings) const
+{
+    const BufferGroup* meshBuffers = getCurveMeshLod0Buffers(tessellationType, meshInstances, meshIndex);
+    if (!meshBuffers)
+    {
+        return false;
+    }
+
+    // One box per BLAS primitive: a triangle of 3 consecutive vertices, or the capsule swept by the end point spheres of a segment
+    const auto& lineSegments = m_curvesLineSegments[meshIndex];
+    const bool isLinearSweptSphere = (tessellationType == TessellationType::LinearSweptSphere);
+    const bool isLssSuccessive = isLinearSweptSphere && !meshBuffers->indexData.empty();
+    const uint32_t numPrimitives = isLinearSweptSphere ?
+        static_cast<uint32_t>(lineSegments.size()) : static_cast<uint32_t>(meshBuffers->indexData.size() / 3);
+
+    std::vector<box3> primitiveBounds(numPrimitives);
+    const uint32_t numTasks = (numPrimitives + m_segmentsPerTask - 1) / m_segmentsPerTask;
+    m_threadPool->ParallelFor(numTasks, [&](const uint32_t taskIndex)
+    {
+        const uint32_t taskEnd = std::min((taskIndex + 1) * m_segmentsPerTask, numPrimitives);
+        for (uint32_t primitiveIndex = taskIndex * m_segmentsPerTask; primitiveIndex < taskEnd; ++primitiveIndex)
+        {
+            box3 bounds = box3::empty();
+            if (isLinearSweptSphere)
+            {
+                // Successive implicit layout: strand g's points start at vertex (first segment + g)
+                const uint32_t vertexIndex = isLssSuccessive ? primitiveIndex + lineSegments[primitiveIndex].geometryIndex : primitiveIndex * 2;
+                for (uint32_t endPoint = 0; endPoint < 2; ++endPoint)
+                {
+                    const float3& position = meshBuffers->positionData[vertexIndex + endPoint];
+                    const float radius = meshBuffers->radiusData[vertexIndex + endPoint];
+                    bounds |= box3(position - float3(radius), position + float3(radius));
+                }
+            }
+            else
+            {
+                for (uint32_t vertex = 0; vertex < 3; ++vertex)
+                {
+                    bounds |= meshBuffers->positionData[meshBuffers->indexData[primitiveIndex * 3 + vertex]];
+                }
+            }
+            primitiveBounds[primitiveIndex] = bounds;
+        }
+    });
+
+    const size_t primitiveBytes = isLinearSweptSphere ? CurveBvhEstimator::kLinearSweptSphereBytes : CurveBvhEstimator::kTriangleBytes;
+    stats = CurveBvhEstimator::build(primitiveBounds, primitiveBytes, *m_threadPool, settings);
+    return true;
+}
+
+const BufferGroup* CurveTessellation::getCurveMeshLodBuffers(
+    const TessellationType tessellationType,
+    const std::vector<std::shared_ptr<MeshInstance>>& meshInstances,
+    const uint32_t meshIndex,
+    const uint32_t lod) const
+{
+    if (tessellationType >= TessellationType::Count || !isTessellationCached(tessellationType) ||
+        meshIndex >= meshInstances.size() || !meshInstances[meshIndex]->GetMesh()->IsCurve() ||
+        (lod > 0 && m_curveLodMeshBuffersCache[(uint32_t)tessellationType].size() < lod))
+    {
+        return nullptr;
+    }
+
+    uint32_t curveIndex = 0;
+    for (uint32_t prevMeshIndex = 0; prevMeshIndex < meshIndex; ++prevMeshIndex)
+    {
+        curveIndex += meshInstances[prevMeshIndex]->GetMesh()->IsCurve() ? 1 : 0;
+    }
+
+    const bool isSceneMesh = (tessellationType == m_sceneTessellationType) && (m_curveMeshSceneLod[curveIndex] == lod);
+    if (isSceneMesh)
+    {
+        return meshInstances[meshIndex]->GetMesh()->buffers.get();
+    }
+
+    const auto& buffersCache = (lod == 0) ? m_curveMeshBuffersCache[(uint32_t)tessellationType] : m_curveLodMeshBuffersCache[(uint32_t)tessellationType][lod - 1];
+    return (curveIndex < buffersCache.size()) ? buffersCache[curveIndex].buffers.get() : nullptr;
+}
+
+std::unordered_map<std::string, uint32_t> CurveTessellation::loadScenePolyTubeOrders(donut::vfs::IFileSystem& fs, const std::filesystem::path& sceneFileName)
+{
+    std::unordered_map<std::string, uint32_t> scenePolyTubeOrders;
+
+    Json::Value documentRoot;
+    if (!donut::json::LoadFromFile(fs, sceneFileName, documentRoot) || !documentRoot.isObject())
+    {
+        return scenePolyTubeOrders;
+    }
+
+    const Json::Value& polyTubeOrders = documentRoot["hairPolytubeOrders"];
+    if (polyTubeOrders.isObject())
+    {
+        for (const auto& meshName : polyTubeOrders.getMemberNames())
+        {
+            const Json::Value& order = polyTubeOrders[meshName];
+            if (order.isIntegral() && order.asInt() > 0)
+            {
+                scenePolyTubeOrders[meshName] = order.asUInt();
+            }
+        }
+    }
+
+    return scenePolyTubeOrders;
+}
+
+void CurveTessellation::selectPolyTubeOrders(
+    const std::vector<std::shared_ptr<MeshInstance>>& meshInstances,
+    const std::unordered_map<std::string, uint32_t>& scenePolyTubeOrders,
+    const float3& viewPosition,
+    const float pixelsPerUnit)
+{
+    using namespace CurveTessellationKernels;
+
+    // Largest distance between the polytube silhouette and the round strand, in pixels
+    constexpr float kMaxSilhouetteErrorPixels = 0.25f;
+
+    auto clampOrder = [](const int order)
+    {
+        return static_cast<uint32_t>(clamp(order, int(kMinPolyTubeOrder), int(kMaxPolyTubeOrder)));
+    };
+
+    const bool isAutoOrder = (m_settings.hairPolyTubeOrder == 0);
+    const uint32_t defaultOrder = isAutoOrder ? RTXCR_CURVE_POLYTUBE_ORDER : clampOrder(m_settings.hairPolyTubeOrder);
+
+    uint64_t totalTriangles = 0;
+    uint64_t totalDefaultTriangles = 0;
+    for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
+    {
+        const auto& mesh = meshInstances[meshIndex]->GetMesh();
+        if (!mesh->IsCurve())
+        {
+            continue;
+        }
+
+        uint32_t order = defaultOrder;
+        const char* orderSource = "fixed";
+        const auto sceneOrderIt = scenePolyTubeOrders.find(mesh->name);
+        if (sceneOrderIt != scenePolyTubeOrders.end())
+        {
+            order = clampOrder(static_cast<int>(sceneOrderIt->second));
+            orderSource = "scene";
+        }
+        else if (isAutoOrder && pixelsPerUnit > 0.0f)
+        {
+            const SceneGraphNode* node = meshInstances[meshIndex]->GetNode();
+            const float strandRadius = CurveLodGenerator::getAverageRadius(m_curvesLineSegments[meshIndex]);
+            if (node && strandRadius > 0.0f && !node->GetGlobalBoundingBox().isempty())
+            {
+                const box3& bounds = node->GetGlobalBoundingBox();
+                const float3 closestPoint = max(bounds.m_mins, min(viewPosition, bounds.m_maxs));
+                const float distance = length(viewPosition - closestPoint);
+
+                const affine3 localToWorld = node->GetLocalToWorldTransformFloat();
+                const float instanceScale = std::max(length(localToWorld.m_linear.row0), std::max(length(localToWorld.m_linear.row1), length(localToWorld.m_linear.row2)));
+                const float strandRadiusPixels = strandRadius * instanceScale * pixelsPerUnit / std::max(distance, 1e-6f);
+
+                // A regular n-gon around the strand is off by at most r * (1 - cos(PI / n)) from the circle
+                order = kMinPolyTubeOrder;
+                while (order < kMaxPolyTubeOrder && strandRadiusPixels * (1.0f - cosf(dm::PI_f / float(order))) > kMaxSilhouetteErrorPixels)
+                {
+                    ++order;
+                }
+                orderSource = "auto";
+            }
+        }
+        m_curvePolyTubeOrder[meshIndex] = order;
+
+        // Triangle budget, 2 triangles per face and segment
+        const uint64_t numLineSegments = m_curvesLineSegments[meshIndex].size();
+        const uint64_t numTriangles = numLineSegments * order * 2;
+        totalTriangles += numTriangles;
+        totalDefaultTriangles += numLineSegments * RTXCR_CURVE_POLYTUBE_ORDER * 2;
+        donut::log::info("Curve polytube order (%s): %u (%s), %llu segments, %.3f M triangles",
+            mesh->name.c_str(), order, orderSource, (unsigned long long)numLineSegments, numTriangles / 1e6);
+    }
+
+    donut::log::info("Curve polytube triangle budget: %.3f M triangles, %.3f M at the uniform order %u (%+.1f%%)",
+        totalTriangles / 1e6, totalDefaultTriangles / 1e6, RTXCR_CURVE_POLYTUBE_ORDER,
+        totalDefaultTriangles > 0 ? 100.0 * (double(totalTriangles) / double(totalDefaultTriangles) - 1.0) : 0.0);
+}
+
+bool CurveTessellation::rescaleCurveRadius(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
+{
+    const float radiusScale = m_settings.hairRadiusScale;
+    if (radiusScale == m_lineSegmentsRadiusScale || radiusScale <= 0.0f || m_curvesLineSegments.empty())
+    {
+        return false;
+    }
+
+    const auto startTime = std::chrono::high_resolution_clock::now();
+    const uint32_t lodLevelCount = getCurveLodLevelCount();
+
+    auto getLodLineSegments = [&](const uint32_t lod) -> std::vector<std::vector<rtxcr::geometry::LineSegment>>&
+    {
+        return (lod == 0) ? m_curvesLineSegments : m_curvesLodLineSegments[lod - 1];
+    };
+
+    // Pass 1 (serial): keep the radii the segments were built with, every rescale scales from them
+    if (m_curvesLineSegmentsBaseRadius.empty())
+    {
+        m_lineSegmentsBaseRadiusScale = m_lineSegmentsRadiusScale;
+        m_curvesLineSegmentsBaseRadius.resize(lodLevelCount);
+        for (uint32_t lod = 0; lod < lodLevelCount; ++lod)
+        {
+            const auto& curvesLineSegments = getLodLineSegments(lod);
+            auto& curvesBaseRadius = m_curvesLineSegmentsBaseRadius[lod];
+            curvesBaseRadius.resize(curvesLineSegments.size());
+            for (uint32_t meshIndex = 0; meshIndex < curvesLineSegments.size(); ++meshIndex)
+            {
+                const auto& lineSegments = curvesLineSegments[meshIndex];
+                curvesBaseRadius[meshIndex].resize(lineSegments.size());
+                for (uint32_t segmentIndex = 0; segmentIndex < lineSegments.size(); ++segmentIndex)
+                {
+                    curvesBaseRadius[meshIndex][segmentIndex] =
+                        float2(lineSegments[segmentIndex].vertices[0].radius, lineSegments[segmentIndex].vertices[1].radius);
+                }
+            }
+        }
+    }
+
+    // A contiguous range of segments of one mesh and LOD
+    struct RescaleTask
+    {
+        std::vector<rtxcr::geometry::LineSegment>* lineSegments;
+        const std::vector<float2>* baseRadius;
+        uint32_t firstSegment;
+        uint32_t numLineSegments;
+    };
+
+    std::vector<RescaleTask> segmentTasks;
+    for (uint32_t lod = 0; lod < lodLevelCount; ++lod)
+    {
+        auto& curvesLineSegments = getLodLineSegments(lod);
+        for (uint32_t meshIndex = 0; meshIndex < curvesLineSegments.size(); ++meshIndex)
+        {
+            const uint32_t numLineSegments = static_cast<uint32_t>(curvesLineSegments[meshIndex].size());
+            for (uint32_t firstSegment = 0; firstSegment < numLineSegments; firstSegment += m_segmentsPerTask)
+            {
+                segmentTasks.push_back({ &curvesLineSegments[meshIndex], &m_curvesLineSegmentsBaseRadius[lod][meshIndex], firstSegment,
+                    std::min(m_segmentsPerTask, numLineSegments - firstSegment) });
+            }
+        }
+    }
+
+    // Pass 2 (parallel): rescale the segment radii of every LOD
+    const float radiusRatio = radiusScale / m_lineSegmentsBaseRadiusScale;
+    m_threadPool->ParallelFor(static_cast<uint32_t>(segmentTasks.size()), [&](const uint32_t taskIndex)
+    {
+        const RescaleTask& task = segmentTasks[taskIndex];
+        for (uint32_t segmentIndex = task.firstSegment; segmentIndex < task.firstSegment + task.numLineSegments; ++segmentIndex)
+        {
+            auto& segment = (*task.lineSegments)[segmentIndex];
+            const float2& baseRadius = (*task.baseRadius)[segmentIndex];
+            segment.vertices[0].radius = baseRadius.x * radiusRatio;
+            segment.vertices[1].radius = baseRadius.y * radiusRatio;
+        }
+    });
+
+    for (uint32_t meshIndex = 0; meshIndex < m_curveLodStrandRadius.size(); ++meshIndex)
+    {
+        if (m_curveLodStrandRadius[meshIndex] > 0.0f)
+        {
+            m_curveLodStrandRadius[meshIndex] = CurveLodGenerator::getAverageRadius(m_curvesLineSegments[meshIndex]);
+        }
+    }
+
+    // Pass 3 (serial, O(meshes)): collect every cached representation. The slot the scene displays is empty, its data lives in the mesh.
+    struct BufferRescaleTask
+    {
+        TessellationType tessellationType;
+        BufferGroup* meshBuffers;
+        const std::vector<rtxcr::geometry::LineSegment>* lineSegments;
+        uint32_t firstSegment;
+        uint32_t numLineSegments;
+        uint32_t polyTubeOrder;
+        bool isLssSuccessive;
+        bool isLibraryTessellation;
+    };
+
+    std::vector<BufferRescaleTask> bufferTasks;
+    uint32_t numRescaledMeshes = 0;
+    for (uint32_t type = 0; type < (uint32_t)TessellationType::Count; ++type)
+    {
+        const TessellationType tessellationType = (TessellationType)type;
+        if (!isTessellationCached(tessellationType))
+        {
+            continue;
+        }
+
+        // The geometry library lays out its vertices differently from the local kernels, ranges it built are rebuilt with it
+        const bool useSimdKernels = useSimdTessellationKernels(tessellationType);
+
+        uint32_t curveIndex = 0;
+        for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
+        {
+            const auto& mesh = meshInstances[meshIndex]->GetMesh();
+            if (!mesh->IsCurve())
+            {
+                continue;
+            }
+
+            const uint32_t meshCurveIndex = curveIndex++;
+            const bool isLibraryTessellation = !useSimdKernels && (tessellationType != TessellationType::LinearSweptSphere) &&
+                (tessellationType != TessellationType::Polytube || m_curvePolyTubeOrder[meshIndex] == RTXCR_CURVE_POLYTUBE_ORDER);
+            for (uint32_t lod = 0; lod < lodLevelCount; ++lod)
+            {
+                if (lod > 0 && m_curveLodMeshBuffersCache[type].size() < lod)
+                {
+                    break;
+                }
+
+                const bool isSceneMesh = (tessellationType == m_sceneTessellationType) && (lod == m_curveMeshSceneLod[meshCurveIndex]);
+                BufferGroup* meshBuffers = isSceneMesh ? mesh->buffers.get() : getCurveMeshBuffersCache(tessellationType, lod, meshCurveIndex).buffers.get();
+                const auto& lineSegments = getLodLineSegments(lod)[meshIndex];
+                if (!meshBuffers || lineSegments.empty())
+                {
+                    continue;
+                }
+
+                const uint32_t numLineSegments = static_cast<uint32_t>(lineSegments.size());
+                const bool isLssSuccessive = (tessellationType == TessellationType::LinearSweptSphere) && !meshBuffers->indexData.empty();
+                for (uint32_t firstSegment = 0; firstSegment < numLineSegments; firstSegment += m_segmentsPerTask)
+                {
+                    bufferTasks.push_back({ tessellationType, meshBuffers, &lineSegments, firstSegment,
+                        std::min(m_segmentsPerTask, numLineSegments - firstSegment), m_curvePolyTubeOrder[meshIndex], isLssSuccessive,
+                        isLibraryTessellation });
+                }
+                ++numRescaledMeshes;
+            }
+        }
+    }
+
+    // Pass 4 (parallel): rewrite the positions and radii, every task owns a disjoint vertex range
+    m_threadPool->ParallelFor(static_cast<uint32_t>(bufferTasks.size()), [&](const uint32_t taskIndex)
+    {
+        const BufferRescaleTask& task = bufferTasks[taskIndex];
+        rescaleCurveMeshBuffers(task.tessellationType, *task.lineSegments, task.firstSegment, task.numLineSegments, task.polyTubeOrder,
+            task.isLssSuccessive, task.isLibraryTessellation, *task.meshBuffers);
+    });
+
+    // The disk cache key follows the radius now in the segments
+    m_lineSegmentsRadiusScale = radiusScale;
+
+    const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+    donut::log::info("Curve radius rescale (%.3f): %u meshes, %u tasks on %u threads in %.2f ms",
+        radiusScale, numRescaledMeshes, static_cast<uint32_t>(segmentTasks.size() + bufferTasks.size()), m_threadPool->GetThreadCount(), elapsedTime.count());
+
+    return true;
+}
+
+void CurveTessellation::rescaleCurveMeshBuffers(
+    const TessellationType tessellationType,
+    const std::vector<rtxcr::geometry::LineSegment>& lineSegments,
+    const uint32_t firstSegment,
+    const uint32_t numLineSegments,
+    const uint32_t polyTubeOrder,
+    const bool isLssSuccessive,
+    const bool isLibraryTessellation,
+    BufferGroup& meshBuffers)
+{
+    if (isLibraryTessellation)
+    {
+        const uint32_t numVerticesPerSegment = (tessellationType == TessellationType::Polytube) ?
+            CurveTessellationKernels::getPolyTubeVerticesPerSegment(polyTubeOrder) : CurveTessellationKernels::kDotsVerticesPerSegment;
+        tessellateWithGeometryLibrary(tessellationType, lineSegments, numLineSegments, meshBuffers, firstSegment * numVerticesPerSegment);
+        return;
+    }
+
+    CurveTessellationOutput output;
+    output.positions = meshBuffers.positionData.data();
+    output.radius = meshBuffers.radiusData.data();
+
+    const rtxcr::geometry::LineSegment* segments = lineSegments.data() + firstSegment;
+    switch (tessellationType)
+    {
+    case TessellationType::Polytube:
+        CurveTessellationKernels::updatePolyTubesRadius(segments, numLineSegments, polyTubeOrder, output,
+            firstSegment * CurveTessellationKernels::getPolyTubeVerticesPerSegment(polyTubeOrder));
+        break;
+    case TessellationType::DisjointOrthogonalTriangleStrip:
+        CurveTessellationKernels::updateDisjointOrthogonalTriangleStripsRadius(segments, numLineSegments, output,
+            firstSegment * CurveTessellationKernels::kDotsVerticesPerSegment);
+        break;
+    case TessellationType::LinearSweptSphere:
+        for (uint32_t segmentIndex = firstSegment; segmentIndex < firstSegment + numLineSegments; ++segmentIndex)
+        {
+            const auto& segment = lineSegments[segmentIndex];
+            if (isLssSuccessive)
+            {
+                // Strand g's points start at vertex (first segment + g), a strand's last segment also writes its end point
+                const uint32_t vertexIndex = segmentIndex + segment.geometryIndex;
+                output.radius[vertexIndex] = segment.vertices[0].radius;
+                if (segmentIndex + 1 == lineSegments.size() || lineSegments[segmentIndex + 1].geometryIndex != segment.geometryIndex)
+                {
+                    output.radius[vertexIndex + 1] = segment.vertices[1].radius;
+                }
+            }
+            else
+            {
+                output.radius[segmentIndex * 2] = segment.vertices[0].radius;
+                output.radius[segmentIndex * 2 + 1] = segment.vertices[1].radius;
+            }
+        }
+        break;
+    default:
+        assert(!"Unknown curve tessellation type");
+        break;
+    }
+}
+
+void CurveTessellation::uploadCurveRadiusData(nvrhi::ICommandList* commandList, const std::vector<std::shared_ptr<MeshInstance>>& meshInstances) const
+{
+    const nvrhi::ResourceStates state = nvrhi::ResourceStates::VertexBuffer | nvrhi::ResourceStates::ShaderResource | nvrhi::ResourceStates::AccelStructBuildInput;
+
+    for (const auto& meshInstance : meshInstances)
+    {
+        const auto& mesh = meshInstance->GetMesh();
+        BufferGroup* meshBuffers = mesh->buffers.get();
+        // Meshes without a vertex buffer get their data with the next scene upload
+        if (!mesh->IsCurve() || !meshBuffers->vertexBuffer)
+        {
+            continue;
+        }
+
+        std::vector<nvrhi::BufferHandle> vertexBuffers = { meshBuffers->vertexBuffer };
+        const auto prevVertexBufferIt = bufferGroupPrevVertexBufferMap.find(meshBuffers);
+        if (prevVertexBufferIt != bufferGroupPrevVertexBufferMap.end())
+        {
+            vertexBuffers.push_back(prevVertexBufferIt->second.vertexBuffer);
+        }
+
+        // LSS positions don't depend on the radius
+        const bool uploadPositions = (mesh->type != MeshType::CurveLinearSweptSpheres) && !meshBuffers->positionData.empty();
+        for (const nvrhi::BufferHandle& vertexBuffer : vertexBuffers)
+        {
+            commandList->beginTrackingBufferState(vertexBuffer, state);
+
+            if (uploadPositions)
+            {
+                commandList->writeBuffer(vertexBuffer, meshBuffers->positionData.data(), meshBuffers->positionData.size() * sizeof(meshBuffers->positionData[0]),
+                    meshBuffers->getVertexBufferRange(VertexAttribute::Position).byteOffset);
+            }
+
+            if (!meshBuffers->radiusData.empty())
+            {
+                commandList->writeBuffer(vertexBuffer, meshBuffers->radiusData.data(), meshBuffers->radiusData.size() * sizeof(meshBuffers->radiusData[0]),
+                    meshBuffers->getVertexBufferRange(VertexAttribute::CurveRadius).byteOffset);
+            }
+
+            commandList->setBufferState(vertexBuffer, state);
+        }
+    }
+
+    commandList->commitBarriers();
+}
+
+bool CurveTessellation::updateCurveLods(
+    const std::vector<std::shared_ptr<MeshInstance>>& meshInstances,
+    const float3& cameraPosition,
+    const float pixelsPerUnit)
+{
+    if (m_curvesLodLineSegments.empty() || m_sceneTessellationType == TessellationType::Count || pixelsPerUnit <= 0.0f)
+    {
+        return false;
+    }
+
+    // A mesh only switches once its continuous LOD leaves the current level by this margin, so it doesn't flicker at a boundary
+    constexpr float kLodHysteresis = 0.2f;
+    const uint32_t maxLod = getCurveLodLevelCount() - 1;
+    const float lodWidthScale = logf(1.0f / m_curveLodStrandKeepRatio);
+    const float targetWidthPixels = std::max(m_settings.hairLodPixelWidth, 1e-3f);
+
+    bool isChanged = false;
+    uint32_t curveIndex = 0;
+    for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
+    {
+        const auto& mesh = meshInstances[meshIndex]->GetMesh();
+        if (!mesh->IsCurve())
+        {
+            continue;
+        }
+
+        const uint32_t meshCurveIndex = curveIndex++;
+        const float strandRadius = m_curveLodStrandRadius[meshIndex];
+        const SceneGraphNode* node = meshInstances[meshIndex]->GetNode();
+        if (strandRadius <= 0.0f || !node)
+        {
+            continue;
+        }
+
+        const box3& bounds = node->GetGlobalBoundingBox();
+        if (bounds.isempty())
+        {
+            continue;
+        }
+
+        const float3 closestPoint = max(bounds.m_mins, min(cameraPosition, bounds.m_maxs));
+        const float distance = length(cameraPosition - closestPoint);
+
+        const affine3 localToWorld = node->GetLocalToWorldTransformFloat();
+        const float instanceScale = std::max(length(localToWorld.m_linear.row0), std::max(length(localToWorld.m_linear.row1), length(localToWorld.m_linear.row2)));
+
+        // Level l strands are keepRatio^-l times wider, the LOD is the last level whose strands are still thinner than the target
+        const float strandWidthPixels = 2.0f * strandRadius * instanceScale * pixelsPerUnit / std::max(distance, 1e-6f);
+        const float lodValue = clamp(logf(targetWidthPixels / strandWidthPixels) / lodWidthScale, -1.0f, float(maxLod + 1));
+
+        const uint32_t sceneLod = m_curveMeshSceneLod[meshCurveIndex];
+        if (lodValue >= float(sceneLod) - kLodHysteresis && lodValue < float(sceneLod + 1) + kLodHysteresis)
+        {
+            continue;
+        }
+
+        const uint32_t lod = std::min(static_cast<uint32_t>(std::max(floorf(lodValue), 0.0f)), maxLod);
+        if (lod != sceneLod)
+        {
+            setCurveMeshLod(mesh, meshCurveIndex, lod);
+            isChanged = true;
+        }
+    }
+
+    return isChanged;
+}
+
+CurveTessellation::CurveMeshBuffersCache& CurveTessellation::getCurveMeshBuffersCache(
+    const TessellationType tessellationType,
+    const uint32_t lod,
+    const uint32_t curveIndex)
+{
+    return (lod == 0) ?
+        m_curveMeshBuffersCache[(uint32_t)tessellationType][curveIndex] :
+        m_curveLodMeshBuffersCache[(uint32_t)tessellationType][lod - 1][curveIndex];
+}
+
+void CurveTessellation::setCurveMeshLod(const std::shared_ptr<MeshInfo>& mesh, const uint32_t curveIndex, const uint32_t lod)
+{
+    const uint32_t sceneLod = m_curveMeshSceneLod[curveIndex];
+    if (lod == sceneLod)
+    {
+        return;
+    }
+
+    auto& lodBuffersCache = getCurveMeshBuffersCache(m_sceneTessellationType, lod, curveIndex);
+    auto& sceneLodBuffersCache = getCurveMeshBuffersCache(m_sceneTessellationType, sceneLod, curveIndex);
+
+    for (uint32_t geometryIndex = 0; geometryIndex < mesh->geometries.size(); ++geometryIndex)
+    {
+        *mesh->geometries[geometryIndex] = lodBuffersCache.geometries[geometryIndex];
+    }
+
+    // Same handover as replacingSceneMesh: the scene takes the LOD's data, then the displayed data goes back to its own slot
+    auto& meshBuffers = mesh->buffers;
+    meshBuffers->vertexBufferRanges = lodBuffersCache.buffers->vertexBufferRanges;
+    swapCurveMeshData(*meshBuffers, *lodBuffersCache.buffers);
+    swapCurveMeshData(*lodBuffersCache.buffers, *sceneLodBuffersCache.buffers);
+
+    meshBuffers->indexBuffer = nullptr;
+    meshBuffers->vertexBuffer = nullptr;
+    meshBuffers->instanceBuffer = nullptr;
+
+    m_curveMeshSceneLod[curveIndex] = lod;
+}
+
+void CurveTessellation::resetCurveLods(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
+{
+    uint32_t curveIndex = 0;
+    for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
+    {
+        const auto& mesh = meshInstances[meshIndex]->GetMesh();
+        if (mesh->IsCurve())
+        {
+            setCurveMeshLod(mesh, curveIndex++, 0);
+        }
+    }
+}
+
+void CurveTessellation::evictTessellationCache(const TessellationType activeTessellationType)
+{
+    if (m_settings.hairTessellationCacheBudgetMB <= 0)
+    {
+        return;
+    }
+
+    const size_t budgetBytes = static_cast<size_t>(m_settings.hairTessellationCacheBudgetMB) * 1024 * 1024;
+
+    // The active representation is never evicted, even if it alone exceeds the budget
+    while (getTessellationCacheTotalBytes() > budgetBytes)
+    {
+        uint32_t evictIndex = (uint32_t)TessellationType::Count;
+        for (uint32_t typeIndex = 0; typeIndex < (uint32_t)TessellationType::Count; ++typeIndex)
+        {
+            if (typeIndex == (uint32_t)activeTessellationType || !m_curveMeshBuffersCacheValid[typeIndex])
+            {
+                continue;
+            }
+
+            if (evictIndex == (uint32_t)TessellationType::Count ||
+                m_curveMeshBuffersCacheLastUse[typeIndex] < m_curveMeshBuffersCacheLastUse[evictIndex])
+            {
+                evictIndex = typeIndex;
+            }
+        }
+
+        if (evictIndex == (uint32_t)TessellationType::Count)
+        {
+            break;
+        }
+
+        donut::log::info("Curve tessellation cache: evicting %s (%.2f MB)",
+            getTessellationTypeName((TessellationType)evictIndex), m_curveMeshBuffersCacheBytes[evictIndex] / (1024.0 * 1024.0));
+
+        std::vector<CurveMeshBuffersCache>().swap(m_curveMeshBuffersCache[evictIndex]);
+        std::vector<std::vector<CurveMeshBuffersCache>>().swap(m_curveLodMeshBuffersCache[evictIndex]);
+        m_curveMeshBuffersCacheBytes[evictIndex] = 0;
+        m_curveMeshBuffersCacheValid[evictIndex] = false;
+    }
+}
+
+size_t CurveTessellation::getMeshBuffersCacheBytes(const BufferGroup& buffers)
+{
+    return buffers.indexData.capacity() * sizeof(buffers.indexData[0]) +
+           buffers.positionData.capacity() * sizeof(buffers.positionData[0]) +
+           buffers.normalData.capacity() * sizeof(buffers.normalData[0]) +
+           buffers.tangentData.capacity() * sizeof(buffers.tangentData[0]) +
+           buffers.texcoord1Data.capacity() * sizeof(buffers.texcoord1Data[0]) +
+           buffers.radiusData.capacity() * sizeof(buffers.radiusData[0]);
 }
 
 void CurveTessellation::createDynamicVertexBuffer(
@@ -490,6 +2399,7 @@ void CurveTessellation::createDynamicVertexBuffer(
 
     nvrhi::ResourceStates state = nvrhi::ResourceStates::VertexBuffer | nvrhi::ResourceStates::ShaderResource | nvrhi::ResourceStates::AccelStructBuildInput;
 
+    // The curve attributes stay on the CPU after the upload, they are handed back to the tessellation cache on the next switch
     auto commandList = device->createCommandList();
     commandList->open();
 
@@ -501,7 +2411,6 @@ void CurveTessellation::createDynamicVertexBuffer(
         const auto& range = meshBuffers->getVertexBufferRange(VertexAttribute::Position);
         commandList->writeBuffer(meshBuffers->vertexBuffer, meshBuffers->positionData.data(), range.byteSize, range.byteOffset);
         commandList->writeBuffer(prevVertexBuffer, meshBuffers->positionData.data(), range.byteSize, range.byteOffset);
-        std::vector<float3>().swap(meshBuffers->positionData);
     }
 
     if (!meshBuffers->normalData.empty())
@@ -509,7 +2418,6 @@ void CurveTessellation::createDynamicVertexBuffer(
         const auto& range = meshBuffers->getVertexBufferRange(VertexAttribute::Normal);
         commandList->writeBuffer(meshBuffers->vertexBuffer, meshBuffers->normalData.data(), range.byteSize, range.byteOffset);
         commandList->writeBuffer(prevVertexBuffer, meshBuffers->normalData.data(), range.byteSize, range.byteOffset);
-        std::vector<uint32_t>().swap(meshBuffers->normalData);
     }
 
     if (!meshBuffers->tangentData.empty())
@@ -517,7 +2425,6 @@ void CurveTessellation::createDynamicVertexBuffer(
         const auto& range = meshBuffers->getVertexBufferRange(VertexAttribute::Tangent);
         commandList->writeBuffer(meshBuffers->vertexBuffer, meshBuffers->tangentData.data(), range.byteSize, range.byteOffset);
         commandList->writeBuffer(prevVertexBuffer, meshBuffers->tangentData.data(), range.byteSize, range.byteOffset);
-        std::vector<uint32_t>().swap(meshBuffers->tangentData);
     }
 
     if (!meshBuffers->texcoord1Data.empty())
@@ -525,7 +2432,6 @@ void CurveTessellation::createDynamicVertexBuffer(
         const auto& range = meshBuffers->getVertexBufferRange(VertexAttribute::TexCoord1);
         commandList->writeBuffer(meshBuffers->vertexBuffer, meshBuffers->texcoord1Data.data(), range.byteSize, range.byteOffset);
         commandList->writeBuffer(prevVertexBuffer, meshBuffers->texcoord1Data.data(), range.byteSize, range.byteOffset);
-        std::vector<float2>().swap(meshBuffers->texcoord1Data);
     }
 
     if (!meshBuffers->texcoord2Data.empty())
@@ -557,7 +2463,6 @@ void CurveTessellation::createDynamicVertexBuffer(
         const auto& range = meshBuffers->getVertexBufferRange(VertexAttribute::CurveRadius);
         commandList->writeBuffer(meshBuffers->vertexBuffer, meshBuffers->radiusData.data(), range.byteSize, range.byteOffset);
         commandList->writeBuffer(prevVertexBuffer, meshBuffers->radiusData.data(), range.byteSize, range.byteOffset);
-        std::vector<float>().swap(meshBuffers->radiusData);
     }
 
     commandList->setBufferState(meshBuffers->vertexBuffer, state);
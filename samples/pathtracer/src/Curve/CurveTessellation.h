@@ -10,15 +10,21 @@
 
 #pragma once
 
+#include <filesystem>
 #include <memory>
 #include <vector>
+#include <donut/core/vfs/VFS.h>
 #include <donut/engine/SceneGraph.h>
 #include <rtxcr/geometry/include/CurveTessellation.h>
 
+#include "CurveBvhEstimator.h"
+#include "CurveTessellationDiskCache.h"
+#include "ThreadPool.h"
+
 using namespace donut::math;
 using namespace donut::engine;
 
-struct UIData;
+struct CurveTessellationSettings;
 
 enum class TessellationType : uint32_t
 {
@@ -28,14 +34,25 @@ enum class TessellationType : uint32_t
     Count
 };
 
+inline const char* getTessellationTypeName(const TessellationType tessellationType)
+{
+    switch (tessellationType)
+    {
+    case TessellationType::Polytube:                        return "Polytube";
+    case TessellationType::DisjointOrthogonalTriangleStrip: return "DOTS";
+    case TessellationType::LinearSweptSphere:               return "LSS";
+    default:                                                return "Unknown";
+    }
+}
+
 class CurveTessellation
 {
 public:
-    CurveTessellation(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances, const UIData& ui);
+    CurveTessellation(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances, const CurveTessellationSettings& settings);
 
     ~CurveTessellation() = default;
 
-    // Cross section polygon order of faces (double amount of triangles) per linear segment.
+    // Cross section polygon order of faces (double amount of triangles) per linear segment, see selectPolyTubeOrders.
     void convertToTrianglePolyTubes(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances);
 
     /**
@@ -52,6 +69,10 @@ public:
 
     void convertToLinearSweptSpheres(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances);
 
+    // Makes sure the representation is resident in the CPU cache, tessellating it on first use,
+    // then evicts the least recently used other representations if the cache is over budget.
+    void requestTessellation(const TessellationType tessellationType, const std::vector<std::shared_ptr<MeshInstance>>& meshInstances);
+
     void replacingSceneMesh(nvrhi::IDevice* device, donut::engine::DescriptorTableManager* descriptorTable, const TessellationType tessellationType, const std::vector<std::shared_ptr<MeshInstance>>& meshInstances);
 
     void swapDynamicVertexBuffer();
@@ -61,6 +82,53 @@ public:
         bufferGroupPrevVertexBufferMap.clear();
     }
 
+    inline bool isTessellationCached(const TessellationType tessellationType) const
+    {
+        return m_curveMeshBuffersCacheValid[(uint32_t)tessellationType];
+    }
+
+    // CPU memory held by the representation cache, in bytes
+    inline size_t getTessellationCacheBytes(const TessellationType tessellationType) const
+    {
+        return m_curveMeshBuffersCacheBytes[(uint32_t)tessellationType];
+    }
+
+    inline size_t getTessellationCacheTotalBytes() const
+    {
+        size_t totalBytes = 0;
+        for (const size_t bytes : m_curveMeshBuffersCacheBytes)
+        {
+            totalBytes += bytes;
+        }
+        return totalBytes;
+    }
+
+    inline size_t getTessellationCachePeakBytes() const { return m_curveMeshBuffersCachePeakBytes; }
+
+    // Picks the LOD of every curve mesh instance from the projected width of its strands at the closest point of its bounds
+    // and swaps the selected buffers into the scene. pixelsPerUnit is the on screen size in pixels of a unit length at unit distance.
+    // Returns true if the scene meshes changed, their GPU buffers and BLAS have to be rebuilt then.
+    bool updateCurveLods(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances, const float3& cameraPosition, const float pixelsPerUnit);
+
+    // Applies a changed CurveTessellationSettings::hairRadiusScale to the line segments of every LOD and rewrites only the radius dependent vertex data
+    // (positions and radii) of every cached representation in place, the topology and all other attributes stay.
+    // Returns false if the scale didn't change. The scene meshes' GPU vertex buffers still hold the old data afterwards.
+    bool rescaleCurveRadius(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances);
+
+    // Writes the positions and radii of every scene curve mesh into its existing GPU vertex buffers after rescaleCurveRadius
+    void uploadCurveRadiusData(nvrhi::ICommandList* commandList, const std::vector<std::shared_ptr<MeshInstance>>& meshInstances) const;
+
+    // Picks the polytube order of every curve mesh, call it before the Polytube representation is built.
+    // An order from the scene metadata wins, otherwise CurveTessellationSettings::hairPolyTubeOrder applies, with 0 every mesh gets the lowest order
+    // whose silhouette stays within a quarter pixel of a round strand seen from viewPosition. Logs the resulting triangle budget.
+    void selectPolyTubeOrders(
+        const std::vector<std::shared_ptr<MeshInstance>>& meshInstances,
+        const std::unordered_map<std::string, uint32_t>& scenePolyTubeOrders,
+        const float3& viewPosition,
+        const float pixelsPerUnit);
+
+    inline uint32_t getCurveLodLevelCount() const { return static_cast<uint32_t>(m_curvesLodLineSegments.size()) + 1; }
+
     inline const std::vector<rtxcr::geometry::LineSegment>& GetCurvesLineSegments(const std::string& meshName) const
     {
         static const std::vector<rtxcr::geometry::LineSegment> kEmpty;
@@ -71,13 +139,169 @@ public:
         return kEmpty;
     }
 
+    inline const std::vector<uint32_t>& GetCurveGeometrySegmentCounts(const std::string& meshName) const
+    {
+        static const std::vector<uint32_t> kEmpty;
+        auto it = m_curvesLineSegmentsIndexMap.find(meshName);
+        if (it != m_curvesLineSegmentsIndexMap.end()) {
+            return m_curveGeometrySegmentCounts[it->second];
+        }
+        return kEmpty;
+    }
+
+    // RTXCR_CURVE_POLYTUBE_ORDER for meshes that aren't curves
+    uint32_t GetCurvePolyTubeOrder(const std::string& meshName) const;
+
+    // Element counts and attribute stream sizes of one curve mesh in one representation, LOD0
+    struct CurveMeshStats
+    {
+        uint32_t numLineSegments = 0;
+        uint32_t numVertices = 0;
+        uint32_t numIndices = 0;
+        uint32_t numPrimitives = 0; // Triangles, LSS: swept segments
+        size_t indexBytes = 0;
+        size_t positionBytes = 0;
+        size_t normalBytes = 0;
+        size_t tangentBytes = 0;
+        size_t texCoordBytes = 0;
+        size_t radiusBytes = 0;
+    };
+
+    // Buffers of one LOD of the curve mesh in the representation, the scene's buffer group if it displays them, nullptr if there are none
+    const BufferGroup* getCurveMeshLodBuffers(
+        const TessellationType tessellationType,
+        const std::vector<std::shared_ptr<MeshInstance>>& meshInstances,
+        const uint32_t meshIndex,
+        const uint32_t lod) const;
+
+    inline const BufferGroup* getCurveMeshLod0Buffers(
+        const TessellationType tessellationType,
+        const std::vector<std::shared_ptr<MeshInstance>>& meshInstances,
+        const uint32_t meshIndex) const
+    {
+        return getCurveMeshLodBuffers(tessellationType, meshInstances, meshIndex, 0);
+    }
+
+    // Returns false if the representation isn't cached or meshIndex isn't a curve mesh
+    bool getCurveMeshStats(
+        const TessellationType tessellationType,
+        const std::vector<std::shared_ptr<MeshInstance>>& meshInstances,
+        const uint32_t meshIndex,
+        CurveMeshStats& stats) const;
+
+    // Estimates the BLAS of one curve mesh in one representation, LOD0, with a binned SAH build over its triangles or swept spheres.
+    // Returns false if the representation isn't cached or meshIndex isn't a curve mesh.
+    bool estimateCurveMeshBvh(
+        const TessellationType tessellationType,
+        const std::vector<std::shared_ptr<MeshInstance>>& meshInstances,
+        const uint32_t meshIndex,
+        CurveBvhStats& stats,
+        const CurveBvhSettings& settings = {}) const;
+
+    // Optional per mesh polytube orders of a scene file, "hairPolytubeOrders": { "meshName": order }
+    static std::unordered_map<std::string, uint32_t> loadScenePolyTubeOrders(donut::vfs::IFileSystem& fs, const std::filesystem::path& sceneFileName);
+
 private:
     void convertCurveLineStripsToLineSegments(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances);
 
-    void copyToMeshBuffersCache(
+    // Sorts the strands of every line list geometry by the Morton code of their bounding box center, so spatially close strands
+    // are adjacent in the segment, vertex and index streams. Morph target keyframes are permuted along. Runs right after extraction.
+    void reorderCurveStrands(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances);
+
+    // A strand moved by reorderCurveStrands, its keyframe points start at (first segment + geometry index)
+    struct StrandMove
+    {
+        uint32_t oldFirstSegment = 0;
+        uint32_t newFirstSegment = 0;
+        uint32_t numSegments = 0;
+        uint32_t oldGeometryIndex = 0;
+        uint32_t newGeometryIndex = 0;
+    };
+
+    static void applyStrandMovesToKeyframes(BufferGroup& meshBuffers, const std::vector<StrandMove>& strandMoves, const bool isInverse);
+
+    // Merges nearly collinear consecutive segments of every strand while the surface deviation stays within CurveTessellationSettings::hairResegmentationError.
+    // Runs once after extraction, before any tessellation. Morph target animated meshes are skipped.
+    void resegmentCurveLineSegments(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances);
+
+    // Builds LOD levels 1 to CurveTessellationSettings::hairLodLevels - 1 of the line segments, morph target animated meshes only have LOD0
+    void generateCurveLods(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances);
+
+    // Tessellates the line segments of all curve meshes into the given representation on the worker pool
+    void tessellateCurveMeshes(const TessellationType tessellationType, const std::vector<std::shared_ptr<MeshInstance>>& meshInstances);
+
+    struct CurveMeshBuffersCache;
+
+    // Tessellates the given line segments into one cache slot per curve mesh, returns the number of tasks.
+    // Meshes whose segment counts don't cover all of their geometries get an empty slot.
+    // With useSegmentVertexCounts geometry sizes follow the segment counts instead of the source vertex counts.
+    uint32_t buildCurveMeshBuffers(
+        const TessellationType tessellationType,
+        const std::vector<std::shared_ptr<MeshInstance>>& meshInstances,
+        const std::vector<std::vector<rtxcr::geometry::LineSegment>>& curvesLineSegments,
+        const std::vector<std::vector<uint32_t>>& curveGeometrySegmentCounts,
+        const bool useSegmentVertexCounts,
+        std::vector<CurveMeshBuffersCache>& curveMeshBuffersCache);
+
+    // LSS LODs always use the list format
+    void tessellateCurveLods(const TessellationType tessellationType, const std::vector<std::shared_ptr<MeshInstance>>& meshInstances);
+
+    bool useSimdTessellationKernels(const TessellationType tessellationType) const;
+
+    // Successive implicit LSS: one vertex per strand point and an index per segment. Returns the total vertex count.
+    uint32_t tessellateLinearSweptSpheresSuccessive(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances);
+
+    bool getLssSuccessiveVertexCount(const uint32_t meshIndex, uint32_t& numVertices) const;
+
+    // Index, vertex and per vertex attribute counts of a curve mesh in the given representation
+    void getTessellatedMeshCounts(
+        const TessellationType tessellationType,
+        const uint32_t meshIndex,
+        uint32_t& numIndices,
+        uint32_t& numVertices,
+        uint32_t& numAttributes) const;
+
+    // Hash of the source curve buffers of all curve meshes, part of the disk cache key
+    static uint64_t hashCurveSourceGeometry(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances);
+
+    CurveTessellationDiskCache::Key getDiskCacheKey(const TessellationType tessellationType) const;
+
+    // Fills the representation's cache slot from its disk cache entry, returns false on a miss or an entry that doesn't match the scene
+    bool loadTessellationFromDiskCache(
+        const TessellationType tessellationType,
+        const std::vector<std::shared_ptr<MeshInstance>>& meshInstances);
+
+    void storeTessellationToDiskCache(const TessellationType tessellationType);
+
+    // Updates the byte accounting after the representation's cache slot was filled
+    void commitTessellationCache(const TessellationType tessellationType);
+
+    // Rewrites the radius dependent attributes of a range of segments of one tessellated mesh from the segments' current radii.
+    // isLssSuccessive selects the successive implicit LSS layout, one vertex per strand point.
+    // Ranges the geometry library built are rebuilt with it.
+    static void rescaleCurveMeshBuffers(
         const TessellationType tessellationType,
-        std::shared_ptr<BufferGroup> buffers,
-        const std::vector<std::shared_ptr<MeshGeometry>>& geometries);
+        const std::vector<rtxcr::geometry::LineSegment>& lineSegments,
+        const uint32_t firstSegment,
+        const uint32_t numLineSegments,
+        const uint32_t polyTubeOrder,
+        const bool isLssSuccessive,
+        const bool isLibraryTessellation,
+        BufferGroup& meshBuffers);
+
+    // Swaps the tessellated attribute vectors between two buffer groups without copying any vertex data
+    static void swapCurveMeshData(BufferGroup& lhs, BufferGroup& rhs);
+
+    CurveMeshBuffersCache& getCurveMeshBuffersCache(const TessellationType tessellationType, const uint32_t lod, const uint32_t curveIndex);
+
+    // Swaps the LOD's buffers into the scene mesh, the previously displayed LOD goes back to its own slot
+    void setCurveMeshLod(const std::shared_ptr<MeshInfo>& mesh, const uint32_t curveIndex, const uint32_t lod);
+
+    void resetCurveLods(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances);
+
+    void evictTessellationCache(const TessellationType activeTessellationType);
+
+    static size_t getMeshBuffersCacheBytes(const BufferGroup& buffers);
 
     void createDynamicVertexBuffer(
         nvrhi::IDevice* device,
@@ -87,15 +311,51 @@ private:
 
     std::vector<std::vector<rtxcr::geometry::LineSegment>> m_curvesLineSegments;
     std::unordered_map<std::string, uint32_t> m_curvesLineSegmentsIndexMap;
+    // Number of line segments of every original curve geometry, per mesh
+    std::vector<std::vector<uint32_t>> m_curveGeometrySegmentCounts;
+    // Polytube order of every mesh, [meshIndex]
+    std::vector<uint32_t> m_curvePolyTubeOrder;
+
+    // Radius scale baked into m_curvesLineSegments
+    float m_lineSegmentsRadiusScale = 1.0f;
+    // Segment end point radii of every LOD at m_lineSegmentsBaseRadiusScale, [lod][meshIndex]. Kept on the first rescale,
+    // every rescale starts from them so repeated changes don't accumulate rounding.
+    std::vector<std::vector<std::vector<float2>>> m_curvesLineSegmentsBaseRadius;
+    float m_lineSegmentsBaseRadiusScale = 1.0f;
+    // Strands of line list geometries are in Morton order instead of asset order
+    bool m_lineSegmentsMortonOrdered = false;
+    // Error bound m_curvesLineSegments were resegmented with, 0 if they were not
+    float m_lineSegmentsResegmentationError = 0.0f;
+
+    // Line segments and per geometry segment counts of LOD 1 and up, [lod - 1][meshIndex], empty for meshes without LODs
+    std::vector<std::vector<std::vector<rtxcr::geometry::LineSegment>>> m_curvesLodLineSegments;
+    std::vector<std::vector<std::vector<uint32_t>>> m_curveLodGeometrySegmentCounts;
+    // Average LOD0 strand radius per mesh, 0 for meshes without LODs
+    std::vector<float> m_curveLodStrandRadius;
+    float m_curveLodStrandKeepRatio = 1.0f;
 
     std::vector<std::vector<MeshGeometry>> m_curveOriginalGeometryInfoCache;
+    // Vertex buffer ranges as loaded, the dynamic vertex buffer of animated meshes overwrites the scene copy
+    std::vector<decltype(BufferGroup::vertexBufferRanges)> m_curveOriginalVertexBufferRanges;
 
     struct CurveMeshBuffersCache
     {
         std::shared_ptr<BufferGroup> buffers;
         std::vector<MeshGeometry> geometries;
     };
+    // The slot of the representation displayed by the scene is empty, its attribute vectors are owned by the scene's buffer groups
     std::vector<CurveMeshBuffersCache> m_curveMeshBuffersCache[(uint32_t)TessellationType::Count];
+    // LOD 1 and up of every representation, [lod - 1][curveIndex]. Same ownership rule, the LOD displayed by the scene has an empty slot.
+    std::vector<std::vector<CurveMeshBuffersCache>> m_curveLodMeshBuffersCache[(uint32_t)TessellationType::Count];
+    // LOD displayed by the scene per curve mesh
+    std::vector<uint32_t> m_curveMeshSceneLod;
+    TessellationType m_sceneTessellationType = TessellationType::Count;
+    bool m_curveMeshBuffersCacheValid[(uint32_t)TessellationType::Count] = {};
+    size_t m_curveMeshBuffersCacheBytes[(uint32_t)TessellationType::Count] = {};
+    size_t m_curveMeshBuffersCachePeakBytes = 0;
+    // Monotonic request counter of the last time each representation was requested, used for LRU eviction
+    uint64_t m_curveMeshBuffersCacheLastUse[(uint32_t)TessellationType::Count] = {};
+    uint64_t m_tessellationRequestCounter = 0;
 
     struct VertexBufferDescriptor
     {
@@ -104,5 +364,23 @@ private:
     };
     std::unordered_map<BufferGroup*, VertexBufferDescriptor> bufferGroupPrevVertexBufferMap;
 
-    const UIData& m_ui;
+    // A contiguous range of line segments of one mesh, tessellated by a single worker
+    struct TessellationTask
+    {
+        uint32_t meshIndex = 0;
+        uint32_t curveIndex = 0;
+        uint32_t numLineSegments = 0;
+        uint32_t numVerticesPerSegment = 0;
+        uint32_t globalIndex = 0;
+    };
+    // Segments of a task, set by hairTessellationSegmentsPerTask. Splits the geometries, the output doesn't depend on it.
+    const uint32_t m_segmentsPerTask;
+
+    std::unique_ptr<ThreadPool> m_threadPool;
+
+    // Only created when the disk cache is enabled
+    std::unique_ptr<CurveTessellationDiskCache> m_diskCache;
+    uint64_t m_curveSourceGeometryHash = 0;
+
+    const CurveTessellationSettings& m_settings;
 };
@@ -0,0 +1,439 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <donut/core/log.h>
+
+#include "CurveTessellationDiskCache.h"
+
+namespace
+{
+    constexpr uint32_t kMagic = 0x43485852; // "RXHC"
+
+    struct FileHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t sourceGeometryHash;
+        uint32_t tessellationType;
+        uint32_t polyTubeOrders;
+        float radiusScale;
+        uint32_t lssSuccessiveImplicit;
+        uint32_t numMeshes;
+        float resegmentationError;
+        uint32_t strandOrder;
+        uint32_t kernels;
+        // Size and hash of everything following the header
+        uint64_t payloadBytes;
+        uint64_t payloadHash;
+    };
+    static_assert(sizeof(FileHeader) == 64, "The cache file header layout must not depend on the compiler");
+
+    struct MeshRecord
+    {
+        uint32_t numGeometries;
+        uint32_t numIndices;
+        uint32_t numVertices;
+        uint32_t numAttributes;
+    };
+
+    inline uint64_t rotl64(const uint64_t x, const int r)
+    {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    inline uint64_t fmix64(uint64_t k)
+    {
+        k ^= k >> 33;
+        k *= 0xff51afd7ed558ccdull;
+        k ^= k >> 33;
+        k *= 0xc4ceb9fe1a85ec53ull;
+        k ^= k >> 33;
+        return k;
+    }
+
+    inline bool keyMatches(const FileHeader& header, const CurveTessellationDiskCache::Key& key)
+    {
+        uint32_t headerRadiusBits = 0;
+        uint32_t keyRadiusBits = 0;
+        std::memcpy(&headerRadiusBits, &header.radiusScale, sizeof(float));
+        std::memcpy(&keyRadiusBits, &key.radiusScale, sizeof(float));
+
+        uint32_t headerErrorBits = 0;
+        uint32_t keyErrorBits = 0;
+        std::memcpy(&headerErrorBits, &header.resegmentationError, sizeof(float));
+        std::memcpy(&keyErrorBits, &key.resegmentationError, sizeof(float));
+
+        return header.sourceGeometryHash == key.sourceGeometryHash &&
+               header.tessellationType == key.tessellationType &&
+               header.polyTubeOrders == key.polyTubeOrders &&
+               header.lssSuccessiveImplicit == key.lssSuccessiveImplicit &&
+               header.strandOrder == key.strandOrder &&
+               header.kernels == key.kernels &&
+               headerRadiusBits == keyRadiusBits &&
+               headerErrorBits == keyErrorBits;
+    }
+
+    // Bounds checked sequential reader over the mapped payload, hashes every chunk it hands out
+    class PayloadReader
+    {
+    public:
+        PayloadReader(const uint8_t* data, const size_t size)
+        : m_data(data)
+        , m_remaining(size)
+        {
+        }
+
+        template<typename T>
+        bool read(const T*& result, const uint32_t count)
+        {
+            const size_t bytes = static_cast<size_t>(count) * sizeof(T);
+            if (bytes > m_remaining)
+            {
+                return false;
+            }
+
+            result = (count > 0) ? reinterpret_cast<const T*>(m_data) : nullptr;
+            m_hash = CurveTessellationDiskCache::hashBytes(m_data, bytes, m_hash);
+            m_data += bytes;
+            m_remaining -= bytes;
+            return true;
+        }
+
+        inline size_t getRemaining() const { return m_remaining; }
+        inline uint64_t getHash() const { return m_hash; }
+
+    private:
+        const uint8_t* m_data = nullptr;
+        size_t m_remaining = 0;
+        uint64_t m_hash = 0;
+    };
+
+    class PayloadWriter
+    {
+    public:
+        explicit PayloadWriter(std::ofstream& stream)
+        : m_stream(stream)
+        {
+        }
+
+        template<typename T>
+        void write(const T* data, const uint32_t count)
+        {
+            const size_t bytes = static_cast<size_t>(count) * sizeof(T);
+            m_hash = CurveTessellationDiskCache::hashBytes(data, bytes, m_hash);
+            m_stream.write(reinterpret_cast<const char*>(data), bytes);
+            m_bytes += bytes;
+        }
+
+        inline uint64_t getBytes() const { return m_bytes; }
+        inline uint64_t getHash() const { return m_hash; }
+
+    private:
+        std::ofstream& m_stream;
+        uint64_t m_bytes = 0;
+        uint64_t m_hash = 0;
+    };
+}
+
+CurveTessellationDiskCache::Entry::~Entry()
+{
+#if defined(_WIN32)
+    if (m_data)
+    {
+        UnmapViewOfFile(m_data);
+    }
+    if (m_mappingHandle)
+    {
+        CloseHandle(m_mappingHandle);
+    }
+    if (m_fileHandle)
+    {
+        CloseHandle(m_fileHandle);
+    }
+#else
+    if (m_data)
+    {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+#endif
+}
+
+CurveTessellationDiskCache::CurveTessellationDiskCache(const std::filesystem::path& cacheDirectory)
+: m_cacheDirectory(cacheDirectory)
+{
+}
+
+std::filesystem::path CurveTessellationDiskCache::getEntryPath(const Key& key) const
+{
+    uint64_t keyHash = hashBytes(&key.sourceGeometryHash, sizeof(key.sourceGeometryHash), kVersion);
+    keyHash = hashBytes(&key.tessellationType, sizeof(key.tessellationType), keyHash);
+    keyHash = hashBytes(&key.polyTubeOrders, sizeof(key.polyTubeOrders), keyHash);
+    keyHash = hashBytes(&key.radiusScale, sizeof(key.radiusScale), keyHash);
+    keyHash = hashBytes(&key.lssSuccessiveImplicit, sizeof(key.lssSuccessiveImplicit), keyHash);
+    keyHash = hashBytes(&key.resegmentationError, sizeof(key.resegmentationError), keyHash);
+    keyHash = hashBytes(&key.strandOrder, sizeof(key.strandOrder), keyHash);
+    keyHash = hashBytes(&key.kernels, sizeof(key.kernels), keyHash);
+
+    char fileName[64];
+    snprintf(fileName, sizeof(fileName), "%016" PRIx64 ".hair", keyHash);
+    return m_cacheDirectory / fileName;
+}
+
+std::unique_ptr<CurveTessellationDiskCache::Entry> CurveTessellationDiskCache::load(const Key& key) const
+{
+    const std::filesystem::path path = getEntryPath(key);
+
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(path, error))
+    {
+        return nullptr;
+    }
+
+    std::unique_ptr<Entry> entry(new Entry());
+
+#if defined(_WIN32)
+    HANDLE fileHandle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        return nullptr;
+    }
+    entry->m_fileHandle = fileHandle;
+
+    LARGE_INTEGER fileSize = {};
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart < static_cast<LONGLONG>(sizeof(FileHeader)))
+    {
+        donut::log::warning("Curve tessellation disk cache: %s is truncated", path.string().c_str());
+        return nullptr;
+    }
+    entry->m_size = static_cast<size_t>(fileSize.QuadPart);
+
+    entry->m_mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!entry->m_mappingHandle)
+    {
+        return nullptr;
+    }
+
+    entry->m_data = static_cast<const uint8_t*>(MapViewOfFile(entry->m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    if (!entry->m_data)
+    {
+        return nullptr;
+    }
+#else
+    const int fileDescriptor = open(path.c_str(), O_RDONLY);
+    if (fileDescriptor < 0)
+    {
+        return nullptr;
+    }
+
+    struct stat fileStat = {};
+    if (fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size < static_cast<off_t>(sizeof(FileHeader)))
+    {
+        donut::log::warning("Curve tessellation disk cache: %s is truncated", path.string().c_str());
+        close(fileDescriptor);
+        return nullptr;
+    }
+    entry->m_size = static_cast<size_t>(fileStat.st_size);
+
+    void* data = mmap(nullptr, entry->m_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    close(fileDescriptor);
+    if (data == MAP_FAILED)
+    {
+        return nullptr;
+    }
+    entry->m_data = static_cast<const uint8_t*>(data);
+#endif
+
+    FileHeader header;
+    std::memcpy(&header, entry->m_data, sizeof(FileHeader));
+    if (header.magic != kMagic || header.version != kVersion)
+    {
+        donut::log::info("Curve tessellation disk cache: %s has an unknown format, rebuilding", path.string().c_str());
+        return nullptr;
+    }
+
+    if (!keyMatches(header, key))
+    {
+        donut::log::info("Curve tessellation disk cache: %s is stale, rebuilding", path.string().c_str());
+        return nullptr;
+    }
+
+    if (header.payloadBytes != entry->m_size - sizeof(FileHeader))
+    {
+        donut::log::warning("Curve tessellation disk cache: %s is truncated", path.string().c_str());
+        return nullptr;
+    }
+
+    // The header isn't covered by the payload hash, a corrupted mesh count must not size the mesh views
+    if (header.numMeshes > header.payloadBytes / sizeof(MeshRecord))
+    {
+        donut::log::warning("Curve tessellation disk cache: %s is corrupted", path.string().c_str());
+        return nullptr;
+    }
+
+    PayloadReader reader(entry->m_data + sizeof(FileHeader), static_cast<size_t>(header.payloadBytes));
+    entry->m_meshes.resize(header.numMeshes);
+    for (MeshView& mesh : entry->m_meshes)
+    {
+        const MeshRecord* record = nullptr;
+        if (!reader.read(record, 1) ||
+            !reader.read(mesh.geometries, record->numGeometries) ||
+            !reader.read(mesh.indices, record->numIndices) ||
+            !reader.read(mesh.positions, record->numVertices) ||
+            !reader.read(mesh.radius, record->numVertices) ||
+            !reader.read(mesh.normals, record->numAttributes) ||
+            !reader.read(mesh.tangents, record->numAttributes) ||
+            !reader.read(mesh.texCoords, record->numAttributes))
+        {
+            donut::log::warning("Curve tessellation disk cache: %s is corrupted", path.string().c_str());
+            return nullptr;
+        }
+
+        mesh.numGeometries = record->numGeometries;
+        mesh.numIndices = record->numIndices;
+        mesh.numVertices = record->numVertices;
+        mesh.numAttributes = record->numAttributes;
+    }
+
+    if (reader.getRemaining() != 0 || reader.getHash() != header.payloadHash)
+    {
+        donut::log::warning("Curve tessellation disk cache: %s is corrupted", path.string().c_str());
+        return nullptr;
+    }
+
+    return entry;
+}
+
+bool CurveTessellationDiskCache::store(const Key& key, const std::vector<MeshView>& meshes) const
+{
+    const std::filesystem::path path = getEntryPath(key);
+    std::filesystem::path tempPath = path;
+    tempPath += ".tmp";
+
+    std::error_code error;
+    std::filesystem::create_directories(m_cacheDirectory, error);
+
+    {
+        std::ofstream stream(tempPath, std::ios::binary | std::ios::trunc);
+        if (!stream)
+        {
+            donut::log::warning("Curve tessellation disk cache: failed to create %s", tempPath.string().c_str());
+            return false;
+        }
+
+        FileHeader header = {};
+        header.magic = kMagic;
+        header.version = kVersion;
+        header.sourceGeometryHash = key.sourceGeometryHash;
+        header.tessellationType = key.tessellationType;
+        header.polyTubeOrders = key.polyTubeOrders;
+        header.radiusScale = key.radiusScale;
+        header.lssSuccessiveImplicit = key.lssSuccessiveImplicit;
+        header.resegmentationError = key.resegmentationError;
+        header.strandOrder = key.strandOrder;
+        header.kernels = key.kernels;
+        header.numMeshes = static_cast<uint32_t>(meshes.size());
+
+        // The header is rewritten once the payload size and hash are known
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+
+        PayloadWriter writer(stream);
+        for (const MeshView& mesh : meshes)
+        {
+            MeshRecord record = {};
+            record.numGeometries = mesh.numGeometries;
+            record.numIndices = mesh.numIndices;
+            record.numVertices = mesh.numVertices;
+            record.numAttributes = mesh.numAttributes;
+
+            writer.write(&record, 1);
+            writer.write(mesh.geometries, mesh.numGeometries);
+            writer.write(mesh.indices, mesh.numIndices);
+            writer.write(mesh.positions, mesh.numVertices);
+            writer.write(mesh.radius, mesh.numVertices);
+            writer.write(mesh.normals, mesh.numAttributes);
+            writer.write(mesh.tangents, mesh.numAttributes);
+            writer.write(mesh.texCoords, mesh.numAttributes);
+        }
+
+        header.payloadBytes = writer.getBytes();
+        header.payloadHash = writer.getHash();
+        stream.seekp(0);
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+
+        if (!stream.good())
+        {
+            stream.close();
+            std::filesystem::remove(tempPath, error);
+            donut::log::warning("Curve tessellation disk cache: failed to write %s", tempPath.string().c_str());
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tempPath, path, error);
+    if (error)
+    {
+        std::filesystem::remove(tempPath, error);
+        donut::log::warning("Curve tessellation disk cache: failed to write %s", path.string().c_str());
+        return false;
+    }
+
+    return true;
+}
+
+uint64_t CurveTessellationDiskCache::hashBytes(const void* data, const size_t size, const uint64_t seed)
+{
+    constexpr uint64_t c1 = 0x87c37b91114253d5ull;
+    constexpr uint64_t c2 = 0x4cf5ad432745937full;
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    uint64_t hash = seed ^ (size * c1);
+
+    const size_t numWords = size / sizeof(uint64_t);
+    for (size_t wordIndex = 0; wordIndex < numWords; ++wordIndex)
+    {
+        uint64_t k = 0;
+        std::memcpy(&k, bytes + wordIndex * sizeof(uint64_t), sizeof(uint64_t));
+        k *= c1;
+        k = rotl64(k, 31);
+        k *= c2;
+        hash ^= k;
+        hash = rotl64(hash, 27) * 5 + 0x52dce729;
+    }
+
+    const size_t tailBytes = size - numWords * sizeof(uint64_t);
+    if (tailBytes > 0)
+    {
+        uint64_t k = 0;
+        std::memcpy(&k, bytes + numWords * sizeof(uint64_t), tailBytes);
+        k *= c1;
+        k = rotl64(k, 31);
+        k *= c2;
+        hash ^= k;
+    }
+
+    return fmix64(hash);
+}
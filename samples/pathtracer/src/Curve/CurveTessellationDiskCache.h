@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <vector>
+#include <donut/core/math/math.h>
+
+// Persistent cache of tessellated curve meshes, one file per (source geometry, tessellation type and tessellation settings).
+// Entries are memory mapped on load, a corrupted, truncated or stale entry is reported as a miss and rebuilt by the caller.
+class CurveTessellationDiskCache
+{
+public:
+    // Bump whenever the file layout or the tessellation output changes
+    static constexpr uint32_t kVersion = 7;
+
+    struct Key
+    {
+        uint64_t sourceGeometryHash = 0;
+        uint32_t tessellationType = 0;
+        uint32_t polyTubeOrders = 0; // Polytube only: hash of the per mesh polytube orders
+        float radiusScale = 0.0f;
+        uint32_t lssSuccessiveImplicit = 0;
+        float resegmentationError = 0.0f;
+        // 0: asset order, 1: Morton order of the strand centers
+        uint32_t strandOrder = 0;
+        // Polytube and DOTS only: 0 for the geometry library and the scalar kernels, 1 + CurveTessellationKernelIsa for the SIMD kernels.
+        // The SIMD kernels round differently from the scalar code, so each kernel set gets its own entries.
+        uint32_t kernels = 0;
+    };
+
+    struct GeometryRecord
+    {
+        uint32_t numIndices = 0;
+        uint32_t numVertices = 0;
+        uint32_t indexOffsetInMesh = 0;
+        uint32_t vertexOffsetInMesh = 0;
+    };
+
+    // Streams of one tessellated curve mesh. Normals, tangents and texcoords have numAttributes elements, radius has numVertices.
+    struct MeshView
+    {
+        const GeometryRecord* geometries = nullptr;
+        uint32_t numGeometries = 0;
+
+        const uint32_t* indices = nullptr;
+        uint32_t numIndices = 0;
+
+        const donut::math::float3* positions = nullptr;
+        const float* radius = nullptr;
+        uint32_t numVertices = 0;
+
+        const uint32_t* normals = nullptr;
+        const uint32_t* tangents = nullptr;
+        const donut::math::float2* texCoords = nullptr;
+        uint32_t numAttributes = 0;
+    };
+
+    // A validated cache entry, the mesh views point into the file mapping and stay valid for the lifetime of the entry
+    class Entry
+    {
+    public:
+        ~Entry();
+
+        Entry(const Entry&) = delete;
+        Entry& operator=(const Entry&) = delete;
+
+        inline const std::vector<MeshView>& getMeshes() const { return m_meshes; }
+
+    private:
+        friend class CurveTessellationDiskCache;
+        Entry() = default;
+
+        void* m_fileHandle = nullptr;
+        void* m_mappingHandle = nullptr;
+        const uint8_t* m_data = nullptr;
+        size_t m_size = 0;
+        std::vector<MeshView> m_meshes;
+    };
+
+    explicit CurveTessellationDiskCache(const std::filesystem::path& cacheDirectory);
+
+    // Returns nullptr on a miss, a version or key mismatch, or a truncated/corrupted file
+    std::unique_ptr<Entry> load(const Key& key) const;
+
+    // Writes to a temporary file first and renames it over the entry, so readers never see a partially written file
+    bool store(const Key& key, const std::vector<MeshView>& meshes) const;
+
+    std::filesystem::path getEntryPath(const Key& key) const;
+
+    // 64-bit non-cryptographic hash, hashing consecutive chunks with the previous result as seed is deterministic
+    static uint64_t hashBytes(const void* data, const size_t size, const uint64_t seed);
+
+private:
+    std::filesystem::path m_cacheDirectory;
+};
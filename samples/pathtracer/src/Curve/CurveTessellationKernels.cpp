@@ -0,0 +1,384 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "CurveTessellationKernelsSimd.h"
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define RTXCR_CURVE_SIMD_X64 1
+#define RTXCR_CURVE_SIMD_AVX2 0
+#include "CurveTessellationKernelsSimdImpl.h"
+#undef RTXCR_CURVE_SIMD_AVX2
+#else
+#define RTXCR_CURVE_SIMD_X64 0
+#endif
+
+namespace CurveTessellationKernels
+{
+namespace
+{
+    inline float3 getEndPoint(const rtxcr::geometry::LineSegment& lineSegment, const uint32_t endPoint)
+    {
+        const auto& position = lineSegment.vertices[endPoint].position;
+        return float3(position[0], position[1], position[2]);
+    }
+
+    // kRadiusOnly only writes the radius dependent attributes, position and radius
+    template <bool kRadiusOnly>
+    inline void writeVertex(
+        const CurveTessellationOutput& output,
+        const uint32_t vertexIndex,
+        const float3& position,
+        const uint32_t normal,
+        const uint32_t tangent,
+        const rtxcr::geometry::LineSegment& lineSegment,
+        const uint32_t endPoint)
+    {
+        const auto& vertex = lineSegment.vertices[endPoint];
+        output.positions[vertexIndex] = position;
+        output.radius[vertexIndex] = vertex.radius;
+        if constexpr (!kRadiusOnly)
+        {
+            output.indices[vertexIndex] = vertexIndex;
+            output.normals[vertexIndex] = normal;
+            output.tangents[vertexIndex] = tangent;
+            output.texCoords[vertexIndex] = float2(vertex.texCoord[0], vertex.texCoord[1]);
+        }
+    }
+
+#if RTXCR_CURVE_TESSELLATION_AVX2
+    bool isAvx2Supported()
+    {
+#if RTXCR_CURVE_SIMD_X64 && defined(_MSC_VER)
+        int cpuInfo[4] = {};
+        __cpuid(cpuInfo, 0);
+        if (cpuInfo[0] < 7)
+        {
+            return false;
+        }
+
+        // AVX and OSXSAVE, then make sure the OS saves the YMM registers
+        __cpuid(cpuInfo, 1);
+        const bool osxsave = (cpuInfo[2] & (1 << 27)) != 0;
+        const bool avx = (cpuInfo[2] & (1 << 28)) != 0;
+        if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+        {
+            return false;
+        }
+
+        __cpuidex(cpuInfo, 7, 0);
+        return (cpuInfo[1] & (1 << 5)) != 0;
+#elif RTXCR_CURVE_SIMD_X64 && (defined(__GNUC__) || defined(__clang__))
+        return __builtin_cpu_supports("avx2");
+#else
+        return false;
+#endif
+    }
+#endif
+} // namespace
+
+const PolyTubeRing* getPolyTubeRings(const uint32_t polyTubeOrder)
+{
+    using RingTable = std::array<PolyTubeRing, kMaxPolyTubeOrder + 1>;
+    static const auto rings = []()
+    {
+        std::array<RingTable, kMaxPolyTubeOrder - kMinPolyTubeOrder + 1> ringTables = {};
+        for (uint32_t order = kMinPolyTubeOrder; order <= kMaxPolyTubeOrder; ++order)
+        {
+            for (uint32_t ring = 0; ring <= order; ++ring)
+            {
+                // Same wrapping as getUnitCircleCoords in morphTargetAnimation.cs.hlsl, we only care about angles < 2PI
+                const float angleRadians = 2.0f * dm::PI_f * float(ring) / float(order);
+                float unused = 0.0f;
+                float unitCircleFraction = std::modf(angleRadians / (2.0f * dm::PI_f), &unused);
+                if (unitCircleFraction < 0.0f)
+                {
+                    unitCircleFraction = 1.0f - unitCircleFraction;
+                }
+                const float adjustedAngleRadians = unitCircleFraction * 2.0f * dm::PI_f;
+                ringTables[order - kMinPolyTubeOrder][ring] = { cosf(adjustedAngleRadians), sinf(adjustedAngleRadians) };
+            }
+        }
+        return ringTables;
+    }();
+    return rings[polyTubeOrder - kMinPolyTubeOrder].data();
+}
+
+float getPolyTubeVolumeCompensationScale(const uint32_t polyTubeOrder)
+{
+    // Necessary to make up for lost volume of PolyTube approximation of a circular tube
+    const float halfSectorAngle = dm::PI_f / float(polyTubeOrder);
+    return 1.0f / (sinf(halfSectorAngle) / halfSectorAngle);
+}
+
+float getDotsVolumeCompensationScale()
+{
+    constexpr float kHalfSectorAngle = dm::PI_f / 4.0f;
+    static const float scale = 1.0f / (sinf(kHalfSectorAngle) / kHalfSectorAngle);
+    return scale;
+}
+
+CurveTessellationKernelIsa getSupportedIsa()
+{
+#if RTXCR_CURVE_SIMD_X64
+    static const CurveTessellationKernelIsa isa =
+#if RTXCR_CURVE_TESSELLATION_AVX2
+        isAvx2Supported() ? CurveTessellationKernelIsa::Avx2 :
+#endif
+        CurveTessellationKernelIsa::Sse2;
+    return isa;
+#else
+    return CurveTessellationKernelIsa::Scalar;
+#endif
+}
+
+namespace
+{
+    template <bool kRadiusOnly, uint32_t kOrder>
+    uint32_t polyTubesScalar(
+        const rtxcr::geometry::LineSegment* lineSegments,
+        const uint32_t numLineSegments,
+        const CurveTessellationOutput& output,
+        uint32_t globalIndex)
+    {
+        const PolyTubeRing* rings = getPolyTubeRings(kOrder);
+        const float volumeCompensationScale = getPolyTubeVolumeCompensationScale(kOrder);
+
+        for (uint32_t segmentIndex = 0; segmentIndex < numLineSegments; ++segmentIndex)
+        {
+            const auto& lineSegment = lineSegments[segmentIndex];
+            const float3 endPoints[2] = { getEndPoint(lineSegment, 0), getEndPoint(lineSegment, 1) };
+            const float scaledRadius[2] = {
+                lineSegment.vertices[0].radius * volumeCompensationScale,
+                lineSegment.vertices[1].radius * volumeCompensationScale };
+
+            // Build the segment frame
+            const float3 fwd = normalizeVector(endPoints[1] - endPoints[0]);
+            const float3 s = perpStark(fwd);
+            const float3 t = crossVector(fwd, s);
+            const uint32_t tangent = vectorToSnorm8(fwd);
+
+            for (uint32_t face = 0; face < kOrder; ++face)
+            {
+                for (uint32_t vertex = 0; vertex < kVerticesPerFace; ++vertex)
+                {
+                    const PolyTubeRing& ring = rings[face + kPolyTubeRingMapping[vertex]];
+                    const uint32_t endPoint = kEndPointMapping[vertex];
+                    const float3 direction = ring.cosAngle * s + ring.sinAngle * t;
+
+                    writeVertex<kRadiusOnly>(output, globalIndex, endPoints[endPoint] + direction * scaledRadius[endPoint],
+                        vectorToSnorm8(direction), tangent, lineSegment, endPoint);
+                    ++globalIndex;
+                }
+            }
+        }
+
+        return globalIndex;
+    }
+
+    template <bool kRadiusOnly>
+    uint32_t disjointOrthogonalTriangleStripsScalar(
+        const rtxcr::geometry::LineSegment* lineSegments,
+        const uint32_t numLineSegments,
+        const CurveTessellationOutput& output,
+        uint32_t globalIndex)
+    {
+        const float volumeCompensationScale = getDotsVolumeCompensationScale();
+
+        for (uint32_t segmentIndex = 0; segmentIndex < numLineSegments; ++segmentIndex)
+        {
+            const auto& lineSegment = lineSegments[segmentIndex];
+            const float3 endPoints[2] = { getEndPoint(lineSegment, 0), getEndPoint(lineSegment, 1) };
+            const float scaledRadius[2] = {
+                lineSegment.vertices[0].radius * volumeCompensationScale,
+                lineSegment.vertices[1].radius * volumeCompensationScale };
+
+            // Build the segment frame, the 2 faces span its 2 axes
+            const float3 fwd = normalizeVector(endPoints[1] - endPoints[0]);
+            const float3 s = perpStark(fwd);
+            const float3 faceAxes[kDotsFaces] = { s, crossVector(fwd, s) };
+            const uint32_t tangent = vectorToSnorm8(fwd);
+
+            for (uint32_t face = 0; face < kDotsFaces; ++face)
+            {
+                for (uint32_t vertex = 0; vertex < kVerticesPerFace; ++vertex)
+                {
+                    const uint32_t endPoint = kEndPointMapping[vertex];
+                    const float3 direction = faceAxes[face] * kDotsNormalSignMapping[vertex];
+
+                    writeVertex<kRadiusOnly>(output, globalIndex, endPoints[endPoint] + direction * scaledRadius[endPoint],
+                        vectorToSnorm8(direction), tangent, lineSegment, endPoint);
+                    ++globalIndex;
+                }
+            }
+        }
+
+        return globalIndex;
+    }
+
+    using PolyTubeKernel = uint32_t (*)(const rtxcr::geometry::LineSegment*, const uint32_t, const CurveTessellationOutput&, uint32_t);
+
+    // One specialization per order keeps the face loops fixed length
+    template <bool kRadiusOnly>
+    PolyTubeKernel getPolyTubesScalarKernel(const uint32_t polyTubeOrder)
+    {
+        static constexpr PolyTubeKernel kKernels[kMaxPolyTubeOrder - kMinPolyTubeOrder + 1] = {
+            polyTubesScalar<kRadiusOnly, 2>,
+            polyTubesScalar<kRadiusOnly, 3>,
+            polyTubesScalar<kRadiusOnly, 4>,
+            polyTubesScalar<kRadiusOnly, 5>,
+            polyTubesScalar<kRadiusOnly, 6>,
+            polyTubesScalar<kRadiusOnly, 7>,
+            polyTubesScalar<kRadiusOnly, 8> };
+        static_assert(kMinPolyTubeOrder == 2 && kMaxPolyTubeOrder == 8, "Polytube kernel table doesn't cover the order range");
+
+        assert(polyTubeOrder >= kMinPolyTubeOrder && polyTubeOrder <= kMaxPolyTubeOrder);
+        return kKernels[polyTubeOrder - kMinPolyTubeOrder];
+    }
+} // namespace
+
+uint32_t tessellatePolyTubesScalar(
+    const rtxcr::geometry::LineSegment* lineSegments,
+    const uint32_t numLineSegments,
+    const uint32_t polyTubeOrder,
+    const CurveTessellationOutput& output,
+    const uint32_t globalIndex)
+{
+    return getPolyTubesScalarKernel<false>(polyTubeOrder)(lineSegments, numLineSegments, output, globalIndex);
+}
+
+uint32_t tessellateDisjointOrthogonalTriangleStripsScalar(
+    const rtxcr::geometry::LineSegment* lineSegments,
+    const uint32_t numLineSegments,
+    const CurveTessellationOutput& output,
+    const uint32_t globalIndex)
+{
+    return disjointOrthogonalTriangleStripsScalar<false>(lineSegments, numLineSegments, output, globalIndex);
+}
+
+uint32_t updatePolyTubesRadius(
+    const rtxcr::geometry::LineSegment* lineSegments,
+    const uint32_t numLineSegments,
+    const uint32_t polyTubeOrder,
+    const CurveTessellationOutput& output,
+    const uint32_t globalIndex)
+{
+    return getPolyTubesScalarKernel<true>(polyTubeOrder)(lineSegments, numLineSegments, output, globalIndex);
+}
+
+uint32_t updateDisjointOrthogonalTriangleStripsRadius(
+    const rtxcr::geometry::LineSegment* lineSegments,
+    const uint32_t numLineSegments,
+    const CurveTessellationOutput& output,
+    const uint32_t globalIndex)
+{
+    return disjointOrthogonalTriangleStripsScalar<true>(lineSegments, numLineSegments, output, globalIndex);
+}
+
+uint32_t tessellatePolyTubes(
+    const rtxcr::geometry::LineSegment* lineSegments,
+    const uint32_t numLineSegments,
+    const uint32_t polyTubeOrder,
+    const CurveTessellationOutput& output,
+    const uint32_t globalIndex)
+{
+    switch (getSupportedIsa())
+    {
+#if RTXCR_CURVE_SIMD_X64
+#if RTXCR_CURVE_TESSELLATION_AVX2
+    case CurveTessellationKernelIsa::Avx2:
+        return avx2::tessellatePolyTubes(lineSegments, numLineSegments, polyTubeOrder, output, globalIndex);
+#endif
+    case CurveTessellationKernelIsa::Sse2:
+        return sse2::tessellatePolyTubes(lineSegments, numLineSegments, polyTubeOrder, output, globalIndex);
+#endif
+    default:
+        return tessellatePolyTubesScalar(lineSegments, numLineSegments, polyTubeOrder, output, globalIndex);
+    }
+}
+
+uint32_t tessellateDisjointOrthogonalTriangleStrips(
+    const rtxcr::geometry::LineSegment* lineSegments,
+    const uint32_t numLineSegments,
+    const CurveTessellationOutput& output,
+    const uint32_t globalIndex)
+{
+    switch (getSupportedIsa())
+    {
+#if RTXCR_CURVE_SIMD_X64
+#if RTXCR_CURVE_TESSELLATION_AVX2
+    case CurveTessellationKernelIsa::Avx2:
+        return avx2::tessellateDisjointOrthogonalTriangleStrips(lineSegments, numLineSegments, output, globalIndex);
+#endif
+    case CurveTessellationKernelIsa::Sse2:
+        return sse2::tessellateDisjointOrthogonalTriangleStrips(lineSegments, numLineSegments, output, globalIndex);
+#endif
+    default:
+        return tessellateDisjointOrthogonalTriangleStripsScalar(lineSegments, numLineSegments, output, globalIndex);
+    }
+}
+
+uint32_t compareTessellation(
+    const CurveTessellationOutput& reference,
+    const CurveTessellationOutput& result,
+    const uint32_t firstVertex,
+    const uint32_t numVertices,
+    const bool hasAttributes)
+{
+    constexpr float kRelativePositionTolerance = 1e-5f;
+
+    // The kernels may round differently, which can move a truncated snorm8 component by one step
+    auto isSnorm8Near = [](const uint32_t a, const uint32_t b)
+    {
+        for (uint32_t component = 0; component < 3; ++component)
+        {
+            const int ca = int8_t((a >> (component * 8)) & 0xff);
+            const int cb = int8_t((b >> (component * 8)) & 0xff);
+            if (std::abs(ca - cb) > 1)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    uint32_t numMismatches = 0;
+    for (uint32_t vertexIndex = firstVertex; vertexIndex < firstVertex + numVertices; ++vertexIndex)
+    {
+        const float3 positionError = abs(reference.positions[vertexIndex] - result.positions[vertexIndex]);
+        const float positionTolerance = kRelativePositionTolerance * (1.0f + length(reference.positions[vertexIndex]));
+        bool isMatching = (positionError.x <= positionTolerance && positionError.y <= positionTolerance && positionError.z <= positionTolerance);
+        isMatching &= (reference.radius[vertexIndex] == result.radius[vertexIndex]);
+
+        if (hasAttributes)
+        {
+            isMatching &= (reference.indices[vertexIndex] == result.indices[vertexIndex]);
+            isMatching &= isSnorm8Near(reference.normals[vertexIndex], result.normals[vertexIndex]);
+            isMatching &= isSnorm8Near(reference.tangents[vertexIndex], result.tangents[vertexIndex]);
+            isMatching &= all(reference.texCoords[vertexIndex] == result.texCoords[vertexIndex]);
+        }
+
+        if (!isMatching)
+        {
+            ++numMismatches;
+        }
+    }
+
+    return numMismatches;
+}
+} // namespace CurveTessellationKernels
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <donut/core/math/math.h>
+#include <rtxcr/geometry/include/CurveTessellation.h>
+
+#include "shared.h"
+
+// CPU vertex generation for Polytube and DOTS curve tessellation.
+// The vertex layout matches the rtxcr::geometry tessellators and morphTargetAnimation.cs.hlsl:
+//   every segment emits faces of 6 vertices, vertex i of a face uses segment end point {0, 1, 1, 0, 0, 1}[i],
+//   Polytube vertex i uses ring (face + {0, 1, 0, 0, 1, 1}[i]), DOTS faces are the 2 axes of the segment frame.
+// The index buffer is the identity and every vertex takes the radius and texcoord of its end point.
+
+// Mesh wide output buffers, vertices of a call are written at [globalIndex, globalIndex + numLineSegments * verticesPerSegment)
+struct CurveTessellationOutput
+{
+    uint32_t* indices = nullptr;
+    donut::math::float3* positions = nullptr;
+    uint32_t* normals = nullptr;
+    uint32_t* tangents = nullptr;
+    donut::math::float2* texCoords = nullptr;
+    float* radius = nullptr;
+};
+
+enum class CurveTessellationKernelIsa : uint32_t
+{
+    Scalar = 0,
+    Sse2,
+    Avx2
+};
+
+inline const char* getCurveTessellationKernelIsaName(const CurveTessellationKernelIsa isa)
+{
+    switch (isa)
+    {
+    case CurveTessellationKernelIsa::Avx2: return "AVX2";
+    case CurveTessellationKernelIsa::Sse2: return "SSE2";
+    default:                               return "Scalar";
+    }
+}
+
+namespace CurveTessellationKernels
+{
+    constexpr uint32_t kVerticesPerFace = 6;
+    constexpr uint32_t kDotsFaces = 2;
+    constexpr uint32_t kDotsVerticesPerSegment = kDotsFaces * kVerticesPerFace;
+    constexpr uint32_t kMinPolyTubeOrder = RTXCR_CURVE_POLYTUBE_MIN_ORDER;
+    constexpr uint32_t kMaxPolyTubeOrder = RTXCR_CURVE_POLYTUBE_MAX_ORDER;
+
+    constexpr uint32_t getPolyTubeVerticesPerSegment(const uint32_t polyTubeOrder) { return polyTubeOrder * kVerticesPerFace; }
+
+    constexpr uint32_t kEndPointMapping[kVerticesPerFace] = { 0, 1, 1, 0, 0, 1 };
+    constexpr uint32_t kPolyTubeRingMapping[kVerticesPerFace] = { 0, 1, 0, 0, 1, 1 };
+    constexpr float kDotsNormalSignMapping[kVerticesPerFace] = { 1.0f, -1.0f, 1.0f, 1.0f, -1.0f, -1.0f };
+
+    // Same math as the helpers of the same name in morphTargetAnimation.cs.hlsl
+    inline donut::math::float3 normalizeVector(const donut::math::float3& v)
+    {
+        return v / sqrtf(v.x * v.x + v.y * v.y + v.z * v.z);
+    }
+
+    inline donut::math::float3 crossVector(const donut::math::float3& a, const donut::math::float3& b)
+    {
+        return donut::math::float3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+    }
+
+    inline uint32_t vectorToSnorm8(const donut::math::float3& v)
+    {
+        const float scale = 127.0f / sqrtf(v.x * v.x + v.y * v.y + v.z * v.z);
+        const int x = int(v.x * scale);
+        const int y = int(v.y * scale);
+        const int z = int(v.z * scale);
+        return (x & 0xff) | ((y & 0xff) << 8) | ((z & 0xff) << 16);
+    }
+
+    // Generate a vector that is orthogonal to the input vector
+    inline donut::math::float3 perpStark(const donut::math::float3& u)
+    {
+        const donut::math::float3 a = abs(u);
+        const uint32_t uyx = (a.x - a.y) < 0 ? 1 : 0;
+        const uint32_t uzx = (a.x - a.z) < 0 ? 1 : 0;
+        const uint32_t uzy = (a.y - a.z) < 0 ? 1 : 0;
+        const uint32_t xm = uyx & uzx;
+        const uint32_t ym = (1 ^ xm) & uzy;
+        const uint32_t zm = 1 ^ (xm | ym);
+        return normalizeVector(crossVector(u, donut::math::float3(float(xm), float(ym), float(zm))));
+    }
+
+    // Best instruction set supported by both the build and the running CPU
+    CurveTessellationKernelIsa getSupportedIsa();
+
+    // Scalar reference, mirrors the math of morphTargetAnimation.cs.hlsl.
+    // lineSegments points at the first segment to tessellate, the return value is the globalIndex after the last vertex.
+    // Every polytube order in [kMinPolyTubeOrder, kMaxPolyTubeOrder] has its own specialized loop.
+    uint32_t tessellatePolyTubesScalar(
+        const rtxcr::geometry::LineSegment* lineSegments,
+        const uint32_t numLineSegments,
+        const uint32_t polyTubeOrder,
+        const CurveTessellationOutput& output,
+        const uint32_t globalIndex);
+
+    uint32_t tessellateDisjointOrthogonalTriangleStripsScalar(
+        const rtxcr::geometry::LineSegment* lineSegments,
+        const uint32_t numLineSegments,
+        const CurveTessellationOutput& output,
+        const uint32_t globalIndex);
+
+    // Batched structure-of-arrays kernels, 8 segments per iteration with AVX2 and 4 with SSE2.
+    // Fall back to the scalar reference on CPUs without SIMD support and for the tail of the range.
+    uint32_t tessellatePolyTubes(
+        const rtxcr::geometry::LineSegment* lineSegments,
+        const uint32_t numLineSegments,
+        const uint32_t polyTubeOrder,
+        const CurveTessellationOutput& output,
+        const uint32_t globalIndex);
+
+    uint32_t tessellateDisjointOrthogonalTriangleStrips(
+        const rtxcr::geometry::LineSegment* lineSegments,
+        const uint32_t numLineSegments,
+        const CurveTessellationOutput& output,
+        const uint32_t globalIndex);
+
+    // Rewrite only the radius dependent attributes (positions and radius) of a range tessellated from the same segments with other radii.
+    // Indices, normals, tangents and texcoords don't depend on the radius, only output.positions and output.radius are accessed.
+    uint32_t updatePolyTubesRadius(
+        const rtxcr::geometry::LineSegment* lineSegments,
+        const uint32_t numLineSegments,
+        const uint32_t polyTubeOrder,
+        const CurveTessellationOutput& output,
+        const uint32_t globalIndex);
+
+    uint32_t updateDisjointOrthogonalTriangleStripsRadius(
+        const rtxcr::geometry::LineSegment* lineSegments,
+        const uint32_t numLineSegments,
+        const CurveTessellationOutput& output,
+        const uint32_t globalIndex);
+
+    // Compares two tessellations of the same vertex range: positions within a relative tolerance,
+    // packed normals/tangents within 1 snorm8 step per component, indices/texcoords/radius exactly.
+    // Returns the number of mismatching vertices.
+    uint32_t compareTessellation(
+        const CurveTessellationOutput& reference,
+        const CurveTessellationOutput& result,
+        const uint32_t firstVertex,
+        const uint32_t numVertices,
+        const bool hasAttributes);
+}
@@ -0,0 +1,16 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+// AVX2 build of the batched curve tessellation kernels. Only this translation unit is compiled with AVX2 enabled,
+// CurveTessellationKernels::getSupportedIsa() makes sure it only runs on CPUs that support it.
+#if RTXCR_CURVE_TESSELLATION_AVX2 && (defined(_M_X64) || defined(__x86_64__))
+#define RTXCR_CURVE_SIMD_AVX2 1
+#include "CurveTessellationKernelsSimdImpl.h"
+#endif
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include "CurveTessellationKernels.h"
+
+// Internal interface between the kernel dispatcher and the per instruction set translation units
+namespace CurveTessellationKernels
+{
+    struct PolyTubeRing
+    {
+        float cosAngle;
+        float sinAngle;
+    };
+
+    // polyTubeOrder + 1 ring directions, the last ring closes the tube and equals the first one
+    const PolyTubeRing* getPolyTubeRings(const uint32_t polyTubeOrder);
+    float getPolyTubeVolumeCompensationScale(const uint32_t polyTubeOrder);
+    float getDotsVolumeCompensationScale();
+
+    namespace sse2
+    {
+        uint32_t tessellatePolyTubes(const rtxcr::geometry::LineSegment* lineSegments, const uint32_t numLineSegments, const uint32_t polyTubeOrder, const CurveTessellationOutput& output, const uint32_t globalIndex);
+        uint32_t tessellateDisjointOrthogonalTriangleStrips(const rtxcr::geometry::LineSegment* lineSegments, const uint32_t numLineSegments, const CurveTessellationOutput& output, const uint32_t globalIndex);
+    }
+
+    namespace avx2
+    {
+        uint32_t tessellatePolyTubes(const rtxcr::geometry::LineSegment* lineSegments, const uint32_t numLineSegments, const uint32_t polyTubeOrder, const CurveTessellationOutput& output, const uint32_t globalIndex);
+        uint32_t tessellateDisjointOrthogonalTriangleStrips(const rtxcr::geometry::LineSegment* lineSegments, const uint32_t numLineSegments, const CurveTessellationOutput& output, const uint32_t globalIndex);
+    }
+}
@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+// Batched structure-of-arrays curve tessellation kernels.
+// Included once per instruction set with RTXCR_CURVE_SIMD_AVX2 set to 0 (SSE2, 4 lanes) or 1 (AVX2, 8 lanes),
+// so this file intentionally has no include guard.
+
+#include <immintrin.h>
+
+#include "CurveTessellationKernelsSimd.h"
+
+#if RTXCR_CURVE_SIMD_AVX2
+#define RTXCR_CURVE_SIMD_NAMESPACE avx2
+#else
+#define RTXCR_CURVE_SIMD_NAMESPACE sse2
+#endif
+
+namespace CurveTessellationKernels
+{
+namespace RTXCR_CURVE_SIMD_NAMESPACE
+{
+namespace
+{
+#if RTXCR_CURVE_SIMD_AVX2
+    constexpr uint32_t kWidth = 8;
+    using VFloat = __m256;
+    using VInt = __m256i;
+
+    inline VFloat vLoad(const float* p) { return _mm256_load_ps(p); }
+    inline void vStore(float* p, const VFloat v) { _mm256_store_ps(p, v); }
+    inline void vStore(uint32_t* p, const VInt v) { _mm256_store_si256(reinterpret_cast<__m256i*>(p), v); }
+    inline VFloat vSet(const float f) { return _mm256_set1_ps(f); }
+    inline VFloat vAdd(const VFloat a, const VFloat b) { return _mm256_add_ps(a, b); }
+    inline VFloat vSub(const VFloat a, const VFloat b) { return _mm256_sub_ps(a, b); }
+    inline VFloat vMul(const VFloat a, const VFloat b) { return _mm256_mul_ps(a, b); }
+    inline VFloat vDiv(const VFloat a, const VFloat b) { return _mm256_div_ps(a, b); }
+    inline VFloat vSqrt(const VFloat a) { return _mm256_sqrt_ps(a); }
+    inline VFloat vAnd(const VFloat a, const VFloat b) { return _mm256_and_ps(a, b); }
+    inline VFloat vAndNot(const VFloat a, const VFloat b) { return _mm256_andnot_ps(a, b); }
+    inline VFloat vOr(const VFloat a, const VFloat b) { return _mm256_or_ps(a, b); }
+    inline VFloat vXor(const VFloat a, const VFloat b) { return _mm256_xor_ps(a, b); }
+    inline VFloat vLess(const VFloat a, const VFloat b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    inline VInt vTruncate(const VFloat a) { return _mm256_cvttps_epi32(a); }
+    inline VInt vSetInt(const uint32_t i) { return _mm256_set1_epi32(static_cast<int>(i)); }
+    inline VInt vAndInt(const VInt a, const VInt b) { return _mm256_and_si256(a, b); }
+    inline VInt vOrInt(const VInt a, const VInt b) { return _mm256_or_si256(a, b); }
+    template<int Shift> inline VInt vShiftLeft(const VInt a) { return _mm256_slli_epi32(a, Shift); }
+#else
+    constexpr uint32_t kWidth = 4;
+    using VFloat = __m128;
+    using VInt = __m128i;
+
+    inline VFloat vLoad(const float* p) { return _mm_load_ps(p); }
+    inline void vStore(float* p, const VFloat v) { _mm_store_ps(p, v); }
+    inline void vStore(uint32_t* p, const VInt v) { _mm_store_si128(reinterpret_cast<__m128i*>(p), v); }
+    inline VFloat vSet(const float f) { return _mm_set1_ps(f); }
+    inline VFloat vAdd(const VFloat a, const VFloat b) { return _mm_add_ps(a, b); }
+    inline VFloat vSub(const VFloat a, const VFloat b) { return _mm_sub_ps(a, b); }
+    inline VFloat vMul(const VFloat a, const VFloat b) { return _mm_mul_ps(a, b); }
+    inline VFloat vDiv(const VFloat a, const VFloat b) { return _mm_div_ps(a, b); }
+    inline VFloat vSqrt(const VFloat a) { return _mm_sqrt_ps(a); }
+    inline VFloat vAnd(const VFloat a, const VFloat b) { return _mm_and_ps(a, b); }
+    inline VFloat vAndNot(const VFloat a, const VFloat b) { return _mm_andnot_ps(a, b); }
+    inline VFloat vOr(const VFloat a, const VFloat b) { return _mm_or_ps(a, b); }
+    inline VFloat vXor(const VFloat a, const VFloat b) { return _mm_xor_ps(a, b); }
+    inline VFloat vLess(const VFloat a, const VFloat b) { return _mm_cmplt_ps(a, b); }
+    inline VInt vTruncate(const VFloat a) { return _mm_cvttps_epi32(a); }
+    inline VInt vSetInt(const uint32_t i) { return _mm_set1_epi32(static_cast<int>(i)); }
+    inline VInt vAndInt(const VInt a, const VInt b) { return _mm_and_si128(a, b); }
+    inline VInt vOrInt(const VInt a, const VInt b) { return _mm_or_si128(a, b); }
+    template<int Shift> inline VInt vShiftLeft(const VInt a) { return _mm_slli_epi32(a, Shift); }
+#endif
+
+    inline VFloat vAllBits() { return vLess(vSet(0.0f), vSet(1.0f)); }
+    inline VFloat vAbs(const VFloat a) { return vAndNot(vSet(-0.0f), a); }
+    inline VFloat vNegate(const VFloat a) { return vXor(vSet(-0.0f), a); }
+
+    struct VFloat3
+    {
+        VFloat x;
+        VFloat y;
+        VFloat z;
+    };
+
+    inline VFloat vDot(const VFloat3& a, const VFloat3& b)
+    {
+        return vAdd(vAdd(vMul(a.x, b.x), vMul(a.y, b.y)), vMul(a.z, b.z));
+    }
+
+    inline VFloat3 vNormalize(const VFloat3& v)
+    {
+        const VFloat length = vSqrt(vDot(v, v));
+        return { vDiv(v.x, length), vDiv(v.y, length), vDiv(v.z, length) };
+    }
+
+    inline VFloat3 vCross(const VFloat3& a, const VFloat3& b)
+    {
+        return {
+            vSub(vMul(a.y, b.z), vMul(a.z, b.y)),
+            vSub(vMul(a.z, b.x), vMul(a.x, b.z)),
+            vSub(vMul(a.x, b.y), vMul(a.y, b.x)) };
+    }
+
+    // Same packing as vectorToSnorm8 in morphTargetAnimation.cs.hlsl, float to int conversion truncates
+    inline VInt vVectorToSnorm8(const VFloat3& v)
+    {
+        const VFloat scale = vDiv(vSet(127.0f), vSqrt(vDot(v, v)));
+        const VInt byteMask = vSetInt(0xff);
+        const VInt x = vAndInt(vTruncate(vMul(v.x, scale)), byteMask);
+        const VInt y = vAndInt(vTruncate(vMul(v.y, scale)), byteMask);
+        const VInt z = vAndInt(vTruncate(vMul(v.z, scale)), byteMask);
+        return vOrInt(x, vOrInt(vShiftLeft<8>(y), vShiftLeft<16>(z)));
+    }
+
+    // perpStark: cross the input with the axis of its smallest component. Exactly one of the axis masks is set per lane.
+    inline VFloat3 vPerpStark(const VFloat3& u)
+    {
+        const VFloat ax = vAbs(u.x);
+        const VFloat ay = vAbs(u.y);
+        const VFloat az = vAbs(u.z);
+        const VFloat uyx = vLess(vSub(ax, ay), vSet(0.0f));
+        const VFloat uzx = vLess(vSub(ax, az), vSet(0.0f));
+        const VFloat uzy = vLess(vSub(ay, az), vSet(0.0f));
+        const VFloat xm = vAnd(uyx, uzx);
+        const VFloat ym = vAndNot(xm, uzy);
+        const VFloat zm = vAndNot(vOr(xm, ym), vAllBits());
+
+        // cross(u, x) = (0, u.z, -u.y), cross(u, y) = (-u.z, 0, u.x), cross(u, z) = (u.y, -u.x, 0)
+        const VFloat3 v = {
+            vOr(vAnd(ym, vNegate(u.z)), vAnd(zm, u.y)),
+            vOr(vAnd(xm, u.z), vAnd(zm, vNegate(u.x))),
+            vOr(vAnd(xm, vNegate(u.y)), vAnd(ym, u.x)) };
+        return vNormalize(v);
+    }
+
+    // Segments of one batch in structure-of-arrays layout
+    struct alignas(32) SegmentBatch
+    {
+        float position[2][3][kWidth];
+        float radius[2][kWidth];
+        float texCoord[2][2][kWidth];
+    };
+
+    inline void loadSegmentBatch(const rtxcr::geometry::LineSegment* lineSegments, SegmentBatch& batch)
+    {
+        for (uint32_t lane = 0; lane < kWidth; ++lane)
+        {
+            const auto& lineSegment = lineSegments[lane];
+            for (uint32_t endPoint = 0; endPoint < 2; ++endPoint)
+            {
+                const auto& vertex = lineSegment.vertices[endPoint];
+                batch.position[endPoint][0][lane] = vertex.position[0];
+                batch.position[endPoint][1][lane] = vertex.position[1];
+                batch.position[endPoint][2][lane] = vertex.position[2];
+                batch.radius[endPoint][lane] = vertex.radius;
+                batch.texCoord[endPoint][0][lane] = vertex.texCoord[0];
+                batch.texCoord[endPoint][1][lane] = vertex.texCoord[1];
+            }
+        }
+    }
+
+    inline VFloat3 loadEndPoint(const SegmentBatch& batch, const uint32_t endPoint)
+    {
+        return { vLoad(batch.position[endPoint][0]), vLoad(batch.position[endPoint][1]), vLoad(batch.position[endPoint][2]) };
+    }
+
+    // Per lane results of all vertices of one segment batch, written out segment by segment so every segment's
+    // vertices land contiguously in the array-of-structures output buffers
+    template<uint32_t VerticesPerSegment>
+    struct alignas(32) VertexBatch
+    {
+        float position[VerticesPerSegment][3][kWidth];
+        uint32_t normal[VerticesPerSegment][kWidth];
+        uint32_t tangent[kWidth];
+    };
+
+    template<uint32_t VerticesPerSegment>
+    inline void storeVertex(VertexBatch<VerticesPerSegment>& vertices, const uint32_t vertex, const VFloat3& position, const VInt normal)
+    {
+        vStore(vertices.position[vertex][0], position.x);
+        vStore(vertices.position[vertex][1], position.y);
+        vStore(vertices.position[vertex][2], position.z);
+        vStore(vertices.normal[vertex], normal);
+    }
+
+    template<uint32_t VerticesPerSegment>
+    inline void writeVertexBatch(
+        const VertexBatch<VerticesPerSegment>& vertices,
+        const SegmentBatch& batch,
+        const CurveTessellationOutput& output,
+        const uint32_t globalIndex)
+    {
+        for (uint32_t lane = 0; lane < kWidth; ++lane)
+        {
+            const uint32_t firstVertex = globalIndex + lane * VerticesPerSegment;
+            const donut::math::float2 texCoords[2] = {
+                donut::math::float2(batch.texCoord[0][0][lane], batch.texCoord[0][1][lane]),
+                donut::math::float2(batch.texCoord[1][0][lane], batch.texCoord[1][1][lane]) };
+
+            for (uint32_t vertex = 0; vertex < VerticesPerSegment; ++vertex)
+            {
+                const uint32_t vertexIndex = firstVertex + vertex;
+                const uint32_t endPoint = kEndPointMapping[vertex % kVerticesPerFace];
+                output.indices[vertexIndex] = vertexIndex;
+                output.positions[vertexIndex] = donut::math::float3(
+                    vertices.position[vertex][0][lane], vertices.position[vertex][1][lane], vertices.position[vertex][2][lane]);
+                output.normals[vertexIndex] = vertices.normal[vertex][lane];
+                output.tangents[vertexIndex] = vertices.tangent[lane];
+                output.texCoords[vertexIndex] = texCoords[endPoint];
+                output.radius[vertexIndex] = batch.radius[endPoint][lane];
+            }
+        }
+    }
+
+    template<uint32_t kOrder>
+    uint32_t polyTubes(
+        const rtxcr::geometry::LineSegment* lineSegments,
+        const uint32_t numLineSegments,
+        const CurveTessellationOutput& output,
+        uint32_t globalIndex)
+    {
+        constexpr uint32_t kNumRings = kOrder + 1;
+        constexpr uint32_t kVerticesPerSegment = getPolyTubeVerticesPerSegment(kOrder);
+        const PolyTubeRing* rings = getPolyTubeRings(kOrder);
+        const VFloat volumeCompensationScale = vSet(getPolyTubeVolumeCompensationScale(kOrder));
+
+        const uint32_t numBatches = numLineSegments / kWidth;
+        for (uint32_t batchIndex = 0; batchIndex < numBatches; ++batchIndex)
+        {
+            SegmentBatch batch;
+            loadSegmentBatch(lineSegments + batchIndex * kWidth, batch);
+
+            const VFloat3 endPoints[2] = { loadEndPoint(batch, 0), loadEndPoint(batch, 1) };
+            const VFloat scaledRadius[2] = {
+                vMul(vLoad(batch.radius[0]), volumeCompensationScale),
+                vMul(vLoad(batch.radius[1]), volumeCompensationScale) };
+
+            // Build the segment frame
+            const VFloat3 fwd = vNormalize({ vSub(endPoints[1].x, endPoints[0].x), vSub(endPoints[1].y, endPoints[0].y), vSub(endPoints[1].z, endPoints[0].z) });
+            const VFloat3 s = vPerpStark(fwd);
+            const VFloat3 t = vCross(fwd, s);
+
+            VertexBatch<kVerticesPerSegment> vertices;
+            vStore(vertices.tangent, vVectorToSnorm8(fwd));
+
+            // Ring directions and normals are shared by all faces touching the ring
+            VFloat3 ringDirections[kNumRings];
+            VInt ringNormals[kNumRings];
+            for (uint32_t ring = 0; ring < kNumRings; ++ring)
+            {
+                const VFloat cosAngle = vSet(rings[ring].cosAngle);
+                const VFloat sinAngle = vSet(rings[ring].sinAngle);
+                ringDirections[ring] = {
+                    vAdd(vMul(cosAngle, s.x), vMul(sinAngle, t.x)),
+                    vAdd(vMul(cosAngle, s.y), vMul(sinAngle, t.y)),
+                    vAdd(vMul(cosAngle, s.z), vMul(sinAngle, t.z)) };
+                ringNormals[ring] = vVectorToSnorm8(ringDirections[ring]);
+            }
+
+            for (uint32_t face = 0; face < kOrder; ++face)
+            {
+                for (uint32_t vertex = 0; vertex < kVerticesPerFace; ++vertex)
+                {
+                    const uint32_t ring = face + kPolyTubeRingMapping[vertex];
+                    const uint32_t endPoint = kEndPointMapping[vertex];
+                    const VFloat3& direction = ringDirections[ring];
+
+                    const VFloat3 position = {
+                        vAdd(endPoints[endPoint].x, vMul(direction.x, scaledRadius[endPoint])),
+                        vAdd(endPoints[endPoint].y, vMul(direction.y, scaledRadius[endPoint])),
+                        vAdd(endPoints[endPoint].z, vMul(direction.z, scaledRadius[endPoint])) };
+                    storeVertex(vertices, face * kVerticesPerFace + vertex, position, ringNormals[ring]);
+                }
+            }
+
+            writeVertexBatch(vertices, batch, output, globalIndex);
+            globalIndex += kWidth * kVerticesPerSegment;
+        }
+
+        return tessellatePolyTubesScalar(lineSegments + numBatches * kWidth, numLineSegments - numBatches * kWidth, kOrder, output, globalIndex);
+    }
+
+    using PolyTubeKernel = uint32_t (*)(const rtxcr::geometry::LineSegment*, const uint32_t, const CurveTessellationOutput&, uint32_t);
+} // namespace
+
+uint32_t tessellatePolyTubes(
+    const rtxcr::geometry::LineSegment* lineSegments,
+    const uint32_t numLineSegments,
+    const uint32_t polyTubeOrder,
+    const CurveTessellationOutput& output,
+    uint32_t globalIndex)
+{
+    static constexpr PolyTubeKernel kKernels[kMaxPolyTubeOrder - kMinPolyTubeOrder + 1] = {
+        polyTubes<2>, polyTubes<3>, polyTubes<4>, polyTubes<5>, polyTubes<6>, polyTubes<7>, polyTubes<8> };
+    return kKernels[polyTubeOrder - kMinPolyTubeOrder](lineSegments, numLineSegments, output, globalIndex);
+}
+
+uint32_t tessellateDisjointOrthogonalTriangleStrips(
+    const rtxcr::geometry::LineSegment* lineSegments,
+    const uint32_t numLineSegments,
+    const CurveTessellationOutput& output,
+    uint32_t globalIndex)
+{
+    const VFloat volumeCompensationScale = vSet(getDotsVolumeCompensationScale());
+
+    const uint32_t numBatches = numLineSegments / kWidth;
+    for (uint32_t batchIndex = 0; batchIndex < numBatches; ++batchIndex)
+    {
+        SegmentBatch batch;
+        loadSegmentBatch(lineSegments + batchIndex * kWidth, batch);
+
+        const VFloat3 endPoints[2] = { loadEndPoint(batch, 0), loadEndPoint(batch, 1) };
+        const VFloat scaledRadius[2] = {
+            vMul(vLoad(batch.radius[0]), volumeCompensationScale),
+            vMul(vLoad(batch.radius[1]), volumeCompensationScale) };
+
+        // Build the segment frame, the 2 faces span its 2 axes
+        const VFloat3 fwd = vNormalize({ vSub(endPoints[1].x, endPoints[0].x), vSub(endPoints[1].y, endPoints[0].y), vSub(endPoints[1].z, endPoints[0].z) });
+        const VFloat3 s = vPerpStark(fwd);
+        const VFloat3 faceAxes[kDotsFaces] = { s, vCross(fwd, s) };
+
+        VertexBatch<kDotsVerticesPerSegment> vertices;
+        vStore(vertices.tangent, vVectorToSnorm8(fwd));
+
+        for (uint32_t face = 0; face < kDotsFaces; ++face)
+        {
+            const VFloat3 faceDirections[2] = {
+                faceAxes[face],
+                { vNegate(faceAxes[face].x), vNegate(faceAxes[face].y), vNegate(faceAxes[face].z) } };
+            const VInt faceNormals[2] = { vVectorToSnorm8(faceDirections[0]), vVectorToSnorm8(faceDirections[1]) };
+
+            for (uint32_t vertex = 0; vertex < kVerticesPerFace; ++vertex)
+            {
+                const uint32_t endPoint = kEndPointMapping[vertex];
+                const uint32_t sign = (kDotsNormalSignMapping[vertex] < 0.0f) ? 1 : 0;
+                const VFloat3& direction = faceDirections[sign];
+
+                const VFloat3 position = {
+                    vAdd(endPoints[endPoint].x, vMul(direction.x, scaledRadius[endPoint])),
+                    vAdd(endPoints[endPoint].y, vMul(direction.y, scaledRadius[endPoint])),
+                    vAdd(endPoints[endPoint].z, vMul(direction.z, scaledRadius[endPoint])) };
+                storeVertex(vertices, face * kVerticesPerFace + vertex, position, faceNormals[sign]);
+            }
+        }
+
+        writeVertexBatch(vertices, batch, output, globalIndex);
+        globalIndex += kWidth * kDotsVerticesPerSegment;
+    }
+
+    return tessellateDisjointOrthogonalTriangleStripsScalar(lineSegments + numBatches * kWidth, numLineSegments - numBatches * kWidth, output, globalIndex);
+}
+
+} // namespace RTXCR_CURVE_SIMD_NAMESPACE
+} // namespace CurveTessellationKernels
+
+#undef RTXCR_CURVE_SIMD_NAMESPACE
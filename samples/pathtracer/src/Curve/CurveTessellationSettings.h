@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <filesystem>
+
+#include "shared.h"
+
+// Hair geometry settings read by CurveTessellation. UIData derives from it, tools without a UI fill it directly.
+struct CurveTessellationSettings
+{
+    float                   hairRadiusScale = 0.618f;
+    float                   hairResegmentationError = 0.0f; // Object space, 0: keep every segment
+    bool                    enableHairStrandReorder = false;
+    int                     hairTessellationThreadCount = 0; // 0: use all hardware threads
+    int                     hairTessellationSegmentsPerTask = 16384; // Line segments a tessellation task processes, groom geometries are split into tasks
+    bool                    enableLazyHairTessellation = false;
+    int                     hairTessellationCacheBudgetMB = 0; // 0: unlimited
+    bool                    enableSimdHairTessellation = false;
+    bool                    enableHairTessellationDiskCache = false;
+    std::filesystem::path   hairTessellationDiskCacheDirectory; // Set by the application when the disk cache is enabled
+    bool                    enableLssSuccessiveImplicit = false;
+    int                     hairLodLevels = 1; // 1: LOD0 only
+    float                   hairLodPixelWidth = 1.0f; // Strands projected thinner than this many pixels switch to a coarser LOD
+    float                   hairLodStrandKeepRatio = 0.5f; // Fraction of strands kept by each LOD relative to the previous one
+    int                     hairPolyTubeOrder = RTXCR_CURVE_POLYTUBE_ORDER; // 0: pick per mesh from the projected strand width
+};
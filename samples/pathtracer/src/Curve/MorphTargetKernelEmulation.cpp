@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <cassert>
+#include <cmath>
+
+#include "CurveTessellationKernels.h"
+#include "MorphTargetKernelEmulation.h"
+
+using namespace donut::math;
+using namespace CurveTessellationKernels;
+
+namespace MorphTargetKernelEmulation
+{
+namespace
+{
+    struct MorphedLineSegment
+    {
+        float3 position[2];
+        float radius[2];
+        float3 forward;
+        float3 s;
+        float3 t;
+    };
+
+    MorphedLineSegment morphLineSegment(const Input& input, const uint32_t lineSegmentIndex)
+    {
+        const LineSegment& lineSegment = input.lineSegments[lineSegmentIndex];
+        const uint32_t keyframeIndex = lineSegmentIndex + lineSegment.geometryIndex;
+
+        // HLSL lerp(x, y, s) is x + s * (y - x)
+        const float3 morphTargetLerpData[2] =
+        {
+            input.keyframe[keyframeIndex].xyz() + (input.nextKeyframe[keyframeIndex].xyz() - input.keyframe[keyframeIndex].xyz()) * input.lerpWeight,
+            input.keyframe[keyframeIndex + 1].xyz() + (input.nextKeyframe[keyframeIndex + 1].xyz() - input.keyframe[keyframeIndex + 1].xyz()) * input.lerpWeight
+        };
+
+        MorphedLineSegment morphedLineSegment;
+        morphedLineSegment.position[0] = lineSegment.point0 + morphTargetLerpData[0];
+        morphedLineSegment.position[1] = lineSegment.point1 + morphTargetLerpData[1];
+        morphedLineSegment.radius[0] = lineSegment.radius0;
+        morphedLineSegment.radius[1] = lineSegment.radius1;
+
+        morphedLineSegment.forward = normalizeVector(morphedLineSegment.position[1] - morphedLineSegment.position[0]);
+        morphedLineSegment.s = perpStark(morphedLineSegment.forward);
+        morphedLineSegment.t = crossVector(morphedLineSegment.forward, morphedLineSegment.s);
+
+        return morphedLineSegment;
+    }
+
+    float3 getUnitCircleCoords(const float3& xAxis, const float3& yAxis, const float angleRadians)
+    {
+        // We only care about angles < 2PI
+        float unused = 0.0f;
+        float unitCircleFraction = std::modf(angleRadians / (2.0f * PI_f), &unused);
+        if (unitCircleFraction < 0.0f)
+        {
+            unitCircleFraction = 1.0f - unitCircleFraction;
+        }
+
+        const float adjustedAngleRadians = unitCircleFraction * (2.0f * PI_f);
+        return cosf(adjustedAngleRadians) * xAxis + sinf(adjustedAngleRadians) * yAxis;
+    }
+
+    float3 getPolyTubeRingDirection(const Input& input, const MorphedLineSegment& morphedLineSegment, const uint32_t ringIndex)
+    {
+        const float angleRadians = (2.0f * PI_f * float(ringIndex) / float(input.polyTubeOrder));
+        return getUnitCircleCoords(morphedLineSegment.s, morphedLineSegment.t, angleRadians);
+    }
+
+    void storePolyTubeVertex(
+        const Input& input,
+        const Output& output,
+        const uint32_t index,
+        const MorphedLineSegment& morphedLineSegment,
+        const uint32_t mappingIndex,
+        const float3& v,
+        const uint32_t normal,
+        const uint32_t tangent)
+    {
+        const uint32_t morphTargetPositionIndex = kEndPointMapping[mappingIndex];
+
+        const float halfSectorAngle = PI_f / float(input.polyTubeOrder);
+        const float polyTubesVolumeCompensationScale = 1.0f / (sinf(halfSectorAngle) / halfSectorAngle);
+        output.positions[index] = morphedLineSegment.position[morphTargetPositionIndex] +
+                                  morphedLineSegment.radius[morphTargetPositionIndex] * v * polyTubesVolumeCompensationScale;
+        output.normals[index] = normal;
+        output.tangents[index] = tangent;
+    }
+
+    void convertToTrianglePolyTubes(const Input& input, const Output& output, const uint32_t index)
+    {
+        const uint32_t numVerticesPerSegment = getPolyTubeVerticesPerSegment(input.polyTubeOrder);
+        const uint32_t lineSegmentIndex = index / numVerticesPerSegment;
+        const MorphedLineSegment morphedLineSegment = morphLineSegment(input, lineSegmentIndex);
+
+        const uint32_t face = (index % numVerticesPerSegment) / kVerticesPerFace;
+        const uint32_t mappingIndex = (index % numVerticesPerSegment) % kVerticesPerFace;
+
+        const float3 v = getPolyTubeRingDirection(input, morphedLineSegment, face + kPolyTubeRingMapping[mappingIndex]);
+        storePolyTubeVertex(input, output, index, morphedLineSegment, mappingIndex, v, vectorToSnorm8(v), vectorToSnorm8(morphedLineSegment.forward));
+    }
+
+    void convertToTrianglePolyTubesPerSegment(const Input& input, const Output& output, const uint32_t lineSegmentIndex)
+    {
+        const MorphedLineSegment morphedLineSegment = morphLineSegment(input, lineSegmentIndex);
+        const uint32_t tangent = vectorToSnorm8(morphedLineSegment.forward);
+
+        float3 ringDirection[kMaxPolyTubeOrder + 1];
+        uint32_t ringNormal[kMaxPolyTubeOrder + 1];
+        for (uint32_t ringIndex = 0; ringIndex <= input.polyTubeOrder; ++ringIndex)
+        {
+            ringDirection[ringIndex] = getPolyTubeRingDirection(input, morphedLineSegment, ringIndex);
+            ringNormal[ringIndex] = vectorToSnorm8(ringDirection[ringIndex]);
+        }
+
+        const uint32_t firstVertexIndex = lineSegmentIndex * getPolyTubeVerticesPerSegment(input.polyTubeOrder);
+        for (uint32_t face = 0; face < input.polyTubeOrder; ++face)
+        {
+            for (uint32_t mappingIndex = 0; mappingIndex < kVerticesPerFace; ++mappingIndex)
+            {
+                const uint32_t ringIndex = face + kPolyTubeRingMapping[mappingIndex];
+                storePolyTubeVertex(input, output, firstVertexIndex + face * kVerticesPerFace + mappingIndex,
+                    morphedLineSegment, mappingIndex, ringDirection[ringIndex], ringNormal[ringIndex], tangent);
+            }
+        }
+    }
+
+    void storeDisjointOrthogonalTriangleStripVertex(
+        const Output& output,
+        const uint32_t index,
+        const MorphedLineSegment& morphedLineSegment,
+        const uint32_t face,
+        const uint32_t mappingIndex,
+        const uint32_t normal,
+        const uint32_t tangent)
+    {
+        const float3 v[kDotsFaces] = { morphedLineSegment.s, morphedLineSegment.t };
+
+        const float weight[kVerticesPerFace] = {
+            morphedLineSegment.radius[0], -morphedLineSegment.radius[1],  morphedLineSegment.radius[1],
+            morphedLineSegment.radius[0], -morphedLineSegment.radius[0], -morphedLineSegment.radius[1] };
+
+        const uint32_t morphTargetPositionIndex = kEndPointMapping[mappingIndex];
+
+        constexpr float kHalfSectorAngle = PI_f / 4.0f;
+        const float dotsVolumeCompensationScale = 1.0f / (sinf(kHalfSectorAngle) / kHalfSectorAngle);
+        output.positions[index] = morphedLineSegment.position[morphTargetPositionIndex] + weight[mappingIndex] * v[face] * dotsVolumeCompensationScale;
+        output.normals[index] = normal;
+        output.tangents[index] = tangent;
+    }
+
+    uint32_t getDisjointOrthogonalTriangleStripNormal(const MorphedLineSegment& morphedLineSegment, const uint32_t face, const uint32_t mappingIndex)
+    {
+        const float3 v = (face == 0) ? morphedLineSegment.s : morphedLineSegment.t;
+        return vectorToSnorm8(float3(kDotsNormalSignMapping[mappingIndex]) * v);
+    }
+
+    void convertToDisjointOrthogonalTriangleStrips(const Input& input, const Output& output, const uint32_t index)
+    {
+        const uint32_t lineSegmentIndex = index / kDotsVerticesPerSegment;
+        const MorphedLineSegment morphedLineSegment = morphLineSegment(input, lineSegmentIndex);
+
+        const uint32_t mappingIndex = (index % kDotsVerticesPerSegment) % kVerticesPerFace;
+        const uint32_t face = (index % kDotsVerticesPerSegment) / kVerticesPerFace;
+
+        storeDisjointOrthogonalTriangleStripVertex(output, index, morphedLineSegment, face, mappingIndex,
+            getDisjointOrthogonalTriangleStripNormal(morphedLineSegment, face, mappingIndex), vectorToSnorm8(morphedLineSegment.forward));
+    }
+
+    void convertToDisjointOrthogonalTriangleStripsPerSegment(const Input& input, const Output& output, const uint32_t lineSegmentIndex)
+    {
+        const MorphedLineSegment morphedLineSegment = morphLineSegment(input, lineSegmentIndex);
+        const uint32_t tangent = vectorToSnorm8(morphedLineSegment.forward);
+
+        const uint32_t firstVertexIndex = lineSegmentIndex * kDotsVerticesPerSegment;
+        for (uint32_t face = 0; face < kDotsFaces; ++face)
+        {
+            for (uint32_t mappingIndex = 0; mappingIndex < kVerticesPerFace; ++mappingIndex)
+            {
+                storeDisjointOrthogonalTriangleStripVertex(output, firstVertexIndex + face * kVerticesPerFace + mappingIndex, morphedLineSegment, face, mappingIndex,
+                    getDisjointOrthogonalTriangleStripNormal(morphedLineSegment, face, mappingIndex), tangent);
+            }
+        }
+    }
+} // namespace
+
+uint32_t getVertexCount(const uint32_t tessellationType, const Input& input)
+{
+    return input.numLineSegments *
+        ((tessellationType == RTXCR_CURVE_TESSELLATION_TYPE_POLYTUBE) ? getPolyTubeVerticesPerSegment(input.polyTubeOrder) : kDotsVerticesPerSegment);
+}
+
+void dispatchPerVertex(const uint32_t tessellationType, const Input& input, const Output& output)
+{
+    assert(tessellationType == RTXCR_CURVE_TESSELLATION_TYPE_POLYTUBE || tessellationType == RTXCR_CURVE_TESSELLATION_TYPE_DOTS);
+
+    const uint32_t vertexCount = getVertexCount(tessellationType, input);
+    for (uint32_t globalIndex = 0; globalIndex < vertexCount; ++globalIndex)
+    {
+        if (tessellationType == RTXCR_CURVE_TESSELLATION_TYPE_POLYTUBE)
+        {
+            convertToTrianglePolyTubes(input, output, globalIndex);
+        }
+        else
+        {
+            convertToDisjointOrthogonalTriangleStrips(input, output, globalIndex);
+        }
+    }
+}
+
+void dispatchPerSegment(const uint32_t tessellationType, const Input& input, const Output& output)
+{
+    assert(tessellationType == RTXCR_CURVE_TESSELLATION_TYPE_POLYTUBE || tessellationType == RTXCR_CURVE_TESSELLATION_TYPE_DOTS);
+
+    for (uint32_t globalIndex = 0; globalIndex < input.numLineSegments; ++globalIndex)
+    {
+        if (tessellationType == RTXCR_CURVE_TESSELLATION_TYPE_POLYTUBE)
+        {
+            convertToTrianglePolyTubesPerSegment(input, output, globalIndex);
+        }
+        else
+        {
+            convertToDisjointOrthogonalTriangleStripsPerSegment(input, output, globalIndex);
+        }
+    }
+}
+} // namespace MorphTargetKernelEmulation
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <donut/core/math/math.h>
+
+#include "shared.h"
+
+// CPU emulation of the Polytube and DOTS morph target kernels of morphTargetAnimation.cs.hlsl.
+// Every function mirrors the shader function of the same name, so the one thread per vertex and the one thread per line segment
+// layouts can be compared without a GPU. A dispatch runs its threads one after another in thread order.
+namespace MorphTargetKernelEmulation
+{
+    // The shader resources of one mesh
+    struct Input
+    {
+        // Line segments as uploaded by ResourceManager::CreateMorphTargetBuffers
+        const LineSegment* lineSegments = nullptr;
+        uint32_t numLineSegments = 0;
+        // Keyframes N and N + 1, one offset per strand point
+        const donut::math::float4* keyframe = nullptr;
+        const donut::math::float4* nextKeyframe = nullptr;
+        float lerpWeight = 0.0f;
+        uint32_t polyTubeOrder = RTXCR_CURVE_POLYTUBE_ORDER;
+    };
+
+    // The morph target vertex buffer ranges, getVertexCount entries each
+    struct Output
+    {
+        donut::math::float3* positions = nullptr;
+        uint32_t* normals = nullptr;
+        uint32_t* tangents = nullptr;
+    };
+
+    // tessellationType is RTXCR_CURVE_TESSELLATION_TYPE_POLYTUBE or RTXCR_CURVE_TESSELLATION_TYPE_DOTS, as the shader macro
+    uint32_t getVertexCount(const uint32_t tessellationType, const Input& input);
+
+    // RTXCR_MORPH_TARGET_PER_SEGMENT 0, one thread per vertex
+    void dispatchPerVertex(const uint32_t tessellationType, const Input& input, const Output& output);
+
+    // RTXCR_MORPH_TARGET_PER_SEGMENT 1, one thread per line segment
+    void dispatchPerSegment(const uint32_t tessellationType, const Input& input, const Output& output);
+}
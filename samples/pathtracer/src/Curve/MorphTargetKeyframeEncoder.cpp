@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <donut/core/log.h>
+
+#include "MorphTargetKeyframeEncoder.h"
+
+using namespace donut::math;
+
+namespace
+{
+    bool encodePca(
+        const std::vector<float4>& keyframeData,
+        const std::vector<nvrhi::BufferRange>& keyframeRanges,
+        const MorphTargetPcaSettings& pcaSettings,
+        MorphTargetKeyframeEncoder::EncodedKeyframes& encodedKeyframes)
+    {
+        ThreadPool threadPool(0);
+        MorphTargetPcaBasis basis;
+        if (!MorphTargetPca::decompose(keyframeData, keyframeRanges, threadPool, basis, pcaSettings))
+        {
+            return false;
+        }
+
+        encodedKeyframes.format = RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_PCA;
+        encodedKeyframes.componentCount = basis.componentCount;
+        const uint32_t* const words = reinterpret_cast<const uint32_t*>(basis.basis.data());
+        encodedKeyframes.data.assign(words, words + basis.basis.size() * 4);
+        encodedKeyframes.coefficients = basis.coefficients;
+
+        nvrhi::BufferRange basisRange;
+        basisRange.byteOffset = 0;
+        basisRange.byteSize = encodedKeyframes.getByteSize();
+        encodedKeyframes.keyframeRanges.assign(keyframeRanges.size(), basisRange);
+
+        encodedKeyframes.maxPositionError = basis.maxPositionError;
+        encodedKeyframes.rmsPositionError = basis.rmsError;
+
+        return true;
+    }
+} // namespace
+
+namespace MorphTargetKeyframeEncoder
+{
+const char* getFormatName(const uint32_t format)
+{
+    switch (format)
+    {
+    case RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_HALF:
+        return "Half";
+    case RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_UNORM10:
+        return "Unorm10";
+    case RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_PCA:
+        return "PCA";
+    default:
+        return "Full";
+    }
+}
+
+void encode(
+    const std::vector<float4>& keyframeData,
+    const std::vector<nvrhi::BufferRange>& keyframeRanges,
+    const uint32_t format,
+    EncodedKeyframes& encodedKeyframes,
+    const MorphTargetPcaSettings& pcaSettings)
+{
+    const auto startTime = std::chrono::high_resolution_clock::now();
+
+    encodedKeyframes = EncodedKeyframes();
+    encodedKeyframes.format = format;
+    encodedKeyframes.keyframeVertexCount = keyframeRanges.empty() ? 0 : (uint32_t)(keyframeRanges[0].byteSize / sizeof(float4));
+
+    if (format == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_PCA)
+    {
+        if (!encodePca(keyframeData, keyframeRanges, pcaSettings, encodedKeyframes))
+        {
+            donut::log::warning("Morph target keyframes (PCA): the keyframes differ in size, using the full format");
+            encode(keyframeData, keyframeRanges, RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_FULL, encodedKeyframes);
+            return;
+        }
+
+        encodedKeyframes.encodeTimeMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+        return;
+    }
+
+    const uint32_t stride = getKeyframeStride(format);
+    size_t numStrandPoints = 0;
+    for (const auto& keyframeRange : keyframeRanges)
+    {
+        assert(keyframeRange.byteOffset + keyframeRange.byteSize <= keyframeData.size() * sizeof(float4));
+        numStrandPoints += keyframeRange.byteSize / sizeof(float4);
+    }
+    encodedKeyframes.data.reserve(numStrandPoints * stride / sizeof(uint32_t));
+    encodedKeyframes.keyframeRanges.reserve(keyframeRanges.size());
+
+    uint32_t numErrors = 0;
+    double squaredError = 0.0;
+    for (const auto& keyframeRange : keyframeRanges)
+    {
+        const float4* const keyframe = keyframeData.data() + keyframeRange.byteOffset / sizeof(float4);
+        const uint32_t keyframeVertexCount = (uint32_t)(keyframeRange.byteSize / sizeof(float4));
+
+        nvrhi::BufferRange encodedRange;
+        encodedRange.byteOffset = encodedKeyframes.getByteSize();
+        encodedRange.byteSize = (uint64_t)keyframeVertexCount * stride;
+        encodedKeyframes.keyframeRanges.push_back(encodedRange);
+
+        if (format == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_FULL)
+        {
+            const uint32_t* const words = reinterpret_cast<const uint32_t*>(keyframe);
+            encodedKeyframes.data.insert(encodedKeyframes.data.end(), words, words + keyframeVertexCount * 4);
+            continue;
+        }
+
+        float3 boundsMin = float3(std::numeric_limits<float>::max());
+        float3 boundsMax = float3(std::numeric_limits<float>::lowest());
+        for (uint32_t pointIndex = 0; pointIndex < keyframeVertexCount; ++pointIndex)
+        {
+            boundsMin = min(boundsMin, keyframe[pointIndex].xyz());
+            boundsMax = max(boundsMax, keyframe[pointIndex].xyz());
+        }
+
+        KeyframeQuantization quantization = {};
+        quantization.origin = keyframeVertexCount > 0 ? boundsMin : float3(0.0f);
+        quantization.extent = keyframeVertexCount > 0 ? boundsMax - boundsMin : float3(0.0f);
+        encodedKeyframes.quantization.push_back(quantization);
+
+        const float errorBound = getComponentErrorBound(format, quantization);
+        for (uint32_t pointIndex = 0; pointIndex < keyframeVertexCount; ++pointIndex)
+        {
+            const float3 offset = keyframe[pointIndex].xyz();
+            float3 decodedOffset;
+            if (format == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_HALF)
+            {
+                const uint2 packed = encodeKeyframeHalf(offset, quantization);
+                encodedKeyframes.data.push_back(packed.x);
+                encodedKeyframes.data.push_back(packed.y);
+                decodedOffset = decodeKeyframeHalf(packed, quantization);
+            }
+            else
+            {
+                const uint packed = encodeKeyframeUnorm10(offset, quantization);
+                encodedKeyframes.data.push_back(packed);
+                decodedOffset = decodeKeyframeUnorm10(packed, quantization);
+            }
+
+            const float3 error = abs(decodedOffset - offset);
+            encodedKeyframes.maxPositionError = std::max(encodedKeyframes.maxPositionError, length(error));
+            squaredError += (double)lengthSquared(error);
+            if (error.x > errorBound || error.y > errorBound || error.z > errorBound)
+            {
+                ++numErrors;
+            }
+        }
+    }
+
+    encodedKeyframes.rmsPositionError = numStrandPoints > 0 ? (float)std::sqrt(squaredError / (double)numStrandPoints) : 0.0f;
+
+    if (numErrors > 0)
+    {
+        donut::log::warning("Morph target keyframes (%s): %u of %zu strand points exceed the quantization error bound",
+                            getFormatName(format), numErrors, numStrandPoints);
+    }
+
+    encodedKeyframes.encodeTimeMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+}
+
+float3 decode(const EncodedKeyframes& encodedKeyframes, const uint32_t keyframeIndex, const uint32_t strandPointIndex)
+{
+    if (encodedKeyframes.format == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_PCA)
+    {
+        // Same sum as MorphTargetPca::reconstruct, the basis vectors of a strand point are contiguous
+        const float4* const pointBasis = reinterpret_cast<const float4*>(encodedKeyframes.data.data()) + (size_t)strandPointIndex * encodedKeyframes.componentCount;
+        const float* const coefficients = encodedKeyframes.coefficients.data() + (size_t)keyframeIndex * encodedKeyframes.componentCount;
+
+        float3 offset = float3(0.0f);
+        for (uint32_t component = 0; component < encodedKeyframes.componentCount; ++component)
+        {
+            offset += coefficients[component] * pointBasis[component].xyz();
+        }
+        return offset;
+    }
+
+    const uint32_t stride = getKeyframeStride(encodedKeyframes.format);
+    const uint64_t byteOffset = encodedKeyframes.keyframeRanges[keyframeIndex].byteOffset + (uint64_t)strandPointIndex * stride;
+    const uint32_t* const words = encodedKeyframes.data.data() + byteOffset / sizeof(uint32_t);
+
+    switch (encodedKeyframes.format)
+    {
+    case RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_HALF:
+        return decodeKeyframeHalf(uint2(words[0], words[1]), encodedKeyframes.quantization[keyframeIndex]);
+    case RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_UNORM10:
+        return decodeKeyframeUnorm10(words[0], encodedKeyframes.quantization[keyframeIndex]);
+    default:
+        return float3(reinterpret_cast<const float*>(words));
+    }
+}
+
+float getComponentErrorBound(const uint32_t format, const KeyframeQuantization& quantization)
+{
+    const float extent = std::max(quantization.extent.x, std::max(quantization.extent.y, quantization.extent.z));
+    const float magnitude = std::max(std::abs(quantization.origin.x), std::max(std::abs(quantization.origin.y), std::abs(quantization.origin.z))) + extent;
+    const float roundingError = magnitude * (4.0f * std::numeric_limits<float>::epsilon());
+
+    switch (format)
+    {
+    case RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_HALF:
+        // Components are in [-1, 1] of the half extent, half floats below 1 are spaced at most 2^-11 apart
+        return extent * 0.5f * (0.5f / 2048.0f) + roundingError;
+    case RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_UNORM10:
+        return extent * (0.5f / 1023.0f) + roundingError;
+    default:
+        return 0.0f;
+    }
+}
+} // namespace MorphTargetKeyframeEncoder
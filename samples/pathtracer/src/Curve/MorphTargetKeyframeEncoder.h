@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <donut/core/math/math.h>
+#include <nvrhi/nvrhi.h>
+
+#include "keyframeEncoding.h"
+#include "MorphTargetPca.h"
+
+// CPU encoder of the morph target keyframe formats of keyframeEncoding.h.
+// Every keyframe is quantized against its own bounds, the encoder measures the error of every strand point it encodes.
+// The PCA format stores the basis of MorphTargetPca in data, every keyframe range covers the whole basis.
+namespace MorphTargetKeyframeEncoder
+{
+    struct EncodedKeyframes
+    {
+        uint32_t format = RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_FULL;
+        std::vector<uint32_t> data;                     // getKeyframeStride(format) bytes per strand point (and basis vector)
+        std::vector<nvrhi::BufferRange> keyframeRanges; // Bytes of data, one range per keyframe
+        std::vector<KeyframeQuantization> quantization; // Half and unorm10 only, one entry per keyframe
+        uint32_t keyframeVertexCount = 0;               // Strand points per keyframe
+        uint32_t componentCount = 0;                    // PCA only: basis vectors per strand point, including the mean
+        std::vector<float> coefficients;                // PCA only: componentCount coefficients per keyframe
+        float maxPositionError = 0.0f;                  // Largest distance between a decoded and its original offset
+        float rmsPositionError = 0.0f;
+        double encodeTimeMs = 0.0;
+
+        size_t getByteSize() const { return data.size() * sizeof(uint32_t); }
+        // Quantization entries or coefficients
+        size_t getParameterByteSize() const { return quantization.size() * sizeof(KeyframeQuantization) + coefficients.size() * sizeof(float); }
+        // The animation reads two keyframes per strand point, or every basis vector with the PCA format
+        size_t getReadBytesPerFrame() const
+        {
+            return (size_t)keyframeVertexCount * getKeyframeStride(format) * (format == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_PCA ? componentCount : 2);
+        }
+    };
+
+    const char* getFormatName(const uint32_t format);
+
+    // keyframeRanges are byte ranges of keyframeData, as BufferGroup::morphTargetBufferRange. The full format keeps the data as is.
+    // Keyframes of different sizes can't be decomposed, the PCA format falls back to the full format then.
+    void encode(
+        const std::vector<donut::math::float4>& keyframeData,
+        const std::vector<nvrhi::BufferRange>& keyframeRanges,
+        const uint32_t format,
+        EncodedKeyframes& encodedKeyframes,
+        const MorphTargetPcaSettings& pcaSettings = {});
+
+    // Offset of a strand point as the morph target shader decodes it
+    donut::math::float3 decode(const EncodedKeyframes& encodedKeyframes, const uint32_t keyframeIndex, const uint32_t strandPointIndex);
+
+    // Largest error of a single component: half a quantization step of the format for the bounds of one keyframe, plus float rounding
+    float getComponentErrorBound(const uint32_t format, const KeyframeQuantization& quantization);
+}
@@ -0,0 +1,407 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <donut/core/log.h>
+
+#include "MorphTargetKeyframeStreaming.h"
+
+namespace
+{
+    constexpr uint32_t kMagic = 0x4b465852; // "RXFK"
+
+    struct FileHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t format;
+        uint32_t keyframeCount;
+        uint64_t keyframeByteSize;
+        uint64_t payloadBytes;
+    };
+    static_assert(sizeof(FileHeader) == 32, "The keyframe file header layout must not depend on the compiler");
+} // namespace
+
+MorphTargetKeyframeFile::~MorphTargetKeyframeFile()
+{
+#if defined(_WIN32)
+    if (m_data)
+    {
+        UnmapViewOfFile(m_data);
+    }
+    if (m_mappingHandle)
+    {
+        CloseHandle(m_mappingHandle);
+    }
+    if (m_fileHandle)
+    {
+        CloseHandle(m_fileHandle);
+    }
+#else
+    if (m_data)
+    {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+#endif
+}
+
+bool MorphTargetKeyframeFile::store(const std::filesystem::path& path, const MorphTargetKeyframeEncoder::EncodedKeyframes& encodedKeyframes)
+{
+    if (encodedKeyframes.format == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_PCA || encodedKeyframes.keyframeRanges.empty())
+    {
+        return false;
+    }
+
+    const uint64_t keyframeByteSize = encodedKeyframes.keyframeRanges[0].byteSize;
+    for (const auto& keyframeRange : encodedKeyframes.keyframeRanges)
+    {
+        if (keyframeRange.byteSize != keyframeByteSize)
+        {
+            return false;
+        }
+    }
+
+    std::filesystem::path tempPath = path;
+    tempPath += ".tmp";
+
+    std::error_code error;
+    std::filesystem::create_directories(path.parent_path(), error);
+
+    {
+        std::ofstream stream(tempPath, std::ios::binary | std::ios::trunc);
+        if (!stream)
+        {
+            donut::log::warning("Morph target keyframe file: failed to create %s", tempPath.string().c_str());
+            return false;
+        }
+
+        FileHeader header = {};
+        header.magic = kMagic;
+        header.version = kVersion;
+        header.format = encodedKeyframes.format;
+        header.keyframeCount = (uint32_t)encodedKeyframes.keyframeRanges.size();
+        header.keyframeByteSize = keyframeByteSize;
+        header.payloadBytes = keyframeByteSize * header.keyframeCount;
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+
+        const char* const data = reinterpret_cast<const char*>(encodedKeyframes.data.data());
+        for (const auto& keyframeRange : encodedKeyframes.keyframeRanges)
+        {
+            stream.write(data + keyframeRange.byteOffset, (std::streamsize)keyframeRange.byteSize);
+        }
+
+        if (!stream.good())
+        {
+            stream.close();
+            std::filesystem::remove(tempPath, error);
+            donut::log::warning("Morph target keyframe file: failed to write %s", tempPath.string().c_str());
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tempPath, path, error);
+    if (error)
+    {
+        std::filesystem::remove(tempPath, error);
+        donut::log::warning("Morph target keyframe file: failed to write %s", path.string().c_str());
+        return false;
+    }
+
+    return true;
+}
+
+std::unique_ptr<MorphTargetKeyframeFile> MorphTargetKeyframeFile::load(const std::filesystem::path& path)
+{
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(path, error))
+    {
+        return nullptr;
+    }
+
+    std::unique_ptr<MorphTargetKeyframeFile> file(new MorphTargetKeyframeFile());
+
+#if defined(_WIN32)
+    HANDLE fileHandle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        return nullptr;
+    }
+    file->m_fileHandle = fileHandle;
+
+    LARGE_INTEGER fileSize = {};
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart < static_cast<LONGLONG>(sizeof(FileHeader)))
+    {
+        donut::log::warning("Morph target keyframe file: %s is truncated", path.string().c_str());
+        return nullptr;
+    }
+    file->m_size = static_cast<size_t>(fileSize.QuadPart);
+
+    file->m_mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!file->m_mappingHandle)
+    {
+        return nullptr;
+    }
+
+    file->m_data = static_cast<const uint8_t*>(MapViewOfFile(file->m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    if (!file->m_data)
+    {
+        return nullptr;
+    }
+#else
+    const int fileDescriptor = open(path.c_str(), O_RDONLY);
+    if (fileDescriptor < 0)
+    {
+        return nullptr;
+    }
+
+    struct stat fileStat = {};
+    if (fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size < static_cast<off_t>(sizeof(FileHeader)))
+    {
+        donut::log::warning("Morph target keyframe file: %s is truncated", path.string().c_str());
+        close(fileDescriptor);
+        return nullptr;
+    }
+    file->m_size = static_cast<size_t>(fileStat.st_size);
+
+    void* data = mmap(nullptr, file->m_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    close(fileDescriptor);
+    if (data == MAP_FAILED)
+    {
+        return nullptr;
+    }
+    file->m_data = static_cast<const uint8_t*>(data);
+#endif
+
+    FileHeader header;
+    std::memcpy(&header, file->m_data, sizeof(FileHeader));
+    if (header.magic != kMagic || header.version != kVersion || header.format >= RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_COUNT)
+    {
+        donut::log::warning("Morph target keyframe file: %s has an unknown format", path.string().c_str());
+        return nullptr;
+    }
+
+    if (header.payloadBytes != header.keyframeByteSize * header.keyframeCount || header.payloadBytes != file->m_size - sizeof(FileHeader))
+    {
+        donut::log::warning("Morph target keyframe file: %s is truncated", path.string().c_str());
+        return nullptr;
+    }
+
+    file->m_format = header.format;
+    file->m_keyframeCount = header.keyframeCount;
+    file->m_keyframeByteSize = header.keyframeByteSize;
+    return file;
+}
+
+const uint8_t* MorphTargetKeyframeFile::getKeyframe(const uint32_t keyframeIndex) const
+{
+    return m_data + sizeof(FileHeader) + keyframeIndex * m_keyframeByteSize;
+}
+
+void MorphTargetKeyframeWindow::reset(const uint32_t keyframeCount, const uint32_t slotCount)
+{
+    m_slots.assign(std::min(std::max(slotCount, 2u), keyframeCount), Slot());
+    m_keyframeSlots.assign(keyframeCount, kInvalid);
+    m_windowStart = 0;
+    m_nextTicket = 1;
+}
+
+bool MorphTargetKeyframeWindow::isInWindow(const uint32_t keyframe) const
+{
+    const uint32_t keyframeCount = getKeyframeCount();
+    return (keyframe + keyframeCount - m_windowStart) % keyframeCount < getSlotCount();
+}
+
+void MorphTargetKeyframeWindow::update(const uint32_t keyframe, const uint32_t nextKeyframe, std::vector<Load>& loads)
+{
+    const uint32_t keyframeCount = getKeyframeCount();
+    if (keyframeCount == 0 || keyframe >= keyframeCount || nextKeyframe >= keyframeCount)
+    {
+        return;
+    }
+    m_windowStart = keyframe;
+
+    // The required keyframes first, then the rest of the window in playback order
+    const uint32_t slotCount = getSlotCount();
+    for (uint32_t windowIndex = 0; windowIndex <= slotCount; ++windowIndex)
+    {
+        const uint32_t windowKeyframe = (windowIndex == 0) ? keyframe :
+                                        (windowIndex == 1) ? nextKeyframe : (keyframe + windowIndex - 1) % keyframeCount;
+        const bool required = (windowIndex < 2);
+        if (!required && windowKeyframe == nextKeyframe)
+        {
+            continue;
+        }
+
+        const uint32_t assignedSlot = m_keyframeSlots[windowKeyframe];
+        if (assignedSlot != kInvalid)
+        {
+            // Resident, or loading in the background: only the required keyframes can't wait for the load
+            if (required && !m_slots[assignedSlot].resident)
+            {
+                loads.push_back({ windowKeyframe, assignedSlot, m_slots[assignedSlot].ticket, true });
+            }
+            continue;
+        }
+
+        // A slot that is free or holds a keyframe that left the window, never one of the required keyframes.
+        // When nextKeyframe isn't the keyframe after keyframe the window doesn't fit, a required keyframe then
+        // takes the slot of the window keyframe furthest ahead.
+        uint32_t freeSlot = kInvalid;
+        uint32_t freeSlotDistance = 0;
+        for (uint32_t slotIndex = 0; slotIndex < slotCount; ++slotIndex)
+        {
+            const uint32_t slotKeyframe = m_slots[slotIndex].keyframe;
+            if (slotKeyframe == keyframe || slotKeyframe == nextKeyframe)
+            {
+                continue;
+            }
+
+            const uint32_t distance = (slotKeyframe == kInvalid || !isInWindow(slotKeyframe)) ?
+                keyframeCount : (slotKeyframe + keyframeCount - m_windowStart) % keyframeCount;
+            if ((required || distance == keyframeCount) && (freeSlot == kInvalid || distance > freeSlotDistance))
+            {
+                freeSlot = slotIndex;
+                freeSlotDistance = distance;
+            }
+        }
+        if (freeSlot == kInvalid)
+        {
+            continue;
+        }
+
+        Slot& slot = m_slots[freeSlot];
+        if (slot.keyframe != kInvalid)
+        {
+            m_keyframeSlots[slot.keyframe] = kInvalid;
+        }
+        slot.keyframe = windowKeyframe;
+        slot.ticket = m_nextTicket++;
+        slot.resident = false;
+        m_keyframeSlots[windowKeyframe] = freeSlot;
+
+        loads.push_back({ windowKeyframe, freeSlot, slot.ticket, required });
+    }
+}
+
+bool MorphTargetKeyframeWindow::complete(const Load& load)
+{
+    if (load.slot >= getSlotCount())
+    {
+        return false;
+    }
+
+    Slot& slot = m_slots[load.slot];
+    if (slot.keyframe != load.keyframe || slot.ticket != load.ticket || slot.resident)
+    {
+        return false;
+    }
+
+    slot.resident = true;
+    return true;
+}
+
+uint32_t MorphTargetKeyframeWindow::getResidentSlot(const uint32_t keyframe) const
+{
+    if (keyframe >= getKeyframeCount())
+    {
+        return kInvalid;
+    }
+
+    const uint32_t slot = m_keyframeSlots[keyframe];
+    return (slot != kInvalid && m_slots[slot].resident) ? slot : kInvalid;
+}
+
+MorphTargetKeyframeReader::MorphTargetKeyframeReader(std::shared_ptr<const MorphTargetKeyframeFile> file)
+: m_file(std::move(file))
+{
+    m_worker = std::thread(&MorphTargetKeyframeReader::workerLoop, this);
+}
+
+MorphTargetKeyframeReader::~MorphTargetKeyframeReader()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+        m_requests.clear();
+    }
+    m_requestAvailable.notify_all();
+    m_worker.join();
+}
+
+void MorphTargetKeyframeReader::request(const MorphTargetKeyframeWindow::Load& load)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_requests.push_back(load);
+    }
+    m_requestAvailable.notify_one();
+}
+
+void MorphTargetKeyframeReader::collect(std::vector<Completed>& completed)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& read : m_completed)
+    {
+        completed.push_back(std::move(read));
+    }
+    m_completed.clear();
+}
+
+void MorphTargetKeyframeReader::read(const uint32_t keyframe, std::vector<uint8_t>& data) const
+{
+    const uint8_t* const keyframeData = m_file->getKeyframe(keyframe);
+    data.assign(keyframeData, keyframeData + m_file->getKeyframeByteSize());
+}
+
+uint32_t MorphTargetKeyframeReader::getPendingCount()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return (uint32_t)m_requests.size() + m_activeReads;
+}
+
+void MorphTargetKeyframeReader::workerLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_requestAvailable.wait(lock, [this]() { return m_shutdown || !m_requests.empty(); });
+        if (m_shutdown)
+        {
+            return;
+        }
+
+        Completed completed;
+        completed.load = m_requests.front();
+        m_requests.pop_front();
+        ++m_activeReads;
+
+        lock.unlock();
+        read(completed.load.keyframe, completed.data);
+        lock.lock();
+
+        --m_activeReads;
+        m_completed.push_back(std::move(completed));
+    }
+}
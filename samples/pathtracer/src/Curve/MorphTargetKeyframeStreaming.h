@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "MorphTargetKeyframeEncoder.h"
+
+// CPU side of the keyframe streaming of long morph target animations: the encoded keyframes of a mesh live in a memory
+// mapped file, only a sliding window of them is resident in a ring of GPU slots. The window is pure bookkeeping driven
+// by the keyframes the animation reads, so the tests play it back against a simulated clock without a device.
+
+// Encoded keyframes of one mesh, one keyframe after the other, memory mapped on load.
+// Only formats with a fixed size per keyframe can be streamed, the PCA basis is shared by all keyframes.
+class MorphTargetKeyframeFile
+{
+public:
+    // Bump whenever the file layout changes
+    static constexpr uint32_t kVersion = 1;
+
+    ~MorphTargetKeyframeFile();
+
+    MorphTargetKeyframeFile(const MorphTargetKeyframeFile&) = delete;
+    MorphTargetKeyframeFile& operator=(const MorphTargetKeyframeFile&) = delete;
+
+    // Fails for the PCA format and for keyframes of different sizes.
+    // Writes to a temporary file first and renames it, so a reader never maps a partially written file.
+    static bool store(const std::filesystem::path& path, const MorphTargetKeyframeEncoder::EncodedKeyframes& encodedKeyframes);
+
+    // Returns nullptr for a missing, truncated or unknown file
+    static std::unique_ptr<MorphTargetKeyframeFile> load(const std::filesystem::path& path);
+
+    inline uint32_t getFormat() const { return m_format; }
+    inline uint32_t getKeyframeCount() const { return m_keyframeCount; }
+    inline uint64_t getKeyframeByteSize() const { return m_keyframeByteSize; }
+    // Points into the file mapping, reading it may page in the keyframe
+    const uint8_t* getKeyframe(const uint32_t keyframeIndex) const;
+
+private:
+    MorphTargetKeyframeFile() = default;
+
+    void* m_fileHandle = nullptr;
+    void* m_mappingHandle = nullptr;
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+
+    uint32_t m_format = 0;
+    uint32_t m_keyframeCount = 0;
+    uint64_t m_keyframeByteSize = 0;
+};
+
+// Sliding window of keyframes over a ring of slots. Every frame the window starts at the keyframe the animation reads
+// and covers slotCount keyframes in playback order, looping at the end of the animation. Slots of keyframes that left
+// the window are reused, a slot is never reused for a keyframe of the current window.
+class MorphTargetKeyframeWindow
+{
+public:
+    static constexpr uint32_t kInvalid = ~0u;
+
+    // Keyframe to read into a slot. The ticket identifies the assignment, a load completes only while its slot
+    // still holds the same assignment.
+    struct Load
+    {
+        uint32_t keyframe = kInvalid;
+        uint32_t slot = kInvalid;
+        uint64_t ticket = 0;
+        bool required = false;  // Read by the animation this frame, the caller loads it before the dispatch
+    };
+
+    // slotCount is clamped to [2, keyframeCount]
+    void reset(const uint32_t keyframeCount, const uint32_t slotCount);
+
+    // Moves the window to keyframe and appends the loads it needs, nearest keyframe first. keyframe and nextKeyframe
+    // are required: they are appended whenever they aren't resident, also when a load of them is already pending.
+    void update(const uint32_t keyframe, const uint32_t nextKeyframe, std::vector<Load>& loads);
+
+    // Marks the keyframe of load resident. Returns false for a stale load: its slot was reassigned, or the keyframe
+    // was already loaded by a required load.
+    bool complete(const Load& load);
+
+    // Slot of a resident keyframe, kInvalid while it isn't resident
+    uint32_t getResidentSlot(const uint32_t keyframe) const;
+
+    inline uint32_t getKeyframeCount() const { return (uint32_t)m_keyframeSlots.size(); }
+    inline uint32_t getSlotCount() const { return (uint32_t)m_slots.size(); }
+
+private:
+    struct Slot
+    {
+        uint32_t keyframe = kInvalid;
+        uint64_t ticket = 0;
+        bool resident = false;
+    };
+
+    bool isInWindow(const uint32_t keyframe) const;
+
+    std::vector<Slot> m_slots;
+    std::vector<uint32_t> m_keyframeSlots;  // Slot assigned to every keyframe, resident or loading, or kInvalid
+    uint32_t m_windowStart = 0;
+    uint64_t m_nextTicket = 1;
+};
+
+// Reads keyframes of a keyframe file on a background thread. Copying a keyframe out of the mapping pages it in there,
+// the render thread only uploads the copies.
+class MorphTargetKeyframeReader
+{
+public:
+    struct Completed
+    {
+        MorphTargetKeyframeWindow::Load load;
+        std::vector<uint8_t> data;
+    };
+
+    explicit MorphTargetKeyframeReader(std::shared_ptr<const MorphTargetKeyframeFile> file);
+
+    // Finishes the read in progress, drops the queued ones
+    ~MorphTargetKeyframeReader();
+
+    MorphTargetKeyframeReader(const MorphTargetKeyframeReader&) = delete;
+    MorphTargetKeyframeReader& operator=(const MorphTargetKeyframeReader&) = delete;
+
+    void request(const MorphTargetKeyframeWindow::Load& load);
+
+    // Appends the reads finished since the last call, in completion order
+    void collect(std::vector<Completed>& completed);
+
+    // Reads on the calling thread, for required keyframes
+    void read(const uint32_t keyframe, std::vector<uint8_t>& data) const;
+
+    inline const MorphTargetKeyframeFile& getFile() const { return *m_file; }
+    uint32_t getPendingCount();
+
+private:
+    void workerLoop();
+
+    std::shared_ptr<const MorphTargetKeyframeFile> m_file;
+
+    std::mutex m_mutex;
+    std::condition_variable m_requestAvailable;
+    std::deque<MorphTargetKeyframeWindow::Load> m_requests;
+    std::vector<Completed> m_completed;
+    uint32_t m_activeReads = 0;
+    bool m_shutdown = false;
+
+    std::thread m_worker;
+};
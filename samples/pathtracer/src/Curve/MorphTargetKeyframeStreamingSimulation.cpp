@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <vector>
+
+#include "Curve/MorphTargetKeyframeStreaming.h"
+#include "Curve/MorphTargetKeyframeStreamingSimulation.h"
+
+namespace MorphTargetKeyframeStreaming
+{
+MorphTargetKeyframeStreamingSimulationStats simulate(const MorphTargetKeyframeStreamingSimulationSettings& settings)
+{
+    MorphTargetKeyframeStreamingSimulationStats stats;
+    if (settings.keyframeCount == 0)
+    {
+        return stats;
+    }
+
+    MorphTargetKeyframeWindow window;
+    window.reset(settings.keyframeCount, settings.slotCount);
+
+    struct PendingLoad
+    {
+        MorphTargetKeyframeWindow::Load load;
+        uint32_t completionFrame;
+    };
+    std::deque<PendingLoad> pendingLoads;
+    std::vector<MorphTargetKeyframeWindow::Load> loads;
+
+    for (uint32_t frame = 0; frame < settings.frameCount; ++frame)
+    {
+        // Background reads finish in request order
+        while (!pendingLoads.empty() && pendingLoads.front().completionFrame <= frame)
+        {
+            if (window.complete(pendingLoads.front().load))
+            {
+                ++stats.numLoads;
+            }
+            else
+            {
+                ++stats.numStaleLoads;
+            }
+            pendingLoads.pop_front();
+        }
+
+        const uint32_t keyframe = (uint32_t)std::floor(frame * settings.keyframesPerFrame) % settings.keyframeCount;
+        const uint32_t nextKeyframe = (keyframe + 1) % settings.keyframeCount;
+
+        loads.clear();
+        window.update(keyframe, nextKeyframe, loads);
+        for (const auto& load : loads)
+        {
+            if (load.required)
+            {
+                // Read on the render thread
+                if (window.complete(load))
+                {
+                    ++stats.numLoads;
+                    ++stats.numRequiredLoads;
+                }
+            }
+            else
+            {
+                pendingLoads.push_back({ load, frame + settings.readLatencyFrames });
+            }
+        }
+        stats.maxPendingLoads = std::max(stats.maxPendingLoads, (uint32_t)pendingLoads.size());
+
+        const uint32_t slot = window.getResidentSlot(keyframe);
+        const uint32_t nextSlot = window.getResidentSlot(nextKeyframe);
+        if (slot == MorphTargetKeyframeWindow::kInvalid || nextSlot == MorphTargetKeyframeWindow::kInvalid ||
+            (slot == nextSlot && keyframe != nextKeyframe))
+        {
+            stats.valid = false;
+        }
+    }
+
+    return stats;
+}
+} // namespace MorphTargetKeyframeStreaming
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+// Playback of the keyframe window of the path tracer against a simulated clock, for the tests, the benchmarks and hairanalysis
+
+struct MorphTargetKeyframeStreamingSimulationSettings
+{
+    uint32_t keyframeCount = 300;
+    uint32_t slotCount = 8;
+    uint32_t frameCount = 1200;
+    float keyframesPerFrame = 0.5f;     // Playback speed, 60 fps rendering of a 30 fps animation by default
+    uint32_t readLatencyFrames = 2;     // Frames between the request and the upload of a background read
+};
+
+struct MorphTargetKeyframeStreamingSimulationStats
+{
+    uint32_t numLoads = 0;              // Keyframe uploads
+    uint32_t numRequiredLoads = 0;      // Uploads the render thread waited for
+    uint32_t numStaleLoads = 0;         // Background reads dropped because their slot was reassigned or already loaded
+    uint32_t maxPendingLoads = 0;
+    bool valid = true;                  // Both keyframes of every frame were resident in distinct slots
+};
+
+namespace MorphTargetKeyframeStreaming
+{
+    // Plays the animation back through MorphTargetKeyframeWindow: frame f reads keyframe floor(f * keyframesPerFrame), looping,
+    // and every background read completes readLatencyFrames frames after its request
+    MorphTargetKeyframeStreamingSimulationStats simulate(const MorphTargetKeyframeStreamingSimulationSettings& settings);
+}
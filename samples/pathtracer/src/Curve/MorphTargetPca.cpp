@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+
+#include "MorphTargetPca.h"
+
+using namespace donut::math;
+
+namespace
+{
+    // Strand points per row block of the covariance, 3 floats each, a multiple of kDotLanes
+    constexpr uint32_t kPointsPerBlock = 64;
+    constexpr uint32_t kDotLanes = 8;
+    // Fixed chunking keeps the reduction order, and with it the result, independent of the thread count
+    constexpr uint32_t kPointsPerChunk = 16 * 1024;
+    constexpr uint32_t kMaxCovarianceSlices = 32;
+    constexpr size_t kMaxCovarianceSliceBytes = 256ull * 1024 * 1024;
+    constexpr uint32_t kMaxJacobiSweeps = 64;
+
+    // Independent partial sums, so the loop vectorizes without reassociating the float additions
+    float dot(const float* const a, const float* const b, const uint32_t count)
+    {
+        float sums[kDotLanes] = {};
+        for (uint32_t i = 0; i < count; i += kDotLanes)
+        {
+            for (uint32_t lane = 0; lane < kDotLanes; ++lane)
+            {
+                sums[lane] += a[i + lane] * b[i + lane];
+            }
+        }
+        return ((sums[0] + sums[1]) + (sums[2] + sums[3])) + ((sums[4] + sums[5]) + (sums[6] + sums[7]));
+    }
+
+    // Eigen decomposition of the symmetric n x n matrix a with cyclic Jacobi rotations, a is destroyed.
+    // Column k of eigenvectors (eigenvectors[i * n + k]) belongs to eigenvalues[k].
+    void decomposeSymmetric(std::vector<double>& a, const uint32_t n, std::vector<double>& eigenvalues, std::vector<double>& eigenvectors)
+    {
+        eigenvectors.assign((size_t)n * n, 0.0);
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            eigenvectors[(size_t)i * n + i] = 1.0;
+        }
+
+        double norm = 0.0;
+        for (const double value : a)
+        {
+            norm += value * value;
+        }
+
+        for (uint32_t sweep = 0; sweep < kMaxJacobiSweeps; ++sweep)
+        {
+            double offDiagonal = 0.0;
+            for (uint32_t p = 0; p < n; ++p)
+            {
+                for (uint32_t q = p + 1; q < n; ++q)
+                {
+                    offDiagonal += a[(size_t)p * n + q] * a[(size_t)p * n + q];
+                }
+            }
+            if (offDiagonal <= norm * 1e-30)
+            {
+                break;
+            }
+
+            for (uint32_t p = 0; p < n; ++p)
+            {
+                for (uint32_t q = p + 1; q < n; ++q)
+                {
+                    const double apq = a[(size_t)p * n + q];
+                    if (apq == 0.0)
+                    {
+                        continue;
+                    }
+
+                    // Rotation in the (p, q) plane that zeroes a[p][q]
+                    const double theta = (a[(size_t)q * n + q] - a[(size_t)p * n + p]) / (2.0 * apq);
+                    const double t = (theta >= 0.0 ? 1.0 : -1.0) / (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+                    const double c = 1.0 / std::sqrt(t * t + 1.0);
+                    const double s = t * c;
+
+                    for (uint32_t k = 0; k < n; ++k)
+                    {
+                        const double akp = a[(size_t)k * n + p];
+                        const double akq = a[(size_t)k * n + q];
+                        a[(size_t)k * n + p] = c * akp - s * akq;
+                        a[(size_t)k * n + q] = s * akp + c * akq;
+                    }
+                    for (uint32_t k = 0; k < n; ++k)
+                    {
+                        const double apk = a[(size_t)p * n + k];
+                        const double aqk = a[(size_t)q * n + k];
+                        a[(size_t)p * n + k] = c * apk - s * aqk;
+                        a[(size_t)q * n + k] = s * apk + c * aqk;
+                    }
+                    for (uint32_t k = 0; k < n; ++k)
+                    {
+                        const double vkp = eigenvectors[(size_t)k * n + p];
+                        const double vkq = eigenvectors[(size_t)k * n + q];
+                        eigenvectors[(size_t)k * n + p] = c * vkp - s * vkq;
+                        eigenvectors[(size_t)k * n + q] = s * vkp + c * vkq;
+                    }
+                }
+            }
+        }
+
+        eigenvalues.resize(n);
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            eigenvalues[i] = a[(size_t)i * n + i];
+        }
+    }
+} // namespace
+
+namespace MorphTargetPca
+{
+bool decompose(
+    const std::vector<float4>& keyframeData,
+    const std::vector<nvrhi::BufferRange>& keyframeRanges,
+    ThreadPool& threadPool,
+    MorphTargetPcaBasis& basis,
+    const MorphTargetPcaSettings& settings)
+{
+    const auto startTime = std::chrono::high_resolution_clock::now();
+
+    basis = MorphTargetPcaBasis();
+    if (keyframeRanges.empty())
+    {
+        return false;
+    }
+
+    const uint32_t numKeyframes = (uint32_t)keyframeRanges.size();
+    const uint32_t numPoints = (uint32_t)(keyframeRanges[0].byteSize / sizeof(float4));
+    std::vector<const float4*> keyframes(numKeyframes);
+    for (uint32_t keyframeIndex = 0; keyframeIndex < numKeyframes; ++keyframeIndex)
+    {
+        const nvrhi::BufferRange& keyframeRange = keyframeRanges[keyframeIndex];
+        if (keyframeRange.byteSize != keyframeRanges[0].byteSize || keyframeRange.byteOffset + keyframeRange.byteSize > keyframeData.size() * sizeof(float4))
+        {
+            return false;
+        }
+        keyframes[keyframeIndex] = keyframeData.data() + keyframeRange.byteOffset / sizeof(float4);
+    }
+
+    const uint32_t numChunks = (numPoints + kPointsPerChunk - 1) / kPointsPerChunk;
+
+    // Mean offset of every strand point
+    std::vector<float3> mean(numPoints);
+    threadPool.ParallelFor(numChunks, [&](const uint32_t chunkIndex)
+    {
+        const uint32_t chunkEnd = std::min((chunkIndex + 1) * kPointsPerChunk, numPoints);
+        for (uint32_t pointIndex = chunkIndex * kPointsPerChunk; pointIndex < chunkEnd; ++pointIndex)
+        {
+            double sum[3] = {};
+            for (const float4* const keyframe : keyframes)
+            {
+                sum[0] += keyframe[pointIndex].x;
+                sum[1] += keyframe[pointIndex].y;
+                sum[2] += keyframe[pointIndex].z;
+            }
+            mean[pointIndex] = float3(float(sum[0] / numKeyframes), float(sum[1] / numKeyframes), float(sum[2] / numKeyframes));
+        }
+    });
+
+    // Covariance of the keyframes, upper triangle. Every slice accumulates its own blocks of strand points,
+    // a block is a numKeyframes x (3 * kPointsPerBlock) matrix of offsets relative to the mean.
+    const uint32_t numBlocks = (numPoints + kPointsPerBlock - 1) / kPointsPerBlock;
+    const size_t covarianceBytes = sizeof(double) * numKeyframes * numKeyframes;
+    const uint32_t numSlices = std::max(1u, std::min({ numBlocks, kMaxCovarianceSlices, (uint32_t)(kMaxCovarianceSliceBytes / covarianceBytes) }));
+    std::vector<std::vector<double>> sliceCovariance(numSlices);
+    threadPool.ParallelFor(numSlices, [&](const uint32_t sliceIndex)
+    {
+        constexpr uint32_t kBlockColumns = 3 * kPointsPerBlock;
+        std::vector<double>& covariance = sliceCovariance[sliceIndex];
+        covariance.assign((size_t)numKeyframes * numKeyframes, 0.0);
+        std::vector<float> block((size_t)numKeyframes * kBlockColumns);
+
+        const uint32_t blockEnd = (uint32_t)((uint64_t)(sliceIndex + 1) * numBlocks / numSlices);
+        for (uint32_t blockIndex = (uint32_t)((uint64_t)sliceIndex * numBlocks / numSlices); blockIndex < blockEnd; ++blockIndex)
+        {
+            const uint32_t firstPoint = blockIndex * kPointsPerBlock;
+            const uint32_t blockPoints = std::min(kPointsPerBlock, numPoints - firstPoint);
+            for (uint32_t keyframeIndex = 0; keyframeIndex < numKeyframes; ++keyframeIndex)
+            {
+                float* const row = block.data() + (size_t)keyframeIndex * kBlockColumns;
+                for (uint32_t point = 0; point < blockPoints; ++point)
+                {
+                    const float4& offset = keyframes[keyframeIndex][firstPoint + point];
+                    const float3& pointMean = mean[firstPoint + point];
+                    row[3 * point + 0] = offset.x - pointMean.x;
+                    row[3 * point + 1] = offset.y - pointMean.y;
+                    row[3 * point + 2] = offset.z - pointMean.z;
+                }
+                std::fill(row + 3 * blockPoints, row + kBlockColumns, 0.0f);
+            }
+
+            for (uint32_t i = 0; i < numKeyframes; ++i)
+            {
+                const float* const rowI = block.data() + (size_t)i * kBlockColumns;
+                for (uint32_t j = i; j < numKeyframes; ++j)
+                {
+                    covariance[(size_t)i * numKeyframes + j] += dot(rowI, block.data() + (size_t)j * kBlockColumns, kBlockColumns);
+                }
+            }
+        }
+    });
+
+    std::vector<double> covariance((size_t)numKeyframes * numKeyframes, 0.0);
+    for (const std::vector<double>& slice : sliceCovariance)
+    {
+        for (uint32_t i = 0; i < numKeyframes; ++i)
+        {
+            for (uint32_t j = i; j < numKeyframes; ++j)
+            {
+                covariance[(size_t)i * numKeyframes + j] += slice[(size_t)i * numKeyframes + j];
+            }
+        }
+    }
+    sliceCovariance.clear();
+    for (uint32_t i = 0; i < numKeyframes; ++i)
+    {
+        for (uint32_t j = i + 1; j < numKeyframes; ++j)
+        {
+            covariance[(size_t)j * numKeyframes + i] = covariance[(size_t)i * numKeyframes + j];
+        }
+    }
+
+    std::vector<double> eigenvalues;
+    std::vector<double> eigenvectors;
+    decomposeSymmetric(covariance, numKeyframes, eigenvalues, eigenvectors);
+
+    std::vector<uint32_t> order(numKeyframes);
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(), [&](const uint32_t a, const uint32_t b) { return eigenvalues[a] > eigenvalues[b]; });
+
+    // Smallest component count whose discarded variance stays within the error target
+    double totalVariance = 0.0;
+    for (double& eigenvalue : eigenvalues)
+    {
+        eigenvalue = std::max(eigenvalue, 0.0);
+        totalVariance += eigenvalue;
+    }
+    const double maxDiscardedVariance = totalVariance * settings.maxRelativeError * settings.maxRelativeError;
+    const uint32_t maxComponents = std::min(settings.maxComponents, numKeyframes - 1);
+    uint32_t numComponents = 0;
+    double discardedVariance = totalVariance;
+    while (numComponents < maxComponents && discardedVariance > maxDiscardedVariance)
+    {
+        discardedVariance -= eigenvalues[order[numComponents]];
+        ++numComponents;
+    }
+
+    basis.keyframeCount = numKeyframes;
+    basis.keyframeVertexCount = numPoints;
+    basis.componentCount = numComponents + 1;
+    basis.rmsDeviation = (float)std::sqrt(totalVariance / ((double)numKeyframes * std::max(numPoints, 1u)));
+
+    // The eigenvector entries are the coefficients, so the basis vectors are the offsets projected on the eigenvectors,
+    // with a length of sqrt(eigenvalue). The coefficients stay in [-1, 1].
+    const uint32_t componentCount = basis.componentCount;
+    basis.coefficients.resize((size_t)numKeyframes * componentCount);
+    for (uint32_t keyframeIndex = 0; keyframeIndex < numKeyframes; ++keyframeIndex)
+    {
+        basis.coefficients[(size_t)keyframeIndex * componentCount] = 1.0f;
+        for (uint32_t component = 0; component < numComponents; ++component)
+        {
+            basis.coefficients[(size_t)keyframeIndex * componentCount + component + 1] =
+                (float)eigenvectors[(size_t)keyframeIndex * numKeyframes + order[component]];
+        }
+    }
+
+    basis.basis.resize((size_t)numPoints * componentCount);
+    threadPool.ParallelFor(numChunks, [&](const uint32_t chunkIndex)
+    {
+        std::vector<double> projection(3 * numComponents);
+        const uint32_t chunkEnd = std::min((chunkIndex + 1) * kPointsPerChunk, numPoints);
+        for (uint32_t pointIndex = chunkIndex * kPointsPerChunk; pointIndex < chunkEnd; ++pointIndex)
+        {
+            std::fill(projection.begin(), projection.end(), 0.0);
+            for (uint32_t keyframeIndex = 0; keyframeIndex < numKeyframes; ++keyframeIndex)
+            {
+                const float3 offset = keyframes[keyframeIndex][pointIndex].xyz() - mean[pointIndex];
+                for (uint32_t component = 0; component < numComponents; ++component)
+                {
+                    const double coefficient = eigenvectors[(size_t)keyframeIndex * numKeyframes + order[component]];
+                    projection[3 * component + 0] += coefficient * offset.x;
+                    projection[3 * component + 1] += coefficient * offset.y;
+                    projection[3 * component + 2] += coefficient * offset.z;
+                }
+            }
+
+            float4* const pointBasis = basis.basis.data() + (size_t)pointIndex * componentCount;
+            pointBasis[0] = float4(mean[pointIndex], 0.0f);
+            for (uint32_t component = 0; component < numComponents; ++component)
+            {
+                pointBasis[component + 1] = float4((float)projection[3 * component + 0], (float)projection[3 * component + 1], (float)projection[3 * component + 2], 0.0f);
+            }
+        }
+    });
+
+    // Error of the reconstruction the shader does
+    std::vector<double> chunkSquaredError(numChunks, 0.0);
+    std::vector<float> chunkMaxError(numChunks, 0.0f);
+    threadPool.ParallelFor(numChunks, [&](const uint32_t chunkIndex)
+    {
+        const uint32_t chunkEnd = std::min((chunkIndex + 1) * kPointsPerChunk, numPoints);
+        for (uint32_t pointIndex = chunkIndex * kPointsPerChunk; pointIndex < chunkEnd; ++pointIndex)
+        {
+            for (uint32_t keyframeIndex = 0; keyframeIndex < numKeyframes; ++keyframeIndex)
+            {
+                const float error = length(reconstruct(basis, keyframeIndex, pointIndex) - keyframes[keyframeIndex][pointIndex].xyz());
+                chunkSquaredError[chunkIndex] += (double)error * error;
+                chunkMaxError[chunkIndex] = std::max(chunkMaxError[chunkIndex], error);
+            }
+        }
+    });
+    const double squaredError = std::accumulate(chunkSquaredError.begin(), chunkSquaredError.end(), 0.0);
+    basis.rmsError = (float)std::sqrt(squaredError / ((double)numKeyframes * std::max(numPoints, 1u)));
+    basis.maxPositionError = *std::max_element(chunkMaxError.begin(), chunkMaxError.end());
+
+    basis.decompositionTimeMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+    return true;
+}
+
+float3 reconstruct(const MorphTargetPcaBasis& basis, const uint32_t keyframeIndex, const uint32_t strandPointIndex)
+{
+    const float4* const pointBasis = basis.basis.data() + (size_t)strandPointIndex * basis.componentCount;
+    const float* const coefficients = basis.coefficients.data() + (size_t)keyframeIndex * basis.componentCount;
+
+    float3 offset = float3(0.0f);
+    for (uint32_t component = 0; component < basis.componentCount; ++component)
+    {
+        offset += coefficients[component] * pointBasis[component].xyz();
+    }
+    return offset;
+}
+} // namespace MorphTargetPca
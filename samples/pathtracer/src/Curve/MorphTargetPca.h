@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <donut/core/math/math.h>
+#include <nvrhi/nvrhi.h>
+
+#include "ThreadPool.h"
+
+struct MorphTargetPcaSettings
+{
+    // RMS reconstruction error relative to the RMS distance of the keyframes to their mean
+    float maxRelativeError = 0.01f;
+    uint32_t maxComponents = 32; // Basis vectors besides the mean
+};
+
+// Keyframe offsets of one mesh as the mean plus a weighted sum of basis vectors.
+// Component 0 is the mean with a coefficient of 1 in every keyframe.
+struct MorphTargetPcaBasis
+{
+    uint32_t keyframeCount = 0;
+    uint32_t keyframeVertexCount = 0;
+    uint32_t componentCount = 0;              // Including the mean
+    // Point major, basis[point * componentCount + component], so the components of a strand point are one contiguous read
+    std::vector<donut::math::float4> basis;
+    std::vector<float> coefficients;          // coefficients[keyframe * componentCount + component]
+
+    float rmsDeviation = 0.0f;                // RMS distance of the keyframe offsets to their mean
+    float rmsError = 0.0f;                    // RMS distance of the reconstructed offsets to the original ones
+    float maxPositionError = 0.0f;
+    double decompositionTimeMs = 0.0;
+};
+
+// Principal component analysis of a morph target keyframe sequence.
+// The covariance between the keyframes (one row per keyframe, 3 x strand points columns) is decomposed with Jacobi rotations,
+// the basis vectors are the keyframe offsets projected on its eigenvectors. The component count is the smallest one whose
+// discarded eigenvalues stay within settings.maxRelativeError. The result doesn't depend on the thread count.
+namespace MorphTargetPca
+{
+    // keyframeRanges are byte ranges of keyframeData, as BufferGroup::morphTargetBufferRange, and must have the same size.
+    // Returns false if they don't.
+    bool decompose(
+        const std::vector<donut::math::float4>& keyframeData,
+        const std::vector<nvrhi::BufferRange>& keyframeRanges,
+        ThreadPool& threadPool,
+        MorphTargetPcaBasis& basis,
+        const MorphTargetPcaSettings& settings = {});
+
+    // Offset of a strand point as the morph target shader reconstructs it
+    donut::math::float3 reconstruct(const MorphTargetPcaBasis& basis, const uint32_t keyframeIndex, const uint32_t strandPointIndex);
+}
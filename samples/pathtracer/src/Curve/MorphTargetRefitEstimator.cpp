@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "MorphTargetRefitEstimator.h"
+
+using namespace donut::math;
+
+namespace
+{
+    float getBoxSurfaceArea(const box3& bounds)
+    {
+        if (bounds.isempty())
+        {
+            return 0.0f;
+        }
+        const float3 extent = bounds.diagonal();
+        return 2.0f * (extent.x * extent.y + extent.y * extent.z + extent.z * extent.x);
+    }
+}
+
+std::vector<float> MorphTargetRefitEstimator::computeKeyframeSurfaceAreas(
+    const std::vector<rtxcr::geometry::LineSegment>& lineSegments,
+    const std::vector<float4>& keyframeData,
+    const std::vector<nvrhi::BufferRange>& keyframeRanges)
+{
+    std::vector<float> keyframeSurfaceAreas;
+    if (lineSegments.empty() || keyframeRanges.empty())
+    {
+        return keyframeSurfaceAreas;
+    }
+
+    // The morph target shader offsets the end points of segment i by the keyframe entries i + geometryIndex and i + geometryIndex + 1
+    uint64_t numStrandPoints = 0;
+    for (size_t segmentIndex = 0; segmentIndex < lineSegments.size(); ++segmentIndex)
+    {
+        numStrandPoints = std::max(numStrandPoints, (uint64_t)segmentIndex + lineSegments[segmentIndex].geometryIndex + 2);
+    }
+    for (const auto& keyframeRange : keyframeRanges)
+    {
+        if (keyframeRange.byteOffset % sizeof(float4) != 0 || keyframeRange.byteSize < numStrandPoints * sizeof(float4) ||
+            keyframeRange.byteOffset + numStrandPoints * sizeof(float4) > keyframeData.size() * sizeof(float4))
+        {
+            return keyframeSurfaceAreas;
+        }
+    }
+
+    const uint32_t numClusters = (uint32_t)((lineSegments.size() + kSegmentsPerCluster - 1) / kSegmentsPerCluster);
+    const uint32_t clusterStride = (numClusters + kMaxSampledClusters - 1) / kMaxSampledClusters;
+
+    keyframeSurfaceAreas.resize(keyframeRanges.size());
+    for (size_t keyframeIndex = 0; keyframeIndex < keyframeRanges.size(); ++keyframeIndex)
+    {
+        const float4* const keyframe = keyframeData.data() + keyframeRanges[keyframeIndex].byteOffset / sizeof(float4);
+
+        double surfaceArea = 0.0;
+        for (uint32_t clusterIndex = 0; clusterIndex < numClusters; clusterIndex += clusterStride)
+        {
+            const size_t firstSegment = (size_t)clusterIndex * kSegmentsPerCluster;
+            const size_t lastSegment = std::min(firstSegment + kSegmentsPerCluster, lineSegments.size());
+
+            box3 bounds = box3::empty();
+            for (size_t segmentIndex = firstSegment; segmentIndex < lastSegment; ++segmentIndex)
+            {
+                const auto& segment = lineSegments[segmentIndex];
+                const size_t strandPointIndex = segmentIndex + segment.geometryIndex;
+                for (uint32_t pointIndex = 0; pointIndex < 2; ++pointIndex)
+                {
+                    const auto& vertex = segment.vertices[pointIndex];
+                    const float3 position = float3(vertex.position) + keyframe[strandPointIndex + pointIndex].xyz();
+                    bounds |= box3(position - float3(vertex.radius), position + float3(vertex.radius));
+                }
+            }
+            surfaceArea += getBoxSurfaceArea(bounds);
+        }
+        keyframeSurfaceAreas[keyframeIndex] = (float)surfaceArea;
+    }
+    return keyframeSurfaceAreas;
+}
+
+float MorphTargetRefitEstimator::getSurfaceArea(const std::vector<float>& keyframeSurfaceAreas, const float keyframePosition)
+{
+    if (keyframeSurfaceAreas.empty())
+    {
+        return 0.0f;
+    }
+
+    // The animation wraps from the last keyframe to the first one
+    const float position = std::max(keyframePosition, 0.0f);
+    const size_t keyframeIndex = (size_t)position % keyframeSurfaceAreas.size();
+    const size_t nextKeyframeIndex = (keyframeIndex + 1) % keyframeSurfaceAreas.size();
+    const float weight = std::min(position - std::floor(position), 1.0f);
+    return keyframeSurfaceAreas[keyframeIndex] + (keyframeSurfaceAreas[nextKeyframeIndex] - keyframeSurfaceAreas[keyframeIndex]) * weight;
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <donut/core/math/math.h>
+#include <nvrhi/nvrhi.h>
+#include <rtxcr/geometry/include/CurveTessellation.h>
+
+// CPU estimate of how much the BLAS of a morph target animated mesh degrades while it is refit.
+// A refit keeps the tree of the build and only grows its node bounds around the moved primitives. Consecutive line segments
+// follow the strands and end up in the same low BVH nodes, so clusters of them stand in for those nodes: the summed surface
+// area of the cluster bounds at a pose, relative to the pose of the build, is the growth of the refit tree. Rigid motion
+// keeps it at 1, strands that spread or stretch raise it.
+namespace MorphTargetRefitEstimator
+{
+    constexpr uint32_t kSegmentsPerCluster = 16;
+    // Larger meshes are sampled with evenly spaced clusters
+    constexpr uint32_t kMaxSampledClusters = 2048;
+
+    // Summed cluster surface area of every keyframe. keyframeRanges are byte ranges of keyframeData, as
+    // BufferGroup::morphTargetBufferRange, with one offset per strand point as the morph target shader reads them.
+    // Empty when the keyframes don't cover the line segments.
+    std::vector<float> computeKeyframeSurfaceAreas(
+        const std::vector<rtxcr::geometry::LineSegment>& lineSegments,
+        const std::vector<donut::math::float4>& keyframeData,
+        const std::vector<nvrhi::BufferRange>& keyframeRanges);
+
+    // Surface area at keyframePosition, a keyframe index plus the interpolation weight to the next keyframe. 0 without keyframes.
+    float getSurfaceArea(const std::vector<float>& keyframeSurfaceAreas, const float keyframePosition);
+}
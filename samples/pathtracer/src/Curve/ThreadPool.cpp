@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+
+#include "ThreadPool.h"
+
+namespace
+{
+    // Pool whose tasks the current thread is running
+    thread_local const ThreadPool* t_taskPool = nullptr;
+}
+
+ThreadPool::ThreadPool(const uint32_t threadCount)
+{
+    const uint32_t totalThreads = (threadCount > 0) ? threadCount : std::max(std::thread::hardware_concurrency(), 1u);
+
+    // The thread calling ParallelFor is one of the workers
+    m_workers.reserve(totalThreads - 1);
+    for (uint32_t threadIndex = 1; threadIndex < totalThreads; ++threadIndex)
+    {
+        m_workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_workAvailable.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+void ThreadPool::ParallelFor(const uint32_t taskCount, const std::function<void(const uint32_t)>& func)
+{
+    if (taskCount == 0)
+    {
+        return;
+    }
+
+    // No point waking up the workers for a single task.
+    // The workers of a nested call would all be busy with the outer call, which holds the dispatch lock.
+    if (m_workers.empty() || taskCount == 1 || t_taskPool == this)
+    {
+        for (uint32_t taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+        {
+            func(taskIndex);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> dispatchLock(m_dispatchMutex);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_func = &func;
+        m_taskCount = taskCount;
+        m_nextTask = 0;
+        m_activeWorkers = static_cast<uint32_t>(m_workers.size());
+        ++m_generation;
+    }
+    m_workAvailable.notify_all();
+
+    t_taskPool = this;
+    runTasks();
+    t_taskPool = nullptr;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_workDone.wait(lock, [this]() { return m_activeWorkers == 0; });
+    m_func = nullptr;
+
+    if (m_exception)
+    {
+        std::exception_ptr exception = nullptr;
+        std::swap(exception, m_exception);
+        lock.unlock();
+        std::rethrow_exception(exception);
+    }
+}
+
+void ThreadPool::workerLoop()
+{
+    uint64_t lastGeneration = 0;
+    t_taskPool = this;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_workAvailable.wait(lock, [&]() { return m_shutdown || m_generation != lastGeneration; });
+
+            if (m_shutdown)
+            {
+                return;
+            }
+
+            lastGeneration = m_generation;
+        }
+
+        runTasks();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            --m_activeWorkers;
+        }
+        m_workDone.notify_one();
+    }
+}
+
+void ThreadPool::runTasks()
+{
+    for (uint32_t taskIndex = m_nextTask.fetch_add(1); taskIndex < m_taskCount; taskIndex = m_nextTask.fetch_add(1))
+    {
+        try
+        {
+            (*m_func)(taskIndex);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_exception)
+            {
+                m_exception = std::current_exception();
+            }
+            // The remaining tasks are skipped
+            m_nextTask = m_taskCount;
+        }
+    }
+}
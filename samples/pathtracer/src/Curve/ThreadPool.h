@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed size worker pool used by the CPU side curve processing.
+// The calling thread also participates in the work, so a pool created with 1 thread runs everything serially.
+class ThreadPool
+{
+public:
+    // threadCount == 0 uses all hardware threads
+    explicit ThreadPool(const uint32_t threadCount);
+
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Runs func(taskIndex) for every taskIndex in [0, taskCount) and blocks until all tasks are finished.
+    // Tasks are handed out dynamically, so they must not depend on each other's execution order.
+    // The first exception thrown by a task stops handing out tasks and is rethrown on the calling thread once the running ones are done.
+    // A ParallelFor called from a task of the same pool runs its tasks serially on the calling worker.
+    void ParallelFor(const uint32_t taskCount, const std::function<void(const uint32_t)>& func);
+
+    inline uint32_t GetThreadCount() const { return static_cast<uint32_t>(m_workers.size()) + 1; }
+
+private:
+    void workerLoop();
+    void runTasks();
+
+    std::vector<std::thread> m_workers;
+
+    // Serializes ParallelFor calls coming from different threads
+    std::mutex m_dispatchMutex;
+
+    std::mutex m_mutex;
+    std::condition_variable m_workAvailable;
+    std::condition_variable m_workDone;
+
+    const std::function<void(const uint32_t)>* m_func = nullptr;
+    std::exception_ptr m_exception;
+    std::atomic<uint32_t> m_nextTask = 0;
+    uint32_t m_taskCount = 0;
+    uint32_t m_activeWorkers = 0;
+    uint64_t m_generation = 0;
+    bool m_shutdown = false;
+};
@@ -9,10 +9,12 @@
  */
 
 #include <donut/app/ApplicationBase.h>
+#include <nvrhi/utils.h>
 
 #include "../SampleScene.h"
 #include "../ScopeMarker.h"
 #include "MorphTargetAnimationPass.h"
+#include "MorphTargetKeyframeRing.h"
 #include "../shared/shared.h"
 
 std::vector<donut::engine::ShaderMacro> polytubeShaderMacro =
@@ -30,6 +32,19 @@ std::vector<donut::engine::ShaderMacro> lssShaderMacro =
     { "RTXCR_CURVE_TESSELLATION_TYPE", std::to_string(RTXCR_CURVE_TESSELLATION_TYPE_LSS) }
 };
 
+static uint32_t getShaderTessellationType(const TessellationType tessellationType)
+{
+    switch (tessellationType)
+    {
+    case TessellationType::Polytube:
+        return RTXCR_CURVE_TESSELLATION_TYPE_POLYTUBE;
+    case TessellationType::DisjointOrthogonalTriangleStrip:
+        return RTXCR_CURVE_TESSELLATION_TYPE_DOTS;
+    default:
+        return RTXCR_CURVE_TESSELLATION_TYPE_LSS;
+    }
+}
+
 MorphTargetAnimationPass::MorphTargetAnimationPass(
     nvrhi::IDevice* const device,
     std::shared_ptr<donut::engine::ShaderFactory> shaderFactory)
@@ -42,39 +57,129 @@ MorphTargetAnimationPass::MorphTargetAnimationPass(
 
 void MorphTargetAnimationPass::createShaders()
 {
-    m_shaders[(uint32_t)TessellationType::Polytube] =
-        m_shaderFactory->CreateShader("app/morphTargetAnimation.cs.hlsl", "main_cs", &polytubeShaderMacro, nvrhi::ShaderType::Compute);
+    // One variant per line segment format, see MorphTargetResources::compactLineSegments, per kernel layout and per keyframe format.
+    // LSS already runs one thread per segment end point and has no per segment variant.
+    // The batched variant reads the line segment format of every mesh from the mesh table instead.
+    auto createShader = [&](std::vector<donut::engine::ShaderMacro> shaderMacros, const uint32_t keyframeFormat, const uint32_t compactLineSegments, const uint32_t perSegment, const uint32_t batched = 0)
+    {
+        shaderMacros.push_back(donut::engine::ShaderMacro("RTXCR_COMPACT_LINE_SEGMENTS", std::to_string(compactLineSegments)));
+        shaderMacros.push_back(donut::engine::ShaderMacro("RTXCR_MORPH_TARGET_PER_SEGMENT", std::to_string(perSegment)));
+        shaderMacros.push_back(donut::engine::ShaderMacro("RTXCR_MORPH_TARGET_BATCHED", std::to_string(batched)));
+        shaderMacros.push_back(donut::engine::ShaderMacro("RTXCR_MORPH_TARGET_KEYFRAME_FORMAT", std::to_string(keyframeFormat)));
+        return m_shaderFactory->CreateShader("app/morphTargetAnimation.cs.hlsl", "main_cs", &shaderMacros, nvrhi::ShaderType::Compute);
+    };
+
+    for (uint32_t keyframeFormat = 0; keyframeFormat < RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_COUNT; ++keyframeFormat)
+    {
+        for (uint32_t compactLineSegments = 0; compactLineSegments < 2; ++compactLineSegments)
+        {
+            for (uint32_t perSegment = 0; perSegment < 2; ++perSegment)
+            {
+                m_shaders[(uint32_t)TessellationType::Polytube][keyframeFormat][compactLineSegments][perSegment] =
+                    createShader(polytubeShaderMacro, keyframeFormat, compactLineSegments, perSegment);
+
+                m_shaders[(uint32_t)TessellationType::DisjointOrthogonalTriangleStrip][keyframeFormat][compactLineSegments][perSegment] =
+                    createShader(dotsShaderMacro, keyframeFormat, compactLineSegments, perSegment);
+            }
 
-    m_shaders[(uint32_t)TessellationType::DisjointOrthogonalTriangleStrip] =
-        m_shaderFactory->CreateShader("app/morphTargetAnimation.cs.hlsl", "main_cs", &dotsShaderMacro, nvrhi::ShaderType::Compute);
+            m_shaders[(uint32_t)TessellationType::LinearSweptSphere][keyframeFormat][compactLineSegments][0] =
+                createShader(lssShaderMacro, keyframeFormat, compactLineSegments, 0);
+        }
 
-    m_shaders[(uint32_t)TessellationType::LinearSweptSphere] =
-        m_shaderFactory->CreateShader("app/morphTargetAnimation.cs.hlsl", "main_cs", &lssShaderMacro, nvrhi::ShaderType::Compute);
+        for (uint32_t perSegment = 0; perSegment < 2; ++perSegment)
+        {
+            m_batchShaders[(uint32_t)TessellationType::Polytube][keyframeFormat][perSegment] =
+                createShader(polytubeShaderMacro, keyframeFormat, 0, perSegment, 1);
+            m_batchShaders[(uint32_t)TessellationType::DisjointOrthogonalTriangleStrip][keyframeFormat][perSegment] =
+                createShader(dotsShaderMacro, keyframeFormat, 0, perSegment, 1);
+        }
+        m_batchShaders[(uint32_t)TessellationType::LinearSweptSphere][keyframeFormat][0] = createShader(lssShaderMacro, keyframeFormat, 0, 0, 1);
+    }
 
     // TODO: Debug triangles
 }
 
 bool MorphTargetAnimationPass::CreateMorphTargetAnimationPipeline(const TessellationType tessellationType)
 {
-    nvrhi::BindingLayoutDesc bindingLayoutDesc;
-    bindingLayoutDesc.visibility = nvrhi::ShaderType::Compute;
-    bindingLayoutDesc.bindings = {
-        nvrhi::BindingLayoutItem::ConstantBuffer(0),
-        nvrhi::BindingLayoutItem::StructuredBuffer_SRV(0),
-        nvrhi::BindingLayoutItem::StructuredBuffer_SRV(1),
-        nvrhi::BindingLayoutItem::StructuredBuffer_SRV(2),
-        nvrhi::BindingLayoutItem::RawBuffer_UAV(0),
-        nvrhi::BindingLayoutItem::RawBuffer_UAV(1),
-        nvrhi::BindingLayoutItem::RawBuffer_UAV(2),
-    };
+    for (uint32_t layoutIndex = 0; layoutIndex < 4; ++layoutIndex)
+    {
+        const uint32_t compactLineSegments = layoutIndex & 1;
+        const uint32_t keyframeParameters = layoutIndex >> 1;
+
+        nvrhi::BindingLayoutDesc bindingLayoutDesc;
+        bindingLayoutDesc.visibility = nvrhi::ShaderType::Compute;
+        bindingLayoutDesc.bindings = {
+            nvrhi::BindingLayoutItem::ConstantBuffer(0),
+            nvrhi::BindingLayoutItem::StructuredBuffer_SRV(0),
+            nvrhi::BindingLayoutItem::StructuredBuffer_SRV(1),
+            nvrhi::BindingLayoutItem::StructuredBuffer_SRV(2),
+            nvrhi::BindingLayoutItem::RawBuffer_UAV(0),
+            nvrhi::BindingLayoutItem::RawBuffer_UAV(1),
+            nvrhi::BindingLayoutItem::RawBuffer_UAV(2),
+        };
+
+        // The LSS morph shader doesn't read the index buffer, successive implicit LSS shares the vertex layout of the keyframes.
+        if (tessellationType != TessellationType::LinearSweptSphere)
+        {
+            bindingLayoutDesc.bindings.push_back(nvrhi::BindingLayoutItem::RawBuffer_SRV(3));
+        }
 
-    // Index buffer data are cleared in CurveTessellation when using LSS geometry mode, as index buffers are not currently supported for LSS.
-    if (tessellationType != TessellationType::LinearSweptSphere)
+        // Quantization bounds of the compact line segments
+        if (compactLineSegments != 0)
+        {
+            bindingLayoutDesc.bindings.push_back(nvrhi::BindingLayoutItem::StructuredBuffer_SRV(4));
+        }
+
+        // Quantization entries or PCA coefficients of the compressed keyframe formats
+        if (keyframeParameters != 0)
+        {
+            bindingLayoutDesc.bindings.push_back(nvrhi::BindingLayoutItem::StructuredBuffer_SRV(5));
+        }
+
+        m_bindingLayout[compactLineSegments][keyframeParameters] = m_device->createBindingLayout(bindingLayoutDesc);
+    }
+
+    // Batched dispatch: constants and mesh table, and a descriptor table with the resources of all meshes
     {
-        bindingLayoutDesc.bindings.push_back(nvrhi::BindingLayoutItem::RawBuffer_SRV(3));
+        nvrhi::BindingLayoutDesc bindingLayoutDesc;
+        bindingLayoutDesc.visibility = nvrhi::ShaderType::Compute;
+        bindingLayoutDesc.registerSpaceIsDescriptorSet = (m_device->getGraphicsAPI() == nvrhi::GraphicsAPI::VULKAN);
+        bindingLayoutDesc.registerSpace = 0;
+        bindingLayoutDesc.bindings = {
+            nvrhi::BindingLayoutItem::ConstantBuffer(0),
+            nvrhi::BindingLayoutItem::StructuredBuffer_SRV(0),
+        };
+        m_batchBindingLayout = m_device->createBindingLayout(bindingLayoutDesc);
+
+        nvrhi::BindlessLayoutDesc bindlessLayoutDesc;
+        bindlessLayoutDesc.visibility = nvrhi::ShaderType::Compute;
+        bindlessLayoutDesc.firstSlot = 0;
+        bindlessLayoutDesc.maxCapacity = 1024;
+        bindlessLayoutDesc.registerSpaces = {
+            nvrhi::BindingLayoutItem::StructuredBuffer_SRV(1), // Keyframes
+            nvrhi::BindingLayoutItem::StructuredBuffer_SRV(2), // Line segments
+            nvrhi::BindingLayoutItem::StructuredBuffer_SRV(3), // Compact line segments
+            nvrhi::BindingLayoutItem::StructuredBuffer_SRV(4), // Line segment bounds
+            nvrhi::BindingLayoutItem::RawBuffer_UAV(5),        // Vertex buffers
+            nvrhi::BindingLayoutItem::StructuredBuffer_SRV(6)  // Keyframe quantization
+        };
+        m_batchBindlessLayout = m_device->createBindlessLayout(bindlessLayoutDesc);
+        m_batchDescriptors.clear();
+        m_batchDescriptorTable = std::make_shared<donut::engine::DescriptorTableManager>(m_device, m_batchBindlessLayout);
+        m_batchBindingSet = nullptr;
+        for (auto& pso : m_batchPso)
+        {
+            pso[0] = nullptr;
+            pso[1] = nullptr;
+        }
     }
 
-    m_bindingLayout = m_device->createBindingLayout(bindingLayoutDesc);
+    for (uint32_t queryIndex = 0; queryIndex < kTimerQueryCount; ++queryIndex)
+    {
+        m_timerQueries[queryIndex] = m_device->createTimerQuery();
+        m_timerQueryPending[queryIndex] = false;
+    }
+    m_timerQueryActive = false;
 
     createShaders();
 
@@ -85,7 +190,7 @@ void MorphTargetAnimationPass::RecompileMorphTargetAnimationShaders()
 {
     createShaders();
 
-    m_pso = nullptr;
+    CleanComputePipeline();
 }
 
 void MorphTargetAnimationPass::Update(const float fElapsedTimeSeconds)
@@ -102,7 +207,8 @@ void MorphTargetAnimationPass::Dispatch(
     const bool enableDebugOverride,
     const uint32_t overrideKeyFrameIndex,
     const float overrideKeyFrameWeight,
-    const float animationSmoothingFactor)
+    const float animationSmoothingFactor,
+    const bool perSegmentKernel)
 {
     if (morphTargetResources.vertexSize == 0)
     {
@@ -112,20 +218,115 @@ void MorphTargetAnimationPass::Dispatch(
 
     ScopedMarker scopedMarker(commandList, "Morph Target Animation");
 
-    if (!m_pso)
+    const uint32_t keyframeFormat = morphTargetResources.keyframeFormat;
+    const uint32_t keyframeParameters = (keyframeFormat != RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_FULL) ? 1 : 0;
+    const uint32_t compactLineSegments = morphTargetResources.compactLineSegments ? 1 : 0;
+    const uint32_t perSegment = (perSegmentKernel && tessellationType != TessellationType::LinearSweptSphere) ? 1 : 0;
+    if (!m_pso[keyframeFormat][compactLineSegments][perSegment])
     {
         nvrhi::ComputePipelineDesc pipelineDesc;
-        pipelineDesc.CS = m_shaders[(uint32_t)tessellationType];
-        pipelineDesc.addBindingLayout(m_bindingLayout);
-        m_pso = m_device->createComputePipeline(pipelineDesc);
+        pipelineDesc.CS = m_shaders[(uint32_t)tessellationType][keyframeFormat][compactLineSegments][perSegment];
+        pipelineDesc.addBindingLayout(m_bindingLayout[compactLineSegments][keyframeParameters]);
+        m_pso[keyframeFormat][compactLineSegments][perSegment] = m_device->createComputePipeline(pipelineDesc);
     }
 
     const auto& positionBufferRange = mesh->buffers->getVertexBufferRange(VertexAttribute::Position);
     const auto& normalBufferRange = mesh->buffers->getVertexBufferRange(VertexAttribute::Normal);
     const auto& tangentBufferRange = mesh->buffers->getVertexBufferRange(VertexAttribute::Tangent);
 
+    const KeyframeSelection keyframeSelection = selectKeyframes(
+        mesh->buffers->morphTargetBufferRange.size(),
+        animationTimestampPerFrame,
+        enableDebugOverride,
+        overrideKeyFrameIndex,
+        overrideKeyFrameWeight,
+        animationSmoothingFactor);
+    m_keyframePositions[mesh.get()] = (float)keyframeSelection.keyFrameIndex + keyframeSelection.lerpWeight;
+
+    // All morph target buffer data are packed into a single buffer 'morphTargetDataBuffer', so we don't need to upload data every frame.
+    // Instead, we calculate the 2 keyframes we need, and use buffer range to bind to the animation shader.
+    // Streamed keyframes are in the slots of the ring, which uploads them first if needed.
+    nvrhi::BufferRange morphTargetBufferKeyframeRange = morphTargetResources.keyframeRanges[keyframeSelection.keyFrameIndex];
+    nvrhi::BufferRange morphTargetBufferNextKeyframeRange = morphTargetResources.keyframeRanges[keyframeSelection.nextKeyFrameIndex];
+    if (morphTargetResources.keyframeRing)
+    {
+        const MorphTargetKeyframeRing::FrameStats ringStats = morphTargetResources.keyframeRing->acquire(commandList,
+            keyframeSelection.keyFrameIndex, keyframeSelection.nextKeyFrameIndex, morphTargetBufferKeyframeRange, morphTargetBufferNextKeyframeRange);
+        m_stats.numKeyframeUploads += ringStats.numUploads;
+        m_stats.numKeyframeStalls += ringStats.numStalls;
+    }
+    else
+    {
+        commandList->beginTrackingBufferState(morphTargetResources.morphTargetDataBuffer, nvrhi::ResourceStates::Common);
+        commandList->setBufferState(morphTargetResources.morphTargetDataBuffer, nvrhi::ResourceStates::ShaderResource);
+    }
+
+    // Update CB
+    MorphTargetConstants morphTargetConstants = {};
+    morphTargetConstants.vertexCount = morphTargetResources.vertexSize;
+    morphTargetConstants.polyTubeOrder = morphTargetResources.polyTubeOrder;
+    morphTargetConstants.lssSuccessiveImplicit =
+        (tessellationType == TessellationType::LinearSweptSphere && !mesh->geometries.empty() && mesh->geometries[0]->numIndices > 0) ? 1 : 0;
+    morphTargetConstants.lerpWeight = keyframeSelection.lerpWeight;
+    morphTargetConstants.keyframeIndex = keyframeSelection.keyFrameIndex;
+    morphTargetConstants.nextKeyframeIndex = keyframeSelection.nextKeyFrameIndex;
+    morphTargetConstants.keyframeComponentCount = morphTargetResources.keyframeComponentCount;
+
+    commandList->beginTrackingBufferState(morphTargetResources.morphTargetConstantBuffer, nvrhi::ResourceStates::Common);
+    commandList->writeBuffer(morphTargetResources.morphTargetConstantBuffer, &morphTargetConstants, sizeof(morphTargetConstants));
+
+    commandList->commitBarriers();
+
+    commandList->beginTrackingBufferState(mesh->buffers->vertexBuffer, nvrhi::ResourceStates::UnorderedAccess);
+
+    nvrhi::BindingSetDesc bindingSetDesc;
+    bindingSetDesc.bindings = {
+        nvrhi::BindingSetItem::ConstantBuffer(0, morphTargetResources.morphTargetConstantBuffer),
+        nvrhi::BindingSetItem::StructuredBuffer_SRV(0, morphTargetResources.morphTargetDataBuffer, nvrhi::Format::UNKNOWN, morphTargetBufferKeyframeRange),
+        nvrhi::BindingSetItem::StructuredBuffer_SRV(1, morphTargetResources.morphTargetDataBuffer, nvrhi::Format::UNKNOWN, morphTargetBufferNextKeyframeRange),
+        nvrhi::BindingSetItem::StructuredBuffer_SRV(2, morphTargetResources.lineSegmentsBuffer),
+        nvrhi::BindingSetItem::RawBuffer_UAV(0, mesh->buffers->vertexBuffer, positionBufferRange),
+        nvrhi::BindingSetItem::RawBuffer_UAV(1, mesh->buffers->vertexBuffer, normalBufferRange),
+        nvrhi::BindingSetItem::RawBuffer_UAV(2, mesh->buffers->vertexBuffer, tangentBufferRange),
+    };
+    // The LSS morph shader doesn't read the index buffer, successive implicit LSS shares the vertex layout of the keyframes.
+    if (tessellationType != TessellationType::LinearSweptSphere)
+    {
+        bindingSetDesc.bindings.push_back(nvrhi::BindingSetItem::RawBuffer_SRV(3, mesh->buffers->indexBuffer));
+    }
+    if (compactLineSegments != 0)
+    {
+        bindingSetDesc.bindings.push_back(nvrhi::BindingSetItem::StructuredBuffer_SRV(4, morphTargetResources.lineSegmentBoundsBuffer));
+    }
+    if (keyframeParameters != 0)
+    {
+        bindingSetDesc.bindings.push_back(nvrhi::BindingSetItem::StructuredBuffer_SRV(5, morphTargetResources.keyframeParameterBuffer));
+    }
+
+    m_bindingSet = m_device->createBindingSet(bindingSetDesc, m_bindingLayout[compactLineSegments][keyframeParameters]);
+    ++m_stats.numBindingSetsCreated;
+
+    nvrhi::ComputeState state;
+    state.setPipeline(m_pso[keyframeFormat][compactLineSegments][perSegment]);
+    state.addBindingSet(m_bindingSet);
+
+    commandList->setComputeState(state);
+    // The per segment kernel runs one thread per line segment, the per vertex kernel one per vertex (LSS: per segment end point)
+    const uint32_t numThreads = (perSegment != 0) ? morphTargetResources.lineSegmentCount : morphTargetResources.vertexSize;
+    commandList->dispatch((numThreads + RTXCR_MORPH_TARGET_THREAD_GROUP_SIZE - 1) / RTXCR_MORPH_TARGET_THREAD_GROUP_SIZE);
+    ++m_stats.numDispatches;
+    ++m_stats.numMeshes;
+}
+
+MorphTargetAnimationPass::KeyframeSelection MorphTargetAnimationPass::selectKeyframes(
+    const uint32_t morphTargetSize,
+    const float animationTimestampPerFrame,
+    const bool enableDebugOverride,
+    const uint32_t overrideKeyFrameIndex,
+    const float overrideKeyFrameWeight,
+    const float animationSmoothingFactor)
+{
     // Calculate morph target buffers that are needed for interpolation
-    const uint32_t morphTargetSize = mesh->buffers->morphTargetBufferRange.size();
     const float totalAnimationTime = (morphTargetSize - 1) * animationTimestampPerFrame;
     const float adjustedTotalAnimationTime = totalAnimationTime + animationSmoothingFactor * animationTimestampPerFrame;
     m_totalTime *= m_prevAnimationTimestampPerFrame != 0.0f ?
@@ -152,10 +353,9 @@ void MorphTargetAnimationPass::Dispatch(
         keyFrameIndex = overrideKeyFrameIndex % morphTargetSize;
     }
 
-    // All morph target buffer data are packed into a single buffer 'morphTargetDataBuffer', so we don't need to upload data every frame.
-    // Instead, we calculate the 2 keyframes we need, and use buffer range to bind to the animation shader.
-    const auto& morphTargetBufferKeyframeRange = mesh->buffers->morphTargetBufferRange[keyFrameIndex];
-    const auto& morphTargetBufferNextKeyframeRange = mesh->buffers->morphTargetBufferRange[(keyFrameIndex + 1) % morphTargetSize];
+    KeyframeSelection keyframeSelection;
+    keyframeSelection.keyFrameIndex = keyFrameIndex;
+    keyframeSelection.nextKeyFrameIndex = (keyFrameIndex + 1) % morphTargetSize;
 
     // Slow down last frame to avoid flickering
     float adjustedAnimationTimestampPerFrame = animationTimestampPerFrame;
@@ -168,55 +368,263 @@ void MorphTargetAnimationPass::Dispatch(
         adjustedAnimationTimestampPerFrame *= 1;
     }
 
-    // Update CB
-    MorphTargetConstants morphTargetConstants = {};
-    morphTargetConstants.vertexCount = morphTargetResources.vertexSize;
-    morphTargetConstants.lerpWeight = !enableDebugOverride ?
+    keyframeSelection.lerpWeight = !enableDebugOverride ?
         saturate((m_totalTime - keyFrameIndex * animationTimestampPerFrame) / adjustedAnimationTimestampPerFrame) :
         saturate(overrideKeyFrameWeight);
 
-    if (morphTargetConstants.lerpWeight < 0.0f || morphTargetConstants.lerpWeight > 1.0f)
+    if (keyframeSelection.lerpWeight < 0.0f || keyframeSelection.lerpWeight > 1.0f)
     {
         donut::log::warning("Morph Target interpolation weight must be in the range between 0 and 1.");
     }
 
-    commandList->beginTrackingBufferState(morphTargetResources.morphTargetConstantBuffer, nvrhi::ResourceStates::Common);
-    commandList->writeBuffer(morphTargetResources.morphTargetConstantBuffer, &morphTargetConstants, sizeof(morphTargetConstants));
+    m_prevAnimationTimestampPerFrame = animationTimestampPerFrame;
+    while (m_totalTime > adjustedTotalAnimationTime)
+    {
+        m_totalTime -= adjustedTotalAnimationTime;
+    }
+
+    return keyframeSelection;
+}
+
+void MorphTargetAnimationPass::DispatchBatched(
+    const std::vector<std::shared_ptr<donut::engine::MeshInfo>>& meshes,
+    nvrhi::CommandListHandle commandList,
+    const std::vector<ResourceManager::MorphTargetResources>& morphTargetResources,
+    const TessellationType tessellationType,
+    const float animationTimestampPerFrame,
+    const bool enableDebugOverride,
+    const uint32_t overrideKeyFrameIndex,
+    const float overrideKeyFrameWeight,
+    const float animationSmoothingFactor,
+    const bool perSegmentKernel)
+{
+    ScopedMarker scopedMarker(commandList, "Morph Target Animation Batched");
 
-    commandList->beginTrackingBufferState(morphTargetResources.morphTargetDataBuffer, nvrhi::ResourceStates::Common);
-    commandList->setBufferState(morphTargetResources.morphTargetDataBuffer, nvrhi::ResourceStates::ShaderResource);
+    const uint32_t perSegment = (perSegmentKernel && tessellationType != TessellationType::LinearSweptSphere) ? 1 : 0;
+    const uint32_t shaderTessellationType = getShaderTessellationType(tessellationType);
+    ++m_batchFrameIndex;
+
+    // Mesh table, the animation clock advances per mesh in the same order as in Dispatch.
+    // The keyframe format is a shader variant, it's the same for all meshes and taken from the first one.
+    uint32_t keyframeFormat = RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_COUNT;
+    m_batchMeshes.clear();
+    for (uint32_t meshIndex = 0; meshIndex < meshes.size() && meshIndex < morphTargetResources.size(); ++meshIndex)
+    {
+        const auto& mesh = meshes[meshIndex];
+        const auto& resources = morphTargetResources[meshIndex];
+        if (resources.vertexSize == 0)
+        {
+            // Not a morph target animation resource
+            continue;
+        }
+
+        if (keyframeFormat == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_COUNT)
+        {
+            keyframeFormat = resources.keyframeFormat;
+        }
+        else if (resources.keyframeFormat != keyframeFormat)
+        {
+            donut::log::warning("Morph target batch: mesh %s has a different keyframe format, skipped", mesh->name.c_str());
+            continue;
+        }
+        const uint32_t keyframeStride = getKeyframeStride(keyframeFormat);
+
+        const KeyframeSelection keyframeSelection = selectKeyframes(
+            mesh->buffers->morphTargetBufferRange.size(),
+            animationTimestampPerFrame,
+            enableDebugOverride,
+            overrideKeyFrameIndex,
+            overrideKeyFrameWeight,
+            animationSmoothingFactor);
+        m_keyframePositions[mesh.get()] = (float)keyframeSelection.keyFrameIndex + keyframeSelection.lerpWeight;
+
+        // Descriptor table resources aren't tracked by the binding set, a ring tracks its own buffer
+        nvrhi::BufferRange keyframeRange = resources.keyframeRanges[keyframeSelection.keyFrameIndex];
+        nvrhi::BufferRange nextKeyframeRange = resources.keyframeRanges[keyframeSelection.nextKeyFrameIndex];
+        if (resources.keyframeRing)
+        {
+            const MorphTargetKeyframeRing::FrameStats ringStats = resources.keyframeRing->acquire(commandList,
+                keyframeSelection.keyFrameIndex, keyframeSelection.nextKeyFrameIndex, keyframeRange, nextKeyframeRange);
+            m_stats.numKeyframeUploads += ringStats.numUploads;
+            m_stats.numKeyframeStalls += ringStats.numStalls;
+        }
+        else
+        {
+            commandList->beginTrackingBufferState(resources.morphTargetDataBuffer, nvrhi::ResourceStates::Common);
+            commandList->setBufferState(resources.morphTargetDataBuffer, nvrhi::ResourceStates::ShaderResource);
+        }
+
+        MorphTargetBatchMesh batchMesh = {};
+        batchMesh.vertexCount = resources.vertexSize;
+        batchMesh.polyTubeOrder = resources.polyTubeOrder;
+        batchMesh.keyframeOffset = (uint32_t)(keyframeRange.byteOffset / keyframeStride);
+        batchMesh.nextKeyframeOffset = (uint32_t)(nextKeyframeRange.byteOffset / keyframeStride);
+        batchMesh.keyframeIndex = keyframeSelection.keyFrameIndex;
+        batchMesh.nextKeyframeIndex = keyframeSelection.nextKeyFrameIndex;
+        batchMesh.keyframeComponentCount = resources.keyframeComponentCount;
+        batchMesh.lerpWeight = keyframeSelection.lerpWeight;
+        batchMesh.lssSuccessiveImplicit =
+            (tessellationType == TessellationType::LinearSweptSphere && !mesh->geometries.empty() && mesh->geometries[0]->numIndices > 0) ? 1 : 0;
+
+        batchMesh.keyframeDescriptorIndex = getBatchDescriptorIndex(nvrhi::BindingSetItem::StructuredBuffer_SRV(0, resources.morphTargetDataBuffer));
+        if (resources.keyframeParameterBuffer)
+        {
+            batchMesh.keyframeParameterDescriptorIndex = getBatchDescriptorIndex(nvrhi::BindingSetItem::StructuredBuffer_SRV(0, resources.keyframeParameterBuffer));
+        }
+        batchMesh.compactLineSegments = resources.compactLineSegments ? 1 : 0;
+        batchMesh.lineSegmentsDescriptorIndex = getBatchDescriptorIndex(nvrhi::BindingSetItem::StructuredBuffer_SRV(0, resources.lineSegmentsBuffer));
+        if (resources.compactLineSegments)
+        {
+            batchMesh.lineSegmentBoundsDescriptorIndex = getBatchDescriptorIndex(nvrhi::BindingSetItem::StructuredBuffer_SRV(0, resources.lineSegmentBoundsBuffer));
+        }
+
+        // The vertex buffer is swapped every frame, both of them end up with a descriptor
+        batchMesh.vertexBufferDescriptorIndex = getBatchDescriptorIndex(nvrhi::BindingSetItem::RawBuffer_UAV(0, mesh->buffers->vertexBuffer));
+        batchMesh.positionByteOffset = (uint32_t)mesh->buffers->getVertexBufferRange(VertexAttribute::Position).byteOffset;
+        batchMesh.normalByteOffset = (uint32_t)mesh->buffers->getVertexBufferRange(VertexAttribute::Normal).byteOffset;
+        batchMesh.tangentByteOffset = (uint32_t)mesh->buffers->getVertexBufferRange(VertexAttribute::Tangent).byteOffset;
+
+        batchMesh.numThreads = MorphTargetBatch::getMeshThreadCount(batchMesh, shaderTessellationType, perSegment != 0);
+        m_batchMeshes.push_back(batchMesh);
+
+        commandList->beginTrackingBufferState(mesh->buffers->vertexBuffer, nvrhi::ResourceStates::UnorderedAccess);
+    }
     commandList->commitBarriers();
 
-    commandList->beginTrackingBufferState(mesh->buffers->vertexBuffer, nvrhi::ResourceStates::UnorderedAccess);
+    // Release the descriptors of buffers that are gone, e.g. after the morph target buffers were recreated
+    for (auto it = m_batchDescriptors.begin(); it != m_batchDescriptors.end();)
+    {
+        if (it->second.lastUsedFrame + kBatchDescriptorRetainFrames < m_batchFrameIndex)
+        {
+            it = m_batchDescriptors.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
 
-    nvrhi::BindingSetDesc bindingSetDesc;
-    bindingSetDesc.bindings = {
-        nvrhi::BindingSetItem::ConstantBuffer(0, morphTargetResources.morphTargetConstantBuffer),
-        nvrhi::BindingSetItem::StructuredBuffer_SRV(0, morphTargetResources.morphTargetDataBuffer, nvrhi::Format::UNKNOWN, morphTargetBufferKeyframeRange),
-        nvrhi::BindingSetItem::StructuredBuffer_SRV(1, morphTargetResources.morphTargetDataBuffer, nvrhi::Format::UNKNOWN, morphTargetBufferNextKeyframeRange),
-        nvrhi::BindingSetItem::StructuredBuffer_SRV(2, morphTargetResources.lineSegmentsBuffer),
-        nvrhi::BindingSetItem::RawBuffer_UAV(0, mesh->buffers->vertexBuffer, positionBufferRange),
-        nvrhi::BindingSetItem::RawBuffer_UAV(1, mesh->buffers->vertexBuffer, normalBufferRange),
-        nvrhi::BindingSetItem::RawBuffer_UAV(2, mesh->buffers->vertexBuffer, tangentBufferRange),
-    };
-    // Index buffer data are cleared in CurveTessellation when using LSS geometry mode, as index buffers are not currently supported for LSS.
-    if (tessellationType != TessellationType::LinearSweptSphere)
+    const uint32_t numThreads = MorphTargetBatch::assignThreadRanges(m_batchMeshes);
+    if (numThreads == 0)
     {
-        bindingSetDesc.bindings.push_back(nvrhi::BindingSetItem::RawBuffer_SRV(3, mesh->buffers->indexBuffer));
+        return;
+    }
+
+    if (!m_batchPso[keyframeFormat][perSegment])
+    {
+        nvrhi::ComputePipelineDesc pipelineDesc;
+        pipelineDesc.CS = m_batchShaders[(uint32_t)tessellationType][keyframeFormat][perSegment];
+        pipelineDesc.addBindingLayout(m_batchBindingLayout);
+        pipelineDesc.addBindingLayout(m_batchBindlessLayout);
+        m_batchPso[keyframeFormat][perSegment] = m_device->createComputePipeline(pipelineDesc);
+    }
+
+    // The binding set only refers to the constants and the mesh table, it's recreated when the mesh table grows
+    if (m_batchMeshes.size() > m_batchMeshCapacity || !m_batchBindingSet)
+    {
+        createBatchBuffers(std::max((uint32_t)m_batchMeshes.size(), m_batchMeshCapacity));
+
+        nvrhi::BindingSetDesc bindingSetDesc;
+        bindingSetDesc.bindings = {
+            nvrhi::BindingSetItem::ConstantBuffer(0, m_batchConstantBuffer),
+            nvrhi::BindingSetItem::StructuredBuffer_SRV(0, m_batchMeshTableBuffer),
+        };
+        m_batchBindingSet = m_device->createBindingSet(bindingSetDesc, m_batchBindingLayout);
+        ++m_stats.numBindingSetsCreated;
     }
 
-    m_bindingSet = m_device->createBindingSet(bindingSetDesc, m_bindingLayout);
+    MorphTargetBatchConstants batchConstants = {};
+    batchConstants.numMeshes = (uint32_t)m_batchMeshes.size();
+    batchConstants.numThreads = numThreads;
+    commandList->beginTrackingBufferState(m_batchConstantBuffer, nvrhi::ResourceStates::Common);
+    commandList->writeBuffer(m_batchConstantBuffer, &batchConstants, sizeof(batchConstants));
+    commandList->writeBuffer(m_batchMeshTableBuffer, m_batchMeshes.data(), m_batchMeshes.size() * sizeof(MorphTargetBatchMesh));
 
     nvrhi::ComputeState state;
-    state.setPipeline(m_pso);
-    state.addBindingSet(m_bindingSet);
+    state.setPipeline(m_batchPso[keyframeFormat][perSegment]);
+    state.addBindingSet(m_batchBindingSet);
+    state.addBindingSet(m_batchDescriptorTable->GetDescriptorTable());
 
     commandList->setComputeState(state);
-    commandList->dispatch((morphTargetResources.vertexSize - 1) / 32 + 1);
+    commandList->dispatch((numThreads + RTXCR_MORPH_TARGET_THREAD_GROUP_SIZE - 1) / RTXCR_MORPH_TARGET_THREAD_GROUP_SIZE);
+    ++m_stats.numDispatches;
+    m_stats.numMeshes += (uint32_t)m_batchMeshes.size();
+}
 
-    m_prevAnimationTimestampPerFrame = animationTimestampPerFrame;
-    while (m_totalTime > adjustedTotalAnimationTime)
+uint32_t MorphTargetAnimationPass::getBatchDescriptorIndex(const nvrhi::BindingSetItem& item)
+{
+    BatchDescriptor& batchDescriptor = m_batchDescriptors[item.resourceHandle];
+    if (!batchDescriptor.descriptor.IsValid())
     {
-        m_totalTime -= adjustedTotalAnimationTime;
+        batchDescriptor.resource = item.resourceHandle;
+        batchDescriptor.descriptor = m_batchDescriptorTable->CreateDescriptorHandle(item);
+        ++m_stats.numDescriptorsCreated;
     }
+    batchDescriptor.lastUsedFrame = m_batchFrameIndex;
+    return (uint32_t)batchDescriptor.descriptor.Get();
+}
+
+void MorphTargetAnimationPass::createBatchBuffers(const uint32_t meshCapacity)
+{
+    if (!m_batchConstantBuffer)
+    {
+        m_batchConstantBuffer = m_device->createBuffer(nvrhi::utils::CreateStaticConstantBufferDesc(
+            sizeof(MorphTargetBatchConstants), "MorphTargetBatchConstants"));
+    }
+
+    if (meshCapacity > m_batchMeshCapacity || !m_batchMeshTableBuffer)
+    {
+        nvrhi::BufferDesc bufferDesc;
+        bufferDesc.byteSize = sizeof(MorphTargetBatchMesh) * std::max(meshCapacity, 1u);
+        bufferDesc.structStride = sizeof(MorphTargetBatchMesh);
+        bufferDesc.debugName = "Morph Target Batch Mesh Table";
+        bufferDesc.initialState = nvrhi::ResourceStates::ShaderResource;
+        bufferDesc.keepInitialState = true;
+        m_batchMeshTableBuffer = m_device->createBuffer(bufferDesc);
+        m_batchMeshCapacity = std::max(meshCapacity, 1u);
+    }
+}
+
+void MorphTargetAnimationPass::BeginFrame(nvrhi::CommandListHandle commandList)
+{
+    m_frameStartTime = std::chrono::high_resolution_clock::now();
+
+    // The GPU time is kept until a newer query finished
+    const double gpuTimeMs = m_stats.gpuTimeMs;
+    m_stats = {};
+    m_stats.gpuTimeMs = gpuTimeMs;
+
+    // Reuse the oldest query once it finished, skip timing this frame otherwise
+    m_timerQueryIndex = (m_timerQueryIndex + 1) % kTimerQueryCount;
+    nvrhi::ITimerQuery* const timerQuery = m_timerQueries[m_timerQueryIndex];
+    m_timerQueryActive = false;
+    if (!timerQuery)
+    {
+        return;
+    }
+    if (m_timerQueryPending[m_timerQueryIndex])
+    {
+        if (!m_device->pollTimerQuery(timerQuery))
+        {
+            return;
+        }
+        m_stats.gpuTimeMs = m_device->getTimerQueryTime(timerQuery) * 1000.0;
+        m_device->resetTimerQuery(timerQuery);
+        m_timerQueryPending[m_timerQueryIndex] = false;
+    }
+
+    commandList->beginTimerQuery(timerQuery);
+    m_timerQueryActive = true;
+}
+
+void MorphTargetAnimationPass::EndFrame(nvrhi::CommandListHandle commandList)
+{
+    if (m_timerQueryActive)
+    {
+        commandList->endTimerQuery(m_timerQueries[m_timerQueryIndex]);
+        m_timerQueryPending[m_timerQueryIndex] = true;
+        m_timerQueryActive = false;
+    }
+
+    m_stats.cpuTimeMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - m_frameStartTime).count();
 }
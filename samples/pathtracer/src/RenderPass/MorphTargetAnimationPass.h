@@ -10,15 +10,33 @@
 
 #pragma once
 
+#include <chrono>
+#include <unordered_map>
 #include <nvrhi/nvrhi.h>
 #include <donut/engine/ShaderFactory.h>
 #include <donut/engine/CommonRenderPasses.h>
+#include <donut/engine/DescriptorTableManager.h>
 #include <donut/engine/View.h>
 
 #include "../ResourceManager.h"
+#include "MorphTargetBatch.h"
+#include "../shared/keyframeEncoding.h"
 
 class SampleScene;
 
+// Per frame counters of the morph target animation, between BeginFrame and EndFrame
+struct MorphTargetAnimationStats
+{
+    uint32_t numMeshes = 0;
+    uint32_t numDispatches = 0;
+    uint32_t numBindingSetsCreated = 0;
+    uint32_t numDescriptorsCreated = 0; // Batch descriptor table entries written
+    uint32_t numKeyframeUploads = 0;    // Streamed keyframes uploaded to their rings
+    uint32_t numKeyframeStalls = 0;     // Streamed keyframes the render thread had to read itself
+    double cpuTimeMs = 0.0;             // Command recording
+    double gpuTimeMs = 0.0;             // Timer query of an earlier frame, the latest one that finished
+};
+
 class MorphTargetAnimationPass
 {
 public:
@@ -42,26 +60,122 @@ public:
         const bool enableDebugOverride,
         const uint32_t overrideKeyFrameIndex,
         const float overrideKeyFrameWeight,
-        const float animationSmoothingFactor);
+        const float animationSmoothingFactor,
+        const bool perSegmentKernel);
+
+    // Animates all meshes with one dispatch, meshes and morphTargetResources are indexed like in Dispatch.
+    // The resources of the meshes are reached through the batch descriptor table, a descriptor is written
+    // the first time a buffer is seen, so the binding set only changes when the mesh table outgrows its buffer.
+    void DispatchBatched(
+        const std::vector<std::shared_ptr<donut::engine::MeshInfo>>& meshes,
+        nvrhi::CommandListHandle commandList,
+        const std::vector<ResourceManager::MorphTargetResources>& morphTargetResources,
+        const TessellationType tessellationType,
+        const float animationTimestampPerFrame,
+        const bool enableDebugOverride,
+        const uint32_t overrideKeyFrameIndex,
+        const float overrideKeyFrameWeight,
+        const float animationSmoothingFactor,
+        const bool perSegmentKernel);
 
-    void CleanComputePipeline() { m_pso = nullptr; }
+    // Timing counter around the dispatches of a frame
+    void BeginFrame(nvrhi::CommandListHandle commandList);
+    void EndFrame(nvrhi::CommandListHandle commandList);
+    inline const MorphTargetAnimationStats& GetStats() const { return m_stats; }
+    // Keyframe index plus the weight to the next keyframe of every mesh at its last dispatch
+    inline const std::unordered_map<const donut::engine::MeshInfo*, float>& GetKeyframePositions() const { return m_keyframePositions; }
+
+    void CleanComputePipeline()
+    {
+        for (auto& formatPso : m_pso)
+        {
+            for (auto& pso : formatPso)
+            {
+                pso[0] = nullptr;
+                pso[1] = nullptr;
+            }
+        }
+        for (auto& pso : m_batchPso)
+        {
+            pso[0] = nullptr;
+            pso[1] = nullptr;
+        }
+    }
 
     inline void ResetAnimation()
     {
         m_totalTime = 0.0f;
         m_prevAnimationTimestampPerFrame = 0.0f;
+        m_keyframePositions.clear();
     }
 
 private:
+    struct KeyframeSelection
+    {
+        uint32_t keyFrameIndex = 0;
+        uint32_t nextKeyFrameIndex = 0;
+        float lerpWeight = 0.0f;
+    };
+
+    // Advances the animation clock of one mesh, called once per mesh and frame in mesh order
+    KeyframeSelection selectKeyframes(
+        const uint32_t morphTargetSize,
+        const float animationTimestampPerFrame,
+        const bool enableDebugOverride,
+        const uint32_t overrideKeyFrameIndex,
+        const float overrideKeyFrameWeight,
+        const float animationSmoothingFactor);
+
+    // Descriptor of the resource of item in the batch descriptor table, written on first use
+    uint32_t getBatchDescriptorIndex(const nvrhi::BindingSetItem& item);
+    void createBatchBuffers(const uint32_t meshCapacity);
+
     void createShaders();
 
     nvrhi::IDevice* const m_device;
     std::shared_ptr<donut::engine::ShaderFactory> m_shaderFactory;
 
-    nvrhi::ComputePipelineHandle m_pso;
-    nvrhi::BindingLayoutHandle m_bindingLayout;
+    // [keyframeFormat][compactLineSegments][perSegment]: keyframe format, full and compact line segment format,
+    // one thread per vertex or per line segment
+    nvrhi::ComputePipelineHandle m_pso[RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_COUNT][2][2];
+    // [compactLineSegments][keyframeParameters]
+    nvrhi::BindingLayoutHandle m_bindingLayout[2][2];
     nvrhi::BindingSetHandle m_bindingSet;
-    nvrhi::ShaderHandle m_shaders[(uint32_t)TessellationType::Count];
+    nvrhi::ShaderHandle m_shaders[(uint32_t)TessellationType::Count][RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_COUNT][2][2];
+
+    // Batched dispatch, [keyframeFormat][perSegment]
+    nvrhi::ComputePipelineHandle m_batchPso[RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_COUNT][2];
+    nvrhi::ShaderHandle m_batchShaders[(uint32_t)TessellationType::Count][RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_COUNT][2];
+    nvrhi::BindingLayoutHandle m_batchBindingLayout;
+    nvrhi::BindingLayoutHandle m_batchBindlessLayout;
+    nvrhi::BindingSetHandle m_batchBindingSet;
+    std::shared_ptr<donut::engine::DescriptorTableManager> m_batchDescriptorTable;
+    nvrhi::BufferHandle m_batchConstantBuffer;
+    nvrhi::BufferHandle m_batchMeshTableBuffer;
+    uint32_t m_batchMeshCapacity = 0;
+    std::vector<MorphTargetBatchMesh> m_batchMeshes;
+
+    struct BatchDescriptor
+    {
+        nvrhi::ResourceHandle resource;
+        donut::engine::DescriptorHandle descriptor;
+        uint64_t lastUsedFrame = 0;
+    };
+    // Keyed by resource. Descriptors unused for kBatchDescriptorRetainFrames frames are released,
+    // the double buffered morph target vertex buffers alternate every frame.
+    static constexpr uint64_t kBatchDescriptorRetainFrames = 8;
+    std::unordered_map<nvrhi::IResource*, BatchDescriptor> m_batchDescriptors;
+    uint64_t m_batchFrameIndex = 0;
+
+    // Timer queries of the last frames, one is read back per frame when it finished
+    static constexpr uint32_t kTimerQueryCount = 4;
+    nvrhi::TimerQueryHandle m_timerQueries[kTimerQueryCount];
+    bool m_timerQueryPending[kTimerQueryCount] = {};
+    uint32_t m_timerQueryIndex = 0;
+    bool m_timerQueryActive = false;
+    std::chrono::high_resolution_clock::time_point m_frameStartTime;
+    MorphTargetAnimationStats m_stats;
+    std::unordered_map<const donut::engine::MeshInfo*, float> m_keyframePositions;
 
     float m_totalTime;
     float m_prevAnimationTimestampPerFrame;
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <donut/core/log.h>
+
+#include "MorphTargetBatch.h"
+
+namespace MorphTargetBatch
+{
+namespace
+{
+    uint32_t getVerticesPerLineSegment(const MorphTargetBatchMesh& mesh, const uint32_t tessellationType)
+    {
+        switch (tessellationType)
+        {
+        case RTXCR_CURVE_TESSELLATION_TYPE_POLYTUBE:
+            return mesh.polyTubeOrder * 6;
+        case RTXCR_CURVE_TESSELLATION_TYPE_DOTS:
+            return 2 * 6;
+        default:
+            // LSS: one vertex per segment end point
+            return 2;
+        }
+    }
+
+    bool isInside(const uint64_t offset, const uint64_t count, const uint64_t size)
+    {
+        return offset + count <= size;
+    }
+} // namespace
+
+uint32_t getMeshThreadCount(const MorphTargetBatchMesh& mesh, const uint32_t tessellationType, const bool perSegment)
+{
+    if (mesh.vertexCount <= 0)
+    {
+        return 0;
+    }
+
+    if (perSegment && tessellationType != RTXCR_CURVE_TESSELLATION_TYPE_LSS)
+    {
+        return (uint32_t)mesh.vertexCount / getVerticesPerLineSegment(mesh, tessellationType);
+    }
+
+    return (uint32_t)mesh.vertexCount;
+}
+
+uint32_t assignThreadRanges(std::vector<MorphTargetBatchMesh>& meshes)
+{
+    uint32_t numThreads = 0;
+    for (auto& mesh : meshes)
+    {
+        mesh.firstThread = numThreads;
+        numThreads += mesh.numThreads;
+    }
+    return numThreads;
+}
+
+uint32_t findMesh(const std::vector<MorphTargetBatchMesh>& meshes, const uint32_t threadIndex)
+{
+    if (meshes.empty() || threadIndex >= meshes.back().firstThread + meshes.back().numThreads)
+    {
+        return (uint32_t)meshes.size();
+    }
+
+    // Same search as findBatchMesh in morphTargetAnimation.cs.hlsl: the last entry with firstThread <= threadIndex.
+    // Meshes without threads share firstThread with the next mesh and are skipped.
+    uint32_t first = 0;
+    uint32_t count = (uint32_t)meshes.size();
+    while (count > 0)
+    {
+        const uint32_t step = count / 2;
+        if (meshes[first + step].firstThread <= threadIndex)
+        {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+    return first - 1;
+}
+
+bool validate(
+    const std::vector<MorphTargetBatchMesh>& meshes,
+    const std::vector<MeshResourceSizes>& meshResourceSizes,
+    const uint32_t numThreads,
+    const uint32_t tessellationType,
+    const bool perSegment)
+{
+    if (meshes.size() != meshResourceSizes.size())
+    {
+        donut::log::warning("Morph target batch: %zu meshes but %zu resource sizes", meshes.size(), meshResourceSizes.size());
+        return false;
+    }
+
+    uint32_t nextThread = 0;
+    for (uint32_t meshIndex = 0; meshIndex < meshes.size(); ++meshIndex)
+    {
+        const MorphTargetBatchMesh& mesh = meshes[meshIndex];
+        const MeshResourceSizes& sizes = meshResourceSizes[meshIndex];
+
+        // Thread ranges
+        if (mesh.firstThread != nextThread || mesh.numThreads != getMeshThreadCount(mesh, tessellationType, perSegment))
+        {
+            donut::log::warning("Morph target batch: mesh %u has threads [%u, %u), expected [%u, %u)",
+                                meshIndex, mesh.firstThread, mesh.firstThread + mesh.numThreads,
+                                nextThread, nextThread + getMeshThreadCount(mesh, tessellationType, perSegment));
+            return false;
+        }
+        nextThread += mesh.numThreads;
+
+        if (mesh.numThreads == 0)
+        {
+            continue;
+        }
+
+        if (findMesh(meshes, mesh.firstThread) != meshIndex || findMesh(meshes, mesh.firstThread + mesh.numThreads - 1) != meshIndex)
+        {
+            donut::log::warning("Morph target batch: threads of mesh %u map to meshes %u and %u", meshIndex,
+                                findMesh(meshes, mesh.firstThread), findMesh(meshes, mesh.firstThread + mesh.numThreads - 1));
+            return false;
+        }
+
+        // Reads: both keyframes of every strand point and their parameters, every line segment and its bounds.
+        // With the PCA format both keyframes are the basis, componentCount vectors and coefficients per strand point and keyframe.
+        const uint32_t lineSegmentCount = (uint32_t)mesh.vertexCount / getVerticesPerLineSegment(mesh, tessellationType);
+        const uint64_t keyframeElementCount = (uint64_t)sizes.keyframeVertexCount * std::max(mesh.keyframeComponentCount, 1u);
+        const uint64_t keyframeParameterCount = std::max(mesh.keyframeComponentCount, 1u);
+        if (!isInside(mesh.keyframeOffset, keyframeElementCount, sizes.keyframeElementCount) ||
+            !isInside(mesh.nextKeyframeOffset, keyframeElementCount, sizes.keyframeElementCount) ||
+            (sizes.keyframeParameterCount != 0 &&
+             (!isInside(mesh.keyframeIndex * keyframeParameterCount, keyframeParameterCount, sizes.keyframeParameterCount) ||
+              !isInside(mesh.nextKeyframeIndex * keyframeParameterCount, keyframeParameterCount, sizes.keyframeParameterCount))) ||
+            lineSegmentCount > sizes.lineSegmentCount ||
+            (mesh.compactLineSegments != 0 && sizes.lineSegmentBoundsCount == 0))
+        {
+            donut::log::warning("Morph target batch: mesh %u reads past its keyframes or line segments", meshIndex);
+            return false;
+        }
+
+        // Writes: positions, and normals and tangents of the triangle representations
+        const bool lss = (tessellationType == RTXCR_CURVE_TESSELLATION_TYPE_LSS);
+        const uint32_t outputVertexCount = (lss && mesh.lssSuccessiveImplicit != 0) ? sizes.keyframeVertexCount : (uint32_t)mesh.vertexCount;
+        if (!isInside(mesh.positionByteOffset, 3ull * sizeof(float) * outputVertexCount, sizes.vertexBufferByteSize) ||
+            (!lss && !isInside(mesh.normalByteOffset, sizeof(uint32_t) * outputVertexCount, sizes.vertexBufferByteSize)) ||
+            (!lss && !isInside(mesh.tangentByteOffset, sizeof(uint32_t) * outputVertexCount, sizes.vertexBufferByteSize)))
+        {
+            donut::log::warning("Morph target batch: mesh %u writes past its vertex buffer", meshIndex);
+            return false;
+        }
+    }
+
+    if (nextThread != numThreads || findMesh(meshes, numThreads) != meshes.size())
+    {
+        donut::log::warning("Morph target batch: %u threads dispatched for %u mesh threads", numThreads, nextThread);
+        return false;
+    }
+
+    return true;
+}
+} // namespace MorphTargetBatch
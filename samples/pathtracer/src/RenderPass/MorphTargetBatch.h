@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <donut/core/math/math.h>
+
+#include "../shared/shared.h"
+
+// Mesh table of the batched morph target dispatch.
+// Every animated mesh gets a contiguous range of dispatch threads laid out like its own unbatched dispatch,
+// a thread finds its mesh with the binary search of findMesh, which the shader mirrors.
+namespace MorphTargetBatch
+{
+    // Sizes of the resources the table refers to, in elements
+    struct MeshResourceSizes
+    {
+        uint32_t keyframeElementCount = 0;      // Strand point entries of the keyframe buffer, in the keyframe format of the mesh
+        uint32_t keyframeVertexCount = 0;       // Strand points per keyframe
+        uint32_t keyframeParameterCount = 0;    // Compressed keyframe formats only: quantization entries or PCA coefficients
+        uint32_t lineSegmentCount = 0;
+        uint32_t lineSegmentBoundsCount = 0;    // Compact line segments only
+        uint32_t vertexBufferByteSize = 0;
+    };
+
+    // Threads of the unbatched dispatch of the mesh: one per line segment with the per segment kernel, otherwise one per vertex.
+    // tessellationType is RTXCR_CURVE_TESSELLATION_TYPE_*, perSegment is ignored for LSS.
+    uint32_t getMeshThreadCount(const MorphTargetBatchMesh& mesh, const uint32_t tessellationType, const bool perSegment);
+
+    // Assigns firstThread in table order, numThreads must be set. Returns the thread count of the dispatch.
+    uint32_t assignThreadRanges(std::vector<MorphTargetBatchMesh>& meshes);
+
+    // Table entry of a dispatch thread, meshes.size() if the thread is past the last mesh
+    uint32_t findMesh(const std::vector<MorphTargetBatchMesh>& meshes, const uint32_t threadIndex);
+
+    // Checks the thread ranges, the thread to mesh mapping and that every read and write of the kernel stays inside the
+    // resources of its mesh. Logs the first error and returns false.
+    bool validate(
+        const std::vector<MorphTargetBatchMesh>& meshes,
+        const std::vector<MeshResourceSizes>& meshResourceSizes,
+        const uint32_t numThreads,
+        const uint32_t tessellationType,
+        const bool perSegment);
+}
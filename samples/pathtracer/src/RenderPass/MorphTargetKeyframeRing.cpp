@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <donut/core/log.h>
+
+#include "MorphTargetKeyframeRing.h"
+
+MorphTargetKeyframeRing::MorphTargetKeyframeRing(
+    nvrhi::IDevice* const device,
+    std::shared_ptr<const MorphTargetKeyframeFile> file,
+    const std::filesystem::path& filePath,
+    const uint32_t slotCount,
+    const std::string& name)
+: m_file(std::move(file))
+, m_filePath(filePath)
+{
+    m_window.reset(m_file->getKeyframeCount(), slotCount);
+
+    nvrhi::BufferDesc bufferDesc = {};
+    bufferDesc.byteSize = m_file->getKeyframeByteSize() * m_window.getSlotCount();
+    bufferDesc.structStride = getKeyframeStride(m_file->getFormat());
+    bufferDesc.debugName = name;
+    bufferDesc.canHaveTypedViews = true;
+    bufferDesc.canHaveRawViews = true;
+    bufferDesc.initialState = nvrhi::ResourceStates::ShaderResource | nvrhi::ResourceStates::CopyDest;
+    m_buffer = device->createBuffer(bufferDesc);
+
+    m_reader = std::make_unique<MorphTargetKeyframeReader>(m_file);
+}
+
+MorphTargetKeyframeRing::~MorphTargetKeyframeRing()
+{
+    // The reader thread reads from the mapping, the mapping must be closed before the file can be removed
+    m_reader.reset();
+    m_file.reset();
+
+    std::error_code error;
+    std::filesystem::remove(m_filePath, error);
+}
+
+nvrhi::BufferRange MorphTargetKeyframeRing::getSlotRange(const uint32_t slot) const
+{
+    nvrhi::BufferRange range;
+    range.byteOffset = slot * m_file->getKeyframeByteSize();
+    range.byteSize = m_file->getKeyframeByteSize();
+    return range;
+}
+
+MorphTargetKeyframeRing::FrameStats MorphTargetKeyframeRing::acquire(
+    nvrhi::ICommandList* const commandList,
+    const uint32_t keyframe,
+    const uint32_t nextKeyframe,
+    nvrhi::BufferRange& keyframeRange,
+    nvrhi::BufferRange& nextKeyframeRange)
+{
+    FrameStats frameStats;
+    commandList->beginTrackingBufferState(m_buffer, nvrhi::ResourceStates::Common);
+
+    // Reads of slots that were reassigned since their request are dropped by the window
+    m_completed.clear();
+    m_reader->collect(m_completed);
+    for (const auto& completed : m_completed)
+    {
+        if (m_window.complete(completed.load))
+        {
+            commandList->writeBuffer(m_buffer, completed.data.data(), completed.data.size(), getSlotRange(completed.load.slot).byteOffset);
+            ++frameStats.numUploads;
+        }
+    }
+
+    m_loads.clear();
+    m_window.update(keyframe, nextKeyframe, m_loads);
+    for (const auto& load : m_loads)
+    {
+        if (load.required)
+        {
+            m_reader->read(load.keyframe, m_requiredKeyframe);
+            if (m_window.complete(load))
+            {
+                commandList->writeBuffer(m_buffer, m_requiredKeyframe.data(), m_requiredKeyframe.size(), getSlotRange(load.slot).byteOffset);
+                ++frameStats.numUploads;
+                ++frameStats.numStalls;
+            }
+        }
+        else
+        {
+            m_reader->request(load);
+        }
+    }
+
+    keyframeRange = getSlotRange(m_window.getResidentSlot(keyframe));
+    nextKeyframeRange = getSlotRange(m_window.getResidentSlot(nextKeyframe));
+
+    commandList->setBufferState(m_buffer, nvrhi::ResourceStates::ShaderResource);
+    return frameStats;
+}
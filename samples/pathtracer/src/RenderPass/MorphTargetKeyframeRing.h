@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <vector>
+#include <nvrhi/nvrhi.h>
+
+#include "../Curve/MorphTargetKeyframeStreaming.h"
+
+// Streamed keyframes of one morph target mesh: a ring of keyframe slots in a GPU buffer, filled from the keyframe file
+// of the mesh by a background reader. The keyframes the animation reads are loaded on the render thread when the
+// reader didn't deliver them in time.
+class MorphTargetKeyframeRing
+{
+public:
+    struct FrameStats
+    {
+        uint32_t numUploads = 0;
+        uint32_t numStalls = 0;     // Keyframes read on the render thread
+    };
+
+    // The file is removed with the ring
+    MorphTargetKeyframeRing(
+        nvrhi::IDevice* const device,
+        std::shared_ptr<const MorphTargetKeyframeFile> file,
+        const std::filesystem::path& filePath,
+        const uint32_t slotCount,
+        const std::string& name);
+
+    ~MorphTargetKeyframeRing();
+
+    MorphTargetKeyframeRing(const MorphTargetKeyframeRing&) = delete;
+    MorphTargetKeyframeRing& operator=(const MorphTargetKeyframeRing&) = delete;
+
+    // Uploads the finished background reads, makes keyframe and nextKeyframe resident and requests the rest of the window.
+    // Returns the ranges of both keyframes in the ring buffer, which is left in the shader resource state.
+    FrameStats acquire(
+        nvrhi::ICommandList* const commandList,
+        const uint32_t keyframe,
+        const uint32_t nextKeyframe,
+        nvrhi::BufferRange& keyframeRange,
+        nvrhi::BufferRange& nextKeyframeRange);
+
+    inline nvrhi::IBuffer* getBuffer() const { return m_buffer; }
+    inline uint32_t getSlotCount() const { return m_window.getSlotCount(); }
+    inline uint64_t getSlotByteSize() const { return m_file->getKeyframeByteSize(); }
+
+private:
+    nvrhi::BufferRange getSlotRange(const uint32_t slot) const;
+
+    std::shared_ptr<const MorphTargetKeyframeFile> m_file;
+    std::filesystem::path m_filePath;
+    nvrhi::BufferHandle m_buffer;
+
+    MorphTargetKeyframeWindow m_window;
+    std::unique_ptr<MorphTargetKeyframeReader> m_reader;
+
+    // Reused every frame
+    std::vector<MorphTargetKeyframeWindow::Load> m_loads;
+    std::vector<MorphTargetKeyframeReader::Completed> m_completed;
+    std::vector<uint8_t> m_requiredKeyframe;
+};
@@ -8,13 +8,19 @@
  * license agreement from NVIDIA CORPORATION is strictly prohibited.
  */
 
+#include <algorithm>
+
 #include <donut/app/ApplicationBase.h>
+#include <donut/core/log.h>
 #include <donut/engine/CommonRenderPasses.h>
 #include <nvrhi/utils.h>
 
 #include "ResourceManager.h"
 #include "SampleScene.h"
 #include "shared.h"
+#include "Curve/CompactLineSegmentEncoder.h"
+#include "Curve/MorphTargetKeyframeEncoder.h"
+#include "RenderPass/MorphTargetKeyframeRing.h"
 
 using namespace donut;
 using namespace donut::math;
@@ -22,6 +28,7 @@ using namespace donut::engine;
 
 #include "../shared/globalCb.h"
 #include "../shared/lightingCb.h"
+#include "../shared/lineSegmentEncoding.h"
 
 ResourceManager::ResourceManager(nvrhi::IDevice* const device,
                                  const uint32_t screenWidth,
@@ -135,6 +142,22 @@ void ResourceManager::CreateMorphTargetBuffers(
     const std::shared_ptr<SampleScene> scene,
     nvrhi::CommandListHandle commandList)
 {
+    // Line segment bytes of all morph target meshes in the full format and in the format actually uploaded
+    size_t fullLineSegmentsBytes = 0;
+    size_t compactLineSegmentsBytes = 0;
+    // Keyframe bytes in the full and the selected format, and the bytes the animation reads per frame: two keyframes per mesh
+    size_t fullKeyframeBytes = 0;
+    size_t keyframeBytes = 0;
+    size_t fullKeyframeFrameBytes = 0;
+    size_t keyframeFrameBytes = 0;
+    float maxKeyframePositionError = 0.0f;
+    double keyframeEncodeTimeMs = 0.0;
+    uint32_t maxKeyframeComponentCount = 0;
+    // Streamed meshes: bytes of their keyframe files and of their rings
+    uint32_t numStreamedMeshes = 0;
+    size_t streamedKeyframeBytes = 0;
+    size_t streamedResidentBytes = 0;
+
     for (const auto& mesh : scene->GetNativeScene()->GetSceneGraph()->GetMeshes())
     {
         const auto& lineSegments = scene->GetCurveTessellation()->GetCurvesLineSegments(mesh->name);
@@ -146,19 +169,89 @@ void ResourceManager::CreateMorphTargetBuffers(
 
             commandList->open();
             {
-                const auto& morphTargetFrameData = mesh->buffers->morphTargetData;
-                const uint32_t morphTargetFrameDataSize = sizeof(float4) * morphTargetFrameData.size();
-                morphTargetResource.morphTargetDataBuffer = createBuffer(morphTargetFrameDataSize, sizeof(float4), "Morph Target Data Buffer " + bufferIndexName, false, true);
+                MorphTargetKeyframeEncoder::EncodedKeyframes encodedKeyframes;
+                MorphTargetKeyframeEncoder::encode(mesh->buffers->morphTargetData, mesh->buffers->morphTargetBufferRange, m_keyframeFormat,
+                    encodedKeyframes, m_keyframePcaSettings);
+                morphTargetResource.keyframeFormat = encodedKeyframes.format;
+                morphTargetResource.keyframeComponentCount = encodedKeyframes.componentCount;
+                morphTargetResource.keyframeRanges = encodedKeyframes.keyframeRanges;
+
+                // Streaming: the keyframes go to a file next to the executable, the ring is filled from it while the animation plays
+                if (m_keyframeStreamingSlotCount > 0)
+                {
+                    const std::filesystem::path keyframeFilePath =
+                        donut::app::GetDirectoryWithExecutable() / "MorphTargetKeyframeStream" / (bufferIndexName + ".keyframes");
+                    std::shared_ptr<const MorphTargetKeyframeFile> keyframeFile;
+                    if (MorphTargetKeyframeFile::store(keyframeFilePath, encodedKeyframes))
+                    {
+                        keyframeFile = MorphTargetKeyframeFile::load(keyframeFilePath);
+                    }
+
+                    if (keyframeFile)
+                    {
+                        morphTargetResource.keyframeRing = std::make_shared<MorphTargetKeyframeRing>(m_device, keyframeFile, keyframeFilePath,
+                            m_keyframeStreamingSlotCount, "Morph Target Keyframe Ring " + bufferIndexName);
+                        morphTargetResource.morphTargetDataBuffer = morphTargetResource.keyframeRing->getBuffer();
+
+                        ++numStreamedMeshes;
+                        streamedKeyframeBytes += encodedKeyframes.getByteSize();
+                        streamedResidentBytes += morphTargetResource.morphTargetDataBuffer->getDesc().byteSize;
+                    }
+                    else
+                    {
+                        donut::log::warning("Morph target keyframes of mesh %s can't be streamed in the %s format, all of them are resident",
+                                            mesh->name.c_str(), MorphTargetKeyframeEncoder::getFormatName(encodedKeyframes.format));
+                    }
+                }
 
-                commandList->beginTrackingBufferState(morphTargetResource.morphTargetDataBuffer, nvrhi::ResourceStates::Common);
-                commandList->writeBuffer(morphTargetResource.morphTargetDataBuffer, morphTargetFrameData.data(), morphTargetFrameDataSize);
+                uint32_t morphTargetFrameDataSize = 0;
+                if (morphTargetResource.keyframeRing)
+                {
+                    morphTargetFrameDataSize = (uint32_t)morphTargetResource.morphTargetDataBuffer->getDesc().byteSize;
+                }
+                else
+                {
+                    morphTargetFrameDataSize = (uint32_t)encodedKeyframes.getByteSize();
+                    morphTargetResource.morphTargetDataBuffer = createBuffer(morphTargetFrameDataSize, getKeyframeStride(encodedKeyframes.format),
+                        "Morph Target Data Buffer " + bufferIndexName, false, true);
+
+                    commandList->beginTrackingBufferState(morphTargetResource.morphTargetDataBuffer, nvrhi::ResourceStates::Common);
+                    commandList->writeBuffer(morphTargetResource.morphTargetDataBuffer, encodedKeyframes.data.data(), morphTargetFrameDataSize);
+                }
+
+                // Quantization entries or PCA coefficients, an encoding has one of them
+                const uint32_t keyframeParameterSize = (uint32_t)encodedKeyframes.getParameterByteSize();
+                if (keyframeParameterSize > 0)
+                {
+                    const bool pca = !encodedKeyframes.coefficients.empty();
+                    morphTargetResource.keyframeParameterBuffer = createBuffer(keyframeParameterSize, pca ? sizeof(float) : sizeof(KeyframeQuantization),
+                        "Morph Target Keyframe Parameter Buffer " + bufferIndexName, false, false);
+                    commandList->beginTrackingBufferState(morphTargetResource.keyframeParameterBuffer, nvrhi::ResourceStates::Common);
+                    commandList->writeBuffer(morphTargetResource.keyframeParameterBuffer,
+                        pca ? (const void*)encodedKeyframes.coefficients.data() : (const void*)encodedKeyframes.quantization.data(), keyframeParameterSize);
+                    commandList->setPermanentBufferState(morphTargetResource.keyframeParameterBuffer, nvrhi::ResourceStates::ShaderResource);
+                    keyframeBytes += keyframeParameterSize;
+                }
                 commandList->commitBarriers();
+
+                const size_t keyframeVertexCount = mesh->buffers->morphTargetBufferRange.empty() ? 0 :
+                    mesh->buffers->morphTargetBufferRange[0].byteSize / sizeof(float4);
+                fullKeyframeBytes += sizeof(float4) * mesh->buffers->morphTargetData.size();
+                keyframeBytes += morphTargetFrameDataSize;
+                fullKeyframeFrameBytes += 2 * keyframeVertexCount * sizeof(float4);
+                keyframeFrameBytes += encodedKeyframes.getReadBytesPerFrame();
+                maxKeyframePositionError = std::max(maxKeyframePositionError, encodedKeyframes.maxPositionError);
+                maxKeyframeComponentCount = std::max(maxKeyframeComponentCount, encodedKeyframes.componentCount);
+                keyframeEncodeTimeMs += encodedKeyframes.encodeTimeMs;
             }
 
             const uint lineSegmentsSize = sizeof(LineSegment) * lineSegments.size();
+            const uint polyTubeOrder = scene->GetCurveTessellation()->GetCurvePolyTubeOrder(mesh->name);
+            morphTargetResource.lineSegmentCount = lineSegments.size();
+            morphTargetResource.polyTubeOrder = polyTubeOrder;
             if (scene->GetCurveTessellationType() == TessellationType::Polytube)
             {
-                morphTargetResource.vertexSize = lineSegments.size() * RTXCR_CURVE_POLYTUBE_ORDER * 6;
+                morphTargetResource.vertexSize = lineSegments.size() * polyTubeOrder * 6;
             }
             else if (scene->GetCurveTessellationType() == TessellationType::DisjointOrthogonalTriangleStrip)
             {
@@ -166,7 +259,8 @@ void ResourceManager::CreateMorphTargetBuffers(
             }
             else if (scene->GetCurveTessellationType() == TessellationType::LinearSweptSphere)
             {
-                morphTargetResource.vertexSize = mesh->totalVertices;
+                // One thread per segment end point in both the list and the successive implicit format
+                morphTargetResource.vertexSize = lineSegments.size() * 2;
             }
 
             {
@@ -181,11 +275,52 @@ void ResourceManager::CreateMorphTargetBuffers(
                     lineSegmentData.point1 = float3(segment.vertices[1].position);
                     lineSegmentData.radius1 = segment.vertices[1].radius;
                 }
-                morphTargetResource.lineSegmentsBuffer = createBuffer(lineSegmentsSize, sizeof(LineSegment), "Mesh Line Segments Buffer " + bufferIndexName, false, false);
-                commandList->beginTrackingBufferState(morphTargetResource.lineSegmentsBuffer, nvrhi::ResourceStates::Common);
-                commandList->writeBuffer(morphTargetResource.lineSegmentsBuffer, lineSegmentsBufferData.data(), lineSegmentsSize);
-                commandList->setPermanentBufferState(morphTargetResource.lineSegmentsBuffer, nvrhi::ResourceStates::ShaderResource);
-                commandList->commitBarriers();
+
+                std::vector<CompactLineSegment> compactLineSegmentsBufferData;
+                std::vector<LineSegmentBounds> lineSegmentBoundsBufferData;
+                if (m_useCompactLineSegments)
+                {
+                    morphTargetResource.compactLineSegments = CompactLineSegmentEncoder::encode(
+                        lineSegmentsBufferData,
+                        scene->GetCurveTessellation()->GetCurveGeometrySegmentCounts(mesh->name),
+                        compactLineSegmentsBufferData,
+                        lineSegmentBoundsBufferData);
+
+                    if (!morphTargetResource.compactLineSegments)
+                    {
+                        donut::log::warning("Mesh %s has more strands than the compact line segment format supports, using the full format",
+                                            mesh->name.c_str());
+                    }
+                }
+
+                if (morphTargetResource.compactLineSegments)
+                {
+                    const uint compactLineSegmentsSize = sizeof(CompactLineSegment) * compactLineSegmentsBufferData.size();
+                    morphTargetResource.lineSegmentsBuffer = createBuffer(compactLineSegmentsSize, sizeof(CompactLineSegment), "Mesh Compact Line Segments Buffer " + bufferIndexName, false, false);
+                    commandList->beginTrackingBufferState(morphTargetResource.lineSegmentsBuffer, nvrhi::ResourceStates::Common);
+                    commandList->writeBuffer(morphTargetResource.lineSegmentsBuffer, compactLineSegmentsBufferData.data(), compactLineSegmentsSize);
+                    commandList->setPermanentBufferState(morphTargetResource.lineSegmentsBuffer, nvrhi::ResourceStates::ShaderResource);
+
+                    const uint lineSegmentBoundsSize = sizeof(LineSegmentBounds) * lineSegmentBoundsBufferData.size();
+                    morphTargetResource.lineSegmentBoundsBuffer = createBuffer(lineSegmentBoundsSize, sizeof(LineSegmentBounds), "Mesh Line Segment Bounds Buffer " + bufferIndexName, false, false);
+                    commandList->beginTrackingBufferState(morphTargetResource.lineSegmentBoundsBuffer, nvrhi::ResourceStates::Common);
+                    commandList->writeBuffer(morphTargetResource.lineSegmentBoundsBuffer, lineSegmentBoundsBufferData.data(), lineSegmentBoundsSize);
+                    commandList->setPermanentBufferState(morphTargetResource.lineSegmentBoundsBuffer, nvrhi::ResourceStates::ShaderResource);
+                    commandList->commitBarriers();
+
+                    compactLineSegmentsBytes += compactLineSegmentsSize + lineSegmentBoundsSize;
+                }
+                else
+                {
+                    morphTargetResource.lineSegmentsBuffer = createBuffer(lineSegmentsSize, sizeof(LineSegment), "Mesh Line Segments Buffer " + bufferIndexName, false, false);
+                    commandList->beginTrackingBufferState(morphTargetResource.lineSegmentsBuffer, nvrhi::ResourceStates::Common);
+                    commandList->writeBuffer(morphTargetResource.lineSegmentsBuffer, lineSegmentsBufferData.data(), lineSegmentsSize);
+                    commandList->setPermanentBufferState(morphTargetResource.lineSegmentsBuffer, nvrhi::ResourceStates::ShaderResource);
+                    commandList->commitBarriers();
+
+                    compactLineSegmentsBytes += lineSegmentsSize;
+                }
+                fullLineSegmentsBytes += lineSegmentsSize;
             }
 
             {
@@ -194,6 +329,7 @@ void ResourceManager::CreateMorphTargetBuffers(
 
                 MorphTargetConstants morphTargetConstants = {};
                 morphTargetConstants.vertexCount = morphTargetResource.vertexSize;
+                morphTargetConstants.polyTubeOrder = polyTubeOrder;
                 commandList->beginTrackingBufferState(morphTargetResource.morphTargetConstantBuffer, nvrhi::ResourceStates::Common);
                 commandList->writeBuffer(morphTargetResource.morphTargetConstantBuffer, &morphTargetConstants, sizeof(MorphTargetConstants));
             }
@@ -211,6 +347,42 @@ void ResourceManager::CreateMorphTargetBuffers(
         }
     }
 
+    if (m_useCompactLineSegments && fullLineSegmentsBytes > 0)
+    {
+        const size_t savedBytes = fullLineSegmentsBytes - std::min(compactLineSegmentsBytes, fullLineSegmentsBytes);
+        donut::log::info("Compact morph target line segments: %.2f MB instead of %.2f MB, saved %.2f MB (%.1f%%)",
+                         compactLineSegmentsBytes / (1024.0 * 1024.0),
+                         fullLineSegmentsBytes / (1024.0 * 1024.0),
+                         savedBytes / (1024.0 * 1024.0),
+                         100.0 * savedBytes / fullLineSegmentsBytes);
+    }
+
+    if (m_keyframeFormat != RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_FULL && fullKeyframeBytes > 0)
+    {
+        donut::log::info("%s morph target keyframes: %.2f MB instead of %.2f MB, %.2f MB instead of %.2f MB read per frame, "
+                         "max position error %g, encoded in %.2f ms",
+                         MorphTargetKeyframeEncoder::getFormatName(m_keyframeFormat),
+                         keyframeBytes / (1024.0 * 1024.0),
+                         fullKeyframeBytes / (1024.0 * 1024.0),
+                         keyframeFrameBytes / (1024.0 * 1024.0),
+                         fullKeyframeFrameBytes / (1024.0 * 1024.0),
+                         maxKeyframePositionError,
+                         keyframeEncodeTimeMs);
+        if (m_keyframeFormat == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_PCA)
+        {
+            donut::log::info("PCA morph target keyframes: up to %u basis vectors per strand point including the mean, relative error target %g",
+                             maxKeyframeComponentCount, m_keyframePcaSettings.maxRelativeError);
+        }
+    }
+
+    if (numStreamedMeshes > 0)
+    {
+        donut::log::info("Streamed morph target keyframes: %u meshes, %u slots per mesh, %.2f MB resident instead of %.2f MB",
+                         numStreamedMeshes, m_keyframeStreamingSlotCount,
+                         streamedResidentBytes / (1024.0 * 1024.0),
+                         streamedKeyframeBytes / (1024.0 * 1024.0));
+    }
+
     {
         const auto& meshInstances = scene->GetNativeScene()->GetSceneGraph()->GetMeshInstances();
         std::vector<uint32_t> morphTargetMaskData(meshInstances.size(), 0);
@@ -268,6 +440,10 @@ void ResourceManager::CleanMorphTargetTextures()
         morphTargetResource.morphTargetConstantBuffer = nullptr;
         morphTargetResource.morphTargetDataBuffer = nullptr;
         morphTargetResource.lineSegmentsBuffer = nullptr;
+        morphTargetResource.lineSegmentBoundsBuffer = nullptr;
+        morphTargetResource.keyframeParameterBuffer = nullptr;
+        morphTargetResource.keyframeRing = nullptr;
+        morphTargetResource.keyframeRanges.clear();
         morphTargetResource.vertexSize = 0;
     }
 
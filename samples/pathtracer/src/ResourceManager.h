@@ -14,7 +14,10 @@
 #include <donut/core/math/math.h>
 #include <donut/engine/TextureCache.h>
 
+#include "Curve/MorphTargetPca.h"
+
 class SampleScene;
+class MorphTargetKeyframeRing;
 
 class ResourceManager
 {
@@ -102,7 +105,23 @@ public:
         nvrhi::BufferHandle morphTargetConstantBuffer;
         nvrhi::BufferHandle morphTargetDataBuffer;
         nvrhi::BufferHandle lineSegmentsBuffer;
+        // Quantization bounds per geometry, only used by the compact line segment format
+        nvrhi::BufferHandle lineSegmentBoundsBuffer;
         uint32_t vertexSize = 0;
+        uint32_t lineSegmentCount = 0;
+        uint32_t polyTubeOrder = 0;
+        // lineSegmentsBuffer holds CompactLineSegment instead of LineSegment
+        bool compactLineSegments = false;
+        // RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_* of morphTargetDataBuffer, the half and unorm10 formats have one
+        // KeyframeQuantization entry per keyframe in keyframeParameterBuffer, the PCA format keyframeComponentCount coefficients
+        uint32_t keyframeFormat = 0;
+        uint32_t keyframeComponentCount = 0;
+        // Byte range of every keyframe in morphTargetDataBuffer, the whole basis with the PCA format
+        std::vector<nvrhi::BufferRange> keyframeRanges;
+        nvrhi::BufferHandle keyframeParameterBuffer;
+        // Streamed keyframes: morphTargetDataBuffer is the ring buffer, keyframeRanges only give the keyframe sizes
+        // and the keyframes are addressed through the ring
+        std::shared_ptr<MorphTargetKeyframeRing> keyframeRing;
     };
 
     struct TaaResources
@@ -125,6 +144,19 @@ public:
     inline uint32_t GetRenderHeight() const { return m_renderHeight; }
     inline const std::string GetResolutionInfo() const { return std::to_string(m_screenWidth) + " x " + std::to_string(m_screenHeight); }
     inline uint32_t GetMorphTargetCount() const { return m_totalMorphTargetCount; }
+    // Takes effect the next time the morph target buffers are created
+    inline void SetUseCompactLineSegments(const bool useCompactLineSegments) { m_useCompactLineSegments = useCompactLineSegments; }
+    inline bool IsUsingCompactLineSegments() const { return m_useCompactLineSegments; }
+    // RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_*, takes effect the next time the morph target buffers are created
+    inline void SetMorphTargetKeyframeFormat(const uint32_t keyframeFormat) { m_keyframeFormat = keyframeFormat; }
+    inline uint32_t GetMorphTargetKeyframeFormat() const { return m_keyframeFormat; }
+    // Relative RMS error target of the PCA keyframe format, takes effect the next time the morph target buffers are created
+    inline void SetMorphTargetKeyframePcaMaxError(const float maxRelativeError) { m_keyframePcaSettings.maxRelativeError = maxRelativeError; }
+    inline float GetMorphTargetKeyframePcaMaxError() const { return m_keyframePcaSettings.maxRelativeError; }
+    // Keyframe slots of the streamed keyframe window of every mesh, 0 keeps all keyframes resident.
+    // Takes effect the next time the morph target buffers are created
+    inline void SetMorphTargetKeyframeStreamingSlots(const uint32_t slotCount) { m_keyframeStreamingSlotCount = slotCount; }
+    inline uint32_t GetMorphTargetKeyframeStreamingSlots() const { return m_keyframeStreamingSlotCount; }
 
 private:
     nvrhi::TextureHandle createRenderTargetTexture(const uint32_t width, const uint32_t height, const std::string& name, const nvrhi::Format format);
@@ -142,5 +174,9 @@ private:
     DebuggingResources m_debuggingResources;
     std::vector<MorphTargetResources> m_morphTargetResources;
     uint32_t m_totalMorphTargetCount;
+    bool m_useCompactLineSegments = false;
+    uint32_t m_keyframeFormat = 0;
+    MorphTargetPcaSettings m_keyframePcaSettings;
+    uint32_t m_keyframeStreamingSlotCount = 0;
     TaaResources m_taaResources;
 };
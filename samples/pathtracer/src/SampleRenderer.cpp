@@ -175,6 +175,36 @@ bool SampleRenderer::Init(int argc, const char* const* argv)
             m_ui.animationKeyFrameWeightOverride = (float)atof(argv[n + 1]);
         }
 
+        if (!strcmp(arg, "-animationCompactLineSegments"))
+        {
+            m_ui.enableCompactLineSegments = (bool)atoi(argv[n + 1]);
+        }
+
+        if (!strcmp(arg, "-animationKeyframeFormat"))
+        {
+            m_ui.morphTargetKeyframeFormat = std::min(std::max(atoi(argv[n + 1]), 0), RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_COUNT - 1);
+        }
+
+        if (!strcmp(arg, "-animationKeyframePcaError"))
+        {
+            m_ui.morphTargetKeyframePcaMaxError = std::min(std::max((float)atof(argv[n + 1]), 0.0001f), 1.0f);
+        }
+
+        if (!strcmp(arg, "-animationKeyframeStreaming"))
+        {
+            m_ui.morphTargetKeyframeStreamingSlots = std::max(atoi(argv[n + 1]), 0);
+        }
+
+        if (!strcmp(arg, "-animationPerSegmentKernel"))
+        {
+            m_ui.enablePerSegmentMorphKernel = (bool)atoi(argv[n + 1]);
+        }
+
+        if (!strcmp(arg, "-animationBatchedDispatch"))
+        {
+            m_ui.enableBatchedMorphDispatch = (bool)atoi(argv[n + 1]);
+        }
+
         if (!strcmp(arg, "-forceLambertianBrdf"))
         {
             m_ui.forceLambertianBRDF = (bool)atoi(argv[n + 1]);
@@ -235,10 +265,100 @@ bool SampleRenderer::Init(int argc, const char* const* argv)
             m_ui.hairRadiusScale = (float)atof(argv[n + 1]);
         }
 
+        if (!strcmp(arg, "-hairResegmentationError"))
+        {
+            m_ui.hairResegmentationError = (float)atof(argv[n + 1]);
+        }
+
+        if (!strcmp(arg, "-hairStrandReorder"))
+        {
+            m_ui.enableHairStrandReorder = (bool)atoi(argv[n + 1]);
+        }
+
+        if (!strcmp(arg, "-hairPolytubeOrder"))
+        {
+            m_ui.hairPolyTubeOrder = atoi(argv[n + 1]);
+        }
+
         if (!strcmp(arg, "-hairTessellationType"))
         {
             m_ui.hairTessellationType = (TessellationType)atoi(argv[n + 1]);
         }
+
+        if (!strcmp(arg, "-hairTessellationThreads"))
+        {
+            m_ui.hairTessellationThreadCount = atoi(argv[n + 1]);
+        }
+
+        if (!strcmp(arg, "-hairLazyTessellation"))
+        {
+            m_ui.enableLazyHairTessellation = (bool)atoi(argv[n + 1]);
+        }
+
+        if (!strcmp(arg, "-hairTessellationCacheBudget"))
+        {
+            m_ui.hairTessellationCacheBudgetMB = atoi(argv[n + 1]);
+        }
+
+        if (!strcmp(arg, "-blasBuildEstimatedScratchBudget"))
+        {
+            m_ui.blasBuildEstimatedScratchBudgetMB = std::max(atoi(argv[n + 1]), 0);
+        }
+
+        if (!strcmp(arg, "-blasBuildPrimitiveBudget"))
+        {
+            m_ui.blasBuildPrimitiveBudget = std::max(atoi(argv[n + 1]), 0);
+        }
+
+        if (!strcmp(arg, "-animationBlasCompaction"))
+        {
+            m_ui.enableAnimatedBlasCompaction = (bool)atoi(argv[n + 1]);
+        }
+
+        if (!strcmp(arg, "-animationBlasRebuildInterval"))
+        {
+            m_ui.animatedBlasRebuildInterval = std::max(atoi(argv[n + 1]), 0);
+        }
+
+        if (!strcmp(arg, "-animationBlasRebuildGrowth"))
+        {
+            m_ui.animatedBlasMaxGrowth = std::max((float)atof(argv[n + 1]), 0.0f);
+        }
+
+        if (!strcmp(arg, "-animationBlasRebuildsPerFrame"))
+        {
+            m_ui.animatedBlasRebuildsPerFrame = std::max(atoi(argv[n + 1]), 0);
+        }
+
+        if (!strcmp(arg, "-hairSimdTessellation"))
+        {
+            m_ui.enableSimdHairTessellation = (bool)atoi(argv[n + 1]);
+        }
+
+        if (!strcmp(arg, "-hairTessellationDiskCache"))
+        {
+            m_ui.enableHairTessellationDiskCache = (bool)atoi(argv[n + 1]);
+        }
+
+        if (!strcmp(arg, "-hairLssSuccessiveImplicit"))
+        {
+            m_ui.enableLssSuccessiveImplicit = (bool)atoi(argv[n + 1]);
+        }
+
+        if (!strcmp(arg, "-hairLodLevels"))
+        {
+            m_ui.hairLodLevels = atoi(argv[n + 1]);
+        }
+
+        if (!strcmp(arg, "-hairLodPixelWidth"))
+        {
+            m_ui.hairLodPixelWidth = (float)atof(argv[n + 1]);
+        }
+
+        if (!strcmp(arg, "-hairLodStrandKeepRatio"))
+        {
+            m_ui.hairLodStrandKeepRatio = (float)atof(argv[n + 1]);
+        }
     }
 
     if (!GetDevice()->queryFeatureSupport(nvrhi::Feature::LinearSweptSpheres) &&
@@ -298,7 +418,7 @@ bool SampleRenderer::Init(int argc, const char* const* argv)
         m_scene = std::make_shared<SampleScene>(GetFrameIndex(), m_ui.cameraSpeed, cameraIndex, false, sceneName, m_ui);
         SetAsynchronousLoadingEnabled(m_scene->IsAsyncSceneLoadingEnabled());
 
-        m_accelerationStructure = std::make_shared<AccelerationStructure>(GetDevice(), m_scene, m_ui);
+        m_accelerationStructure = std::make_shared<AccelerationStructure>(GetDevice(), m_scene, m_ui, GetDeviceManager()->GetDeviceParams().maxFramesInFlight);
     }
 
     // Render Passes
@@ -334,6 +454,10 @@ bool SampleRenderer::Init(int argc, const char* const* argv)
     //       because we need to loop the meshes in CreateMorphTargetBuffers to determine how many morph targets we have
     // if (m_resourceManager.GetMorphTargetCount() > 0)
     {
+        m_resourceManager.SetUseCompactLineSegments(m_ui.enableCompactLineSegments);
+        m_resourceManager.SetMorphTargetKeyframeFormat((uint32_t)m_ui.morphTargetKeyframeFormat);
+        m_resourceManager.SetMorphTargetKeyframePcaMaxError(m_ui.morphTargetKeyframePcaMaxError);
+        m_resourceManager.SetMorphTargetKeyframeStreamingSlots((uint32_t)m_ui.morphTargetKeyframeStreamingSlots);
         m_resourceManager.CreateMorphTargetBuffers(m_scene, m_commandList);
     }
 
@@ -385,7 +509,9 @@ void SampleRenderer::SceneLoaded()
 {
     ApplicationBase::SceneLoaded();
 
-    m_scene->FinishLoading(GetDevice(), m_descriptorTable.get(), GetFrameIndex());
+    // The render size isn't known before the first frame, the back buffer height is close enough to pick the hair polytube orders
+    const uint32_t renderHeight = m_renderSize.y > 0 ? m_renderSize.y : GetDeviceManager()->GetDeviceParams().backBufferHeight;
+    m_scene->FinishLoading(GetDevice(), m_descriptorTable.get(), GetFrameIndex(), renderHeight);
 
     m_pathTracingPass->ResetAccumulation();
 
@@ -442,7 +568,52 @@ bool SampleRenderer::SetCurrentEnvironmentMapAndLoading(const std::string& envMa
 void SampleRenderer::Animate(float fElapsedTimeSeconds)
 {
     bool isRebuildAsAfterAnimation = false;
-    if (m_scene->Animate(GetDevice(), m_descriptorTable.get(), fElapsedTimeSeconds, IsSceneLoaded(), GetFrameIndex(), m_ui.lockCamera, &isRebuildAsAfterAnimation))
+
+    // Switching the line segment or keyframe format or the keyframe streaming only re-uploads the morph target buffers,
+    // the tessellated meshes stay as they are
+    if (m_resourceManager.IsUsingCompactLineSegments() != m_ui.enableCompactLineSegments ||
+        m_resourceManager.GetMorphTargetKeyframeFormat() != (uint32_t)m_ui.morphTargetKeyframeFormat ||
+        m_resourceManager.GetMorphTargetKeyframeStreamingSlots() != (uint32_t)m_ui.morphTargetKeyframeStreamingSlots ||
+        (m_ui.morphTargetKeyframeFormat == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_PCA &&
+         m_resourceManager.GetMorphTargetKeyframePcaMaxError() != m_ui.morphTargetKeyframePcaMaxError))
+    {
+        m_resourceManager.SetUseCompactLineSegments(m_ui.enableCompactLineSegments);
+        m_resourceManager.SetMorphTargetKeyframeFormat((uint32_t)m_ui.morphTargetKeyframeFormat);
+        m_resourceManager.SetMorphTargetKeyframePcaMaxError(m_ui.morphTargetKeyframePcaMaxError);
+        m_resourceManager.SetMorphTargetKeyframeStreamingSlots((uint32_t)m_ui.morphTargetKeyframeStreamingSlots);
+        if (m_resourceManager.GetMorphTargetCount() > 0)
+        {
+            m_resourceManager.RecreateMorphTargetBuffers(m_scene, m_commandList);
+            m_morphTargetAnimationPass->CleanComputePipeline();
+        }
+    }
+
+    // A changed hair radius is applied in place, only the hair vertex data is re-uploaded and only the hair BLAS are rebuilt
+    if (IsSceneLoaded() && m_scene->UpdateCurveRadiusScale(GetDevice(), m_commandList))
+    {
+        for (const auto& mesh : m_scene->GetNativeScene()->GetSceneGraph()->GetMeshes())
+        {
+            if (mesh->IsCurve())
+            {
+                m_accelerationStructure->RequestBlasRebuild(mesh.get());
+            }
+        }
+
+        if (m_resourceManager.GetMorphTargetCount() > 0)
+        {
+            m_resourceManager.RecreateMorphTargetBuffers(m_scene, m_commandList);
+            m_morphTargetAnimationPass->CleanComputePipeline();
+        }
+
+        m_pathTracingPass->ResetAccumulation();
+    }
+
+    if (IsSceneLoaded() && m_accelerationStructure->IsCompactingAnimatedBlas() != m_ui.enableAnimatedBlasCompaction)
+    {
+        m_accelerationStructure->SetCompactAnimatedBlas(m_ui.enableAnimatedBlasCompaction);
+    }
+
+    if (m_scene->Animate(GetDevice(), m_descriptorTable.get(), fElapsedTimeSeconds, IsSceneLoaded(), GetFrameIndex(), m_ui.lockCamera, m_renderSize.y, &isRebuildAsAfterAnimation))
     {
         if (m_resourceManager.GetMorphTargetCount() > 0)
         {
@@ -1041,9 +1212,14 @@ void SampleRenderer::Render(nvrhi::IFramebuffer* framebuffer)
     const bool isRecreateRenderResolutionTextures = m_renderSize.x != m_resourceManager.GetRenderWidth() ||
                                                     m_renderSize.y != m_resourceManager.GetRenderHeight();
 
-    if (m_accelerationStructure->IsRebuildAS() || m_accelerationStructure->IsUpdateAS() || m_ui.recompileShader)
+    // Pending BLAS builds keep the AS build going until every mesh is traceable, pending compactions until the TLAS
+    // references the compacted BLAS
+    const bool isBuildAS = m_accelerationStructure->IsRebuildAS() || m_accelerationStructure->IsUpdateAS() ||
+                           m_accelerationStructure->IsBlasRebuildRequested() || m_accelerationStructure->HasPendingBlasBuilds() ||
+                           m_accelerationStructure->HasPendingBlasCompactions();
+    if (isBuildAS || m_ui.recompileShader)
     {
-        if (m_accelerationStructure->IsRebuildAS() || m_accelerationStructure->IsUpdateAS())
+        if (isBuildAS)
         {
             if (m_accelerationStructure->IsRebuildAS())
             {
@@ -1054,7 +1230,16 @@ void SampleRenderer::Render(nvrhi::IFramebuffer* framebuffer)
             {
                 m_commandList->beginTrackingBufferState(mesh->buffers->vertexBuffer, nvrhi::ResourceStates::AccelStructBuildInput);
             }
+            // The vertex buffers hold the poses of the last morph target dispatch
+            if (m_morphTargetAnimationPass)
+            {
+                m_accelerationStructure->SetMorphTargetKeyframePositions(m_morphTargetAnimationPass->GetKeyframePositions());
+            }
             m_accelerationStructure->CreateAccelerationStructures(m_commandList, GetFrameIndex());
+            if (m_accelerationStructure->GetBlasBuildStats().numBuilds > 0)
+            {
+                m_pathTracingPass->ResetAccumulation();
+            }
 
             m_accelerationStructure->BuildTLAS(m_commandList);
         }
@@ -1168,27 +1353,53 @@ void SampleRenderer::Render(nvrhi::IFramebuffer* framebuffer)
     }
 
     m_scene->GetNativeScene()->Refresh(m_commandList, GetFrameIndex());
+    if (m_ui.enableAnimations)
+    {
+        m_accelerationStructure->MarkAnimatedTlasInstancesChanged();
+    }
 
     updateConstantBuffers();
 
     if (m_ui.enableAnimations && m_resourceManager.GetMorphTargetCount() > 0)
     {
-        uint32_t morphTargetResourcesIndex = 0;
-        for (const auto& mesh : m_scene->GetNativeScene()->GetSceneGraph()->GetMeshes())
+        m_morphTargetAnimationPass->BeginFrame(m_commandList);
+
+        if (m_ui.enableBatchedMorphDispatch)
         {
-            m_morphTargetAnimationPass->Dispatch(
-                mesh,
+            m_morphTargetAnimationPass->DispatchBatched(
+                m_scene->GetNativeScene()->GetSceneGraph()->GetMeshes(),
                 m_commandList,
-                m_resourceManager.GetMorphTargetResources()[morphTargetResourcesIndex],
+                m_resourceManager.GetMorphTargetResources(),
                 m_scene->GetCurveTessellationType(),
                 std::max(1.0f / m_ui.animationFps, 0.001f),
                 m_ui.enableAnimationDebugging,
                 m_ui.animationKeyFrameIndexOverride,
                 m_ui.animationKeyFrameWeightOverride,
-                m_ui.enableAnimationSmoothing ? m_ui.animationSmoothingFactor : 1.0f);
-
-            ++morphTargetResourcesIndex;
+                m_ui.enableAnimationSmoothing ? m_ui.animationSmoothingFactor : 1.0f,
+                m_ui.enablePerSegmentMorphKernel);
+        }
+        else
+        {
+            uint32_t morphTargetResourcesIndex = 0;
+            for (const auto& mesh : m_scene->GetNativeScene()->GetSceneGraph()->GetMeshes())
+            {
+                m_morphTargetAnimationPass->Dispatch(
+                    mesh,
+                    m_commandList,
+                    m_resourceManager.GetMorphTargetResources()[morphTargetResourcesIndex],
+                    m_scene->GetCurveTessellationType(),
+                    std::max(1.0f / m_ui.animationFps, 0.001f),
+                    m_ui.enableAnimationDebugging,
+                    m_ui.animationKeyFrameIndexOverride,
+                    m_ui.animationKeyFrameWeightOverride,
+                    m_ui.enableAnimationSmoothing ? m_ui.animationSmoothingFactor : 1.0f,
+                    m_ui.enablePerSegmentMorphKernel);
+
+                ++morphTargetResourcesIndex;
+            }
         }
+
+        m_morphTargetAnimationPass->EndFrame(m_commandList);
     }
 
     m_gbufferPass->Dispatch(m_commandList,
@@ -153,6 +153,49 @@ public:
         return &m_scene->GetCamera();
     }
 
+    // Null without animated meshes
+    inline const MorphTargetAnimationStats* GetMorphTargetAnimationStats() const
+    {
+        return m_morphTargetAnimationPass ? &m_morphTargetAnimationPass->GetStats() : nullptr;
+    }
+
+    // BLAS builds of the last frame that built the acceleration structures
+    inline const BlasBuildScheduler::FrameStats& GetBlasBuildStats() const
+    {
+        return m_accelerationStructure->GetBlasBuildStats();
+    }
+
+    // TLAS instance changes of the last frame that built the acceleration structures
+    inline const TlasInstanceTableStats& GetTlasInstanceStats() const
+    {
+        return m_accelerationStructure->GetTlasInstanceStats();
+    }
+
+    inline bool IsTlasBuildSkipped() const
+    {
+        return m_accelerationStructure->IsTlasBuildSkipped();
+    }
+
+    inline BlasCompactionMemoryStats GetBlasMemoryStats() const
+    {
+        return m_accelerationStructure->GetBlasMemoryStats();
+    }
+
+    inline void GetBlasMemoryReport(std::vector<BlasMemoryReportEntry>& report) const
+    {
+        m_accelerationStructure->GetBlasMemoryReport(report);
+    }
+
+    inline const BlasRefitCounters& GetBlasRefitFrameCounters() const
+    {
+        return m_accelerationStructure->GetBlasRefitFrameCounters();
+    }
+
+    inline const BlasRefitCounters& GetBlasRefitTotalCounters() const
+    {
+        return m_accelerationStructure->GetBlasRefitTotalCounters();
+    }
+
 	inline std::string GetResolutionInfo()
 	{
 		return m_resourceManager.GetResolutionInfo();
@@ -61,21 +61,33 @@ bool SampleScene::Load(nvrhi::IDevice* device,
     if (scene->Load(sceneFileName))
     {
         m_scene = std::unique_ptr<engine::Scene>(scene);
+        m_ui.hairTessellationDiskCacheDirectory = app::GetDirectoryWithExecutable() / "HairTessellationCache";
         m_curveTessellation = std::make_shared<CurveTessellation>(m_scene->GetSceneGraph()->GetMeshInstances(), m_ui);
+
+        m_scenePolyTubeOrders = CurveTessellation::loadScenePolyTubeOrders(*fs, sceneFileName);
+
         return true;
     }
 
     return false;
 }
 
-void SampleScene::FinishLoading(nvrhi::IDevice* device, donut::engine::DescriptorTableManager* descriptorTable, const uint32_t frameIndex)
+void SampleScene::FinishLoading(nvrhi::IDevice* device, donut::engine::DescriptorTableManager* descriptorTable, const uint32_t frameIndex, const uint32_t renderHeight)
 {
-    // Tessellate curve line segments into Polytubes/DOTS/LSS and cache them on CPU
-    m_curveTessellation->convertToTrianglePolyTubes(m_scene->GetSceneGraph()->GetMeshInstances());
-    m_curveTessellation->convertToDisjointOrthogonalTriangleStrips(m_scene->GetSceneGraph()->GetMeshInstances());
-    m_curveTessellation->convertToLinearSweptSpheres(m_scene->GetSceneGraph()->GetMeshInstances());
+    // Polytube orders are picked from the initial view before anything is tessellated
+    selectCurvePolyTubeOrders(frameIndex, renderHeight);
+
+    // Tessellate curve line segments into Polytubes/DOTS/LSS and cache them on CPU.
+    // In lazy mode only the active representation is built, the others are built the first time they are selected.
+    if (!m_ui.enableLazyHairTessellation)
+    {
+        m_curveTessellation->convertToTrianglePolyTubes(m_scene->GetSceneGraph()->GetMeshInstances());
+        m_curveTessellation->convertToDisjointOrthogonalTriangleStrips(m_scene->GetSceneGraph()->GetMeshInstances());
+        m_curveTessellation->convertToLinearSweptSpheres(m_scene->GetSceneGraph()->GetMeshInstances());
+    }
 
     // Ensure that the currently chosen tessellation type is ready to be uploaded to the GPU
+    m_curveTessellation->requestTessellation(m_currentTessellationType, m_scene->GetSceneGraph()->GetMeshInstances());
     m_curveTessellation->replacingSceneMesh(device, descriptorTable, m_currentTessellationType, m_scene->GetSceneGraph()->GetMeshInstances());
 
     m_scene->FinishedLoading(frameIndex);
@@ -104,20 +116,8 @@ void SampleScene::FinishLoading(nvrhi::IDevice* device, donut::engine::Descripto
     auto cameras = m_scene->GetSceneGraph()->GetCameras();
     if (!cameras.empty())
     {
-        // Override camera
-        if (m_cameraIndex != -1 && m_cameraIndex < cameras.size())
-        {
-            m_ui.activeSceneCamera = cameras[m_cameraIndex];
-            m_cameraIndex = -1;
-        }
-        else
-        {
-            std::string cameraName = "DefaultCamera";
-            auto it = std::find_if(cameras.begin(), cameras.end(), [cameraName](std::shared_ptr<donut::engine::SceneCamera> const& camera) {
-                return camera->GetName() == cameraName;
-                });
-            it != cameras.end() ? m_ui.activeSceneCamera = *it : m_ui.activeSceneCamera = cameras[0];
-        }
+        m_ui.activeSceneCamera = getInitialSceneCamera();
+        m_cameraIndex = -1;
 
         // Copy active camera to FirstPersonCamera
         if (m_ui.activeSceneCamera)
@@ -134,6 +134,49 @@ void SampleScene::FinishLoading(nvrhi::IDevice* device, donut::engine::Descripto
     }
 }
 
+std::shared_ptr<SceneCamera> SampleScene::getInitialSceneCamera() const
+{
+    const auto& cameras = m_scene->GetSceneGraph()->GetCameras();
+    if (cameras.empty())
+    {
+        return nullptr;
+    }
+
+    // Override camera
+    if (m_cameraIndex != -1 && m_cameraIndex < cameras.size())
+    {
+        return cameras[m_cameraIndex];
+    }
+
+    std::string cameraName = "DefaultCamera";
+    auto it = std::find_if(cameras.begin(), cameras.end(), [cameraName](std::shared_ptr<donut::engine::SceneCamera> const& camera) {
+        return camera->GetName() == cameraName;
+        });
+    return it != cameras.end() ? *it : cameras[0];
+}
+
+void SampleScene::selectCurvePolyTubeOrders(const uint32_t frameIndex, const uint32_t renderHeight)
+{
+    // Global transforms of the cameras and the hair bounds
+    m_scene->GetSceneGraph()->Refresh(frameIndex);
+
+    float3 viewPosition = float3(0.f, 1.8f, 0.f);
+    float pixelsPerUnit = 0.0f;
+    const auto sceneCamera = getInitialSceneCamera();
+    if (sceneCamera)
+    {
+        viewPosition = sceneCamera->GetViewToWorldMatrix().m_translation;
+
+        const auto perspectiveCamera = std::dynamic_pointer_cast<PerspectiveCamera>(sceneCamera);
+        if (perspectiveCamera && renderHeight > 0)
+        {
+            pixelsPerUnit = float(renderHeight) / (2.0f * tanf(perspectiveCamera->verticalFov * 0.5f));
+        }
+    }
+
+    m_curveTessellation->selectPolyTubeOrders(m_scene->GetSceneGraph()->GetMeshInstances(), m_scenePolyTubeOrders, viewPosition, pixelsPerUnit);
+}
+
 void SampleScene::Unload()
 {
     m_sunLight = nullptr;
@@ -149,6 +192,7 @@ bool SampleScene::Animate(
     const bool isSceneLoaded,
     const uint32_t frameIndex,
     const bool lockCamera,
+    const uint32_t renderHeight,
     bool* isRebuildAsAfterAnimation)
 {
     static bool enableCam = false;
@@ -179,6 +223,7 @@ bool SampleScene::Animate(
     if (m_currentTessellationType != m_ui.hairTessellationType)
     {
         m_currentTessellationType = m_ui.hairTessellationType;
+        m_curveTessellation->requestTessellation(m_currentTessellationType, m_scene->GetSceneGraph()->GetMeshInstances());
         m_curveTessellation->replacingSceneMesh(device, descriptorTable, m_currentTessellationType, m_scene->GetSceneGraph()->GetMeshInstances());
 
         m_scene->FinishedLoading(frameIndex);
@@ -188,9 +233,41 @@ bool SampleScene::Animate(
         return true;
     }
 
+    // Hair LOD follows the camera, a changed LOD replaces the mesh buffers like a tessellation type switch
+    const auto& cameras = m_scene->GetSceneGraph()->GetCameras();
+    if (isSceneLoaded && m_curveTessellation->getCurveLodLevelCount() > 1 && !cameras.empty())
+    {
+        const auto sceneCamera = (PerspectiveCamera*)cameras.at(0).get();
+        const float pixelsPerUnit = float(renderHeight) / (2.0f * tanf(sceneCamera->verticalFov * 0.5f));
+        if (m_curveTessellation->updateCurveLods(m_scene->GetSceneGraph()->GetMeshInstances(), m_camera.GetPosition(), pixelsPerUnit))
+        {
+            m_scene->FinishedLoading(frameIndex);
+
+            *isRebuildAsAfterAnimation = true;
+
+            return true;
+        }
+    }
+
     return m_ui.enableAnimations;
 }
 
+bool SampleScene::UpdateCurveRadiusScale(nvrhi::IDevice* device, nvrhi::CommandListHandle commandList)
+{
+    const auto& meshInstances = m_scene->GetSceneGraph()->GetMeshInstances();
+    if (!m_curveTessellation->rescaleCurveRadius(meshInstances))
+    {
+        return false;
+    }
+
+    commandList->open();
+    m_curveTessellation->uploadCurveRadiusData(commandList, meshInstances);
+    commandList->close();
+    device->executeCommandList(commandList);
+
+    return true;
+}
+
 void SampleScene::importSceneFiles(const std::string& mediaFolder)
 {
     static std::filesystem::path mediaFolderPath;
@@ -37,7 +37,8 @@ public:
               std::shared_ptr<donut::engine::SceneTypeFactory> sceneTypeFactory,
               const std::filesystem::path& sceneFileName);
 
-    void FinishLoading(nvrhi::IDevice* device, donut::engine::DescriptorTableManager* descriptorTable, const uint32_t frameIndex);
+    // renderHeight is used to pick the polytube order of the hair meshes from their projected strand width
+    void FinishLoading(nvrhi::IDevice* device, donut::engine::DescriptorTableManager* descriptorTable, const uint32_t frameIndex, const uint32_t renderHeight);
 
     void Unload();
 
@@ -48,8 +49,13 @@ public:
         const bool isSceneLoaded,
         const uint32_t frameIndex,
         const bool lockCamera,
+        const uint32_t renderHeight,
         bool* isRebuildAsAfterAnimation);
 
+    // Applies a changed hair radius scale to the hair meshes in place and uploads their new vertex data.
+    // Returns true if the scale changed, the hair BLAS then need a rebuild.
+    bool UpdateCurveRadiusScale(nvrhi::IDevice* device, nvrhi::CommandListHandle commandList);
+
     inline void SetCurrentSceneName(const std::string& sceneName)
     {
         if (m_currentScene != sceneName)
@@ -110,6 +116,11 @@ public:
 private:
     void importSceneFiles(const std::string& mediaFolder);
 
+    // Scene camera the view starts from: the -camera override, then "DefaultCamera", then the first camera
+    std::shared_ptr<donut::engine::SceneCamera> getInitialSceneCamera() const;
+
+    void selectCurvePolyTubeOrders(const uint32_t frameIndex, const uint32_t renderHeight);
+
     std::shared_ptr<donut::engine::Scene> m_scene;
 
     std::filesystem::path m_currentScene;
@@ -126,6 +137,7 @@ private:
 
     TessellationType m_currentTessellationType;
     std::shared_ptr<CurveTessellation> m_curveTessellation;
+    std::unordered_map<std::string, uint32_t> m_scenePolyTubeOrders;
 
     bool m_enableAsyncSceneLoading;
     float m_wallclockTime;
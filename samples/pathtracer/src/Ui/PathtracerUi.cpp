@@ -324,6 +324,78 @@ void PathtracerUI::buildUI(void)
             updateAccum |= ImGui::Checkbox("Back Face Culling", &m_ui.enableBackFaceCull); ImGui::SameLine();
             updateAccum |= ImGui::Checkbox("Enable Soft Shadows", &m_ui.enableSoftShadows);
 
+            ImGui::SliderInt("BLAS Build Estimated Scratch (MB)", &m_ui.blasBuildEstimatedScratchBudgetMB, 0, 1024, m_ui.blasBuildEstimatedScratchBudgetMB == 0 ? "Unlimited" : "%d");
+            ImGui::SliderInt("BLAS Build Primitives", &m_ui.blasBuildPrimitiveBudget, 0, 16 * 1024 * 1024,
+                             m_ui.blasBuildPrimitiveBudget == 0 ? "Unlimited" : "%d", ImGuiSliderFlags_Logarithmic);
+            {
+                const BlasBuildScheduler::FrameStats& blasBuildStats = m_app.GetBlasBuildStats();
+                ImGui::Text("BLAS Builds: %u (%.1f MB scratch), %u pending", blasBuildStats.numBuilds,
+                            blasBuildStats.scratchBytes / (1024.0 * 1024.0), blasBuildStats.numPending);
+                const TlasInstanceTableStats& tlasInstanceStats = m_app.GetTlasInstanceStats();
+                ImGui::Text("TLAS Instances: %u, %u dirty in %u ranges (%.1f KB)%s", tlasInstanceStats.numInstances,
+                            tlasInstanceStats.numDirtyInstances, tlasInstanceStats.numRanges,
+                            tlasInstanceStats.numUploadedInstances * sizeof(nvrhi::rt::InstanceDesc) / 1024.0,
+                            m_app.IsTlasBuildSkipped() ? ", build skipped" : "");
+            }
+
+            ImGui::Checkbox("Compact Animated BLAS", &m_ui.enableAnimatedBlasCompaction);
+            ImGui::SliderInt("Animated BLAS Rebuild Interval", &m_ui.animatedBlasRebuildInterval, 0, 3600,
+                             m_ui.animatedBlasRebuildInterval == 0 ? "Never" : "%d refits");
+            ImGui::SliderFloat("Animated BLAS Max Growth", &m_ui.animatedBlasMaxGrowth, 0.0f, 4.0f,
+                               m_ui.animatedBlasMaxGrowth == 0.0f ? "Never" : "%.2f");
+            ImGui::SliderInt("Animated BLAS Rebuilds Per Frame", &m_ui.animatedBlasRebuildsPerFrame, 0, 16,
+                             m_ui.animatedBlasRebuildsPerFrame == 0 ? "Unlimited" : "%d");
+            {
+                const BlasRefitCounters& frameCounters = m_app.GetBlasRefitFrameCounters();
+                const BlasRefitCounters& totalCounters = m_app.GetBlasRefitTotalCounters();
+                ImGui::Text("BLAS Refits: %u, max growth %.2f, rebuilds %u (%u deferred)", frameCounters.numRefits,
+                            frameCounters.maxSurfaceAreaGrowth, frameCounters.getRebuildCount(), frameCounters.numDeferredRebuilds);
+                ImGui::Text("BLAS Refits Total: %u, rebuilds %u by growth, %u by refits", totalCounters.numRefits,
+                            totalCounters.numGrowthRebuilds, totalCounters.numRefitCountRebuilds);
+            }
+            {
+                const BlasCompactionMemoryStats blasMemoryStats = m_app.GetBlasMemoryStats();
+                ImGui::Text("BLAS Memory: %.1f MB, %.1f MB as built, %u/%u compacted", blasMemoryStats.currentBytes / (1024.0 * 1024.0),
+                            blasMemoryStats.builtBytes / (1024.0 * 1024.0), blasMemoryStats.numCompacted, blasMemoryStats.numBlas);
+                if (ImGui::TreeNode("BLAS Memory Report"))
+                {
+                    std::vector<BlasMemoryReportEntry> blasMemoryReport;
+                    m_app.GetBlasMemoryReport(blasMemoryReport);
+                    if (ImGui::BeginTable("BLAS_Memory_Report_Table", 5))
+                    {
+                        ImGui::TableSetupColumn("Mesh");
+                        ImGui::TableSetupColumn("State");
+                        ImGui::TableSetupColumn("Built (MB)");
+                        ImGui::TableSetupColumn("Compacted (MB)");
+                        ImGui::TableSetupColumn("Refits");
+                        ImGui::TableHeadersRow();
+                        for (const auto& entry : blasMemoryReport)
+                        {
+                            ImGui::TableNextColumn();
+                            ImGui::TextUnformatted(entry.meshName.c_str());
+                            ImGui::TableNextColumn();
+                            ImGui::TextUnformatted(getBlasCompactionStateName(entry.blas.state));
+                            ImGui::TableNextColumn();
+                            ImGui::Text("%.2f", entry.blas.builtBytes / (1024.0 * 1024.0));
+                            ImGui::TableNextColumn();
+                            if (entry.blas.compactedBytes > 0)
+                            {
+                                ImGui::Text("%.2f (%.0f%%)", entry.blas.compactedBytes / (1024.0 * 1024.0),
+                                            100.0 * entry.blas.compactedBytes / std::max(entry.blas.builtBytes, (uint64_t)1));
+                            }
+                            else
+                            {
+                                ImGui::TextUnformatted("-");
+                            }
+                            ImGui::TableNextColumn();
+                            ImGui::Text("%u", entry.blas.refitsSinceBuild);
+                        }
+                        ImGui::EndTable();
+                    }
+                    ImGui::TreePop();
+                }
+            }
+
 #ifdef _DEBUG
             if (ImGui::BeginTable("Transmission_Jitter_Mode_Table", 2)) {
                 ImGui::TableNextColumn();
@@ -841,11 +913,38 @@ void PathtracerUI::buildUI(void)
             {
                 ImGui::Indent(12.0f);
 
-                m_showRefreshSceneRemindText |= ImGui::SliderFloat("Radius Scale", &m_ui.hairRadiusScale, 0.01f, 5.0f);
+                if (ImGui::Combo("Tessellation", (int*)&m_ui.hairTessellationType, m_ui.hairTessellationTypeStrings))
+                {
+                    if (m_ui.hairTessellationType == TessellationType::LinearSweptSphere &&
+                        !GetDeviceManager()->GetDevice()->queryFeatureSupport(nvrhi::Feature::LinearSweptSpheres))
+                    {
+                        m_ui.hairTessellationType = TessellationType::DisjointOrthogonalTriangleStrip;
+                    }
+                }
+
+                const auto curveTessellation = m_app.GetScene() ? m_app.GetScene()->GetCurveTessellation() : nullptr;
+                if (curveTessellation)
+                {
+                    constexpr double kBytesToMB = 1.0 / (1024.0 * 1024.0);
+                    ImGui::Text("CPU Cache: Polytube %.1f MB, DOTS %.1f MB, LSS %.1f MB",
+                        curveTessellation->getTessellationCacheBytes(TessellationType::Polytube) * kBytesToMB,
+                        curveTessellation->getTessellationCacheBytes(TessellationType::DisjointOrthogonalTriangleStrip) * kBytesToMB,
+                        curveTessellation->getTessellationCacheBytes(TessellationType::LinearSweptSphere) * kBytesToMB);
+                    ImGui::Text("CPU Cache Peak: %.1f MB", curveTessellation->getTessellationCachePeakBytes() * kBytesToMB);
+                }
+
+                ImGui::SliderFloat("Radius Scale", &m_ui.hairRadiusScale, 0.01f, 5.0f);
+                m_showRefreshSceneRemindText |= ImGui::SliderInt("Polytube Order", &m_ui.hairPolyTubeOrder, 0, RTXCR_CURVE_POLYTUBE_MAX_ORDER,
+                                                                 m_ui.hairPolyTubeOrder == 0 ? "Auto" : "%d", ImGuiSliderFlags_AlwaysClamp);
+                m_showRefreshSceneRemindText |= ImGui::SliderFloat("Resegmentation Error", &m_ui.hairResegmentationError, 0.0f, 0.01f, "%.5f");
+                m_showRefreshSceneRemindText |= ImGui::Checkbox("Morton Strand Order", &m_ui.enableHairStrandReorder);
+                m_showRefreshSceneRemindText |= ImGui::SliderInt("LOD Levels", &m_ui.hairLodLevels, 1, 8);
+                m_showRefreshSceneRemindText |= ImGui::SliderFloat("LOD Strand Keep Ratio", &m_ui.hairLodStrandKeepRatio, 0.05f, 0.95f);
+                ImGui::SliderFloat("LOD Pixel Width", &m_ui.hairLodPixelWidth, 0.1f, 8.0f);
                 if (m_showRefreshSceneRemindText)
                 {
                     ImGui::PushStyleColor(ImGuiCol_Text, IM_COL32(255, 80, 80, 255));
-                    ImGui::Text("Radius Scale is changed. Please refresh scene.");
+                    ImGui::Text("Hair geometry is changed. Please refresh scene.");
                     ImGui::PopStyleColor();
                 }
 
@@ -995,6 +1094,37 @@ void PathtracerUI::buildUI(void)
                     ImGui::SliderFloat("Smoothing Factor", &m_ui.animationSmoothingFactor, 1.0f, 256.0f);
                 }
 
+                ImGui::Checkbox("Compact Line Segments", &m_ui.enableCompactLineSegments);
+                ImGui::Combo("Keyframe Format", &m_ui.morphTargetKeyframeFormat, m_ui.morphTargetKeyframeFormatStrings);
+                if (m_ui.morphTargetKeyframeFormat == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_PCA)
+                {
+                    // Every change decomposes the keyframes again, only applied once the value is entered
+                    float pcaMaxError = m_ui.morphTargetKeyframePcaMaxError;
+                    if (ImGui::InputFloat("PCA Max Error", &pcaMaxError, 0.001f, 0.01f, "%.4f", ImGuiInputTextFlags_EnterReturnsTrue))
+                    {
+                        m_ui.morphTargetKeyframePcaMaxError = std::min(std::max(pcaMaxError, 0.0001f), 1.0f);
+                    }
+                }
+                int keyframeStreamingSlots = m_ui.morphTargetKeyframeStreamingSlots;
+                if (ImGui::InputInt("Keyframe Streaming Slots", &keyframeStreamingSlots, 1, 8, ImGuiInputTextFlags_EnterReturnsTrue))
+                {
+                    m_ui.morphTargetKeyframeStreamingSlots = std::max(keyframeStreamingSlots, 0);
+                }
+                ImGui::Checkbox("Per Segment Morph Kernel", &m_ui.enablePerSegmentMorphKernel);
+                ImGui::Checkbox("Batched Morph Dispatch", &m_ui.enableBatchedMorphDispatch);
+
+                if (const MorphTargetAnimationStats* morphTargetStats = m_app.GetMorphTargetAnimationStats())
+                {
+                    ImGui::Text("Morph: %u meshes, %u dispatches, %u binding sets, %u descriptors",
+                                morphTargetStats->numMeshes, morphTargetStats->numDispatches,
+                                morphTargetStats->numBindingSetsCreated, morphTargetStats->numDescriptorsCreated);
+                    if (m_ui.morphTargetKeyframeStreamingSlots > 0)
+                    {
+                        ImGui::Text("Morph: %u keyframe uploads, %u stalls", morphTargetStats->numKeyframeUploads, morphTargetStats->numKeyframeStalls);
+                    }
+                    ImGui::Text("Morph: CPU %.3f ms, GPU %.3f ms", morphTargetStats->cpuTimeMs, morphTargetStats->gpuTimeMs);
+                }
+
 #if _DEBUG
                 ImGui::Checkbox("Enable Animation Debugging", &m_ui.enableAnimationDebugging);
                 if (m_ui.enableAnimationDebugging)
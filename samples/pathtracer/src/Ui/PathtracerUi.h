@@ -18,6 +18,7 @@
 #include <donut/render/TemporalAntiAliasingPass.h>
 
 #include "../Curve/CurveTessellation.h"
+#include "../Curve/CurveTessellationSettings.h"
 
 #include <NRD.h>
 #include "../Denoiser/NRD/NrdConfig.h"
@@ -81,7 +82,7 @@ enum class ToneMappingOperator : uint32_t
     Reinhard = 1,
 };
 
-struct UIData
+struct UIData : public CurveTessellationSettings
 {
     bool                    showUI = true;
     bool                    enableRandom = true;
@@ -183,8 +184,7 @@ struct UIData
     float                   cuticleAngleInDegrees = 3.0f;
     // Hair Tests
     int                     whiteFurnaceSampleCount = 1000;
-    // Hair Geometry
-    float                   hairRadiusScale = 0.618f;
+    // Hair Geometry: inherited from CurveTessellationSettings
 
     // SSS
     bool                    enableSss = true;
@@ -238,6 +238,20 @@ struct UIData
     bool                    enableAnimationDebugging = false;
     int                     animationKeyFrameIndexOverride = 0;
     float                   animationKeyFrameWeightOverride = 0.0f;
+    bool                    enableCompactLineSegments = false; // 16 bit quantized morph target line segments
+    int                     morphTargetKeyframeFormat = 0; // RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_*: float, half, 10/10/10 bit or PCA basis keyframe offsets
+    const char* const       morphTargetKeyframeFormatStrings = "Full\0Half\0Unorm10\0PCA\0";
+    float                   morphTargetKeyframePcaMaxError = 0.01f; // Relative RMS error target of the PCA keyframe format
+    int                     morphTargetKeyframeStreamingSlots = 0; // Streamed keyframe window per mesh, 0 keeps all keyframes resident
+    bool                    enablePerSegmentMorphKernel = true; // Polytube/DOTS: one morph thread per line segment instead of per vertex
+    bool                    enableBatchedMorphDispatch = false; // One morph target dispatch for all animated meshes
+
+    int                     blasBuildEstimatedScratchBudgetMB = 0; // Estimated scratch memory of the BLAS builds of one frame, 0: unlimited
+    int                     blasBuildPrimitiveBudget = 0; // Primitives of the BLAS builds of one frame, 0: unlimited
+    bool                    enableAnimatedBlasCompaction = false; // Compact the morph target animated BLAS and refit the compacted copy
+    int                     animatedBlasRebuildInterval = 600; // Refits before an animated BLAS is rebuilt, 0: never
+    float                   animatedBlasMaxGrowth = 0.5f; // Growth of the estimated bounds of a refit animated BLAS before it is rebuilt, 0: never
+    int                     animatedBlasRebuildsPerFrame = 1; // Animated BLAS rebuilds started per frame, the most degraded first, 0: unlimited
 
     bool                    recompileShader = false;
 
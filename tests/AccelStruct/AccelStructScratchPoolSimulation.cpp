@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "AccelStruct/AccelStructScratchPoolSimulation.h"
+
+AccelStructScratchPoolSimulationResult AccelStructScratchPooling::simulate(const AccelStructScratchPoolSimulationSettings& settings)
+{
+    constexpr uint64_t kGranularity = 1024 * 1024;
+
+    struct LiveAllocation
+    {
+        uint64_t frame;
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    AccelStructScratchPoolSimulationResult result;
+    AccelStructScratchPool pool;
+    std::vector<LiveAllocation> liveAllocations;
+
+    std::mt19937 random(settings.seed);
+    const double minLogBytes = std::log((double)std::max(settings.minBuildBytes, (uint64_t)1));
+    const double maxLogBytes = std::log((double)std::max(settings.maxBuildBytes, settings.minBuildBytes));
+    std::uniform_real_distribution<double> logBytes(minLogBytes, maxLogBytes);
+    std::uniform_real_distribution<double> largeLogBytes(0.5 * (minLogBytes + maxLogBytes), maxLogBytes);
+
+    for (uint32_t frame = 0; frame < settings.frameCount; ++frame)
+    {
+        pool.beginFrame(frame, settings.framesInFlight);
+        liveAllocations.erase(std::remove_if(liveAllocations.begin(), liveAllocations.end(),
+            [&settings, frame](const LiveAllocation& allocation) { return allocation.frame + settings.framesInFlight < frame; }), liveAllocations.end());
+
+        // A load builds every BLAS at once, the other frames refit a few animated meshes
+        const bool isLoad = (settings.loadInterval > 0 && frame % settings.loadInterval == 0);
+        const uint32_t numBuilds = isLoad ? settings.maxBuildsPerFrame :
+            (uint32_t)(random() % (settings.maxBuildsPerFrame / 4 + 1));
+        for (uint32_t buildIndex = 0; buildIndex < numBuilds; ++buildIndex)
+        {
+            const uint64_t size = (uint64_t)std::exp(isLoad ? largeLogBytes(random) : logBytes(random));
+
+            uint64_t offset = pool.allocate(size);
+            if (offset == AccelStructScratchPool::kInvalidOffset)
+            {
+                // Outgrown: the renderer resizes the pool, the scratch still used by the GPU stays alive until it completes
+                pool.reset(pool.getRecommendedCapacity(settings.framesInFlight, kGranularity));
+                liveAllocations.clear();
+                ++result.numResizes;
+                offset = pool.allocate(size);
+                if (offset == AccelStructScratchPool::kInvalidOffset)
+                {
+                    result.valid = false;
+                    continue;
+                }
+            }
+
+            result.valid &= (offset % AccelStructScratchPool::kDefaultAlignment == 0);
+            result.valid &= (offset + size <= pool.getCapacity());
+            for (const auto& allocation : liveAllocations)
+            {
+                result.valid &= (offset + size <= allocation.offset || allocation.offset + allocation.size <= offset);
+            }
+            liveAllocations.push_back({ frame, offset, size });
+        }
+    }
+
+    result.stats = pool.getStats();
+    return result;
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "AccelStruct/AccelStructScratchPool.h"
+
+// Synthetic acceleration structure build sequence run through the scratch pool of the path tracer, for the tests and the benchmarks
+
+struct AccelStructScratchPoolSimulationSettings
+{
+    uint32_t frameCount = 600;
+    uint32_t framesInFlight = 2;
+    uint32_t maxBuildsPerFrame = 32;
+    uint64_t minBuildBytes = 4 * 1024;
+    uint64_t maxBuildBytes = 64 * 1024 * 1024;
+    uint32_t loadInterval = 200;            // Every loadInterval frames all builds are large, as on a scene load
+    uint32_t seed = 1;
+};
+
+struct AccelStructScratchPoolSimulationResult
+{
+    AccelStructScratchPoolStats stats;
+    uint32_t numResizes = 0;
+    bool valid = true;                      // Live allocations never overlapped and were aligned
+};
+
+namespace AccelStructScratchPooling
+{
+    // Runs a deterministic synthetic build sequence: a random number of builds of log-uniform sizes per frame,
+    // with a load burst every loadInterval frames. The pool starts empty and grows to its recommended capacity
+    // whenever an allocation fails, as in the renderer.
+    AccelStructScratchPoolSimulationResult simulate(const AccelStructScratchPoolSimulationSettings& settings);
+}
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <random>
+
+#include "AccelStruct/AccelStructScratchPool.h"
+#include "AccelStruct/AccelStructScratchPoolSimulation.h"
+#include "TestFramework.h"
+
+namespace
+{
+    struct LiveAllocation
+    {
+        uint64_t frame;
+        uint64_t offset;
+        uint64_t size;
+    };
+}
+
+// Offsets of a small ring by hand: padding, reuse of completed frames, a skipped ring end and an allocation that doesn't fit
+TEST(AccelStructScratchPool, RingOffsets)
+{
+    AccelStructScratchPool pool;
+    pool.reset(4096);
+    CHECK(pool.getCapacity() == 4096);
+    CHECK(pool.getUsedBytes() == 0);
+
+    pool.beginFrame(0, 1);
+    CHECK(pool.allocate(1000) == 0);
+    CHECK(pool.allocate(1000) == 1024);
+    CHECK(pool.getStats().alignmentWasteBytes == 24);
+
+    pool.beginFrame(1, 1);
+    CHECK(pool.allocate(1000) == 2048);
+    CHECK(pool.getUsedBytes() == 3048);
+    CHECK(pool.getLiveAllocationCount() == 3);
+
+    // Frame 0 completed, the allocation skips the ring end that is too small and starts over where frame 0 was
+    pool.beginFrame(2, 1);
+    CHECK(pool.getLiveAllocationCount() == 1);
+    CHECK(pool.allocate(1500) == 0);
+    CHECK(pool.getStats().wrapWasteBytes == 4096 - 3048);
+    CHECK(pool.getUsedBytes() == 4096 - 2024 + 1500);
+
+    // The padded allocation would reach into frame 1
+    CHECK(pool.allocate(600) == AccelStructScratchPool::kInvalidOffset);
+
+    const AccelStructScratchPoolStats& stats = pool.getStats();
+    CHECK(stats.numAllocations == 4);
+    CHECK(stats.numFailedAllocations == 1);
+    CHECK(stats.alignmentWasteBytes == 48);
+    CHECK(stats.peakUsedBytes == 3572);
+    CHECK(stats.peakRequestedBytes == 3000);
+    CHECK(stats.peakWastedBytes == 3572 - 2500);
+    // The failed allocation asked for the frame so far, skipped ring end included, its own 600 bytes and worst case padding
+    CHECK(stats.peakBatchBytes == (4096 - 3048) + 1500 + 600 + AccelStructScratchPool::kDefaultAlignment - 1);
+    CHECK(pool.getRecommendedCapacity(1, 0) == 3 * stats.peakBatchBytes);
+    CHECK(pool.getRecommendedCapacity(1, 1024) == 10240);
+
+    // A reset drops the allocations and keeps the statistics
+    pool.reset(8192);
+    CHECK(pool.getLiveAllocationCount() == 0);
+    CHECK(pool.getUsedBytes() == 0);
+    CHECK(pool.getStats().numAllocations == 4);
+}
+
+// Random allocations of every alignment are aligned, inside the pool and never overlap the live ones of the frames in flight
+TEST(AccelStructScratchPool, AllocationsDontOverlap)
+{
+    std::mt19937 rng(221);
+    for (uint32_t framesInFlight = 0; framesInFlight <= 3; ++framesInFlight)
+    {
+        AccelStructScratchPool pool;
+        pool.reset(1024 * 1024);
+        std::vector<LiveAllocation> liveAllocations;
+        uint32_t numAllocations = 0;
+        uint32_t numFailedAllocations = 0;
+        for (uint64_t frame = 0; frame < 500; ++frame)
+        {
+            pool.beginFrame(frame, framesInFlight);
+            liveAllocations.erase(std::remove_if(liveAllocations.begin(), liveAllocations.end(),
+                [framesInFlight, frame](const LiveAllocation& allocation) { return allocation.frame + framesInFlight < frame; }), liveAllocations.end());
+            CHECK(pool.getLiveAllocationCount() == liveAllocations.size());
+
+            const uint32_t numBuilds = rng() % 8;
+            for (uint32_t buildIndex = 0; buildIndex < numBuilds; ++buildIndex)
+            {
+                const uint64_t size = 1 + rng() % 100000;
+                const uint64_t alignment = 1ull << (rng() % 13);
+                const uint64_t offset = pool.allocate(size, alignment);
+                if (offset == AccelStructScratchPool::kInvalidOffset)
+                {
+                    ++numFailedAllocations;
+                    continue;
+                }
+                ++numAllocations;
+
+                CHECK(offset % alignment == 0);
+                CHECK(offset + size <= pool.getCapacity());
+                for (const LiveAllocation& allocation : liveAllocations)
+                {
+                    CHECK(offset + size <= allocation.offset || allocation.offset + allocation.size <= offset);
+                }
+                liveAllocations.push_back({ frame, offset, size });
+
+                uint64_t liveBytes = 0;
+                for (const LiveAllocation& allocation : liveAllocations)
+                {
+                    liveBytes += allocation.size;
+                }
+                CHECK(liveBytes <= pool.getUsedBytes());
+                CHECK(pool.getUsedBytes() <= pool.getCapacity());
+            }
+        }
+
+        const AccelStructScratchPoolStats& stats = pool.getStats();
+        CHECK(stats.numAllocations == numAllocations);
+        CHECK(stats.numFailedAllocations == numFailedAllocations);
+        CHECK(stats.peakRequestedBytes <= stats.peakUsedBytes);
+        CHECK(stats.peakUsedBytes <= pool.getCapacity());
+        CHECK(numAllocations > 1000);
+    }
+}
+
+// A pool grown to its recommended capacity holds a repeating frame of builds with every frame in flight,
+// whatever ring end it has to skip
+TEST(AccelStructScratchPool, RecommendedCapacityHoldsSteadyState)
+{
+    constexpr uint64_t kGranularity = 1024 * 1024;
+    for (uint32_t framesInFlight = 0; framesInFlight <= 3; ++framesInFlight)
+    {
+        AccelStructScratchPool pool;
+        uint32_t numResizes = 0;
+        uint32_t numLateResizes = 0;
+        for (uint64_t frame = 0; frame < 200; ++frame)
+        {
+            pool.beginFrame(frame, framesInFlight);
+            for (const uint64_t size : { 300000ull, 1000000ull, 50000ull })
+            {
+                uint64_t offset = pool.allocate(size);
+                if (offset == AccelStructScratchPool::kInvalidOffset)
+                {
+                    pool.reset(pool.getRecommendedCapacity(framesInFlight, kGranularity));
+                    ++numResizes;
+                    numLateResizes += (frame > framesInFlight) ? 1 : 0;
+                    offset = pool.allocate(size);
+                }
+                REQUIRE(offset != AccelStructScratchPool::kInvalidOffset);
+            }
+        }
+
+        // The empty pool grows on the first allocation, then once the first frame shows its whole batch
+        CHECK(numResizes <= 2);
+        CHECK(numLateResizes == 0);
+        CHECK(pool.getCapacity() % kGranularity == 0);
+        CHECK(pool.getStats().peakRequestedBytes == (framesInFlight + 1) * 1350000ull);
+    }
+}
+
+// Synthetic build sequences stay valid for every number of frames in flight, burst size and seed
+TEST(AccelStructScratchPool, SimulatedSequences)
+{
+    for (uint32_t framesInFlight = 1; framesInFlight <= 3; ++framesInFlight)
+    {
+        for (const uint64_t maxBuildBytes : { 64ull * 1024, 16ull * 1024 * 1024, 256ull * 1024 * 1024 })
+        {
+            for (uint32_t seed = 1; seed <= 3; ++seed)
+            {
+                AccelStructScratchPoolSimulationSettings settings;
+                settings.frameCount = 400;
+                settings.framesInFlight = framesInFlight;
+                settings.maxBuildBytes = maxBuildBytes;
+                settings.seed = seed;
+                const AccelStructScratchPoolSimulationResult result = AccelStructScratchPooling::simulate(settings);
+                CHECK(result.valid);
+                CHECK(result.numResizes >= 1);
+                CHECK(result.numResizes == result.stats.numFailedAllocations);
+                CHECK(result.stats.capacity >= result.stats.peakUsedBytes);
+                CHECK(result.stats.peakRequestedBytes <= result.stats.peakUsedBytes);
+                CHECK(result.stats.peakWastedBytes < result.stats.peakUsedBytes);
+                CHECK(result.stats.numAllocations > 0);
+            }
+        }
+    }
+}
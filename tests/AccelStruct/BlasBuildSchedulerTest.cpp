@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <random>
+
+#include "AccelStruct/BlasBuildScheduler.h"
+#include "AccelStruct/BlasBuildSchedulerSimulation.h"
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+namespace
+{
+    BlasBuildRequest makeRequest(const uint64_t key, const uint32_t primitiveCount, const uint32_t priority)
+    {
+        BlasBuildRequest request;
+        request.key = key;
+        request.primitiveCount = primitiveCount;
+        request.scratchBytes = BlasBuildScheduler::estimateScratchBytes(primitiveCount);
+        request.priority = priority;
+        return request;
+    }
+}
+
+// Every frame stays within the budget, or builds a single request that alone exceeds it
+TEST(BlasBuildScheduler, FramesStayWithinBudget)
+{
+    std::mt19937 rng(211);
+    std::uniform_int_distribution<uint32_t> primitiveCounts(1, 30000);
+
+    BlasBuildBudget budget;
+    budget.maxPrimitives = 100000;
+    budget.maxScratchBytes = BlasBuildScheduler::estimateScratchBytes(80000);
+    BlasBuildScheduler scheduler;
+    scheduler.setBudget(budget);
+
+    std::vector<BlasBuildRequest> builds;
+    uint32_t numBuilt = 0;
+    uint32_t numFramesOutsideBudget = 0;
+    for (uint32_t frame = 0; frame < 400; ++frame)
+    {
+        if (frame < 200)
+        {
+            for (uint32_t request = 0; request < 4; ++request)
+            {
+                // Now and then a BLAS larger than the budget
+                const uint32_t primitiveCount = (rng() % 50 == 0) ? 150000 : primitiveCounts(rng);
+                scheduler.enqueue(makeRequest(frame * 4 + request, primitiveCount, rng() % 5));
+            }
+        }
+
+        builds.clear();
+        scheduler.schedule(builds);
+        const BlasBuildScheduler::FrameStats& stats = scheduler.getFrameStats();
+        CHECK(stats.numBuilds == builds.size());
+        CHECK(stats.numPending == scheduler.getPendingCount());
+        CHECK(builds.size() > 0 || scheduler.getPendingCount() == 0);
+
+        uint64_t scratchBytes = 0;
+        uint64_t primitives = 0;
+        for (const BlasBuildRequest& build : builds)
+        {
+            scratchBytes += build.scratchBytes;
+            primitives += build.primitiveCount;
+            CHECK(!scheduler.isPending(build.key));
+        }
+        CHECK(stats.scratchBytes == scratchBytes && stats.primitives == primitives);
+
+        const bool withinBudget = scratchBytes <= budget.maxScratchBytes && primitives <= budget.maxPrimitives;
+        numFramesOutsideBudget += (withinBudget || builds.size() == 1) ? 0 : 1;
+        CHECK(stats.overBudget == !withinBudget);
+        numBuilt += (uint32_t)builds.size();
+    }
+    CHECK(numFramesOutsideBudget == 0);
+    CHECK(numBuilt == 800);
+    CHECK(scheduler.getPendingCount() == 0);
+}
+
+// A higher priority is worth agingFrames frames of waiting per level, a large low priority request is built once
+// kMaxPriority * agingFrames frames of high priority requests are done, even when they keep filling the budget
+TEST(BlasBuildScheduler, AgingBoundsTheWait)
+{
+    BlasBuildBudget budget;
+    budget.maxPrimitives = 100;
+    budget.agingFrames = 8;
+    BlasBuildScheduler scheduler;
+    scheduler.setBudget(budget);
+
+    constexpr uint64_t kLargeKey = ~0ull;
+    scheduler.enqueue(makeRequest(kLargeKey, 1000, 0));
+
+    std::vector<BlasBuildRequest> builds;
+    uint32_t largeBuildFrame = 0;
+    uint32_t numFramesOutsideBudget = 0;
+    for (uint32_t frame = 0; frame < 40 && largeBuildFrame == 0; ++frame)
+    {
+        // Ten small high priority requests a frame fill the budget exactly
+        for (uint32_t request = 0; request < 10; ++request)
+        {
+            scheduler.enqueue(makeRequest(frame * 10 + request, 10, BlasBuildScheduler::kMaxPriority));
+        }
+
+        builds.clear();
+        scheduler.schedule(builds);
+        for (const BlasBuildRequest& build : builds)
+        {
+            if (build.key == kLargeKey)
+            {
+                largeBuildFrame = frame;
+                // Built first, alone
+                CHECK(builds.size() == 1);
+                CHECK(scheduler.getFrameStats().overBudget);
+                CHECK(scheduler.getFrameStats().maxWaitFrames == frame);
+            }
+        }
+        numFramesOutsideBudget += (largeBuildFrame == 0 && scheduler.getFrameStats().primitives > budget.maxPrimitives) ? 1 : 0;
+    }
+
+    // The small requests of frame kMaxPriority * agingFrames tie with the large one and go first, being smaller
+    CHECK(largeBuildFrame == BlasBuildScheduler::kMaxPriority * budget.agingFrames + 1);
+    CHECK(numFramesOutsideBudget == 0);
+}
+
+// A request for a pending key replaces it in place: the age stays, the priority never drops
+TEST(BlasBuildScheduler, RequeueKeepsPlace)
+{
+    BlasBuildBudget budget;
+    budget.maxPrimitives = 1;
+    budget.agingFrames = 8;
+    BlasBuildScheduler scheduler;
+    scheduler.setBudget(budget);
+
+    scheduler.enqueue(makeRequest(1, 10, 2));
+    scheduler.enqueue(makeRequest(2, 5, 1));
+    scheduler.enqueue(makeRequest(1, 50, 0));
+    CHECK(scheduler.getPendingCount() == 2);
+    CHECK(scheduler.isPending(1) && scheduler.isPending(2));
+    CHECK(!scheduler.isPending(3));
+
+    std::vector<BlasBuildRequest> builds;
+    scheduler.schedule(builds);
+    REQUIRE(builds.size() == 1);
+    CHECK(builds[0].key == 1);
+    CHECK(builds[0].primitiveCount == 50);
+    CHECK(builds[0].priority == 2);
+    CHECK(!scheduler.isPending(1) && scheduler.isPending(2));
+
+    // The schedule moved key 2, a new request for it still finds its place
+    scheduler.enqueue(makeRequest(2, 7, 1));
+    CHECK(scheduler.getPendingCount() == 1);
+
+    // Priorities above kMaxPriority are clamped, key 3 then overtakes key 2, which has waited fewer frames than its lower priority is worth
+    scheduler.enqueue(makeRequest(3, 1, 100));
+    builds.clear();
+    scheduler.schedule(builds);
+    REQUIRE(builds.size() == 1);
+    CHECK(builds[0].key == 3);
+    CHECK(builds[0].priority == BlasBuildScheduler::kMaxPriority);
+    builds.clear();
+    scheduler.schedule(builds);
+    REQUIRE(builds.size() == 1);
+    CHECK(builds[0].key == 2);
+    CHECK(builds[0].primitiveCount == 7);
+
+    builds.clear();
+    scheduler.schedule(builds);
+    CHECK(builds.empty());
+    CHECK(scheduler.getFrameStats().numBuilds == 0);
+
+    scheduler.enqueue(makeRequest(4, 1, 0));
+    scheduler.clear();
+    CHECK(scheduler.getPendingCount() == 0);
+    CHECK(!scheduler.isPending(4));
+}
+
+// Random workloads with repeated keys and oversized builds are fully built within the budget
+TEST(BlasBuildScheduler, SimulatedWorkloads)
+{
+    std::mt19937 rng(212);
+    for (const uint32_t maxPrimitives : { 0u, 20000u, 100000u, 1000000u })
+    {
+        std::vector<BlasBuildRequest> requests;
+        std::vector<uint32_t> arrivalFrames;
+        for (uint32_t requestIndex = 0; requestIndex < 1000; ++requestIndex)
+        {
+            requests.push_back(makeRequest(rng() % 600, 1 + rng() % 50000, rng() % 4));
+            arrivalFrames.push_back((requestIndex < 300) ? 0 : rng() % 200);
+        }
+
+        BlasBuildBudget budget;
+        budget.maxPrimitives = maxPrimitives;
+        budget.maxScratchBytes = maxPrimitives > 0 ? BlasBuildScheduler::estimateScratchBytes(maxPrimitives) : 0;
+        const BlasBuildScheduleStats stats = BlasBuildScheduling::simulate(requests, arrivalFrames, budget);
+        CHECK(stats.valid);
+        CHECK(stats.numRequests == 1000);
+        if (maxPrimitives == 0)
+        {
+            // Everything is built the frame it arrives
+            CHECK(stats.maxWaitFrames == 0);
+            CHECK(stats.numOverBudgetFrames == 0);
+        }
+        else
+        {
+            CHECK(stats.maxPrimitivesPerFrame <= std::max(maxPrimitives, 50000u));
+            CHECK(stats.numOverBudgetFrames == 0 || maxPrimitives < 50000);
+        }
+    }
+}
+
+// The budget is enforced against the estimate, not the driver's prebuild size which nvrhi doesn't report: pins the estimate
+// against the LSS and triangle primitive counts of the same strands, worked out by hand
+TEST(BlasBuildScheduler, ScratchEstimate)
+{
+    CHECK(BlasBuildScheduler::estimateScratchBytes(0) == 64 * 1024);
+    CHECK(BlasBuildScheduler::estimateScratchBytes(1000) == 64 * 1024 + 64000);
+    CHECK(BlasBuildScheduler::estimateScratchBytes(1000000) == 64 * 1024 + 64000000);
+    // Computed in 64 bits, the scratch of 64M primitives and more overflows 32 bits
+    CHECK(BlasBuildScheduler::estimateScratchBytes(0xffffffffu) == 64 * 1024 + 64ull * 0xffffffffull);
+
+    // 64 strands of 9 points: 512 segments, one swept sphere each with LSS, 4 triangles with DOTS and 2 per tube side with Polytube
+    SyntheticGroomDesc groomDesc;
+    groomDesc.minPointsPerStrand = 9;
+    groomDesc.maxPointsPerStrand = 9;
+    const std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(groomDesc) };
+    CurveTessellation curveTessellation(meshInstances, CurveTessellationSettings());
+    REQUIRE(curveTessellation.GetCurvesLineSegments(groomDesc.name).size() == 512);
+    const uint64_t polyTubeOrder = curveTessellation.GetCurvePolyTubeOrder(groomDesc.name);
+
+    for (uint32_t type = 0; type < (uint32_t)TessellationType::Count; ++type)
+    {
+        const TessellationType tessellationType = (TessellationType)type;
+        curveTessellation.requestTessellation(tessellationType, meshInstances);
+        CurveTessellation::CurveMeshStats stats;
+        REQUIRE(curveTessellation.getCurveMeshStats(tessellationType, meshInstances, 0, stats));
+
+        const uint64_t primitiveCount = (tessellationType == TessellationType::Polytube) ? 512 * polyTubeOrder * 2 :
+            (tessellationType == TessellationType::DisjointOrthogonalTriangleStrip) ? 512 * 4 : 512;
+        CHECK(BlasBuildScheduler::estimateScratchBytes(stats.numPrimitives) == 64 * 1024 + primitiveCount * 64);
+    }
+}
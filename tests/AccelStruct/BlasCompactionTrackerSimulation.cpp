@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "AccelStruct/BlasCompactionTrackerSimulation.h"
+
+BlasCompactionSimulationResult BlasCompaction::simulate(const BlasCompactionSimulationSettings& settings)
+{
+    BlasCompactionSimulationResult result;
+
+    BlasCompactionPolicy policy;
+    policy.maxCompactionWaitFrames = settings.compactionLatencyFrames + 1;
+
+    BlasCompactionTracker tracker;
+    tracker.setPolicy(policy);
+
+    // Frame of the last build of every BLAS, the GPU compacts it compactionLatencyFrames later
+    std::vector<uint32_t> buildFrames(settings.blasCount, 0);
+    const uint64_t compactedBytes = (uint64_t)((double)settings.builtBytes * settings.compactionRatio);
+
+    for (uint32_t frame = 0; frame < settings.frameCount; ++frame)
+    {
+        tracker.beginFrame();
+
+        if (settings.invalidateInterval > 0 && frame > 0 && frame % settings.invalidateInterval == 0)
+        {
+            tracker.invalidate((frame / settings.invalidateInterval) % settings.blasCount);
+        }
+
+        for (uint32_t blasIndex = 0; blasIndex < settings.blasCount; ++blasIndex)
+        {
+            if (tracker.needsBuild(blasIndex))
+            {
+                result.numRebuilds += (tracker.getState(blasIndex) == BlasCompactionState::RebuildDue) ? 1 : 0;
+                tracker.onBuilt(blasIndex, settings.builtBytes, true);
+                buildFrames[blasIndex] = frame;
+                ++result.numBuilds;
+                continue;
+            }
+
+            result.valid &= tracker.isRefittable(blasIndex);
+            result.numCompactedRefits += (tracker.getEntry(blasIndex)->compactedBytes > 0) ? 1 : 0;
+            tracker.onRefit(blasIndex);
+            ++result.numRefits;
+            result.maxRefitsSinceBuild = std::max(result.maxRefitsSinceBuild, tracker.getEntry(blasIndex)->refitsSinceBuild);
+
+            // Compacted after the refits of the frame, as the renderer compacts before the TLAS build
+            if (frame - buildFrames[blasIndex] == settings.compactionLatencyFrames && tracker.getState(blasIndex) == BlasCompactionState::Built)
+            {
+                // A build is compacted once
+                result.valid &= tracker.onCompacted(blasIndex, compactedBytes);
+                result.valid &= !tracker.onCompacted(blasIndex, compactedBytes);
+                ++result.numCompactions;
+            }
+
+            // The refit policy of the renderer, with the refit count alone. Rebuilds wait for the compaction.
+            const BlasCompactionState state = tracker.getState(blasIndex);
+            if (settings.rebuildInterval > 0 && tracker.getEntry(blasIndex)->refitsSinceBuild >= settings.rebuildInterval &&
+                (state == BlasCompactionState::Built || state == BlasCompactionState::Compacted) && !tracker.isCompactionPending(blasIndex))
+            {
+                tracker.requestRebuild(blasIndex);
+            }
+        }
+    }
+
+    for (uint32_t blasIndex = 0; blasIndex < settings.blasCount; ++blasIndex)
+    {
+        const BlasCompactionTracker::Entry* const entry = tracker.getEntry(blasIndex);
+        result.valid &= (entry && entry->numCompactions <= entry->numBuilds);
+    }
+    result.memoryStats = tracker.getMemoryStats();
+    return result;
+}
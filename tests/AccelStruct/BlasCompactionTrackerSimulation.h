@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "AccelStruct/BlasCompactionTracker.h"
+
+// Animated BLAS run through the compaction tracker of the path tracer frame by frame, for the tests and the benchmarks
+
+struct BlasCompactionSimulationSettings
+{
+    uint32_t frameCount = 600;
+    uint32_t blasCount = 8;
+    uint32_t rebuildInterval = 120;         // Refits since the build after which a compacted BLAS is rebuilt, 0 never
+    uint32_t compactionLatencyFrames = 3;   // Frames from a build until the compaction, the frames in flight plus one
+    uint32_t invalidateInterval = 0;        // Every invalidateInterval frames one BLAS changes its geometry, 0 never
+    uint64_t builtBytes = 64 * 1024 * 1024;
+    float compactionRatio = 0.5f;           // Compacted size of a BLAS relative to its build
+};
+
+struct BlasCompactionSimulationResult
+{
+    uint32_t numBuilds = 0;
+    uint32_t numRebuilds = 0;               // Builds because the rebuild was due
+    uint32_t numCompactions = 0;
+    uint32_t numRefits = 0;
+    uint32_t numCompactedRefits = 0;        // Refits of a compacted BLAS
+    uint32_t maxRefitsSinceBuild = 0;
+    BlasCompactionMemoryStats memoryStats;  // At the end
+    bool valid = true;                      // Every transition was accepted, every build compacted at most once
+};
+
+namespace BlasCompaction
+{
+    // Runs blasCount animated BLAS through the lifecycle as the renderer does: every frame each BLAS is built when it
+    // needs a build and refit otherwise, and compacted compactionLatencyFrames frames after its build.
+    BlasCompactionSimulationResult simulate(const BlasCompactionSimulationSettings& settings);
+}
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include "AccelStruct/BlasCompactionTracker.h"
+#include "AccelStruct/BlasCompactionTrackerSimulation.h"
+#include "TestFramework.h"
+
+// One BLAS through every transition: build, refit, compaction, rebuild, invalidation and removal
+TEST(BlasCompactionTracker, Lifecycle)
+{
+    BlasCompactionTracker tracker;
+    CHECK(tracker.getState(1) == BlasCompactionState::Unbuilt);
+    CHECK(tracker.getEntry(1) == nullptr);
+    CHECK(tracker.needsBuild(1));
+    CHECK(!tracker.isRefittable(1));
+    CHECK(!tracker.onCompacted(1, 400));
+
+    tracker.onBuilt(1, 1000, true);
+    CHECK(tracker.getState(1) == BlasCompactionState::Built);
+    CHECK(!tracker.needsBuild(1));
+    CHECK(tracker.isRefittable(1));
+    CHECK(tracker.isCompactionPending(1));
+    CHECK(tracker.hasPendingCompactions());
+
+    tracker.beginFrame();
+    tracker.onRefit(1);
+    CHECK(tracker.getEntry(1)->refitsSinceBuild == 1);
+
+    // A build is compacted once
+    CHECK(tracker.onCompacted(1, 400));
+    CHECK(!tracker.onCompacted(1, 300));
+    CHECK(tracker.getState(1) == BlasCompactionState::Compacted);
+    CHECK(tracker.getEntry(1)->compactedBytes == 400);
+    CHECK(!tracker.isCompactionPending(1));
+    tracker.onRefit(1);
+
+    // A BLAS with a rebuild due keeps refitting, the compacted size stays until the rebuild
+    tracker.requestRebuild(1);
+    CHECK(tracker.getState(1) == BlasCompactionState::RebuildDue);
+    CHECK(tracker.needsBuild(1));
+    CHECK(tracker.isRefittable(1));
+    CHECK(!tracker.onCompacted(1, 400));
+    tracker.onRefit(1);
+    CHECK(tracker.getEntry(1)->refitsSinceBuild == 3);
+    CHECK(tracker.getMemoryStats().numCompacted == 1);
+
+    tracker.beginFrame();
+    tracker.onBuilt(1, 1200, true);
+    const BlasCompactionTracker::Entry* entry = tracker.getEntry(1);
+    REQUIRE(entry != nullptr);
+    CHECK(entry->state == BlasCompactionState::Built);
+    CHECK(entry->builtBytes == 1200);
+    CHECK(entry->compactedBytes == 0);
+    CHECK(entry->buildFrame == 2);
+    CHECK(entry->refitsSinceBuild == 0);
+    CHECK(entry->numBuilds == 2);
+    CHECK(entry->numCompactions == 1);
+
+    // An invalidated BLAS can't be refit or compacted, its sizes stay in the report until the next build
+    tracker.invalidate(1);
+    CHECK(tracker.getState(1) == BlasCompactionState::Unbuilt);
+    CHECK(tracker.needsBuild(1));
+    CHECK(!tracker.isRefittable(1));
+    CHECK(!tracker.isCompactionPending(1));
+    CHECK(!tracker.onCompacted(1, 400));
+    CHECK(tracker.getMemoryStats().builtBytes == 1200);
+    tracker.requestRebuild(1);
+    CHECK(tracker.getState(1) == BlasCompactionState::Unbuilt);
+
+    tracker.remove(1);
+    CHECK(tracker.getEntry(1) == nullptr);
+    CHECK(tracker.getMemoryStats().numBlas == 0);
+
+    // Unknown keys are left alone
+    tracker.invalidate(2);
+    tracker.requestRebuild(2);
+    CHECK(tracker.getEntry(2) == nullptr);
+}
+
+// A compactable BLAS is pending for maxCompactionWaitFrames frames, a BLAS built without AllowCompaction never is
+TEST(BlasCompactionTracker, CompactionWait)
+{
+    BlasCompactionPolicy policy;
+    policy.maxCompactionWaitFrames = 3;
+    BlasCompactionTracker tracker;
+    tracker.setPolicy(policy);
+    CHECK(tracker.getPolicy().maxCompactionWaitFrames == 3);
+
+    tracker.onBuilt(1, 1000, true);
+    tracker.onBuilt(2, 1000, false);
+    CHECK(!tracker.isCompactionPending(2));
+    CHECK(!tracker.onCompacted(2, 500));
+    CHECK(tracker.getState(2) == BlasCompactionState::Built);
+
+    for (uint32_t frame = 1; frame < 3; ++frame)
+    {
+        tracker.beginFrame();
+        CHECK(tracker.isCompactionPending(1));
+    }
+    tracker.beginFrame();
+    CHECK(!tracker.isCompactionPending(1));
+    CHECK(!tracker.hasPendingCompactions());
+
+    // A late compaction is still accepted
+    CHECK(tracker.onCompacted(1, 500));
+
+    tracker.clear();
+    CHECK(tracker.getEntry(1) == nullptr && tracker.getEntry(2) == nullptr);
+}
+
+// The memory report adds the current size of every BLAS, compacted or not
+TEST(BlasCompactionTracker, MemoryStats)
+{
+    BlasCompactionTracker tracker;
+    tracker.onBuilt(1, 1000, true);
+    tracker.onBuilt(2, 2000, true);
+    tracker.onBuilt(3, 4000, false);
+    tracker.onBuilt(4, 8000, true);
+    CHECK(tracker.onCompacted(1, 300));
+    CHECK(tracker.onCompacted(4, 5000));
+    tracker.requestRebuild(4);
+
+    BlasCompactionMemoryStats stats = tracker.getMemoryStats();
+    CHECK(stats.numBlas == 4);
+    CHECK(stats.builtBytes == 15000);
+    CHECK(stats.currentBytes == 300 + 2000 + 4000 + 5000);
+    CHECK(stats.numCompacted == 2);
+    CHECK(stats.numPendingCompactions == 1);
+
+    // A new build drops the compacted size
+    tracker.onBuilt(4, 8000, true);
+    stats = tracker.getMemoryStats();
+    CHECK(stats.currentBytes == 300 + 2000 + 4000 + 8000);
+    CHECK(stats.numCompacted == 1);
+    CHECK(stats.numPendingCompactions == 2);
+}
+
+// Animated BLAS are compacted after every build and rebuilt every rebuildInterval refits, with and without geometry changes
+TEST(BlasCompactionTracker, SimulatedLifecycles)
+{
+    // Built at frame 0, compacted at frame 3 and rebuilt the frame after its 120th refit: builds at 0, 121, 242, 363 and 484
+    BlasCompactionSimulationSettings settings;
+    BlasCompactionSimulationResult result = BlasCompaction::simulate(settings);
+    CHECK(result.valid);
+    CHECK(result.numBuilds == 5 * settings.blasCount);
+    CHECK(result.numRebuilds == 4 * settings.blasCount);
+    CHECK(result.numCompactions == result.numBuilds);
+    CHECK(result.numRefits == (settings.frameCount - 5) * settings.blasCount);
+    CHECK(result.numCompactedRefits == (4 * 117 + 112) * settings.blasCount);
+    CHECK(result.maxRefitsSinceBuild == settings.rebuildInterval);
+    CHECK(result.memoryStats.numBlas == settings.blasCount);
+    CHECK(result.memoryStats.numCompacted == settings.blasCount);
+    CHECK(result.memoryStats.numPendingCompactions == 0);
+    CHECK(result.memoryStats.currentBytes * 2 == result.memoryStats.builtBytes);
+
+    for (const uint32_t invalidateInterval : { 0u, 7u, 50u })
+    {
+        for (const uint32_t rebuildInterval : { 0u, 5u, 120u })
+        {
+            for (const uint32_t compactionLatencyFrames : { 1u, 3u })
+            {
+                settings.invalidateInterval = invalidateInterval;
+                settings.rebuildInterval = rebuildInterval;
+                settings.compactionLatencyFrames = compactionLatencyFrames;
+                result = BlasCompaction::simulate(settings);
+                CHECK(result.valid);
+
+                // Every build is the first one, follows a geometry change or was due
+                const uint32_t numInvalidations = invalidateInterval > 0 ? (settings.frameCount - 1) / invalidateInterval : 0;
+                CHECK(result.numBuilds == settings.blasCount + numInvalidations + result.numRebuilds);
+                CHECK(result.numBuilds + result.numRefits == settings.frameCount * settings.blasCount);
+                CHECK(result.numCompactions <= result.numBuilds);
+                CHECK(result.numCompactions == result.numBuilds || invalidateInterval > 0);
+                CHECK(rebuildInterval == 0 || result.maxRefitsSinceBuild <= rebuildInterval);
+                CHECK(rebuildInterval == 0 || invalidateInterval > 0 || result.maxRefitsSinceBuild == rebuildInterval);
+                CHECK(result.numRebuilds == 0 || rebuildInterval > 0);
+            }
+        }
+    }
+}
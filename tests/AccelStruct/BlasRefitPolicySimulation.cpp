@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+
+#include "AccelStruct/BlasRefitPolicySimulation.h"
+
+BlasRefitSimulationResult BlasRefit::simulate(const std::vector<std::vector<float>>& surfaceAreas, const BlasRefitPolicySettings& settings)
+{
+    BlasRefitSimulationResult result;
+
+    BlasRefitPolicy policy;
+    policy.setSettings(settings);
+
+    size_t numFrames = 0;
+    for (size_t blasIndex = 0; blasIndex < surfaceAreas.size(); ++blasIndex)
+    {
+        numFrames = std::max(numFrames, surfaceAreas[blasIndex].size());
+        if (!surfaceAreas[blasIndex].empty())
+        {
+            policy.onBuilt(blasIndex, surfaceAreas[blasIndex][0]);
+        }
+    }
+
+    // Frames each BLAS has been due
+    std::vector<uint32_t> dueFrames(surfaceAreas.size(), 0);
+    std::vector<uint64_t> rebuilds;
+    double growthSum = 0.0;
+    for (size_t frame = 1; frame < numFrames; ++frame)
+    {
+        policy.beginFrame();
+        for (size_t blasIndex = 0; blasIndex < surfaceAreas.size(); ++blasIndex)
+        {
+            if (frame < surfaceAreas[blasIndex].size())
+            {
+                policy.onRefit(blasIndex, surfaceAreas[blasIndex][frame], true);
+                growthSum += policy.getSurfaceAreaGrowth(blasIndex);
+
+                const bool isDue = (settings.maxSurfaceAreaGrowth > 0.0f && policy.getSurfaceAreaGrowth(blasIndex) >= settings.maxSurfaceAreaGrowth) ||
+                                   (settings.maxRefits > 0 && policy.getRefitCount(blasIndex) >= settings.maxRefits);
+                dueFrames[blasIndex] = isDue ? dueFrames[blasIndex] + 1 : 0;
+            }
+        }
+
+        rebuilds.clear();
+        policy.selectRebuilds(rebuilds);
+        result.valid &= (settings.maxRebuildsPerFrame == 0 || rebuilds.size() <= settings.maxRebuildsPerFrame);
+        result.maxRebuildsPerFrame = std::max(result.maxRebuildsPerFrame, (uint32_t)rebuilds.size());
+        for (const uint64_t key : rebuilds)
+        {
+            result.valid &= (dueFrames[key] > 0);
+            result.maxDueFrames = std::max(result.maxDueFrames, dueFrames[key] - 1);
+            result.maxGrowthAtRebuild = std::max(result.maxGrowthAtRebuild, policy.getSurfaceAreaGrowth(key));
+            policy.onBuilt(key, surfaceAreas[key][frame]);
+            dueFrames[key] = 0;
+        }
+
+        for (const uint32_t frames : dueFrames)
+        {
+            result.valid &= (settings.maxRebuildsPerFrame > 0 || frames == 0);
+            result.maxDueFrames = std::max(result.maxDueFrames, frames);
+        }
+    }
+
+    result.counters = policy.getTotalCounters();
+    result.meanGrowth = (result.counters.numRefits > 0) ? (float)(growthSum / result.counters.numRefits) : 0.0f;
+    return result;
+}
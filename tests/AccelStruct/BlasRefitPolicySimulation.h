@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "AccelStruct/BlasRefitPolicy.h"
+
+// Animated BLAS bounds played back through the refit versus rebuild policy of the path tracer, for the tests and the benchmarks
+
+struct BlasRefitSimulationResult
+{
+    BlasRefitCounters counters;
+    uint32_t maxRebuildsPerFrame = 0;
+    uint32_t maxDueFrames = 0;          // Longest wait of a due BLAS for its rebuild
+    float maxGrowthAtRebuild = 0.0f;
+    float meanGrowth = 0.0f;            // Mean growth of the refit BLAS over all frames
+    bool valid = true;                  // Never more than maxRebuildsPerFrame rebuilds, only due BLAS rebuilt, none waiting when unlimited
+};
+
+namespace BlasRefit
+{
+    // Plays surfaceAreas[blas][frame] back through the policy. A BLAS rebuilt in frame f is built at the pose of frame f
+    // and refit from frame f + 1 on, as in the renderer with an unlimited build budget. All BLAS are built in frame 0.
+    BlasRefitSimulationResult simulate(const std::vector<std::vector<float>>& surfaceAreas, const BlasRefitPolicySettings& settings);
+}
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <cmath>
+
+#include "AccelStruct/BlasRefitPolicy.h"
+#include "AccelStruct/BlasRefitPolicySimulation.h"
+#include "TestFramework.h"
+
+namespace
+{
+    BlasRefitPolicySettings makeSettings(const float maxSurfaceAreaGrowth, const uint32_t maxRefits, const uint32_t maxRebuildsPerFrame)
+    {
+        BlasRefitPolicySettings settings;
+        settings.maxSurfaceAreaGrowth = maxSurfaceAreaGrowth;
+        settings.maxRefits = maxRefits;
+        settings.maxRebuildsPerFrame = maxRebuildsPerFrame;
+        return settings;
+    }
+}
+
+// A BLAS is due once its bounds grew by maxSurfaceAreaGrowth over the build, shrinking bounds are no growth
+TEST(BlasRefitPolicy, GrowthTriggersRebuild)
+{
+    BlasRefitPolicy policy;
+    policy.setSettings(makeSettings(0.5f, 0, 0));
+    policy.onBuilt(1, 100.0f);
+
+    std::vector<uint64_t> rebuilds;
+    policy.beginFrame();
+    policy.onRefit(1, 80.0f, true);
+    policy.selectRebuilds(rebuilds);
+    CHECK(policy.getSurfaceAreaGrowth(1) == 0.0f);
+    CHECK(rebuilds.empty());
+
+    policy.beginFrame();
+    policy.onRefit(1, 120.0f, true);
+    policy.selectRebuilds(rebuilds);
+    CHECK(std::abs(policy.getSurfaceAreaGrowth(1) - 0.2f) < 1e-6f);
+    CHECK(std::abs(policy.getFrameCounters().maxSurfaceAreaGrowth - 0.2f) < 1e-6f);
+    CHECK(rebuilds.empty());
+
+    policy.beginFrame();
+    policy.onRefit(1, 150.0f, true);
+    policy.selectRebuilds(rebuilds);
+    REQUIRE(rebuilds.size() == 1);
+    CHECK(rebuilds[0] == 1);
+    CHECK(policy.getFrameCounters().numGrowthRebuilds == 1);
+    CHECK(policy.getFrameCounters().numRefitCountRebuilds == 0);
+    CHECK(policy.getRefitCount(1) == 3);
+
+    // The rebuild measures the growth from its own pose
+    policy.onBuilt(1, 150.0f);
+    CHECK(policy.getSurfaceAreaGrowth(1) == 0.0f);
+    CHECK(policy.getRefitCount(1) == 0);
+
+    const BlasRefitCounters& totalCounters = policy.getTotalCounters();
+    CHECK(totalCounters.numRefits == 3);
+    CHECK(totalCounters.getRebuildCount() == 1);
+    CHECK(totalCounters.maxSurfaceAreaGrowth == 0.5f);
+}
+
+// A BLAS is due after maxRefits refits, but only picked while it can be rebuilt
+TEST(BlasRefitPolicy, RefitCountTriggersRebuild)
+{
+    BlasRefitPolicy policy;
+    policy.setSettings(makeSettings(0.0f, 3, 0));
+    policy.onBuilt(1, 100.0f);
+
+    std::vector<uint64_t> rebuilds;
+    for (uint32_t frame = 1; frame <= 5; ++frame)
+    {
+        // Waiting for its compaction until frame 4, the growth limit is disabled
+        policy.beginFrame();
+        policy.onRefit(1, 1000.0f, frame >= 4);
+        rebuilds.clear();
+        policy.selectRebuilds(rebuilds);
+        CHECK(policy.getRefitCount(1) == frame);
+        CHECK(rebuilds.size() == (frame >= 4 ? 1u : 0u));
+    }
+    CHECK(policy.getTotalCounters().numRefitCountRebuilds == 2);
+    CHECK(policy.getTotalCounters().numGrowthRebuilds == 0);
+
+    // A BLAS refit before its first build measures its growth from that pose
+    policy.beginFrame();
+    policy.onRefit(2, 100.0f, false);
+    CHECK(policy.getRefitCount(2) == 1);
+    CHECK(policy.getSurfaceAreaGrowth(2) == 0.0f);
+
+    policy.remove(1);
+    CHECK(policy.getRefitCount(1) == 0);
+    policy.clear();
+    CHECK(policy.getRefitCount(2) == 0);
+    CHECK(policy.getSurfaceAreaGrowth(2) == 0.0f);
+}
+
+// With one rebuild per frame the most degraded BLAS goes first, and every frame a BLAS waits counts as much as a limit
+TEST(BlasRefitPolicy, RebuildOrder)
+{
+    BlasRefitPolicy policy;
+    policy.setSettings(makeSettings(0.5f, 0, 1));
+    for (uint64_t key = 1; key <= 5; ++key)
+    {
+        policy.onBuilt(key, 100.0f);
+    }
+
+    // Growths of 1, 0.75 and 0.6 are 2, 1.5 and 1.2 times the limit, key 4 and 5 are due later
+    float surfaceAreas[] = { 0.0f, 200.0f, 175.0f, 160.0f, 100.0f, 100.0f };
+    std::vector<uint64_t> rebuilds;
+    auto runFrame = [&policy, &surfaceAreas, &rebuilds]()
+    {
+        policy.beginFrame();
+        for (uint64_t key = 1; key <= 5; ++key)
+        {
+            policy.onRefit(key, surfaceAreas[key], true);
+        }
+        rebuilds.clear();
+        policy.selectRebuilds(rebuilds);
+        for (const uint64_t key : rebuilds)
+        {
+            policy.onBuilt(key, surfaceAreas[key]);
+        }
+    };
+
+    runFrame();
+    REQUIRE(rebuilds.size() == 1);
+    CHECK(rebuilds[0] == 1);
+    CHECK(policy.getFrameCounters().numDeferredRebuilds == 2);
+
+    // 1.5 + 1 waited frame goes before 1.2 + 1
+    runFrame();
+    REQUIRE(rebuilds.size() == 1);
+    CHECK(rebuilds[0] == 2);
+
+    // Key 4 is newly due at 3 times the limit, key 3 has waited two frames and goes first
+    surfaceAreas[4] = 250.0f;
+    runFrame();
+    REQUIRE(rebuilds.size() == 1);
+    CHECK(rebuilds[0] == 3);
+    CHECK(policy.getFrameCounters().numDeferredRebuilds == 1);
+
+    // Key 4 has waited a frame, key 5 is newly due at the same priority and loses the tie on its key
+    surfaceAreas[5] = 300.0f;
+    runFrame();
+    REQUIRE(rebuilds.size() == 1);
+    CHECK(rebuilds[0] == 4);
+    CHECK(policy.getFrameCounters().numDeferredRebuilds == 1);
+
+    CHECK(policy.getTotalCounters().numGrowthRebuilds == 4);
+    CHECK(policy.getTotalCounters().numRefitCountRebuilds == 0);
+}
+
+// A BLAS growing by one unit a frame is rebuilt each time its bounds reach 1.5 times those of its build
+TEST(BlasRefitPolicy, SimulatedGrowth)
+{
+    std::vector<std::vector<float>> surfaceAreas(1);
+    for (uint32_t frame = 0; frame <= 300; ++frame)
+    {
+        surfaceAreas[0].push_back(100.0f + (float)frame);
+    }
+
+    const BlasRefitSimulationResult result = BlasRefit::simulate(surfaceAreas, makeSettings(0.5f, 0, 1));
+    CHECK(result.valid);
+    // Built at 100, rebuilt at 150 (frame 50), 225 (frame 125) and 338 (frame 238)
+    CHECK(result.counters.numGrowthRebuilds == 3);
+    CHECK(result.counters.numRefits == 300);
+    CHECK(result.maxRebuildsPerFrame == 1);
+    CHECK(result.maxDueFrames == 0);
+    CHECK(std::abs(result.maxGrowthAtRebuild - 113.0f / 225.0f) < 1e-5f);
+    CHECK(result.counters.maxSurfaceAreaGrowth < 0.51f);
+}
+
+// Many BLAS that degrade together are spread over frames by the rebuild limit, and all rebuilt at once without it
+TEST(BlasRefitPolicy, SimulatedBursts)
+{
+    constexpr uint32_t kNumBlas = 16;
+    constexpr uint32_t kNumFrames = 400;
+    std::vector<std::vector<float>> surfaceAreas(kNumBlas);
+    for (uint32_t blasIndex = 0; blasIndex < kNumBlas; ++blasIndex)
+    {
+        for (uint32_t frame = 0; frame < kNumFrames; ++frame)
+        {
+            // The same loop of 100 frames with small phase differences, the bounds nearly double halfway through
+            const float phase = 6.2831853f * (float)(frame + blasIndex % 4) / 100.0f;
+            surfaceAreas[blasIndex].push_back(100.0f * (1.9f - 0.9f * std::cos(phase)));
+        }
+    }
+
+    for (const uint32_t maxRebuildsPerFrame : { 0u, 1u, 4u })
+    {
+        for (const uint32_t maxRefits : { 0u, 30u })
+        {
+            const BlasRefitSimulationResult result = BlasRefit::simulate(surfaceAreas, makeSettings(0.5f, maxRefits, maxRebuildsPerFrame));
+            CHECK(result.valid);
+            CHECK(result.counters.numRefits == kNumBlas * (kNumFrames - 1));
+            CHECK(result.counters.getRebuildCount() > 0);
+            CHECK(result.counters.numRefitCountRebuilds == 0 || maxRefits > 0);
+            CHECK(result.maxGrowthAtRebuild >= 0.5f || maxRefits > 0);
+            if (maxRebuildsPerFrame == 0)
+            {
+                CHECK(result.maxDueFrames == 0);
+                CHECK(result.counters.numDeferredRebuilds == 0);
+            }
+            else
+            {
+                CHECK(result.maxRebuildsPerFrame <= maxRebuildsPerFrame);
+                // All BLAS degrade in the same frames, a limit below their count defers some
+                CHECK(result.counters.numDeferredRebuilds > 0);
+            }
+        }
+    }
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "AccelStruct/TlasInstanceTableSimulation.h"
+
+TlasInstanceSimulationResult TlasInstances::simulate(const TlasInstanceSimulationSettings& settings)
+{
+    constexpr uint32_t kNumGroups = 16;
+    constexpr uint32_t kGridWidth = 1000;
+
+    TlasInstanceSimulationResult result;
+
+    const uint32_t groupSize = std::max((uint32_t)(settings.movingInstanceFraction * settings.instanceCount / kNumGroups), 1u);
+    std::vector<float> heights(settings.instanceCount, 0.0f);
+    std::vector<uint64_t> blasAddresses(std::max(settings.blasCount, 1u));
+    for (uint32_t blasIndex = 0; blasIndex < blasAddresses.size(); ++blasIndex)
+    {
+        blasAddresses[blasIndex] = (uint64_t)(blasIndex + 1) << 16;
+    }
+    bool showEmissiveSurfaces = true;
+
+    // The instance of the renderer: mirror like, emissive and the rest in their own masks, some without culling
+    const auto getInstance = [&](const uint32_t instanceIndex)
+    {
+        nvrhi::rt::InstanceDesc instance;
+        instance.transform[3] = (float)(instanceIndex % kGridWidth);
+        instance.transform[7] = heights[instanceIndex];
+        instance.transform[11] = (float)(instanceIndex / kGridWidth);
+        instance.blasDeviceAddress = blasAddresses[instanceIndex % blasAddresses.size()];
+        instance.instanceID = instanceIndex;
+        if (instanceIndex % 16 == 1)
+        {
+            instance.instanceMask = 4;
+        }
+        else if (!showEmissiveSurfaces && instanceIndex % 8 == 0)
+        {
+            instance.instanceMask = 2;
+        }
+        else
+        {
+            instance.instanceMask = 1;
+        }
+        if (instanceIndex % 4 == 2)
+        {
+            instance.setFlags(nvrhi::rt::InstanceFlags::TriangleCullDisable);
+        }
+        return instance;
+    };
+
+    // The ranges of a table go into its mirror of the instance buffer, in order, not overlapping and within the table
+    const auto copyRanges = [&](const TlasInstanceTable& rangeTable, const std::vector<TlasInstanceRange>& rangeList,
+                                std::vector<nvrhi::rt::InstanceDesc>& mirror)
+    {
+        uint32_t nextInstance = 0;
+        for (const TlasInstanceRange& range : rangeList)
+        {
+            if (range.numInstances == 0 || range.firstInstance < nextInstance || range.firstInstance + range.numInstances > settings.instanceCount)
+            {
+                return false;
+            }
+            memcpy(&mirror[range.firstInstance], rangeTable.getInstances() + range.firstInstance, range.numInstances * sizeof(nvrhi::rt::InstanceDesc));
+            nextInstance = range.firstInstance + range.numInstances;
+        }
+        return true;
+    };
+
+    TlasInstanceTable table;
+    table.resize(settings.instanceCount);
+    TlasInstanceTable changedTable;
+    changedTable.resize(settings.instanceCount);
+    std::vector<nvrhi::rt::InstanceDesc> previousInstances;
+    std::vector<nvrhi::rt::InstanceDesc> bufferMirror(settings.instanceCount);
+    std::vector<nvrhi::rt::InstanceDesc> changedBufferMirror(settings.instanceCount);
+    std::vector<TlasInstanceRange> ranges;
+    std::vector<TlasInstanceRange> changedRanges;
+    std::vector<uint32_t> changedInputs;
+    for (uint32_t frame = 0; frame < settings.frameCount; ++frame)
+    {
+        const bool isMoving = settings.animationInterval == 0 || (frame / settings.animationInterval) % 2 == 0;
+        const bool isBlasRebuilt = settings.blasRebuildInterval > 0 && frame > 0 && frame % settings.blasRebuildInterval == 0;
+        const uint32_t rebuiltBlas = isBlasRebuilt ? (uint32_t)((frame / settings.blasRebuildInterval) % blasAddresses.size()) : 0;
+        const bool isMaskToggled = settings.maskToggleInterval > 0 && frame > 0 && frame % settings.maskToggleInterval == 0;
+        if (isMoving)
+        {
+            for (uint32_t group = 0; group < kNumGroups; ++group)
+            {
+                const uint32_t firstInstance = (uint32_t)((uint64_t)group * settings.instanceCount / kNumGroups);
+                const uint32_t lastInstance = std::min(firstInstance + groupSize, settings.instanceCount);
+                for (uint32_t instanceIndex = firstInstance; instanceIndex < lastInstance; ++instanceIndex)
+                {
+                    heights[instanceIndex] = std::sin(0.1f * frame + (float)group);
+                }
+            }
+        }
+        if (isBlasRebuilt)
+        {
+            blasAddresses[rebuiltBlas] += 1ull << 32;
+        }
+        if (isMaskToggled)
+        {
+            showEmissiveSurfaces = !showEmissiveSurfaces;
+        }
+
+        auto startTime = std::chrono::high_resolution_clock::now();
+        std::vector<nvrhi::rt::InstanceDesc> instances;
+        for (uint32_t instanceIndex = 0; instanceIndex < settings.instanceCount; ++instanceIndex)
+        {
+            instances.push_back(getInstance(instanceIndex));
+        }
+        result.fullUpdateTimeMs += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+        startTime = std::chrono::high_resolution_clock::now();
+        for (uint32_t instanceIndex = 0; instanceIndex < settings.instanceCount; ++instanceIndex)
+        {
+            table.setInstance(instanceIndex, getInstance(instanceIndex));
+        }
+        ranges.clear();
+        table.collectDirtyRanges(ranges);
+        result.tableUpdateTimeMs += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+        // The renderer marks the instances of a moving node, of a rebuilt BLAS and all of them on a mask setting change
+        startTime = std::chrono::high_resolution_clock::now();
+        if (isMoving)
+        {
+            for (uint32_t group = 0; group < kNumGroups; ++group)
+            {
+                const uint32_t firstInstance = (uint32_t)((uint64_t)group * settings.instanceCount / kNumGroups);
+                const uint32_t lastInstance = std::min(firstInstance + groupSize, settings.instanceCount);
+                for (uint32_t instanceIndex = firstInstance; instanceIndex < lastInstance; ++instanceIndex)
+                {
+                    changedTable.markInputChanged(instanceIndex);
+                }
+            }
+        }
+        if (isBlasRebuilt)
+        {
+            for (uint32_t instanceIndex = rebuiltBlas; instanceIndex < settings.instanceCount; instanceIndex += (uint32_t)blasAddresses.size())
+            {
+                changedTable.markInputChanged(instanceIndex);
+            }
+        }
+        if (isMaskToggled)
+        {
+            changedTable.markAllInputsChanged();
+        }
+        changedInputs.clear();
+        changedTable.collectChangedInputs(changedInputs);
+        for (const uint32_t instanceIndex : changedInputs)
+        {
+            changedTable.setInstance(instanceIndex, getInstance(instanceIndex));
+        }
+        changedRanges.clear();
+        changedTable.collectDirtyRanges(changedRanges);
+        result.changedUpdateTimeMs += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+        result.numChangedInputs += changedInputs.size();
+
+        // The dirty instances are the ones that differ from the last frame, all of them in the first frame
+        uint32_t numChangedInstances = 0;
+        for (uint32_t instanceIndex = 0; instanceIndex < settings.instanceCount; ++instanceIndex)
+        {
+            numChangedInstances += (previousInstances.empty() ||
+                                    memcmp(&instances[instanceIndex], &previousInstances[instanceIndex], sizeof(nvrhi::rt::InstanceDesc)) != 0) ? 1 : 0;
+        }
+        const TlasInstanceTableStats& stats = table.getStats();
+        result.valid &= (stats.numDirtyInstances == numChangedInstances);
+        result.valid &= (changedTable.getStats().numDirtyInstances == numChangedInstances);
+
+        result.valid &= copyRanges(table, ranges, bufferMirror) && copyRanges(changedTable, changedRanges, changedBufferMirror);
+        result.valid &= (memcmp(bufferMirror.data(), instances.data(), instances.size() * sizeof(nvrhi::rt::InstanceDesc)) == 0);
+        result.valid &= (memcmp(changedBufferMirror.data(), instances.data(), instances.size() * sizeof(nvrhi::rt::InstanceDesc)) == 0);
+
+        result.totalStats.numInstances = stats.numInstances;
+        result.totalStats.numDirtyInstances += stats.numDirtyInstances;
+        result.totalStats.numTransformChanges += stats.numTransformChanges;
+        result.totalStats.numMaskChanges += stats.numMaskChanges;
+        result.totalStats.numFlagChanges += stats.numFlagChanges;
+        result.totalStats.numBlasChanges += stats.numBlasChanges;
+        result.totalStats.numRanges += stats.numRanges;
+        result.totalStats.numUploadedInstances += stats.numUploadedInstances;
+        result.numSkippedFrames += ranges.empty() ? 1 : 0;
+        result.maxRangesPerFrame = std::max(result.maxRangesPerFrame, stats.numRanges);
+        result.fullUploadBytes += instances.size() * sizeof(nvrhi::rt::InstanceDesc);
+        result.rangeUploadBytes += (uint64_t)stats.numUploadedInstances * sizeof(nvrhi::rt::InstanceDesc);
+        ++result.numFrames;
+
+        previousInstances.swap(instances);
+    }
+    return result;
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "AccelStruct/TlasInstanceTable.h"
+
+// Synthetic scene whose TLAS instances are updated through the instance table of the path tracer, for the tests and the benchmarks
+
+struct TlasInstanceSimulationSettings
+{
+    uint32_t instanceCount = 100000;
+    uint32_t frameCount = 300;
+    uint32_t blasCount = 64;
+    float movingInstanceFraction = 0.01f;   // Instances moving in an animated frame, in 16 groups of consecutive instances
+    uint32_t animationInterval = 60;        // The groups move for animationInterval frames, then pause as long
+    uint32_t blasRebuildInterval = 30;      // Every blasRebuildInterval frames one BLAS gets a new address, 0 never
+    uint32_t maskToggleInterval = 100;      // Every maskToggleInterval frames the emissive instances change their mask, 0 never
+};
+
+struct TlasInstanceSimulationResult
+{
+    TlasInstanceTableStats totalStats;      // Summed over the frames
+    uint32_t numFrames = 0;
+    uint32_t numSkippedFrames = 0;          // Frames without dirty instances
+    uint32_t maxRangesPerFrame = 0;
+    uint64_t fullUploadBytes = 0;           // Every instance every frame, as without the table
+    uint64_t rangeUploadBytes = 0;
+    double fullUpdateTimeMs = 0.0;          // Filling a new instance vector every frame
+    double tableUpdateTimeMs = 0.0;         // Setting every instance of the table and collecting its ranges
+    double changedUpdateTimeMs = 0.0;       // Marking the instances whose inputs changed, setting only those and collecting the ranges
+    uint64_t numChangedInputs = 0;          // Instances set by the marking, summed over the frames
+    bool valid = true;                      // The uploaded ranges of both tables reproduced every frame and the dirty instances were the changed ones
+};
+
+namespace TlasInstances
+{
+    // Animates a synthetic scene and updates its instances every frame: into a full instance vector, by setting every
+    // instance of a table and, as the renderer does, by setting only the instances marked where their inputs changed.
+    // The ranges of both tables are copied into mirrors of the instance buffer, which must match the full instance vector.
+    TlasInstanceSimulationResult simulate(const TlasInstanceSimulationSettings& settings);
+}
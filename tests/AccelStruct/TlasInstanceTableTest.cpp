@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include "AccelStruct/TlasInstanceTable.h"
+#include "AccelStruct/TlasInstanceTableSimulation.h"
+#include "TestFramework.h"
+
+namespace
+{
+    nvrhi::rt::InstanceDesc makeInstance(const uint32_t instanceIndex)
+    {
+        nvrhi::rt::InstanceDesc instance;
+        instance.transform[3] = (float)instanceIndex;
+        instance.blasDeviceAddress = 0x10000;
+        instance.instanceID = instanceIndex;
+        instance.instanceMask = 1;
+        return instance;
+    }
+
+    // Sets every instance of the table to makeInstance and uploads it
+    void fillTable(TlasInstanceTable& table, const uint32_t instanceCount)
+    {
+        table.resize(instanceCount);
+        for (uint32_t instanceIndex = 0; instanceIndex < instanceCount; ++instanceIndex)
+        {
+            table.setInstance(instanceIndex, makeInstance(instanceIndex));
+        }
+        std::vector<TlasInstanceRange> ranges;
+        table.collectDirtyRanges(ranges);
+    }
+
+    bool isUploaded(const std::vector<TlasInstanceRange>& ranges, const uint32_t instanceIndex)
+    {
+        for (const TlasInstanceRange& range : ranges)
+        {
+            if (instanceIndex >= range.firstInstance && instanceIndex < range.firstInstance + range.numInstances)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+// Only instances that changed are dirty, each kind of change is counted, and close dirty instances share a range
+TEST(TlasInstanceTable, ChangeDetection)
+{
+    TlasInstanceTable table;
+    table.resize(100);
+    CHECK(table.getInstanceCount() == 100);
+    CHECK(table.isDirty());
+
+    // New instances are inactive and uploaded as one range
+    std::vector<TlasInstanceRange> ranges;
+    table.collectDirtyRanges(ranges);
+    REQUIRE(ranges.size() == 1);
+    CHECK(ranges[0].firstInstance == 0 && ranges[0].numInstances == 100);
+    CHECK(table.getStats().numInstances == 100);
+    CHECK(table.getStats().numDirtyInstances == 100);
+    CHECK(table.getInstances()[7].blasDeviceAddress == 0 && table.getInstances()[7].instanceMask == 0);
+    CHECK(!table.isDirty());
+
+    for (uint32_t instanceIndex = 0; instanceIndex < 100; ++instanceIndex)
+    {
+        table.setInstance(instanceIndex, makeInstance(instanceIndex));
+    }
+    ranges.clear();
+    table.collectDirtyRanges(ranges);
+    CHECK(table.getStats().numDirtyInstances == 100);
+
+    // Setting the same instances again changes nothing, a frame without ranges needs no TLAS build
+    for (uint32_t instanceIndex = 0; instanceIndex < 100; ++instanceIndex)
+    {
+        table.setInstance(instanceIndex, makeInstance(instanceIndex));
+    }
+    CHECK(!table.isDirty());
+    ranges.clear();
+    table.collectDirtyRanges(ranges);
+    CHECK(ranges.empty());
+    CHECK(table.getStats().numDirtyInstances == 0 && table.getStats().numRanges == 0);
+
+    nvrhi::rt::InstanceDesc instance = makeInstance(10);
+    instance.transform[7] = 1.0f;
+    table.setInstance(10, instance);
+    // Set twice in a frame, dirty once
+    instance.transform[7] = 2.0f;
+    table.setInstance(10, instance);
+
+    instance = makeInstance(12);
+    instance.instanceMask = 2;
+    table.setInstance(12, instance);
+
+    instance = makeInstance(50);
+    instance.setFlags(nvrhi::rt::InstanceFlags::TriangleCullDisable);
+    instance.blasDeviceAddress = 0x20000;
+    table.setInstance(50, instance);
+
+    // 60 is kMaxRangeGap + 1 clean instances after 50 and starts a range, 61 joins it
+    instance = makeInstance(60);
+    instance.instanceContributionToHitGroupIndex = 3;
+    table.setInstance(60, instance);
+
+    instance = makeInstance(61);
+    instance.instanceID = 1000;
+    table.setInstance(61, instance);
+
+    ranges.clear();
+    table.collectDirtyRanges(ranges);
+    REQUIRE(ranges.size() == 3);
+    CHECK(ranges[0].firstInstance == 10 && ranges[0].numInstances == 3);
+    CHECK(ranges[1].firstInstance == 50 && ranges[1].numInstances == 1);
+    CHECK(ranges[2].firstInstance == 60 && ranges[2].numInstances == 2);
+    CHECK(table.getInstances()[10].transform[7] == 2.0f);
+    CHECK(table.getInstances()[50].blasDeviceAddress == 0x20000);
+
+    const TlasInstanceTableStats& stats = table.getStats();
+    CHECK(stats.numDirtyInstances == 5);
+    CHECK(stats.numTransformChanges == 2);
+    CHECK(stats.numMaskChanges == 1);
+    CHECK(stats.numFlagChanges == 3);
+    CHECK(stats.numBlasChanges == 1);
+    CHECK(stats.numRanges == 3);
+    CHECK(stats.numUploadedInstances == 6);
+}
+
+// Beyond kMaxRanges ranges the ones with the smallest gaps between them are merged, the dirty instances stay covered
+TEST(TlasInstanceTable, RangeLimit)
+{
+    TlasInstanceTable table;
+    fillTable(table, 20000);
+
+    // 200 single instances with equal gaps: the first ones are merged until 64 ranges are left
+    for (uint32_t dirtyIndex = 0; dirtyIndex < 200; ++dirtyIndex)
+    {
+        nvrhi::rt::InstanceDesc instance = makeInstance(dirtyIndex * 20);
+        instance.instanceMask = 2;
+        table.setInstance(dirtyIndex * 20, instance);
+    }
+
+    // Ranges already in the vector are left alone
+    std::vector<TlasInstanceRange> ranges = { { 5, 1 } };
+    table.collectDirtyRanges(ranges);
+    REQUIRE(ranges.size() == TlasInstanceTable::kMaxRanges + 1);
+    CHECK(ranges[0].firstInstance == 5 && ranges[0].numInstances == 1);
+    ranges.erase(ranges.begin());
+    CHECK(ranges[0].firstInstance == 0);
+    CHECK(ranges[0].numInstances == (200 - TlasInstanceTable::kMaxRanges) * 20 + 1);
+    CHECK(table.getStats().numRanges == TlasInstanceTable::kMaxRanges);
+    CHECK(table.getStats().numUploadedInstances == ranges[0].numInstances + TlasInstanceTable::kMaxRanges - 1);
+    for (uint32_t dirtyIndex = 0; dirtyIndex < 200; ++dirtyIndex)
+    {
+        CHECK(isUploaded(ranges, dirtyIndex * 20));
+    }
+
+    // 70 pairs 11 instances apart, 200 apart from each other: every pair is merged before any two pairs are
+    for (uint32_t pairIndex = 0; pairIndex < 70; ++pairIndex)
+    {
+        for (const uint32_t instanceIndex : { pairIndex * 200, pairIndex * 200 + 11 })
+        {
+            nvrhi::rt::InstanceDesc instance = makeInstance(instanceIndex);
+            instance.instanceMask = 4;
+            table.setInstance(instanceIndex, instance);
+        }
+    }
+    ranges.clear();
+    table.collectDirtyRanges(ranges);
+    REQUIRE(ranges.size() == TlasInstanceTable::kMaxRanges);
+    uint32_t nextInstance = 0;
+    for (const TlasInstanceRange& range : ranges)
+    {
+        CHECK(range.firstInstance >= nextInstance);
+        CHECK(range.firstInstance % 200 == 0);
+        nextInstance = range.firstInstance + range.numInstances;
+    }
+    for (uint32_t pairIndex = 0; pairIndex < 70; ++pairIndex)
+    {
+        CHECK(isUploaded(ranges, pairIndex * 200) && isUploaded(ranges, pairIndex * 200 + 11));
+    }
+}
+
+// Growing the table adds dirty inactive instances, shrinking drops the dirty ones past the end, invalidating uploads everything
+TEST(TlasInstanceTable, ResizeAndInvalidate)
+{
+    TlasInstanceTable table;
+    fillTable(table, 10);
+
+    nvrhi::rt::InstanceDesc instance = makeInstance(8);
+    instance.instanceMask = 2;
+    table.setInstance(8, instance);
+    table.resize(5);
+    CHECK(table.getInstanceCount() == 5);
+    CHECK(!table.isDirty());
+
+    std::vector<TlasInstanceRange> ranges;
+    table.resize(8);
+    table.collectDirtyRanges(ranges);
+    REQUIRE(ranges.size() == 1);
+    CHECK(ranges[0].firstInstance == 5 && ranges[0].numInstances == 3);
+    CHECK(table.getInstances()[5].instanceMask == 0);
+
+    table.invalidate();
+    ranges.clear();
+    table.collectDirtyRanges(ranges);
+    REQUIRE(ranges.size() == 1);
+    CHECK(ranges[0].firstInstance == 0 && ranges[0].numInstances == 8);
+    CHECK(table.getStats().numDirtyInstances == 8);
+    // Nothing changed, the instances were uploaded for a new buffer
+    CHECK(table.getStats().numTransformChanges == 0);
+
+    table.setInstance(2, instance);
+    table.clear();
+    CHECK(table.getInstanceCount() == 0);
+    CHECK(!table.isDirty());
+    ranges.clear();
+    table.collectDirtyRanges(ranges);
+    CHECK(ranges.empty());
+}
+
+// Marked instances are collected once each until marked again, marking all collects every instance, resizing drops or adds marks
+TEST(TlasInstanceTable, ChangedInputs)
+{
+    TlasInstanceTable table;
+    table.resize(10);
+
+    // New instances have changed inputs
+    std::vector<uint32_t> changedInputs;
+    table.collectChangedInputs(changedInputs);
+    CHECK(changedInputs.size() == 10);
+    changedInputs.clear();
+    table.collectChangedInputs(changedInputs);
+    CHECK(changedInputs.empty());
+
+    table.markInputChanged(7);
+    table.markInputChanged(2);
+    table.markInputChanged(7);
+    table.collectChangedInputs(changedInputs);
+    REQUIRE(changedInputs.size() == 2);
+    CHECK((changedInputs[0] == 7 && changedInputs[1] == 2) || (changedInputs[0] == 2 && changedInputs[1] == 7));
+
+    changedInputs.clear();
+    table.markInputChanged(3);
+    table.markAllInputsChanged();
+    table.markInputChanged(4);
+    table.collectChangedInputs(changedInputs);
+    CHECK(changedInputs.size() == 10);
+    changedInputs.clear();
+    table.markInputChanged(3);
+    table.collectChangedInputs(changedInputs);
+    CHECK(changedInputs.size() == 1);
+
+    changedInputs.clear();
+    table.markInputChanged(1);
+    table.markInputChanged(8);
+    table.resize(5);
+    table.resize(6);
+    table.collectChangedInputs(changedInputs);
+    REQUIRE(changedInputs.size() == 2);
+    CHECK((changedInputs[0] == 1 && changedInputs[1] == 5) || (changedInputs[0] == 5 && changedInputs[1] == 1));
+}
+
+// Animated scenes reproduce the full instance vector from the uploaded ranges alone, for animation, BLAS and mask changes
+TEST(TlasInstanceTable, SimulatedScenes)
+{
+    for (const uint32_t animationInterval : { 0u, 20u })
+    {
+        for (const float movingInstanceFraction : { 0.001f, 0.05f })
+        {
+            TlasInstanceSimulationSettings settings;
+            settings.instanceCount = 20000;
+            settings.frameCount = 120;
+            settings.movingInstanceFraction = movingInstanceFraction;
+            settings.animationInterval = animationInterval;
+            settings.blasRebuildInterval = 15;
+            settings.maskToggleInterval = 50;
+            const TlasInstanceSimulationResult result = TlasInstances::simulate(settings);
+            CHECK(result.valid);
+            CHECK(result.numFrames == settings.frameCount);
+            CHECK(result.maxRangesPerFrame <= TlasInstanceTable::kMaxRanges);
+            CHECK(result.rangeUploadBytes < result.fullUploadBytes);
+            CHECK(result.totalStats.numUploadedInstances >= result.totalStats.numDirtyInstances);
+            CHECK(result.totalStats.numBlasChanges > 0);
+            CHECK(result.totalStats.numMaskChanges > 0);
+            // Only the mask setting changes set every instance
+            CHECK(result.numChangedInputs < (uint64_t)settings.frameCount * settings.instanceCount);
+            // Paused frames without a BLAS or mask change are skipped
+            CHECK((result.numSkippedFrames > 0) == (animationInterval > 0));
+        }
+    }
+}
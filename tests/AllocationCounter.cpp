@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "AllocationCounter.h"
+
+namespace
+{
+    // Constant initialized, so allocations of static constructors are counted too
+    std::atomic<uint64_t> g_numAllocations{ 0 };
+    std::atomic<uint64_t> g_numFrees{ 0 };
+    std::atomic<uint64_t> g_allocatedBytes{ 0 };
+
+    void* countedAllocate(const size_t size)
+    {
+        void* const pointer = malloc(size > 0 ? size : 1);
+        if (!pointer)
+        {
+            throw std::bad_alloc();
+        }
+        g_numAllocations.fetch_add(1, std::memory_order_relaxed);
+        g_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+        return pointer;
+    }
+
+    void countedFree(void* const pointer)
+    {
+        if (pointer)
+        {
+            g_numFrees.fetch_add(1, std::memory_order_relaxed);
+            free(pointer);
+        }
+    }
+}
+
+namespace AllocationCounter
+{
+    Counts get()
+    {
+        return { g_numAllocations.load(std::memory_order_relaxed), g_numFrees.load(std::memory_order_relaxed), g_allocatedBytes.load(std::memory_order_relaxed) };
+    }
+}
+
+// The nothrow and aligned forms aren't replaced, the nothrow ones forward to these
+void* operator new(const size_t size) { return countedAllocate(size); }
+void* operator new[](const size_t size) { return countedAllocate(size); }
+void operator delete(void* const pointer) noexcept { countedFree(pointer); }
+void operator delete[](void* const pointer) noexcept { countedFree(pointer); }
+void operator delete(void* const pointer, size_t) noexcept { countedFree(pointer); }
+void operator delete[](void* const pointer, size_t) noexcept { countedFree(pointer); }
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+// Heap allocations of the whole process. rtxcr_tests and rtxcr_benchmarks replace the global operator new and delete to count them,
+// a test or benchmark takes the difference of two snapshots around the code it measures.
+namespace AllocationCounter
+{
+    struct Counts
+    {
+        uint64_t numAllocations = 0;
+        uint64_t numFrees = 0;
+        uint64_t allocatedBytes = 0;
+    };
+
+    Counts get();
+
+    inline Counts getDifference(const Counts& begin, const Counts& end)
+    {
+        return { end.numAllocations - begin.numAllocations, end.numFrees - begin.numFrees, end.allocatedBytes - begin.allocatedBytes };
+    }
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <cstdio>
+#include <donut/core/log.h>
+
+#include "TestFramework.h"
+
+// rtxcr_benchmarks <name> [args]: runs one benchmark, prints the results to stdout
+int main(int argc, const char* const* argv)
+{
+    donut::log::SetMinSeverity(donut::log::Severity::Warning);
+
+    for (const TestFramework::Benchmark& benchmark : TestFramework::getBenchmarks())
+    {
+        if (argc > 1 && benchmark.name == argv[1])
+        {
+            benchmark.function(std::vector<std::string>(argv + 2, argv + argc));
+            return 0;
+        }
+    }
+
+    printf("Usage: rtxcr_benchmarks <name> [args]\n");
+    for (const TestFramework::Benchmark& benchmark : TestFramework::getBenchmarks())
+    {
+        printf("  %s %s\n", benchmark.name.c_str(), benchmark.usage.c_str());
+    }
+    return 1;
+}
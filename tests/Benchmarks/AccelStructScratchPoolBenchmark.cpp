@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+#include "AccelStruct/AccelStructScratchPoolSimulation.h"
+#include "TestFramework.h"
+
+// Synthetic build sequence with load bursts through the scratch pool, for every number of frames in flight: the size the
+// pool grows to against the largest batch, the peak used, requested and wasted bytes and the cost of an allocation
+BENCHMARK(AccelStructScratchPool, "[frames = 2000] [max builds per frame = 64] [repetitions = 3]")
+{
+    const uint32_t numFrames = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 0, 2000)), 1u);
+    const uint32_t maxBuildsPerFrame = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 1, 64)), 1u);
+    const uint32_t numRepetitions = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 2, 3)), 1u);
+
+    const double bytesPerMb = 1024.0 * 1024.0;
+    printf("Acceleration structure scratch pool: %u frames, up to %u builds per frame, best of %u\n", numFrames, maxBuildsPerFrame, numRepetitions);
+    printf("%-16s %8s %12s %8s %9s %12s %10s %10s %9s %10s\n",
+           "frames in flight", "resizes", "capacity MB", "batch MB", "peak MB", "requested MB", "wasted MB", "wrap MB", "sim ms", "ns/alloc");
+
+    for (uint32_t framesInFlight = 1; framesInFlight <= 3; ++framesInFlight)
+    {
+        AccelStructScratchPoolSimulationSettings settings;
+        settings.frameCount = numFrames;
+        settings.maxBuildsPerFrame = maxBuildsPerFrame;
+        settings.framesInFlight = framesInFlight;
+
+        AccelStructScratchPoolSimulationResult result;
+        double bestTimeMs = 1e30;
+        for (uint32_t repetition = 0; repetition < numRepetitions; ++repetition)
+        {
+            const auto startTime = std::chrono::high_resolution_clock::now();
+            result = AccelStructScratchPooling::simulate(settings);
+            const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+            bestTimeMs = std::min(bestTimeMs, elapsedTime.count());
+        }
+
+        const AccelStructScratchPoolStats& stats = result.stats;
+        printf("%-16u %8u %12.1f %8.1f %9.1f %12.1f %10.1f %10.1f %9.2f %10.1f%s\n", framesInFlight, result.numResizes,
+               stats.capacity / bytesPerMb, stats.peakBatchBytes / bytesPerMb, stats.peakUsedBytes / bytesPerMb,
+               stats.peakRequestedBytes / bytesPerMb, stats.peakWastedBytes / bytesPerMb, stats.wrapWasteBytes / bytesPerMb, bestTimeMs,
+               bestTimeMs * 1e6 / std::max(stats.numAllocations + stats.numFailedAllocations, 1u), result.valid ? "" : " INVALID");
+    }
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+#include "AccelStruct/BlasBuildSchedulerSimulation.h"
+#include "TestFramework.h"
+
+// A scene load followed by a stream of rebuilds, scheduled with several per frame budgets: frames until everything is
+// built, the largest frame, the longest wait and the CPU time of the scheduling
+BENCHMARK(BlasBuildScheduler, "[blas = 2000] [rebuilds = 20000] [frames = 600]")
+{
+    const uint32_t numBlas = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 0, 2000)), 1u);
+    const uint32_t numRebuilds = static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 1, 20000));
+    const uint32_t numFrames = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 2, 600)), 1u);
+
+    // Hair BLAS sizes spread over two orders of magnitude, every BLAS arrives with the scene, rebuilds of animated ones follow
+    std::mt19937 rng(213);
+    std::lognormal_distribution<float> primitiveCounts(10.0f, 1.2f);
+    std::vector<BlasBuildRequest> requests;
+    std::vector<uint32_t> arrivalFrames;
+    uint64_t totalPrimitives = 0;
+    for (uint32_t requestIndex = 0; requestIndex < numBlas + numRebuilds; ++requestIndex)
+    {
+        BlasBuildRequest request;
+        request.key = requestIndex < numBlas ? requestIndex : rng() % numBlas;
+        request.primitiveCount = std::min(std::max((uint32_t)primitiveCounts(rng), 1u), 4000000u);
+        request.scratchBytes = BlasBuildScheduler::estimateScratchBytes(request.primitiveCount);
+        request.priority = requestIndex < numBlas ? 1 : rng() % (BlasBuildScheduler::kMaxPriority + 1);
+        requests.push_back(request);
+        arrivalFrames.push_back(requestIndex < numBlas ? 0 : rng() % numFrames);
+        totalPrimitives += request.primitiveCount;
+    }
+
+    printf("BLAS build scheduler: %u BLAS, %u rebuilds over %u frames, %.1f M primitives\n", numBlas, numRebuilds, numFrames, totalPrimitives / 1e6);
+    printf("%-14s %7s %12s %14s %11s %9s %10s %8s\n",
+           "budget", "frames", "max builds", "max scratch MB", "max prims", "max wait", "oversized", "ms");
+
+    for (const uint32_t maxPrimitives : { 0u, 4000000u, 1000000u, 250000u })
+    {
+        BlasBuildBudget budget;
+        budget.maxPrimitives = maxPrimitives;
+        budget.maxScratchBytes = maxPrimitives > 0 ? BlasBuildScheduler::estimateScratchBytes(maxPrimitives) : 0;
+
+        const auto startTime = std::chrono::high_resolution_clock::now();
+        const BlasBuildScheduleStats stats = BlasBuildScheduling::simulate(requests, arrivalFrames, budget);
+        const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+
+        char budgetName[32];
+        snprintf(budgetName, sizeof(budgetName), maxPrimitives > 0 ? "%u prims" : "unlimited", maxPrimitives);
+        printf("%-14s %7u %12u %14.1f %11u %9u %10u %8.1f%s\n", budgetName, stats.numFrames, stats.maxBuildsPerFrame,
+               stats.maxScratchBytesPerFrame / (1024.0 * 1024.0), stats.maxPrimitivesPerFrame, stats.maxWaitFrames,
+               stats.numOverBudgetFrames, elapsedTime.count(), stats.valid ? "" : " INVALID");
+    }
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+#include "AccelStruct/BlasCompactionTrackerSimulation.h"
+#include "TestFramework.h"
+
+// Lifecycle of many animated BLAS for several rebuild intervals and frames in flight: builds, compactions, the refits
+// that ran on a compacted BLAS, the memory compaction saves and the CPU time of the tracking
+BENCHMARK(BlasCompactionTracker, "[blas = 1000] [frames = 600] [invalidate interval = 10]")
+{
+    const uint32_t numBlas = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 0, 1000)), 1u);
+    const uint32_t numFrames = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 1, 600)), 1u);
+    const uint32_t invalidateInterval = static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 2, 10));
+
+    const double bytesPerMb = 1024.0 * 1024.0;
+    printf("BLAS compaction tracker: %u BLAS, %u frames, a geometry change every %u frames\n", numBlas, numFrames, invalidateInterval);
+    printf("%-16s %16s %8s %9s %12s %17s %10s %11s %9s\n", "rebuild interval", "frames in flight", "builds", "rebuilds",
+           "compactions", "compacted refits", "built MB", "current MB", "ms");
+
+    for (const uint32_t rebuildInterval : { 0u, 30u, 120u })
+    {
+        for (uint32_t framesInFlight = 1; framesInFlight <= 3; ++framesInFlight)
+        {
+            BlasCompactionSimulationSettings settings;
+            settings.frameCount = numFrames;
+            settings.blasCount = numBlas;
+            settings.rebuildInterval = rebuildInterval;
+            settings.compactionLatencyFrames = framesInFlight + 1;
+            settings.invalidateInterval = invalidateInterval;
+
+            const auto startTime = std::chrono::high_resolution_clock::now();
+            const BlasCompactionSimulationResult result = BlasCompaction::simulate(settings);
+            const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+
+            printf("%-16u %16u %8u %9u %12u %16.1f%% %10.1f %11.1f %9.2f%s\n", rebuildInterval, framesInFlight, result.numBuilds,
+                   result.numRebuilds, result.numCompactions, 100.0 * result.numCompactedRefits / std::max(result.numRefits, 1u),
+                   result.memoryStats.builtBytes / bytesPerMb, result.memoryStats.currentBytes / bytesPerMb, elapsedTime.count(),
+                   result.valid ? "" : " INVALID");
+        }
+    }
+}
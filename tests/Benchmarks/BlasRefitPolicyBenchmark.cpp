@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+#include "AccelStruct/BlasRefitPolicySimulation.h"
+#include "Curve/MorphTargetRefitEstimator.h"
+#include "TestFramework.h"
+
+using namespace donut::math;
+
+// Looping animation of many BLAS whose bounds swell and settle with different phases, played back through the policy with
+// several growth and per frame rebuild limits: rebuilds, deferred rebuilds, the longest wait, the growth the refit BLAS
+// are traced with and the CPU time of the policy
+BENCHMARK(BlasRefitPolicy, "[blas = 256] [frames = 2000] [loop frames = 240]")
+{
+    const uint32_t numBlas = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 0, 256)), 1u);
+    const uint32_t numFrames = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 1, 2000)), 2u);
+    const uint32_t loopFrames = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 2, 240)), 1u);
+
+    // Meshes of the same animation share a few phases, so their bounds swell together
+    std::mt19937 rng(241);
+    std::uniform_int_distribution<uint32_t> phases(0, 7);
+    std::uniform_real_distribution<float> swells(0.3f, 1.2f);
+    std::vector<std::vector<float>> surfaceAreas(numBlas);
+    for (uint32_t blasIndex = 0; blasIndex < numBlas; ++blasIndex)
+    {
+        const float phaseOffset = (float)phases(rng) / 8.0f;
+        const float swell = swells(rng);
+        surfaceAreas[blasIndex].resize(numFrames);
+        for (uint32_t frame = 0; frame < numFrames; ++frame)
+        {
+            const float phase = 6.2831853f * ((float)frame / (float)loopFrames + phaseOffset);
+            surfaceAreas[blasIndex][frame] = 1.0f + 0.5f * swell * (1.0f - std::cos(phase)) + 0.1f * swell * (1.0f - std::cos(2.0f * phase));
+        }
+    }
+
+    printf("BLAS refit policy: %u BLAS, %u frames, a loop every %u frames\n", numBlas, numFrames, loopFrames);
+    printf("%-10s %14s %9s %10s %9s %9s %11s %11s %9s\n", "max growth", "rebuilds/frame", "rebuilds", "max/frame", "deferred",
+           "max wait", "mean growth", "max growth", "ms");
+
+    for (const float maxSurfaceAreaGrowth : { 0.25f, 0.5f, 1.0f })
+    {
+        for (const uint32_t maxRebuildsPerFrame : { 0u, 1u, 4u, 16u })
+        {
+            BlasRefitPolicySettings settings;
+            settings.maxSurfaceAreaGrowth = maxSurfaceAreaGrowth;
+            settings.maxRebuildsPerFrame = maxRebuildsPerFrame;
+
+            const auto startTime = std::chrono::high_resolution_clock::now();
+            const BlasRefitSimulationResult result = BlasRefit::simulate(surfaceAreas, settings);
+            const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+
+            char limitName[32];
+            snprintf(limitName, sizeof(limitName), maxRebuildsPerFrame > 0 ? "%u" : "unlimited", maxRebuildsPerFrame);
+            printf("%-10g %14s %9u %10u %9u %9u %11.3f %11.3f %9.2f%s\n", maxSurfaceAreaGrowth, limitName, result.counters.getRebuildCount(),
+                   result.maxRebuildsPerFrame, result.counters.numDeferredRebuilds, result.maxDueFrames, result.meanGrowth,
+                   result.counters.maxSurfaceAreaGrowth, elapsedTime.count(), result.valid ? "" : " INVALID");
+        }
+    }
+}
+
+// Synthetic hair animation whose strands sway as a whole, and spread and frizz apart twice per loop, which is what degrades
+// a refit tree. The bounds come from the refit estimator of the renderer, the BLAS play the loop with different phases as
+// the hair meshes of a scene do. Refits alone, the refit count alone and the growth limits with the default refit count.
+BENCHMARK(BlasRefitPolicyHairAnimation, "[frames = 2000] [max rebuilds per frame = 1]")
+{
+    const uint32_t numFrames = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 0, 2000)), 2u);
+    const uint32_t maxRebuildsPerFrame = static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 1, 1));
+
+    constexpr uint32_t kNumStrands = 1024;
+    constexpr uint32_t kStrandPoints = 16;
+    constexpr uint32_t kNumKeyframes = 120;
+    constexpr uint32_t kNumBlas = 8;
+    constexpr float kKeyframesPerFrame = 0.5f;
+    constexpr float kTwoPi = 6.28318531f;
+
+    // One segment between consecutive points of a strand, the keyframe entry of point j of strand s is s * kStrandPoints + j
+    std::vector<rtxcr::geometry::LineSegment> lineSegments;
+    lineSegments.reserve(kNumStrands * (kStrandPoints - 1));
+    std::vector<float3> strandDirections(kNumStrands);
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> uniform(-1.0f, 1.0f);
+    const uint32_t gridSize = (uint32_t)std::ceil(std::sqrt((float)kNumStrands));
+    for (uint32_t strandIndex = 0; strandIndex < kNumStrands; ++strandIndex)
+    {
+        const float3 root = float3((float)(strandIndex % gridSize), 0.0f, (float)(strandIndex / gridSize)) * 0.05f;
+        strandDirections[strandIndex] = normalize(float3(uniform(rng), 0.0f, uniform(rng)) + float3(0.0f, 0.01f, 0.0f));
+        for (uint32_t pointIndex = 0; pointIndex + 1 < kStrandPoints; ++pointIndex)
+        {
+            rtxcr::geometry::LineSegment lineSegment = {};
+            for (uint32_t endPoint = 0; endPoint < 2; ++endPoint)
+            {
+                const float3 position = root - float3(0.0f, 0.1f * (pointIndex + endPoint), 0.0f);
+                lineSegment.vertices[endPoint].position[0] = position.x;
+                lineSegment.vertices[endPoint].position[1] = position.y;
+                lineSegment.vertices[endPoint].position[2] = position.z;
+                lineSegment.vertices[endPoint].radius = 0.005f;
+            }
+            lineSegment.geometryIndex = strandIndex;
+            lineSegments.push_back(lineSegment);
+        }
+    }
+
+    std::vector<float4> keyframeData((size_t)kNumKeyframes * kNumStrands * kStrandPoints);
+    std::vector<nvrhi::BufferRange> keyframeRanges(kNumKeyframes);
+    for (uint32_t keyframeIndex = 0; keyframeIndex < kNumKeyframes; ++keyframeIndex)
+    {
+        keyframeRanges[keyframeIndex].byteOffset = (uint64_t)keyframeIndex * kNumStrands * kStrandPoints * sizeof(float4);
+        keyframeRanges[keyframeIndex].byteSize = (uint64_t)kNumStrands * kStrandPoints * sizeof(float4);
+
+        const float phase = kTwoPi * keyframeIndex / kNumKeyframes;
+        const float sway = 0.3f * std::sin(phase);
+        const float spread = 0.05f * (1.0f - std::cos(2.0f * phase));
+        float4* const keyframe = keyframeData.data() + (size_t)keyframeIndex * kNumStrands * kStrandPoints;
+        for (uint32_t strandIndex = 0; strandIndex < kNumStrands; ++strandIndex)
+        {
+            for (uint32_t pointIndex = 0; pointIndex < kStrandPoints; ++pointIndex)
+            {
+                const float t = (float)pointIndex / (kStrandPoints - 1);
+                const float3 frizz = float3(uniform(rng), uniform(rng), uniform(rng)) * 0.2f;
+                const float3 offset = float3(sway * t * t, 0.0f, 0.0f) + (strandDirections[strandIndex] * t + frizz) * spread;
+                keyframe[(size_t)strandIndex * kStrandPoints + pointIndex] = float4(offset, 0.0f);
+            }
+        }
+    }
+
+    const auto startTime = std::chrono::high_resolution_clock::now();
+    const std::vector<float> keyframeSurfaceAreas = MorphTargetRefitEstimator::computeKeyframeSurfaceAreas(lineSegments, keyframeData, keyframeRanges);
+    const std::chrono::duration<double, std::milli> estimationTime = std::chrono::high_resolution_clock::now() - startTime;
+    if (keyframeSurfaceAreas.empty() || keyframeSurfaceAreas[0] <= 0.0f)
+    {
+        printf("BLAS refit policy on a hair animation: the estimator returned no surface areas INVALID\n");
+        return;
+    }
+
+    std::vector<std::vector<float>> surfaceAreas(kNumBlas, std::vector<float>(numFrames));
+    for (uint32_t blasIndex = 0; blasIndex < kNumBlas; ++blasIndex)
+    {
+        for (uint32_t frame = 0; frame < numFrames; ++frame)
+        {
+            const float keyframePosition = std::fmod(frame * kKeyframesPerFrame + (float)blasIndex * kNumKeyframes / kNumBlas, (float)kNumKeyframes);
+            surfaceAreas[blasIndex][frame] = MorphTargetRefitEstimator::getSurfaceArea(keyframeSurfaceAreas, keyframePosition);
+        }
+    }
+
+    const auto minMax = std::minmax_element(keyframeSurfaceAreas.begin(), keyframeSurfaceAreas.end());
+    printf("BLAS refit policy on a hair animation: %u BLAS, %zu line segments, %u keyframes, %u frames, largest keyframe growth %.3f, estimated in %.2f ms\n",
+           kNumBlas, lineSegments.size(), kNumKeyframes, numFrames, *minMax.second / *minMax.first - 1.0f, estimationTime.count());
+    printf("%-10s %10s %9s %15s %14s %9s %10s %9s %11s %11s\n", "max growth", "max refits", "refits", "growth rebuilds",
+           "count rebuilds", "deferred", "max/frame", "max wait", "mean growth", "max growth");
+
+    struct PolicyCase
+    {
+        float maxSurfaceAreaGrowth;
+        uint32_t maxRefits;
+    };
+    const PolicyCase policyCases[] = { { 0.0f, 0 }, { 0.0f, 100 }, { 0.25f, 600 }, { 0.5f, 600 }, { 1.0f, 600 } };
+    for (const PolicyCase& policyCase : policyCases)
+    {
+        BlasRefitPolicySettings settings;
+        settings.maxSurfaceAreaGrowth = policyCase.maxSurfaceAreaGrowth;
+        settings.maxRefits = policyCase.maxRefits;
+        settings.maxRebuildsPerFrame = maxRebuildsPerFrame;
+        const BlasRefitSimulationResult result = BlasRefit::simulate(surfaceAreas, settings);
+
+        printf("%-10g %10u %9u %15u %14u %9u %10u %9u %11.3f %11.3f%s\n", policyCase.maxSurfaceAreaGrowth, policyCase.maxRefits,
+               result.counters.numRefits, result.counters.numGrowthRebuilds, result.counters.numRefitCountRebuilds,
+               result.counters.numDeferredRebuilds, result.maxRebuildsPerFrame, result.maxDueFrames, result.meanGrowth,
+               result.counters.maxSurfaceAreaGrowth, result.valid ? "" : " INVALID");
+    }
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <cstdio>
+
+#include "Curve/CurveBvhEstimator.h"
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+// BVH estimate of every representation of a synthetic groom on 1 thread and on all threads, with the statistics of the tree
+BENCHMARK(CurveBvhEstimator, "[strands = 20000] [points per strand = 32] [repetitions = 3]")
+{
+    const SyntheticGroomDesc groomDesc = getBenchmarkGroomDesc(args, 20000);
+    const uint32_t numRepetitions = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 2, 3)), 1u);
+
+    printf("Curve BVH estimator: %u strands of %u points, best of %u\n",
+        groomDesc.numGeometries * groomDesc.strandsPerGeometry, groomDesc.minPointsPerStrand, numRepetitions);
+    printf("%-9s %-8s %11s %9s %7s %9s %9s %9s %11s\n", "type", "threads", "primitives", "nodes", "depth", "SAH", "leaf ovl", "MB", "ms");
+
+    for (uint32_t type = 0; type < (uint32_t)TessellationType::Count; ++type)
+    {
+        const TessellationType tessellationType = (TessellationType)type;
+        for (const int threadCount : { 1, 0 })
+        {
+            const std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(groomDesc) };
+            CurveTessellationSettings settings;
+            settings.hairTessellationThreadCount = threadCount;
+            CurveTessellation curveTessellation(meshInstances, settings);
+            curveTessellation.requestTessellation(tessellationType, meshInstances);
+
+            CurveBvhStats stats;
+            double bestTimeMs = 1e30;
+            for (uint32_t repetition = 0; repetition < numRepetitions; ++repetition)
+            {
+                curveTessellation.estimateCurveMeshBvh(tessellationType, meshInstances, 0, stats);
+                bestTimeMs = std::min(bestTimeMs, stats.buildTimeMs);
+            }
+
+            printf("%-9s %-8s %11u %9u %7u %9.2f %9.2f %9.2f %11.1f\n", getTessellationTypeName(tessellationType), (threadCount == 1) ? "1" : "all",
+                stats.numPrimitives, stats.numNodes, stats.maxDepth, stats.sahCost, stats.leafOverlap, stats.estimatedBytes / (1024.0 * 1024.0), bestTimeMs);
+        }
+    }
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#include "Curve/CurveLodGenerator.h"
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+// LOD levels of a synthetic groom generated from its LOD0 segments, with the segments each level keeps and its projected
+// strand area against LOD0, which the widening should preserve
+BENCHMARK(CurveLodGenerator, "[strands = 100000] [points per strand = 32] [levels = 6] [repetitions = 3]")
+{
+    constexpr uint32_t kSeed = 0x9e3779b9u;
+    constexpr double kAreaTolerance = 0.1;
+
+    const SyntheticGroomDesc groomDesc = getBenchmarkGroomDesc(args, 100000);
+    const uint32_t numLevels = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 2, 6)), 2u);
+    const uint32_t numRepetitions = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 3, 3)), 1u);
+
+    const std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(groomDesc) };
+    const CurveTessellationSettings settings;
+    CurveTessellation curveTessellation(meshInstances, settings);
+    const std::vector<rtxcr::geometry::LineSegment>& lod0LineSegments = curveTessellation.GetCurvesLineSegments(groomDesc.name);
+    std::vector<uint32_t> lod0GeometrySegmentCounts;
+    for (const auto& geometry : meshInstances[0]->GetMesh()->geometries)
+    {
+        lod0GeometrySegmentCounts.push_back(geometry->numIndices / 2);
+    }
+    const double lod0Area = CurveLodGenerator::getProjectedArea(lod0LineSegments);
+
+    printf("Curve LOD generator: %u strands of %u points, keep ratio %g, best of %u\n",
+        groomDesc.numGeometries * groomDesc.strandsPerGeometry, groomDesc.minPointsPerStrand, settings.hairLodStrandKeepRatio, numRepetitions);
+    printf("%-6s %11s %9s %9s\n", "LOD", "segments", "area", "ms");
+    printf("%-6u %11zu %8.1f%% %9s\n", 0u, lod0LineSegments.size(), 100.0, "-");
+
+    for (uint32_t level = 1; level < numLevels; ++level)
+    {
+        std::vector<rtxcr::geometry::LineSegment> lineSegments;
+        std::vector<uint32_t> geometrySegmentCounts;
+        double bestTimeMs = 1e30;
+        for (uint32_t repetition = 0; repetition < numRepetitions; ++repetition)
+        {
+            const auto startTime = std::chrono::high_resolution_clock::now();
+            CurveLodGenerator::generateLevel(lod0LineSegments, lod0GeometrySegmentCounts, settings.hairLodStrandKeepRatio, level, kSeed,
+                lineSegments, geometrySegmentCounts);
+            const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+            bestTimeMs = std::min(bestTimeMs, elapsedTime.count());
+        }
+
+        const double areaRatio = (lod0Area > 0.0) ? CurveLodGenerator::getProjectedArea(lineSegments) / lod0Area : 0.0;
+        printf("%-6u %11zu %8.1f%% %9.2f%s\n", level, lineSegments.size(), 100.0 * areaRatio, bestTimeMs,
+            (std::abs(areaRatio - 1.0) > kAreaTolerance) ? " INVALID" : "");
+    }
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <chrono>
+#include <cstdio>
+
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationKernels.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+// Polytube tessellation of a synthetic groom at every order, with its triangle budget against the uniform default order
+BENCHMARK(CurvePolyTubeOrder, "[strands = 100000] [points per strand = 32] [repetitions = 3]")
+{
+    using namespace CurveTessellationKernels;
+
+    const SyntheticGroomDesc groomDesc = getBenchmarkGroomDesc(args, 100000);
+    const uint32_t numRepetitions = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 2, 3)), 1u);
+    const std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(groomDesc) };
+
+    printf("Curve Polytube order: %u strands of %u points, best of %u\n",
+        groomDesc.numGeometries * groomDesc.strandsPerGeometry, groomDesc.minPointsPerStrand, numRepetitions);
+    printf("%-6s %13s %13s %13s\n", "order", "M triangles", "vs default", "Polytube ms");
+
+    for (uint32_t order = kMinPolyTubeOrder; order <= kMaxPolyTubeOrder; ++order)
+    {
+        CurveTessellationSettings settings;
+        settings.hairPolyTubeOrder = order;
+
+        uint64_t numLineSegments = 0;
+        uint64_t numTriangles = 0;
+        double bestTimeMs = 1e30;
+        for (uint32_t repetition = 0; repetition < numRepetitions; ++repetition)
+        {
+            CurveTessellation curveTessellation(meshInstances, settings);
+            curveTessellation.selectPolyTubeOrders(meshInstances, {}, float3(0.0f), 0.0f);
+
+            const auto startTime = std::chrono::high_resolution_clock::now();
+            curveTessellation.requestTessellation(TessellationType::Polytube, meshInstances);
+            const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+            bestTimeMs = std::min(bestTimeMs, elapsedTime.count());
+
+            numLineSegments = curveTessellation.GetCurvesLineSegments(groomDesc.name).size();
+            const BufferGroup* buffers = curveTessellation.getCurveMeshLod0Buffers(TessellationType::Polytube, meshInstances, 0);
+            numTriangles = buffers ? buffers->indexData.size() / 3 : 0;
+        }
+
+        const uint64_t numDefaultTriangles = numLineSegments * RTXCR_CURVE_POLYTUBE_ORDER * 2;
+        const double budget = (numDefaultTriangles > 0) ? 100.0 * (double(numTriangles) / double(numDefaultTriangles) - 1.0) : 0.0;
+        printf("%-6u %13.3f %+12.1f%% %13.1f%s\n", order, numTriangles / 1e6, budget, bestTimeMs,
+            (numTriangles != numLineSegments * order * 2) ? " INVALID" : "");
+    }
+}
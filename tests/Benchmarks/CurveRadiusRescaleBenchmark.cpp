@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <chrono>
+#include <cstdio>
+
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+// A radius scale change applied in place to every cached representation and LOD, against extracting and tessellating them again at the new scale
+BENCHMARK(CurveRadiusRescale, "[strands = 20000] [points per strand = 32] [LOD levels = 3] [SIMD = 0] [repetitions = 3]")
+{
+    const SyntheticGroomDesc groomDesc = getBenchmarkGroomDesc(args, 20000);
+    const std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(groomDesc) };
+
+    CurveTessellationSettings settings;
+    settings.hairLodLevels = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 2, 3)), 1u);
+    settings.enableSimdHairTessellation = TestFramework::getBenchmarkArg(args, 3, 0) != 0;
+    const uint32_t numRepetitions = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 4, 3)), 1u);
+
+    auto requestEveryTessellation = [](CurveTessellation& curveTessellation, const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
+    {
+        for (uint32_t type = 0; type < (uint32_t)TessellationType::Count; ++type)
+        {
+            curveTessellation.requestTessellation((TessellationType)type, meshInstances);
+        }
+    };
+
+    CurveTessellation curveTessellation(meshInstances, settings);
+    requestEveryTessellation(curveTessellation, meshInstances);
+
+    printf("Curve radius rescale: %u strands of %u points, %u LOD levels, %s kernels, best of %u\n",
+        groomDesc.numGeometries * groomDesc.strandsPerGeometry, groomDesc.minPointsPerStrand, curveTessellation.getCurveLodLevelCount(),
+        settings.enableSimdHairTessellation ? "SIMD" : "library", numRepetitions);
+
+    double bestRescaleTimeMs = 1e30;
+    double bestFreshTimeMs = 1e30;
+    for (uint32_t repetition = 0; repetition < numRepetitions; ++repetition)
+    {
+        settings.hairRadiusScale = (repetition % 2 == 0) ? 1.2f : 0.8f;
+
+        auto startTime = std::chrono::high_resolution_clock::now();
+        curveTessellation.rescaleCurveRadius(meshInstances);
+        std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+        bestRescaleTimeMs = std::min(bestRescaleTimeMs, elapsedTime.count());
+
+        const std::vector<std::shared_ptr<MeshInstance>> freshMeshInstances = { createSyntheticGroom(groomDesc) };
+        startTime = std::chrono::high_resolution_clock::now();
+        CurveTessellation freshCurveTessellation(freshMeshInstances, settings);
+        requestEveryTessellation(freshCurveTessellation, freshMeshInstances);
+        elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+        bestFreshTimeMs = std::min(bestFreshTimeMs, elapsedTime.count());
+    }
+
+    printf("%-22s %10.1f ms\n", "rescale in place", bestRescaleTimeMs);
+    printf("%-22s %10.1f ms\n", "fresh tessellation", bestFreshTimeMs);
+    printf("%-22s %10.2fx\n", "speedup", bestFreshTimeMs / bestRescaleTimeMs);
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <chrono>
+#include <cstdio>
+
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+// Line segment extraction of a synthetic groom with the resegmentation off and at a few error bounds, with the segments it keeps
+BENCHMARK(CurveResegmentation, "[strands = 100000] [points per strand = 32] [repetitions = 3]")
+{
+    const SyntheticGroomDesc groomDesc = getBenchmarkGroomDesc(args, 100000);
+    const uint32_t numRepetitions = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 2, 3)), 1u);
+
+    printf("Curve resegmentation: %u strands of %u points, best of %u\n",
+        groomDesc.numGeometries * groomDesc.strandsPerGeometry, groomDesc.minPointsPerStrand, numRepetitions);
+    printf("%-8s %-11s %11s %9s %13s\n", "threads", "error", "segments", "kept", "extract ms");
+
+    const std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(groomDesc) };
+    const std::string& meshName = meshInstances[0]->GetMesh()->name;
+    for (const int threadCount : { 1, 0 })
+    {
+        size_t numOriginalSegments = 0;
+        for (const float maxError : { 0.0f, 0.0005f, 0.002f, 0.01f })
+        {
+            CurveTessellationSettings settings;
+            settings.hairResegmentationError = maxError;
+            settings.hairTessellationThreadCount = threadCount;
+
+            size_t numLineSegments = 0;
+            double bestTimeMs = 1e30;
+            for (uint32_t repetition = 0; repetition < numRepetitions; ++repetition)
+            {
+                const auto startTime = std::chrono::high_resolution_clock::now();
+                CurveTessellation curveTessellation(meshInstances, settings);
+                const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+                bestTimeMs = std::min(bestTimeMs, elapsedTime.count());
+                numLineSegments = curveTessellation.GetCurvesLineSegments(meshName).size();
+            }
+
+            if (maxError == 0.0f)
+            {
+                numOriginalSegments = numLineSegments;
+            }
+            const double keptRatio = (numOriginalSegments > 0) ? 100.0 * double(numLineSegments) / double(numOriginalSegments) : 0.0;
+            printf("%-8s %-11g %11zu %8.1f%% %13.1f%s\n", (threadCount == 1) ? "1" : "all", maxError, numLineSegments, keptRatio, bestTimeMs,
+                (numLineSegments > numOriginalSegments) ? " INVALID" : "");
+        }
+    }
+}
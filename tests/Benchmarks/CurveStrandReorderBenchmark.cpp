@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+namespace
+{
+    // Mean distance between the roots of consecutive strands, a strand starts where a segment doesn't continue the previous one
+    double getMeanRootDistance(const std::vector<rtxcr::geometry::LineSegment>& lineSegments)
+    {
+        double distance = 0.0;
+        uint32_t numStrands = 0;
+        const float* previousRoot = nullptr;
+        for (size_t segmentIndex = 0; segmentIndex < lineSegments.size(); ++segmentIndex)
+        {
+            const rtxcr::geometry::LineSegment& segment = lineSegments[segmentIndex];
+            if (segmentIndex > 0 && segment.geometryIndex == lineSegments[segmentIndex - 1].geometryIndex &&
+                memcmp(segment.vertices[0].position, lineSegments[segmentIndex - 1].vertices[1].position, sizeof(segment.vertices[0].position)) == 0)
+            {
+                continue;
+            }
+
+            if (previousRoot)
+            {
+                double distanceSquared = 0.0;
+                for (uint32_t i = 0; i < 3; ++i)
+                {
+                    const double d = double(segment.vertices[0].position[i]) - double(previousRoot[i]);
+                    distanceSquared += d * d;
+                }
+                distance += std::sqrt(distanceSquared);
+            }
+            previousRoot = segment.vertices[0].position;
+            ++numStrands;
+        }
+        return (numStrands > 1) ? distance / double(numStrands - 1) : 0.0;
+    }
+}
+
+// Line segment extraction of a synthetic groom in asset order and in Morton order, the difference is the cost of the reorder.
+// With keyframes the reorder also permutes the morph target data. The root distance is the mean distance between consecutive strands.
+BENCHMARK(CurveStrandReorder, "[strands = 100000] [points per strand = 32] [keyframes = 0] [repetitions = 3]")
+{
+    SyntheticGroomDesc groomDesc = getBenchmarkGroomDesc(args, 100000);
+    groomDesc.numKeyframes = static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 2, 0));
+    const uint32_t numRepetitions = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 3, 3)), 1u);
+
+    printf("Curve strand reorder: %u strands of %u points, %u keyframes, best of %u\n",
+        groomDesc.numGeometries * groomDesc.strandsPerGeometry, groomDesc.minPointsPerStrand, groomDesc.numKeyframes, numRepetitions);
+    printf("%-8s %-7s %13s %13s %11s\n", "threads", "order", "extract ms", "Polytube ms", "root dist");
+
+    for (const int threadCount : { 1, 0 })
+    {
+        double extractTimeMs[2] = {};
+        for (const bool isReordered : { false, true })
+        {
+            CurveTessellationSettings settings;
+            settings.enableHairStrandReorder = isReordered;
+            settings.hairTessellationThreadCount = threadCount;
+
+            double bestTimeMs[2] = { 1e30, 1e30 };
+            double rootDistance = 0.0;
+            for (uint32_t repetition = 0; repetition < numRepetitions; ++repetition)
+            {
+                // The reorder permutes the scene's keyframes, every repetition starts from asset order
+                const std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(groomDesc) };
+
+                auto startTime = std::chrono::high_resolution_clock::now();
+                CurveTessellation curveTessellation(meshInstances, settings);
+                std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+                bestTimeMs[0] = std::min(bestTimeMs[0], elapsedTime.count());
+
+                startTime = std::chrono::high_resolution_clock::now();
+                curveTessellation.requestTessellation(TessellationType::Polytube, meshInstances);
+                elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+                bestTimeMs[1] = std::min(bestTimeMs[1], elapsedTime.count());
+                rootDistance = getMeanRootDistance(curveTessellation.GetCurvesLineSegments(groomDesc.name));
+            }
+
+            extractTimeMs[isReordered ? 1 : 0] = bestTimeMs[0];
+            printf("%-8s %-7s %13.1f %13.1f %11.4f\n", (threadCount == 1) ? "1" : "all", isReordered ? "Morton" : "asset", bestTimeMs[0], bestTimeMs[1],
+                rootDistance);
+        }
+        printf("%-8s %-7s %13.1f\n", (threadCount == 1) ? "1" : "all", "cost", extractTimeMs[1] - extractTimeMs[0]);
+    }
+}
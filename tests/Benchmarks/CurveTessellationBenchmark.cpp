@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+// Extraction and tessellation time of a synthetic groom for 1, 2, 4, ... threads up to the hardware threads.
+// Every column also shows the speedup over 1 thread.
+BENCHMARK(CurveTessellationScaling, "[strands = 100000] [points per strand = 32] [repetitions = 3] [max threads = hardware threads]")
+{
+    const SyntheticGroomDesc groomDesc = getBenchmarkGroomDesc(args, 100000);
+    const uint32_t numRepetitions = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 2, 3)), 1u);
+    const std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(groomDesc) };
+
+    const uint32_t maxThreadCount = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 3, std::thread::hardware_concurrency())), 1u);
+    printf("Curve tessellation scaling: %u strands of %u points, %u hardware threads, best of %u\n",
+        groomDesc.numGeometries * groomDesc.strandsPerGeometry, groomDesc.minPointsPerStrand, std::thread::hardware_concurrency(), numRepetitions);
+    printf("%-8s %-9s %13s %13s %13s %13s\n", "threads", "kernels", "extract ms", "Polytube ms", "DOTS ms", "LSS ms");
+
+    for (const bool useSimdKernels : { false, true })
+    {
+        double serialTimeMs[4] = {};
+        for (uint32_t threadCount = 1; ; threadCount = std::min(threadCount * 2, maxThreadCount))
+        {
+            CurveTessellationSettings settings;
+            settings.hairTessellationThreadCount = static_cast<int>(threadCount);
+            settings.enableSimdHairTessellation = useSimdKernels;
+
+            double bestTimeMs[4] = { 1e30, 1e30, 1e30, 1e30 };
+            for (uint32_t repetition = 0; repetition < numRepetitions; ++repetition)
+            {
+                auto startTime = std::chrono::high_resolution_clock::now();
+                CurveTessellation curveTessellation(meshInstances, settings);
+                std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+                bestTimeMs[0] = std::min(bestTimeMs[0], elapsedTime.count());
+
+                for (uint32_t typeIndex = 0; typeIndex < (uint32_t)TessellationType::Count; ++typeIndex)
+                {
+                    startTime = std::chrono::high_resolution_clock::now();
+                    curveTessellation.requestTessellation((TessellationType)typeIndex, meshInstances);
+                    elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+                    bestTimeMs[typeIndex + 1] = std::min(bestTimeMs[typeIndex + 1], elapsedTime.count());
+                }
+            }
+
+            if (threadCount == 1)
+            {
+                std::copy(bestTimeMs, bestTimeMs + 4, serialTimeMs);
+            }
+            printf("%-8u %-9s", threadCount, useSimdKernels ? "SIMD" : "library");
+            for (uint32_t column = 0; column < 4; ++column)
+            {
+                printf(" %7.1f %4.1fx", bestTimeMs[column], serialTimeMs[column] / bestTimeMs[column]);
+            }
+            printf("\n");
+
+            if (threadCount == maxThreadCount)
+            {
+                break;
+            }
+        }
+    }
+}
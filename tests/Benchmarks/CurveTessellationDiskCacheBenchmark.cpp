@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <chrono>
+#include <cstdio>
+
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+// Startup of a synthetic groom into every representation with an empty (cold) and a filled (warm) disk cache.
+// Polytube and DOTS use the SIMD kernels unless told otherwise, so the cold time doesn't depend on the geometry library build.
+BENCHMARK(CurveTessellationDiskCache, "[strands = 20000] [points per strand = 32] [repetitions = 3] [SIMD kernels = 1]")
+{
+    const SyntheticGroomDesc groomDesc = getBenchmarkGroomDesc(args, 20000);
+    const uint32_t numRepetitions = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 2, 3)), 1u);
+
+    const std::filesystem::path cacheDirectory = std::filesystem::temp_directory_path() / "rtxcr_benchmarks_diskcache";
+
+    CurveTessellationSettings settings;
+    settings.enableHairTessellationDiskCache = true;
+    settings.hairTessellationDiskCacheDirectory = cacheDirectory;
+    settings.enableSimdHairTessellation = (TestFramework::getBenchmarkArg(args, 3, 1) != 0);
+
+    printf("Curve tessellation disk cache: %u strands of %u points, %s kernels, best of %u, cache in %s\n",
+        groomDesc.numGeometries * groomDesc.strandsPerGeometry, groomDesc.minPointsPerStrand, settings.enableSimdHairTessellation ? "SIMD" : "library",
+        numRepetitions, cacheDirectory.string().c_str());
+    printf("%-6s %13s %13s %13s %13s %13s\n", "cache", "startup ms", "extract ms", "Polytube ms", "DOTS ms", "LSS ms");
+
+    for (const bool isWarm : { false, true })
+    {
+        double bestTimeMs[5] = { 1e30, 1e30, 1e30, 1e30, 1e30 };
+        for (uint32_t repetition = 0; repetition < numRepetitions; ++repetition)
+        {
+            if (!isWarm)
+            {
+                std::filesystem::remove_all(cacheDirectory);
+            }
+
+            // Every launch loads its scene anew
+            const std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(groomDesc) };
+
+            const auto startupTime = std::chrono::high_resolution_clock::now();
+            auto startTime = startupTime;
+            CurveTessellation curveTessellation(meshInstances, settings);
+            std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+            bestTimeMs[1] = std::min(bestTimeMs[1], elapsedTime.count());
+
+            for (uint32_t typeIndex = 0; typeIndex < (uint32_t)TessellationType::Count; ++typeIndex)
+            {
+                startTime = std::chrono::high_resolution_clock::now();
+                curveTessellation.requestTessellation((TessellationType)typeIndex, meshInstances);
+                elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+                bestTimeMs[typeIndex + 2] = std::min(bestTimeMs[typeIndex + 2], elapsedTime.count());
+            }
+
+            elapsedTime = std::chrono::high_resolution_clock::now() - startupTime;
+            bestTimeMs[0] = std::min(bestTimeMs[0], elapsedTime.count());
+        }
+
+        printf("%-6s", isWarm ? "warm" : "cold");
+        for (const double timeMs : bestTimeMs)
+        {
+            printf(" %13.1f", timeMs);
+        }
+        printf("\n");
+    }
+
+    std::filesystem::remove_all(cacheDirectory);
+}
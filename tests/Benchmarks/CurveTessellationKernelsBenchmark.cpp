@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+#include "Curve/CurveTessellationKernels.h"
+#include "TestFramework.h"
+
+// Single threaded vertex generation of the scalar reference and the batched kernels of the best supported instruction set
+BENCHMARK(CurveTessellationKernels, "[segments = 1000000] [repetitions = 5]")
+{
+    using namespace CurveTessellationKernels;
+
+    const uint32_t numLineSegments = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 0, 1000000)), 1u);
+    const uint32_t numRepetitions = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 1, 5)), 1u);
+
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::vector<rtxcr::geometry::LineSegment> lineSegments(numLineSegments);
+    for (auto& segment : lineSegments)
+    {
+        for (uint32_t endPoint = 0; endPoint < 2; ++endPoint)
+        {
+            for (uint32_t axis = 0; axis < 3; ++axis)
+            {
+                segment.vertices[endPoint].position[axis] = unit(rng) * 4.0f - 2.0f;
+            }
+            segment.vertices[endPoint].radius = 0.001f + 0.01f * unit(rng);
+            segment.vertices[endPoint].texCoord[0] = unit(rng);
+            segment.vertices[endPoint].texCoord[1] = unit(rng);
+        }
+    }
+
+    const uint32_t maxVertices = numLineSegments * std::max(getPolyTubeVerticesPerSegment(RTXCR_CURVE_POLYTUBE_ORDER), kDotsVerticesPerSegment);
+    std::vector<uint32_t> indices(maxVertices);
+    std::vector<float3> positions(maxVertices);
+    std::vector<uint32_t> normals(maxVertices);
+    std::vector<uint32_t> tangents(maxVertices);
+    std::vector<float2> texCoords(maxVertices);
+    std::vector<float> radius(maxVertices);
+    const CurveTessellationOutput output = { indices.data(), positions.data(), normals.data(), tangents.data(), texCoords.data(), radius.data() };
+
+    printf("Curve tessellation kernels: %u segments, polytube order %u, best of %u, %s kernels\n",
+        numLineSegments, RTXCR_CURVE_POLYTUBE_ORDER, numRepetitions, getCurveTessellationKernelIsaName(getSupportedIsa()));
+    printf("%-10s %13s %13s %9s\n", "type", "scalar ms", "SIMD ms", "speedup");
+
+    for (const bool isDots : { false, true })
+    {
+        double bestTimeMs[2] = { 1e30, 1e30 };
+        for (uint32_t repetition = 0; repetition < numRepetitions; ++repetition)
+        {
+            for (const bool useSimdKernels : { false, true })
+            {
+                const auto startTime = std::chrono::high_resolution_clock::now();
+                if (isDots)
+                {
+                    useSimdKernels ? tessellateDisjointOrthogonalTriangleStrips(lineSegments.data(), numLineSegments, output, 0) :
+                        tessellateDisjointOrthogonalTriangleStripsScalar(lineSegments.data(), numLineSegments, output, 0);
+                }
+                else
+                {
+                    useSimdKernels ? tessellatePolyTubes(lineSegments.data(), numLineSegments, RTXCR_CURVE_POLYTUBE_ORDER, output, 0) :
+                        tessellatePolyTubesScalar(lineSegments.data(), numLineSegments, RTXCR_CURVE_POLYTUBE_ORDER, output, 0);
+                }
+                const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+                bestTimeMs[useSimdKernels ? 1 : 0] = std::min(bestTimeMs[useSimdKernels ? 1 : 0], elapsedTime.count());
+            }
+        }
+
+        printf("%-10s %13.1f %13.1f %8.2fx\n", isDots ? "DOTS" : "Polytube", bestTimeMs[0], bestTimeMs[1], bestTimeMs[0] / bestTimeMs[1]);
+    }
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+#include "AllocationCounter.h"
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+// Scene switches between DOTS and LSS of a 10M segment groom, with both representations cached and with a budget that evicts
+// the one not displayed: the time and heap allocations of the switch itself, apart from the tessellation a switch may need
+BENCHMARK(CurveTessellationSwitch, "[strands = 312500] [points per strand = 33] [switches = 10]")
+{
+    const SyntheticGroomDesc groomDesc = getBenchmarkGroomDesc(args, 312500, 33);
+    const uint32_t numSwitches = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 2, 10)), 2u);
+    const std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(groomDesc) };
+
+    printf("Curve tessellation switch: %u strands of %u points (%.1fM segments), %u switches between DOTS and LSS\n",
+        groomDesc.numGeometries * groomDesc.strandsPerGeometry, groomDesc.minPointsPerStrand,
+        groomDesc.numGeometries * groomDesc.strandsPerGeometry * (groomDesc.minPointsPerStrand - 1) / 1e6, numSwitches);
+    printf("%-9s %15s %14s %13s %13s %14s %13s\n", "budget", "tessellate ms", "tessellations", "mean ms", "max ms", "allocs/switch", "frees/switch");
+
+    // With a 1 MB budget requesting one representation evicts the other, the switch releases the evicted one
+    for (const int budgetMB : { 0, 1 })
+    {
+        CurveTessellationSettings settings;
+        settings.enableLazyHairTessellation = true;
+        settings.hairTessellationCacheBudgetMB = budgetMB;
+        CurveTessellation curveTessellation(meshInstances, settings);
+
+        // The first switch releases the source line buffers of the scene and isn't measured
+        curveTessellation.requestTessellation(TessellationType::LinearSweptSphere, meshInstances);
+        curveTessellation.replacingSceneMesh(nullptr, nullptr, TessellationType::LinearSweptSphere, meshInstances);
+
+        double tessellationTimeMs = 0.0;
+        uint32_t numTessellations = 0;
+        double switchTimeMs = 0.0;
+        double maxSwitchTimeMs = 0.0;
+        AllocationCounter::Counts switchCounts;
+        for (uint32_t switchIndex = 0; switchIndex < numSwitches; ++switchIndex)
+        {
+            const TessellationType tessellationType = (switchIndex % 2 == 0) ? TessellationType::DisjointOrthogonalTriangleStrip : TessellationType::LinearSweptSphere;
+
+            numTessellations += curveTessellation.isTessellationCached(tessellationType) ? 0 : 1;
+            auto startTime = std::chrono::high_resolution_clock::now();
+            curveTessellation.requestTessellation(tessellationType, meshInstances);
+            std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+            tessellationTimeMs += elapsedTime.count();
+
+            const AllocationCounter::Counts startCounts = AllocationCounter::get();
+            startTime = std::chrono::high_resolution_clock::now();
+            curveTessellation.replacingSceneMesh(nullptr, nullptr, tessellationType, meshInstances);
+            elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+            const AllocationCounter::Counts counts = AllocationCounter::getDifference(startCounts, AllocationCounter::get());
+
+            switchTimeMs += elapsedTime.count();
+            maxSwitchTimeMs = std::max(maxSwitchTimeMs, elapsedTime.count());
+            switchCounts.numAllocations += counts.numAllocations;
+            switchCounts.numFrees += counts.numFrees;
+        }
+
+        char budgetName[32];
+        snprintf(budgetName, sizeof(budgetName), budgetMB > 0 ? "%d MB" : "unlimited", budgetMB);
+        printf("%-9s %15.1f %14u %13.3f %13.3f %14.1f %13.1f\n", budgetName, tessellationTimeMs, numTessellations, switchTimeMs / numSwitches,
+            maxSwitchTimeMs, (double)switchCounts.numAllocations / numSwitches, (double)switchCounts.numFrees / numSwitches);
+    }
+}
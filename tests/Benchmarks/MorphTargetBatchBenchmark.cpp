@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+#include "RenderPass/MorphTargetBatch.h"
+#include "TestFramework.h"
+
+// Mesh table of the batched morph target dispatch: the per frame CPU cost of the thread ranges, and the thread to mesh
+// search every shader thread runs, emulated on the CPU
+BENCHMARK(MorphTargetBatch, "[meshes = 1000] [segments per mesh = 2000] [repetitions = 3]")
+{
+    const uint32_t numMeshes = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 0, 1000)), 1u);
+    const uint32_t maxLineSegments = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 1, 2000)), 1u);
+    const uint32_t numRepetitions = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 2, 3)), 1u);
+
+    std::mt19937 rng(171);
+    std::uniform_int_distribution<uint32_t> lineSegments(maxLineSegments / 2, maxLineSegments);
+    std::uniform_int_distribution<uint32_t> orders(RTXCR_CURVE_POLYTUBE_MIN_ORDER, RTXCR_CURVE_POLYTUBE_MAX_ORDER);
+    std::vector<MorphTargetBatchMesh> meshes(numMeshes);
+    for (MorphTargetBatchMesh& mesh : meshes)
+    {
+        mesh = {};
+        mesh.polyTubeOrder = orders(rng);
+        mesh.vertexCount = (int)(lineSegments(rng) * mesh.polyTubeOrder * 6);
+    }
+
+    printf("Morph target batch: %u meshes of up to %u segments, best of %u, 1 thread\n", numMeshes, maxLineSegments, numRepetitions);
+    printf("%-12s %11s %9s %16s\n", "kernel", "threads", "table us", "lookup ns/thread");
+
+    for (const bool perSegment : { false, true })
+    {
+        double bestTableTimeUs = 1e30;
+        double bestLookupTimeNs = 1e30;
+        uint32_t numThreads = 0;
+        std::vector<uint32_t> threadMeshes;
+        for (uint32_t repetition = 0; repetition < numRepetitions; ++repetition)
+        {
+            const auto tableStartTime = std::chrono::high_resolution_clock::now();
+            for (MorphTargetBatchMesh& mesh : meshes)
+            {
+                mesh.numThreads = MorphTargetBatch::getMeshThreadCount(mesh, RTXCR_CURVE_TESSELLATION_TYPE_POLYTUBE, perSegment);
+            }
+            numThreads = MorphTargetBatch::assignThreadRanges(meshes);
+            const std::chrono::duration<double, std::micro> tableTime = std::chrono::high_resolution_clock::now() - tableStartTime;
+            bestTableTimeUs = std::min(bestTableTimeUs, tableTime.count());
+
+            threadMeshes.resize(numThreads);
+            const auto lookupStartTime = std::chrono::high_resolution_clock::now();
+            for (uint32_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+            {
+                threadMeshes[threadIndex] = MorphTargetBatch::findMesh(meshes, threadIndex);
+            }
+            const std::chrono::duration<double, std::nano> lookupTime = std::chrono::high_resolution_clock::now() - lookupStartTime;
+            bestLookupTimeNs = std::min(bestLookupTimeNs, lookupTime.count() / std::max(numThreads, 1u));
+        }
+
+        printf("%-12s %11u %9.1f %16.2f\n", perSegment ? "per segment" : "per vertex", numThreads, bestTableTimeUs, bestLookupTimeNs);
+    }
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+#include "Curve/CurveTessellationKernels.h"
+#include "Curve/MorphTargetKernelEmulation.h"
+#include "TestFramework.h"
+
+// CPU emulation of the one thread per vertex and the one thread per segment morph target kernels. The emulation runs the threads
+// one after another, so the time difference is the per vertex work the segment layout saves, not a GPU timing.
+BENCHMARK(MorphTargetKernelEmulation, "[segments = 200000] [repetitions = 3]")
+{
+    using namespace CurveTessellationKernels;
+
+    const uint32_t numLineSegments = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 0, 200000)), 1u);
+    const uint32_t numRepetitions = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 1, 3)), 1u);
+
+    // Strands of 16 segments, keyframe point p of strand g lives at (first segment + g + p)
+    constexpr uint32_t kSegmentsPerStrand = 16;
+    std::mt19937 rng(141);
+    std::uniform_real_distribution<float> random(-1.0f, 1.0f);
+    std::vector<LineSegment> lineSegments(numLineSegments);
+    for (uint32_t segmentIndex = 0; segmentIndex < numLineSegments; ++segmentIndex)
+    {
+        LineSegment& lineSegment = lineSegments[segmentIndex];
+        lineSegment.geometryIndex = segmentIndex / kSegmentsPerStrand;
+        lineSegment.pad0 = float3(0.0f);
+        lineSegment.point0 = float3(random(rng), random(rng), random(rng));
+        lineSegment.point1 = lineSegment.point0 + float3(random(rng), random(rng), random(rng)) * 0.05f;
+        lineSegment.radius0 = 0.001f;
+        lineSegment.radius1 = 0.0008f;
+    }
+    std::vector<float4> keyframes[2];
+    for (std::vector<float4>& keyframe : keyframes)
+    {
+        keyframe.resize(numLineSegments + numLineSegments / kSegmentsPerStrand + 2);
+        for (float4& point : keyframe)
+        {
+            point = float4(random(rng), random(rng), random(rng), 0.0f) * 0.01f;
+        }
+    }
+
+    printf("Morph target kernel emulation: %u segments, best of %u, 1 thread\n", numLineSegments, numRepetitions);
+    printf("%-10s %13s %14s %9s\n", "type", "per vertex ms", "per segment ms", "speedup");
+
+    for (uint32_t order = kMinPolyTubeOrder; order <= kMaxPolyTubeOrder + 1; ++order)
+    {
+        // kMaxPolyTubeOrder + 1 stands for DOTS
+        const bool isDots = (order > kMaxPolyTubeOrder);
+        MorphTargetKernelEmulation::Input input;
+        input.lineSegments = lineSegments.data();
+        input.numLineSegments = numLineSegments;
+        input.keyframe = keyframes[0].data();
+        input.nextKeyframe = keyframes[1].data();
+        input.lerpWeight = 0.37f;
+        input.polyTubeOrder = isDots ? RTXCR_CURVE_POLYTUBE_ORDER : order;
+        const uint32_t tessellationType = isDots ? RTXCR_CURVE_TESSELLATION_TYPE_DOTS : RTXCR_CURVE_TESSELLATION_TYPE_POLYTUBE;
+
+        const uint32_t numVertices = MorphTargetKernelEmulation::getVertexCount(tessellationType, input);
+        std::vector<float3> positions(numVertices);
+        std::vector<uint32_t> normals(numVertices);
+        std::vector<uint32_t> tangents(numVertices);
+        const MorphTargetKernelEmulation::Output output = { positions.data(), normals.data(), tangents.data() };
+
+        double bestTimeMs[2] = { 1e30, 1e30 };
+        for (uint32_t repetition = 0; repetition < numRepetitions; ++repetition)
+        {
+            for (uint32_t perSegment = 0; perSegment < 2; ++perSegment)
+            {
+                const auto startTime = std::chrono::high_resolution_clock::now();
+                if (perSegment != 0)
+                {
+                    MorphTargetKernelEmulation::dispatchPerSegment(tessellationType, input, output);
+                }
+                else
+                {
+                    MorphTargetKernelEmulation::dispatchPerVertex(tessellationType, input, output);
+                }
+                const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+                bestTimeMs[perSegment] = std::min(bestTimeMs[perSegment], elapsedTime.count());
+            }
+        }
+
+        char typeName[16];
+        snprintf(typeName, sizeof(typeName), isDots ? "DOTS" : "Polytube %u", order);
+        printf("%-10s %13.1f %14.1f %8.2fx\n", typeName, bestTimeMs[0], bestTimeMs[1], bestTimeMs[0] / bestTimeMs[1]);
+    }
+}
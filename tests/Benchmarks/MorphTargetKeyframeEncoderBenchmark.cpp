@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#include "Curve/MorphTargetKeyframeEncoder.h"
+#include "TestFramework.h"
+
+// Encode time, size, bytes read per frame and error of the quantized keyframe formats against the full format
+BENCHMARK(MorphTargetKeyframeEncoder, "[strand points = 100000] [keyframes = 64] [repetitions = 3]")
+{
+    const uint32_t numStrandPoints = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 0, 100000)), 1u);
+    const uint32_t numKeyframes = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 1, 64)), 1u);
+    const uint32_t numRepetitions = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 2, 3)), 1u);
+
+    // Strands swaying a few centimeters, every point further from the root moves further
+    std::vector<float4> keyframeData((size_t)numStrandPoints * numKeyframes);
+    std::vector<nvrhi::BufferRange> keyframeRanges(numKeyframes);
+    for (uint32_t keyframeIndex = 0; keyframeIndex < numKeyframes; ++keyframeIndex)
+    {
+        keyframeRanges[keyframeIndex].byteOffset = (uint64_t)keyframeIndex * numStrandPoints * sizeof(float4);
+        keyframeRanges[keyframeIndex].byteSize = (uint64_t)numStrandPoints * sizeof(float4);
+        const float phase = 6.2831853f * (float)keyframeIndex / (float)numKeyframes;
+        for (uint32_t pointIndex = 0; pointIndex < numStrandPoints; ++pointIndex)
+        {
+            const float strandPosition = (float)(pointIndex % 16) / 15.0f;
+            const float strandPhase = (float)(pointIndex / 16) * 0.01f;
+            keyframeData[(size_t)keyframeIndex * numStrandPoints + pointIndex] =
+                float4(std::sin(phase + strandPhase), 0.2f * std::cos(2.0f * phase + strandPhase), std::cos(phase), 0.0f) * (0.03f * strandPosition);
+        }
+    }
+
+    printf("Morph target keyframe encoder: %u strand points, %u keyframes, best of %u, 1 thread\n", numStrandPoints, numKeyframes, numRepetitions);
+    printf("%-8s %9s %9s %14s %13s %13s\n", "format", "encode ms", "MB", "MB read/frame", "max error mm", "rms error mm");
+
+    for (const uint32_t format : { RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_FULL, RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_HALF, RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_UNORM10 })
+    {
+        MorphTargetKeyframeEncoder::EncodedKeyframes encodedKeyframes;
+        double bestTimeMs = 1e30;
+        for (uint32_t repetition = 0; repetition < numRepetitions; ++repetition)
+        {
+            const auto startTime = std::chrono::high_resolution_clock::now();
+            MorphTargetKeyframeEncoder::encode(keyframeData, keyframeRanges, format, encodedKeyframes);
+            const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+            bestTimeMs = std::min(bestTimeMs, elapsedTime.count());
+        }
+
+        const double bytesPerMb = 1024.0 * 1024.0;
+        printf("%-8s %9.1f %9.2f %14.2f %13.4f %13.4f\n", MorphTargetKeyframeEncoder::getFormatName(format), bestTimeMs,
+               (double)(encodedKeyframes.getByteSize() + encodedKeyframes.getParameterByteSize()) / bytesPerMb,
+               (double)encodedKeyframes.getReadBytesPerFrame() / bytesPerMb,
+               encodedKeyframes.maxPositionError * 1000.0f, encodedKeyframes.rmsPositionError * 1000.0f);
+    }
+}
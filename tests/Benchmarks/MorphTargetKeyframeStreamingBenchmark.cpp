@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+#include "Curve/MorphTargetKeyframeStreamingSimulation.h"
+#include "TestFramework.h"
+
+// Keyframe window of a long animation against its slot count: keyframe uploads, the ones the render thread waited for,
+// dropped background reads and the GPU memory of the slots, with background reads that take a few frames
+BENCHMARK(MorphTargetKeyframeStreaming, "[keyframes = 3000] [strand points = 200000] [read latency frames = 2]")
+{
+    const uint32_t numKeyframes = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 0, 3000)), 2u);
+    const uint32_t numStrandPoints = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 1, 200000)), 1u);
+    const uint32_t readLatencyFrames = static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 2, 2));
+
+    const double bytesPerMb = 1024.0 * 1024.0;
+    const uint64_t keyframeBytes = (uint64_t)numStrandPoints * getKeyframeStride(RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_HALF);
+    printf("Morph target keyframe streaming: %u keyframes of %u strand points, %.1f MB resident in the half format, %u frames read latency\n",
+           numKeyframes, numStrandPoints, (double)keyframeBytes * numKeyframes / bytesPerMb, readLatencyFrames);
+    printf("%-6s %6s %11s %9s %9s %9s %12s %9s\n", "speed", "slots", "slots MB", "uploads", "stalls", "dropped", "max pending", "sim ms");
+
+    for (const float keyframesPerFrame : { 0.5f, 2.0f })
+    {
+        for (const uint32_t slotCount : { 2u, 4u, 8u, 16u, 64u })
+        {
+            MorphTargetKeyframeStreamingSimulationSettings settings;
+            settings.keyframeCount = numKeyframes;
+            settings.slotCount = slotCount;
+            settings.frameCount = (uint32_t)(numKeyframes / keyframesPerFrame);
+            settings.keyframesPerFrame = keyframesPerFrame;
+            settings.readLatencyFrames = readLatencyFrames;
+
+            const auto startTime = std::chrono::high_resolution_clock::now();
+            const MorphTargetKeyframeStreamingSimulationStats stats = MorphTargetKeyframeStreaming::simulate(settings);
+            const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+
+            printf("%-6g %6u %11.1f %9u %9u %9u %12u %9.2f%s\n", keyframesPerFrame, slotCount,
+                   (double)keyframeBytes * std::min(slotCount, numKeyframes) / bytesPerMb, stats.numLoads, stats.numRequiredLoads,
+                   stats.numStaleLoads, stats.maxPendingLoads, elapsedTime.count(), stats.valid ? "" : " INVALID");
+        }
+    }
+}
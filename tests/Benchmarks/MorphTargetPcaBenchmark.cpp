@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+
+#include "Curve/MorphTargetPca.h"
+#include "TestFramework.h"
+
+// Decomposition time of a swaying keyframe sequence on one and on all threads, and the size of the basis against the full keyframes
+BENCHMARK(MorphTargetPca, "[strand points = 100000] [keyframes = 256] [repetitions = 3]")
+{
+    const uint32_t numStrandPoints = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 0, 100000)), 1u);
+    const uint32_t numKeyframes = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 1, 256)), 1u);
+    const uint32_t numRepetitions = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 2, 3)), 1u);
+
+    // A few sine modes of different frequencies per strand, the motion of a looping hair animation
+    std::vector<float4> keyframeData((size_t)numStrandPoints * numKeyframes);
+    std::vector<nvrhi::BufferRange> keyframeRanges(numKeyframes);
+    for (uint32_t keyframeIndex = 0; keyframeIndex < numKeyframes; ++keyframeIndex)
+    {
+        keyframeRanges[keyframeIndex].byteOffset = (uint64_t)keyframeIndex * numStrandPoints * sizeof(float4);
+        keyframeRanges[keyframeIndex].byteSize = (uint64_t)numStrandPoints * sizeof(float4);
+        const float phase = 6.2831853f * (float)keyframeIndex / (float)numKeyframes;
+        for (uint32_t pointIndex = 0; pointIndex < numStrandPoints; ++pointIndex)
+        {
+            const float strandPosition = (float)(pointIndex % 16) / 15.0f;
+            const float strandPhase = (float)(pointIndex / 16) * 0.01f;
+            keyframeData[(size_t)keyframeIndex * numStrandPoints + pointIndex] = float4(
+                std::sin(phase + strandPhase) + 0.3f * std::sin(3.0f * phase),
+                0.2f * std::cos(2.0f * phase + strandPhase),
+                std::cos(phase) + 0.1f * std::sin(5.0f * phase + strandPhase), 0.0f) * (0.03f * strandPosition);
+        }
+    }
+
+    const uint32_t hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    const double bytesPerMb = 1024.0 * 1024.0;
+    printf("Morph target PCA: %u strand points, %u keyframes (%.1f MB in the full format), best of %u\n",
+           numStrandPoints, numKeyframes, (double)keyframeData.size() * sizeof(float4) / bytesPerMb, numRepetitions);
+    printf("%-10s %8s %11s %10s %9s %13s\n", "max error", "threads", "decompose ms", "components", "MB", "max error mm");
+
+    for (const float maxRelativeError : { 0.05f, 0.01f, 0.002f })
+    {
+        for (const uint32_t numThreads : { 1u, hardwareThreads })
+        {
+            ThreadPool threadPool(numThreads);
+            MorphTargetPcaSettings settings;
+            settings.maxRelativeError = maxRelativeError;
+            MorphTargetPcaBasis basis;
+            double bestTimeMs = 1e30;
+            for (uint32_t repetition = 0; repetition < numRepetitions; ++repetition)
+            {
+                const auto startTime = std::chrono::high_resolution_clock::now();
+                MorphTargetPca::decompose(keyframeData, keyframeRanges, threadPool, basis, settings);
+                const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+                bestTimeMs = std::min(bestTimeMs, elapsedTime.count());
+            }
+
+            printf("%-10g %8u %11.1f %10u %9.2f %13.4f\n", maxRelativeError, numThreads, bestTimeMs, basis.componentCount,
+                   (double)(basis.basis.size() * sizeof(float4) + basis.coefficients.size() * sizeof(float)) / bytesPerMb,
+                   basis.maxPositionError * 1000.0f);
+
+            if (hardwareThreads == 1)
+            {
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <cstdio>
+
+#include "AccelStruct/TlasInstanceTableSimulation.h"
+#include "TestFramework.h"
+
+// Synthetic scene whose instances move and pause, get new BLAS and toggle their mask, updated through the instance table
+// for several moving fractions: dirty instances, ranges, skipped TLAS builds, the uploaded bytes and the CPU time of
+// filling every instance, of setting every instance of the table and of setting only the instances marked as changed
+BENCHMARK(TlasInstanceTable, "[instances = 100000] [frames = 300] [animation interval = 60]")
+{
+    const uint32_t numInstances = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 0, 100000)), 1u);
+    const uint32_t numFrames = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 1, 300)), 1u);
+    const uint32_t animationInterval = static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 2, 60));
+
+    const double bytesPerMb = 1024.0 * 1024.0;
+    printf("TLAS instance table: %u instances, %u frames, animation paused every %u frames\n", numInstances, numFrames, animationInterval);
+    printf("%-7s %11s %8s %10s %8s %9s %10s %9s %9s %9s %11s\n", "moving", "dirty/frame", "ranges", "max/frame", "skipped", "full MB",
+           "ranges MB", "full ms", "table ms", "set/frame", "changed ms");
+
+    for (const float movingInstanceFraction : { 0.001f, 0.01f, 0.1f, 1.0f })
+    {
+        TlasInstanceSimulationSettings settings;
+        settings.instanceCount = numInstances;
+        settings.frameCount = numFrames;
+        settings.movingInstanceFraction = movingInstanceFraction;
+        settings.animationInterval = animationInterval;
+        const TlasInstanceSimulationResult result = TlasInstances::simulate(settings);
+
+        printf("%6.1f%% %11.1f %8u %10u %8u %9.1f %10.1f %9.2f %9.2f %9.1f %11.2f%s\n", 100.0f * movingInstanceFraction,
+               (double)result.totalStats.numDirtyInstances / std::max(result.numFrames, 1u), result.totalStats.numRanges,
+               result.maxRangesPerFrame, result.numSkippedFrames, result.fullUploadBytes / bytesPerMb, result.rangeUploadBytes / bytesPerMb,
+               result.fullUpdateTimeMs, result.tableUpdateTimeMs, (double)result.numChangedInputs / std::max(result.numFrames, 1u),
+               result.changedUpdateTimeMs, result.valid ? "" : " INVALID");
+    }
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <limits>
+
+#include "Curve/CompactLineSegmentEncoder.h"
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+namespace
+{
+    // Line segments of a groom in the layout the morph target animation reads, as the resource manager uploads them
+    struct SceneLineSegments
+    {
+        std::vector<LineSegment> lineSegments;
+        std::vector<uint32_t> geometrySegmentCounts;
+    };
+
+    SceneLineSegments getSceneLineSegments(const SyntheticGroomDesc& desc)
+    {
+        const std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(desc) };
+        // The tessellator keeps a reference to its settings
+        const CurveTessellationSettings settings;
+        CurveTessellation curveTessellation(meshInstances, settings);
+
+        SceneLineSegments scene;
+        for (const auto& segment : curveTessellation.GetCurvesLineSegments(desc.name))
+        {
+            LineSegment& lineSegment = scene.lineSegments.emplace_back();
+            lineSegment.geometryIndex = segment.geometryIndex;
+            lineSegment.pad0 = float3(0.0f);
+            lineSegment.point0 = float3(segment.vertices[0].position);
+            lineSegment.radius0 = segment.vertices[0].radius;
+            lineSegment.point1 = float3(segment.vertices[1].position);
+            lineSegment.radius1 = segment.vertices[1].radius;
+        }
+        scene.geometrySegmentCounts = curveTessellation.GetCurveGeometrySegmentCounts(desc.name);
+        return scene;
+    }
+
+    // Decodes every segment and counts the ones off by more than half a quantization step of their bounds, plus float rounding of the decode
+    uint32_t countRoundTripErrors(
+        const std::vector<LineSegment>& lineSegments,
+        const std::vector<CompactLineSegment>& compactLineSegments,
+        const std::vector<LineSegmentBounds>& lineSegmentBounds)
+    {
+        uint32_t numErrors = 0;
+        for (size_t segmentIndex = 0; segmentIndex < lineSegments.size(); ++segmentIndex)
+        {
+            const LineSegment& segment = lineSegments[segmentIndex];
+            const uint32_t boundsIndex = getCompactLineSegmentBoundsIndex(compactLineSegments[segmentIndex]);
+            REQUIRE(boundsIndex < lineSegmentBounds.size());
+            const LineSegmentBounds& bounds = lineSegmentBounds[boundsIndex];
+            const LineSegment decodedSegment = decodeLineSegment(compactLineSegments[segmentIndex], bounds);
+
+            const float3 positionError = max(abs(decodedSegment.point0 - segment.point0), abs(decodedSegment.point1 - segment.point1));
+            const float radiusError = std::max(std::abs(decodedSegment.radius0 - segment.radius0), std::abs(decodedSegment.radius1 - segment.radius1));
+            const float3 roundingError = (abs(bounds.origin) + bounds.extent) * (4.0f * std::numeric_limits<float>::epsilon());
+            const float3 positionTolerance = bounds.extent * (0.5f / 65535.0f) + roundingError;
+            const float radiusTolerance = bounds.maxRadius * (0.5f / 65535.0f + 4.0f * std::numeric_limits<float>::epsilon());
+
+            if (decodedSegment.geometryIndex != segment.geometryIndex ||
+                positionError.x > positionTolerance.x || positionError.y > positionTolerance.y || positionError.z > positionTolerance.z ||
+                radiusError > radiusTolerance)
+            {
+                ++numErrors;
+            }
+        }
+        return numErrors;
+    }
+}
+
+// Every geometry gets its own bounds entry, and every decoded value is within the quantization error of its bounds
+TEST(CompactLineSegmentEncoder, RoundTripWithinQuantizationError)
+{
+    SyntheticGroomDesc desc;
+    desc.name = "compactGroom";
+    desc.numGeometries = 5;
+    desc.strandsPerGeometry = 200;
+    desc.seed = 91;
+    const SceneLineSegments scene = getSceneLineSegments(desc);
+
+    std::vector<CompactLineSegment> compactLineSegments;
+    std::vector<LineSegmentBounds> lineSegmentBounds;
+    REQUIRE(CompactLineSegmentEncoder::encode(scene.lineSegments, scene.geometrySegmentCounts, compactLineSegments, lineSegmentBounds));
+    REQUIRE(compactLineSegments.size() == scene.lineSegments.size());
+    CHECK(lineSegmentBounds.size() == desc.numGeometries);
+    CHECK(countRoundTripErrors(scene.lineSegments, compactLineSegments, lineSegmentBounds) == 0);
+
+    size_t segmentIndex = 0;
+    for (uint32_t geometryIndex = 0; geometryIndex < scene.geometrySegmentCounts.size(); ++geometryIndex)
+    {
+        for (uint32_t i = 0; i < scene.geometrySegmentCounts[geometryIndex]; ++i)
+        {
+            CHECK(getCompactLineSegmentBoundsIndex(compactLineSegments[segmentIndex++]) == geometryIndex);
+        }
+    }
+}
+
+// Geometries past the last bounds entry share it, and its bounds still cover them
+TEST(CompactLineSegmentEncoder, GeometriesPastLastBoundsShareIt)
+{
+    SyntheticGroomDesc desc;
+    desc.name = "compactGroom";
+    desc.numGeometries = RTXCR_COMPACT_LINE_SEGMENT_MAX_BOUNDS_COUNT + 20;
+    desc.strandsPerGeometry = 2;
+    desc.seed = 92;
+    const SceneLineSegments scene = getSceneLineSegments(desc);
+
+    std::vector<CompactLineSegment> compactLineSegments;
+    std::vector<LineSegmentBounds> lineSegmentBounds;
+    REQUIRE(CompactLineSegmentEncoder::encode(scene.lineSegments, scene.geometrySegmentCounts, compactLineSegments, lineSegmentBounds));
+    CHECK(lineSegmentBounds.size() == RTXCR_COMPACT_LINE_SEGMENT_MAX_BOUNDS_COUNT);
+    CHECK(getCompactLineSegmentBoundsIndex(compactLineSegments.back()) == RTXCR_COMPACT_LINE_SEGMENT_MAX_BOUNDS_COUNT - 1);
+    CHECK(countRoundTripErrors(scene.lineSegments, compactLineSegments, lineSegmentBounds) == 0);
+}
+
+// Segment counts that don't describe the segments fall back to a single bounds entry over the whole mesh
+TEST(CompactLineSegmentEncoder, MismatchedSegmentCountsUseOneBounds)
+{
+    SyntheticGroomDesc desc;
+    desc.name = "compactGroom";
+    desc.numGeometries = 3;
+    desc.seed = 93;
+    const SceneLineSegments scene = getSceneLineSegments(desc);
+
+    std::vector<uint32_t> geometrySegmentCounts = scene.geometrySegmentCounts;
+    geometrySegmentCounts.back() += 1;
+
+    std::vector<CompactLineSegment> compactLineSegments;
+    std::vector<LineSegmentBounds> lineSegmentBounds;
+    REQUIRE(CompactLineSegmentEncoder::encode(scene.lineSegments, geometrySegmentCounts, compactLineSegments, lineSegmentBounds));
+    CHECK(lineSegmentBounds.size() == 1);
+    CHECK(countRoundTripErrors(scene.lineSegments, compactLineSegments, lineSegmentBounds) == 0);
+}
+
+// A strand index beyond the packed bits keeps the mesh in the full format
+TEST(CompactLineSegmentEncoder, StrandIndexOverflowFails)
+{
+    SyntheticGroomDesc desc;
+    desc.name = "compactGroom";
+    desc.seed = 94;
+    SceneLineSegments scene = getSceneLineSegments(desc);
+
+    std::vector<CompactLineSegment> compactLineSegments;
+    std::vector<LineSegmentBounds> lineSegmentBounds;
+    scene.lineSegments.back().geometryIndex = RTXCR_COMPACT_LINE_SEGMENT_MAX_STRAND_INDEX;
+    CHECK(CompactLineSegmentEncoder::encode(scene.lineSegments, scene.geometrySegmentCounts, compactLineSegments, lineSegmentBounds));
+    CHECK(countRoundTripErrors(scene.lineSegments, compactLineSegments, lineSegmentBounds) == 0);
+
+    scene.lineSegments.back().geometryIndex = RTXCR_COMPACT_LINE_SEGMENT_MAX_STRAND_INDEX + 1;
+    CHECK(!CompactLineSegmentEncoder::encode(scene.lineSegments, scene.geometrySegmentCounts, compactLineSegments, lineSegmentBounds));
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <cmath>
+#include <random>
+
+#include "Curve/CurveBvhEstimator.h"
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+namespace
+{
+    // Thin random boxes along random directions in a unit cube, like hair segments
+    std::vector<box3> createRandomBounds(const uint32_t numPrimitives, const uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(0.0f, 1.0f);
+        std::uniform_real_distribution<float> offset(-0.01f, 0.01f);
+
+        std::vector<box3> bounds(numPrimitives);
+        for (box3& primitiveBounds : bounds)
+        {
+            const float3 start(position(rng), position(rng), position(rng));
+            const float3 end = start + float3(offset(rng), offset(rng), offset(rng));
+            primitiveBounds = box3(min(start, end), max(start, end) + float3(0.001f));
+        }
+        return bounds;
+    }
+
+    bool isSameTree(const CurveBvhStats& lhs, const CurveBvhStats& rhs)
+    {
+        return lhs.numPrimitives == rhs.numPrimitives && lhs.numNodes == rhs.numNodes && lhs.numLeaves == rhs.numLeaves &&
+            lhs.maxDepth == rhs.maxDepth && lhs.sahCost == rhs.sahCost && lhs.leafOverlap == rhs.leafOverlap &&
+            lhs.siblingOverlap == rhs.siblingOverlap && lhs.estimatedBytes == rhs.estimatedBytes;
+    }
+}
+
+// Trees small enough to work out by hand
+TEST(CurveBvhEstimator, HandComputedTrees)
+{
+    ThreadPool threadPool(1);
+    CHECK(CurveBvhEstimator::build({}, CurveBvhEstimator::kTriangleBytes, threadPool).numNodes == 0);
+
+    // A single primitive is the root leaf, a ray through the root always tests it
+    const CurveBvhStats single = CurveBvhEstimator::build({ box3(float3(0.0f), float3(1.0f)) }, CurveBvhEstimator::kTriangleBytes, threadPool);
+    CHECK(single.numNodes == 1);
+    CHECK(single.numLeaves == 1);
+    CHECK(single.maxDepth == 0);
+    CHECK(single.sahCost == 1.0f);
+    CHECK(single.leafOverlap == 1.0f);
+    CHECK(single.estimatedBytes == CurveBvhEstimator::kNodeBytes + CurveBvhEstimator::kTriangleBytes + sizeof(uint32_t));
+
+    // Two unit cubes 2 apart on x: the root bounds have area 18, each leaf 6, the siblings don't overlap
+    CurveBvhSettings settings;
+    settings.maxLeafPrimitives = 1;
+    const std::vector<box3> pair = { box3(float3(0.0f), float3(1.0f)), box3(float3(3.0f, 0.0f, 0.0f), float3(4.0f, 1.0f, 1.0f)) };
+    const CurveBvhStats split = CurveBvhEstimator::build(pair, CurveBvhEstimator::kLinearSweptSphereBytes, threadPool, settings);
+    CHECK(split.numNodes == 3);
+    CHECK(split.numLeaves == 2);
+    CHECK(split.maxDepth == 1);
+    CHECK(std::abs(split.leafOverlap - 12.0f / 18.0f) < 1e-6f);
+    CHECK(std::abs(split.sahCost - (18.0f + 12.0f) / 18.0f) < 1e-6f);
+    CHECK(split.siblingOverlap == 0.0f);
+    CHECK(split.estimatedBytes == 3 * CurveBvhEstimator::kNodeBytes + 2 * (CurveBvhEstimator::kLinearSweptSphereBytes + sizeof(uint32_t)));
+}
+
+// Every leaf holds 1 to maxLeafPrimitives primitives of a binary tree
+TEST(CurveBvhEstimator, BinaryTreeShape)
+{
+    ThreadPool threadPool(2);
+    const std::vector<box3> bounds = createRandomBounds(5000, 121);
+    for (const uint32_t maxLeafPrimitives : { 1u, 4u, 8u })
+    {
+        CurveBvhSettings settings;
+        settings.maxLeafPrimitives = maxLeafPrimitives;
+        const CurveBvhStats stats = CurveBvhEstimator::build(bounds, CurveBvhEstimator::kTriangleBytes, threadPool, settings);
+        CHECK(stats.numPrimitives == bounds.size());
+        CHECK(stats.numNodes == 2 * stats.numLeaves - 1);
+        CHECK(stats.numLeaves * maxLeafPrimitives >= bounds.size());
+        CHECK(stats.numLeaves <= bounds.size());
+        CHECK(stats.maxDepth >= uint32_t(std::ceil(std::log2(double(stats.numLeaves)))));
+        CHECK(stats.leafOverlap > 0.0f);
+        CHECK(stats.sahCost > stats.leafOverlap);
+        if (maxLeafPrimitives == 1)
+        {
+            CHECK(stats.numLeaves == bounds.size());
+        }
+    }
+}
+
+// The tree doesn't depend on the thread count, the top levels above the subtree size are built by all workers together
+TEST(CurveBvhEstimator, IndependentOfThreadCount)
+{
+    const std::vector<box3> bounds = createRandomBounds(100000, 122);
+    CurveBvhStats reference;
+    for (const uint32_t threadCount : { 1u, 2u, 4u })
+    {
+        ThreadPool threadPool(threadCount);
+        const CurveBvhStats stats = CurveBvhEstimator::build(bounds, CurveBvhEstimator::kTriangleBytes, threadPool);
+        if (threadCount == 1)
+        {
+            reference = stats;
+        }
+        CHECK(isSameTree(stats, reference));
+    }
+}
+
+// The tessellator hands the estimator one primitive per triangle, or per segment for LSS
+TEST(CurveBvhEstimator, RepresentationPrimitiveCounts)
+{
+    SyntheticGroomDesc desc;
+    desc.name = "bvhGroom";
+    desc.numGeometries = 2;
+    desc.strandsPerGeometry = 200;
+    desc.seed = 123;
+    const std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(desc) };
+
+    for (const bool isLssSuccessive : { false, true })
+    {
+        CurveTessellationSettings settings;
+        settings.enableLssSuccessiveImplicit = isLssSuccessive;
+        CurveTessellation curveTessellation(meshInstances, settings);
+        const uint32_t numLineSegments = static_cast<uint32_t>(curveTessellation.GetCurvesLineSegments(desc.name).size());
+        const uint32_t polyTubeOrder = curveTessellation.GetCurvePolyTubeOrder(desc.name);
+
+        for (uint32_t type = 0; type < (uint32_t)TessellationType::Count; ++type)
+        {
+            const TessellationType tessellationType = (TessellationType)type;
+            CurveBvhStats stats;
+            CHECK(!curveTessellation.estimateCurveMeshBvh(tessellationType, meshInstances, 0, stats));
+
+            curveTessellation.requestTessellation(tessellationType, meshInstances);
+            REQUIRE(curveTessellation.estimateCurveMeshBvh(tessellationType, meshInstances, 0, stats));
+
+            const uint32_t expectedPrimitives = (tessellationType == TessellationType::Polytube) ? numLineSegments * polyTubeOrder * 2 :
+                (tessellationType == TessellationType::DisjointOrthogonalTriangleStrip) ? numLineSegments * 4 : numLineSegments;
+            CHECK(stats.numPrimitives == expectedPrimitives);
+            CHECK(stats.numNodes == 2 * stats.numLeaves - 1);
+            CHECK(stats.sahCost > 0.0f);
+        }
+    }
+}
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <string>
+
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+namespace
+{
+    // The serial extractor CurveTessellation::convertCurveLineStripsToLineSegments replaced, kept as the reference
+    std::vector<std::vector<rtxcr::geometry::LineSegment>> extractLineSegmentsSerial(
+        const std::vector<std::shared_ptr<MeshInstance>>& meshInstances, const float radiusScale)
+    {
+        std::vector<std::vector<rtxcr::geometry::LineSegment>> curvesLineSegments(meshInstances.size());
+
+        for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
+        {
+            const auto& mesh = meshInstances[meshIndex]->GetMesh();
+
+            if (mesh->IsCurve())
+            {
+                const auto& indices = mesh->buffers->indexData;
+                const auto& positions = mesh->buffers->positionData;
+                const auto& radius = mesh->buffers->radiusData;
+                const auto& texCoord1 = mesh->buffers->texcoord1Data;
+
+                uint32_t virtualGeometryIndex = 0;
+                for (uint32_t geometryIndex = 0; geometryIndex < mesh->geometries.size(); ++geometryIndex)
+                {
+                    const auto& geometry = mesh->geometries[geometryIndex];
+
+                    const uint32_t indexStep = (geometry->type == MeshGeometryPrimitiveType::Lines) ? 2 : 1;
+                    for (uint32_t index = 0; index < geometry->numIndices - 1; index += indexStep)
+                    {
+                        const uint32_t lineIndexStart = indices[index + geometry->indexOffsetInMesh] + geometry->indexOffsetInMesh;
+                        const uint32_t lineIndexEnd = indices[index + 1 + geometry->indexOffsetInMesh] + geometry->indexOffsetInMesh;
+
+                        const auto& posStart = positions[lineIndexStart];
+                        const auto& posEnd = positions[lineIndexEnd];
+
+                        rtxcr::geometry::LineSegment segment = {};
+                        segment.vertices[0].position[0] = posStart.x;
+                        segment.vertices[0].position[1] = posStart.y;
+                        segment.vertices[0].position[2] = posStart.z;
+                        segment.vertices[0].radius = radius[lineIndexStart] * radiusScale;
+                        segment.vertices[1].position[0] = posEnd.x;
+                        segment.vertices[1].position[1] = posEnd.y;
+                        segment.vertices[1].position[2] = posEnd.z;
+                        segment.vertices[1].radius = radius[lineIndexEnd] * radiusScale;
+
+                        if (texCoord1.data())
+                        {
+                            const auto& uvStart = texCoord1[lineIndexStart];
+                            const auto& uvEnd = texCoord1[lineIndexEnd];
+                            segment.vertices[0].texCoord[0] = uvStart.x;
+                            segment.vertices[0].texCoord[1] = uvStart.y;
+                            segment.vertices[1].texCoord[0] = uvEnd.x;
+                            segment.vertices[1].texCoord[1] = uvEnd.y;
+                        }
+
+                        if (geometry->type == MeshGeometryPrimitiveType::Lines)
+                        {
+                            if (!curvesLineSegments[meshIndex].empty())
+                            {
+                                const auto& prevSegmentEndVertex = curvesLineSegments[meshIndex].back().vertices[1];
+                                if (!isnear(posStart.x, prevSegmentEndVertex.position[0]) ||
+                                    !isnear(posStart.y, prevSegmentEndVertex.position[1]) ||
+                                    !isnear(posStart.z, prevSegmentEndVertex.position[2]))
+                                {
+                                    ++virtualGeometryIndex;
+                                }
+                            }
+
+                            segment.geometryIndex = virtualGeometryIndex;
+                        }
+                        else
+                        {
+                            segment.geometryIndex = geometryIndex;
+                        }
+
+                        curvesLineSegments[meshIndex].push_back(segment);
+                    }
+                }
+            }
+        }
+
+        return curvesLineSegments;
+    }
+
+    // Field wise, the padding of a LineSegment isn't written by either extractor
+    bool isLineSegmentEqual(const rtxcr::geometry::LineSegment& lhs, const rtxcr::geometry::LineSegment& rhs)
+    {
+        if (lhs.geometryIndex != rhs.geometryIndex)
+        {
+            return false;
+        }
+
+        for (uint32_t vertexIndex = 0; vertexIndex < 2; ++vertexIndex)
+        {
+            const auto& lhsVertex = lhs.vertices[vertexIndex];
+            const auto& rhsVertex = rhs.vertices[vertexIndex];
+            if (memcmp(lhsVertex.position, rhsVertex.position, sizeof(lhsVertex.position)) != 0 ||
+                memcmp(lhsVertex.texCoord, rhsVertex.texCoord, sizeof(lhsVertex.texCoord)) != 0 ||
+                memcmp(&lhsVertex.radius, &rhsVertex.radius, sizeof(lhsVertex.radius)) != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Index of the first differing segment, or the shorter size if one is a prefix of the other, ~0u if both match
+    uint32_t findFirstMismatch(const std::vector<rtxcr::geometry::LineSegment>& lhs, const std::vector<rtxcr::geometry::LineSegment>& rhs)
+    {
+        const size_t numSegments = std::min(lhs.size(), rhs.size());
+        for (size_t segmentIndex = 0; segmentIndex < numSegments; ++segmentIndex)
+        {
+            if (!isLineSegmentEqual(lhs[segmentIndex], rhs[segmentIndex]))
+            {
+                return static_cast<uint32_t>(segmentIndex);
+            }
+        }
+        return (lhs.size() == rhs.size()) ? ~0u : static_cast<uint32_t>(numSegments);
+    }
+
+    // A few meshes of random line lists and line strips, line list strands are joined to or start just apart from the previous strand
+    std::vector<std::shared_ptr<MeshInstance>> createRandomGrooms(std::mt19937& rng)
+    {
+        std::uniform_int_distribution<uint32_t> meshCount(1, 4);
+        std::uniform_int_distribution<uint32_t> geometryCount(1, 5);
+        std::uniform_int_distribution<uint32_t> strandCount(1, 60);
+        std::uniform_int_distribution<uint32_t> pointCount(2, 24);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+        std::vector<std::shared_ptr<MeshInstance>> meshInstances;
+        const uint32_t numMeshes = meshCount(rng);
+        for (uint32_t meshIndex = 0; meshIndex < numMeshes; ++meshIndex)
+        {
+            SyntheticGroomDesc desc;
+            desc.name = "random" + std::to_string(meshIndex);
+            desc.numGeometries = geometryCount(rng);
+            desc.strandsPerGeometry = strandCount(rng);
+            desc.minPointsPerStrand = pointCount(rng);
+            desc.maxPointsPerStrand = std::max(desc.minPointsPerStrand, pointCount(rng));
+            desc.isLineStrip = (unit(rng) < 0.25f);
+            desc.joinedStrandRatio = 0.4f * unit(rng);
+            desc.nearStrandRatio = 0.4f * unit(rng);
+            desc.seed = rng();
+            meshInstances.push_back(createSyntheticGroom(desc));
+        }
+        return meshInstances;
+    }
+}
+
+// Random grooms with random task sizes, so strands and segment groups straddle the task boundaries, against the serial extractor
+TEST(CurveLineSegmentExtraction, RandomGroomsMatchSerialExtractor)
+{
+    std::mt19937 rng(4);
+    std::uniform_int_distribution<int> segmentsPerTask(1, 64);
+    std::uniform_real_distribution<float> radiusScale(0.25f, 2.0f);
+
+    constexpr uint32_t kNumIterations = 64;
+    for (uint32_t iteration = 0; iteration < kNumIterations; ++iteration)
+    {
+        const std::vector<std::shared_ptr<MeshInstance>> meshInstances = createRandomGrooms(rng);
+
+        CurveTessellationSettings settings;
+        settings.hairRadiusScale = radiusScale(rng);
+        settings.hairTessellationThreadCount = 1 + static_cast<int>(iteration % 4);
+        settings.hairTessellationSegmentsPerTask = (iteration % 8 == 7) ? 1 : segmentsPerTask(rng);
+
+        const std::vector<std::vector<rtxcr::geometry::LineSegment>> reference = extractLineSegmentsSerial(meshInstances, settings.hairRadiusScale);
+        CurveTessellation curveTessellation(meshInstances, settings);
+
+        for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
+        {
+            const auto& lineSegments = curveTessellation.GetCurvesLineSegments(meshInstances[meshIndex]->GetMesh()->name);
+            const uint32_t mismatch = findFirstMismatch(reference[meshIndex], lineSegments);
+            if (mismatch != ~0u)
+            {
+                printf("  iteration %u, mesh %u, %d segments per task: segment %u of %u differs\n",
+                    iteration, meshIndex, settings.hairTessellationSegmentsPerTask, mismatch, static_cast<uint32_t>(reference[meshIndex].size()));
+            }
+            CHECK(mismatch == ~0u);
+        }
+    }
+}
+
+// Segment groups start exactly where a strand starts beyond isnear() of the previous strand's end
+TEST(CurveLineSegmentExtraction, GroupsSplitAtNearMisses)
+{
+    SyntheticGroomDesc desc;
+    desc.name = "nearMisses";
+    desc.strandsPerGeometry = 200;
+    desc.minPointsPerStrand = 2;
+    desc.maxPointsPerStrand = 5;
+    desc.joinedStrandRatio = 0.5f;
+    desc.nearStrandRatio = 0.5f;
+    desc.seed = 5;
+    const std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(desc) };
+
+    CurveTessellationSettings settings;
+    settings.hairTessellationThreadCount = 2;
+    settings.hairTessellationSegmentsPerTask = 3;
+    CurveTessellation curveTessellation(meshInstances, settings);
+
+    const auto& lineSegments = curveTessellation.GetCurvesLineSegments(desc.name);
+    REQUIRE(!lineSegments.empty());
+    CHECK(lineSegments[0].geometryIndex == 0);
+
+    // Every strand is either joined or a near miss, so only the near misses start a group
+    uint32_t numGroups = 1;
+    for (size_t segmentIndex = 1; segmentIndex < lineSegments.size(); ++segmentIndex)
+    {
+        const float gapY = lineSegments[segmentIndex].vertices[0].position[1] - lineSegments[segmentIndex - 1].vertices[1].position[1];
+        const bool isNearMiss = (gapY > 1e-5f);
+        numGroups += isNearMiss ? 1 : 0;
+        CHECK(lineSegments[segmentIndex].geometryIndex == numGroups - 1);
+    }
+    CHECK(numGroups > 1);
+    CHECK(numGroups < desc.strandsPerGeometry);
+}
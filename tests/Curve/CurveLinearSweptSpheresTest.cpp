@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+namespace
+{
+    struct Capsule
+    {
+        float3 points[2];
+        float radius[2];
+    };
+
+    // Capsules of every geometry of the mesh the scene displays, in segment order
+    std::vector<std::vector<Capsule>> getSceneCapsules(const MeshInfo& mesh)
+    {
+        const BufferGroup& buffers = *mesh.buffers;
+        std::vector<std::vector<Capsule>> capsules;
+        for (const auto& geometry : mesh.geometries)
+        {
+            auto& geometryCapsules = capsules.emplace_back();
+
+            // The list format has no index buffer, every segment owns 2 vertices
+            const bool isSuccessive = (geometry->numIndices > 0);
+            const uint32_t numLineSegments = isSuccessive ? geometry->numIndices : geometry->numVertices / 2;
+            for (uint32_t segmentIndex = 0; segmentIndex < numLineSegments; ++segmentIndex)
+            {
+                const uint32_t firstVertex = geometry->vertexOffsetInMesh +
+                    (isSuccessive ? buffers.indexData[geometry->indexOffsetInMesh + segmentIndex] : segmentIndex * 2);
+                REQUIRE(firstVertex + 1 < buffers.positionData.size());
+
+                Capsule capsule;
+                for (uint32_t endPoint = 0; endPoint < 2; ++endPoint)
+                {
+                    capsule.points[endPoint] = buffers.positionData[firstVertex + endPoint];
+                    capsule.radius[endPoint] = buffers.radiusData[firstVertex + endPoint];
+                }
+                geometryCapsules.push_back(capsule);
+            }
+        }
+        return capsules;
+    }
+
+    bool isCapsuleEqual(const Capsule& lhs, const Capsule& rhs)
+    {
+        return all(lhs.points[0] == rhs.points[0]) && all(lhs.points[1] == rhs.points[1]) &&
+               lhs.radius[0] == rhs.radius[0] && lhs.radius[1] == rhs.radius[1];
+    }
+}
+
+// The successive implicit encoding describes the capsules of the list encoding with one vertex per strand point.
+// Line list strands joined within isnear() of each other don't share their joint exactly, such meshes keep the list encoding.
+TEST(CurveLinearSweptSpheres, SuccessiveMatchesListCapsules)
+{
+    SyntheticGroomDesc lineListDesc;
+    lineListDesc.name = "lineList";
+    lineListDesc.numGeometries = 3;
+    lineListDesc.strandsPerGeometry = 40;
+    lineListDesc.minPointsPerStrand = 2;
+    lineListDesc.maxPointsPerStrand = 14;
+    lineListDesc.seed = 51;
+
+    SyntheticGroomDesc joinedLineListDesc = lineListDesc;
+    joinedLineListDesc.name = "joinedLineList";
+    joinedLineListDesc.joinedStrandRatio = 0.2f;
+
+    SyntheticGroomDesc lineStripDesc;
+    lineStripDesc.name = "lineStrip";
+    lineStripDesc.numGeometries = 12;
+    lineStripDesc.isLineStrip = true;
+    lineStripDesc.seed = 52;
+
+    for (const SyntheticGroomDesc& desc : { lineListDesc, joinedLineListDesc, lineStripDesc })
+    {
+        for (const int segmentsPerTask : { 1, 5, 16384 })
+        {
+            std::vector<std::vector<Capsule>> capsules[2];
+            size_t numVertices[2] = {};
+            const bool isSuccessiveLayout = (desc.joinedStrandRatio == 0.0f);
+            for (const bool isSuccessive : { false, true })
+            {
+                const std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(desc) };
+
+                CurveTessellationSettings settings;
+                settings.enableLssSuccessiveImplicit = isSuccessive;
+                settings.hairTessellationThreadCount = 2;
+                settings.hairTessellationSegmentsPerTask = segmentsPerTask;
+                CurveTessellation curveTessellation(meshInstances, settings);
+                curveTessellation.requestTessellation(TessellationType::LinearSweptSphere, meshInstances);
+                curveTessellation.replacingSceneMesh(nullptr, nullptr, TessellationType::LinearSweptSphere, meshInstances);
+
+                const MeshInfo& mesh = *meshInstances[0]->GetMesh();
+                CHECK(mesh.type == MeshType::CurveLinearSweptSpheres);
+                CHECK(mesh.buffers->indexData.empty() != (isSuccessive && isSuccessiveLayout));
+                capsules[isSuccessive ? 1 : 0] = getSceneCapsules(mesh);
+                numVertices[isSuccessive ? 1 : 0] = mesh.buffers->positionData.size();
+            }
+
+            REQUIRE(capsules[0].size() == capsules[1].size());
+            for (size_t geometryIndex = 0; geometryIndex < capsules[0].size(); ++geometryIndex)
+            {
+                REQUIRE(capsules[0][geometryIndex].size() == capsules[1][geometryIndex].size());
+                uint32_t numMismatches = 0;
+                for (size_t segmentIndex = 0; segmentIndex < capsules[0][geometryIndex].size(); ++segmentIndex)
+                {
+                    numMismatches += isCapsuleEqual(capsules[0][geometryIndex][segmentIndex], capsules[1][geometryIndex][segmentIndex]) ? 0 : 1;
+                }
+                if (numMismatches > 0)
+                {
+                    printf("  %s, %d segments per task: %u capsules of geometry %u differ\n",
+                        desc.name.c_str(), segmentsPerTask, numMismatches, static_cast<uint32_t>(geometryIndex));
+                }
+                CHECK(numMismatches == 0);
+            }
+
+            // One vertex per strand point instead of 2 per segment
+            CHECK(isSuccessiveLayout ? (numVertices[1] < numVertices[0]) : (numVertices[1] == numVertices[0]));
+        }
+    }
+}
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <set>
+#include <tuple>
+
+#include "Curve/CurveLodGenerator.h"
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+namespace
+{
+    constexpr uint32_t kSeed = 0x9e3779b9u;
+    constexpr uint32_t kNumLevels = 4;
+
+    // LOD0 line segments and per geometry segment counts as the tessellator hands them to the generator
+    struct Lod0
+    {
+        std::vector<rtxcr::geometry::LineSegment> lineSegments;
+        std::vector<uint32_t> geometrySegmentCounts;
+    };
+
+    Lod0 getLod0(const SyntheticGroomDesc& desc)
+    {
+        const std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(desc) };
+        // The tessellator keeps a reference to its settings
+        const CurveTessellationSettings settings;
+        CurveTessellation curveTessellation(meshInstances, settings);
+
+        Lod0 lod0;
+        lod0.lineSegments = curveTessellation.GetCurvesLineSegments(desc.name);
+        for (const auto& geometry : meshInstances[0]->GetMesh()->geometries)
+        {
+            lod0.geometrySegmentCounts.push_back(geometry->numIndices / 2);
+        }
+        return lod0;
+    }
+
+    // Root positions of the strands of a level, strands start at a geometry index change
+    std::set<std::tuple<float, float, float>> getStrandRoots(const std::vector<rtxcr::geometry::LineSegment>& lineSegments)
+    {
+        std::set<std::tuple<float, float, float>> roots;
+        for (size_t segmentIndex = 0; segmentIndex < lineSegments.size(); ++segmentIndex)
+        {
+            if (segmentIndex == 0 || lineSegments[segmentIndex].geometryIndex != lineSegments[segmentIndex - 1].geometryIndex)
+            {
+                const float* position = lineSegments[segmentIndex].vertices[0].position;
+                roots.insert({ position[0], position[1], position[2] });
+            }
+        }
+        return roots;
+    }
+}
+
+// The same LOD0 and seed always produce the same level, and the segment counts describe it
+TEST(CurveLodGenerator, Deterministic)
+{
+    SyntheticGroomDesc desc;
+    desc.name = "lodGroom";
+    desc.numGeometries = 4;
+    desc.strandsPerGeometry = 200;
+    desc.seed = 71;
+    const Lod0 lod0 = getLod0(desc);
+    REQUIRE(std::accumulate(lod0.geometrySegmentCounts.begin(), lod0.geometrySegmentCounts.end(), 0u) == lod0.lineSegments.size());
+
+    for (uint32_t level = 1; level < kNumLevels; ++level)
+    {
+        std::vector<rtxcr::geometry::LineSegment> lineSegments[2];
+        std::vector<uint32_t> geometrySegmentCounts[2];
+        for (uint32_t run = 0; run < 2; ++run)
+        {
+            CurveLodGenerator::generateLevel(lod0.lineSegments, lod0.geometrySegmentCounts, 0.5f, level, kSeed, lineSegments[run], geometrySegmentCounts[run]);
+        }
+
+        CHECK(isBitwiseEqual(lineSegments[0], lineSegments[1]));
+        CHECK(geometrySegmentCounts[0] == geometrySegmentCounts[1]);
+        CHECK(geometrySegmentCounts[0].size() == lod0.geometrySegmentCounts.size());
+        CHECK(std::accumulate(geometrySegmentCounts[0].begin(), geometrySegmentCounts[0].end(), 0u) == lineSegments[0].size());
+        CHECK(lineSegments[0].size() < lod0.lineSegments.size());
+
+        // Kept segments stay in the geometry they came from, their geometry index is the strand group index of LOD0
+        uint32_t segmentOffset = 0;
+        uint32_t lod0Offset = 0;
+        for (uint32_t geometryIndex = 0; geometryIndex < geometrySegmentCounts[0].size(); ++geometryIndex)
+        {
+            std::set<uint32_t> lod0GroupIndices;
+            for (uint32_t segmentIndex = 0; segmentIndex < lod0.geometrySegmentCounts[geometryIndex]; ++segmentIndex)
+            {
+                lod0GroupIndices.insert(lod0.lineSegments[lod0Offset + segmentIndex].geometryIndex);
+            }
+            for (uint32_t segmentIndex = 0; segmentIndex < geometrySegmentCounts[0][geometryIndex]; ++segmentIndex)
+            {
+                CHECK(lod0GroupIndices.count(lineSegments[0][segmentOffset + segmentIndex].geometryIndex) == 1);
+            }
+            segmentOffset += geometrySegmentCounts[0][geometryIndex];
+            lod0Offset += lod0.geometrySegmentCounts[geometryIndex];
+        }
+    }
+}
+
+// Coarser levels keep a subset of the strands of finer ones, so switching levels never pops strands in
+TEST(CurveLodGenerator, CoarserLevelsAreSubsets)
+{
+    SyntheticGroomDesc desc;
+    desc.name = "lodGroom";
+    desc.numGeometries = 2;
+    desc.strandsPerGeometry = 500;
+    desc.seed = 72;
+    const Lod0 lod0 = getLod0(desc);
+
+    std::set<std::tuple<float, float, float>> finerRoots = getStrandRoots(lod0.lineSegments);
+    for (uint32_t level = 1; level < kNumLevels; ++level)
+    {
+        std::vector<rtxcr::geometry::LineSegment> lineSegments;
+        std::vector<uint32_t> geometrySegmentCounts;
+        CurveLodGenerator::generateLevel(lod0.lineSegments, lod0.geometrySegmentCounts, 0.6f, level, kSeed, lineSegments, geometrySegmentCounts);
+
+        const std::set<std::tuple<float, float, float>> roots = getStrandRoots(lineSegments);
+        CHECK(!roots.empty());
+        CHECK(std::includes(finerRoots.begin(), finerRoots.end(), roots.begin(), roots.end()));
+        finerRoots = roots;
+    }
+}
+
+// A mesh whose strands all fail the keep test still keeps one strand
+TEST(CurveLodGenerator, KeepsOneStrand)
+{
+    SyntheticGroomDesc desc;
+    desc.name = "lodGroom";
+    desc.strandsPerGeometry = 2;
+    desc.seed = 73;
+    const Lod0 lod0 = getLod0(desc);
+
+    std::vector<rtxcr::geometry::LineSegment> lineSegments;
+    std::vector<uint32_t> geometrySegmentCounts;
+    CurveLodGenerator::generateLevel(lod0.lineSegments, lod0.geometrySegmentCounts, 0.05f, 7, kSeed, lineSegments, geometrySegmentCounts);
+    CHECK(getStrandRoots(lineSegments).size() == 1);
+    CHECK(std::accumulate(geometrySegmentCounts.begin(), geometrySegmentCounts.end(), 0u) == lineSegments.size());
+}
+
+// The widened strands of every level keep the projected strand area, the coverage of optically thin hair, of LOD0.
+// Strand dropping is stochastic, the groom has enough strands for the coarsest level to keep about 2000 of them.
+TEST(CurveLodGenerator, ProjectedAreaWithinToleranceOfLod0)
+{
+    constexpr double kAreaTolerance = 0.1;
+
+    SyntheticGroomDesc desc;
+    desc.name = "lodGroom";
+    desc.numGeometries = 16;
+    desc.strandsPerGeometry = 1000;
+    desc.minPointsPerStrand = 8;
+    desc.maxPointsPerStrand = 16;
+    desc.seed = 74;
+    const Lod0 lod0 = getLod0(desc);
+    const double lod0Area = CurveLodGenerator::getProjectedArea(lod0.lineSegments);
+    REQUIRE(lod0Area > 0.0);
+
+    for (uint32_t level = 1; level < kNumLevels; ++level)
+    {
+        std::vector<rtxcr::geometry::LineSegment> lineSegments;
+        std::vector<uint32_t> geometrySegmentCounts;
+        CurveLodGenerator::generateLevel(lod0.lineSegments, lod0.geometrySegmentCounts, 0.5f, level, kSeed, lineSegments, geometrySegmentCounts);
+
+        const double areaRatio = CurveLodGenerator::getProjectedArea(lineSegments) / lod0Area;
+        if (std::abs(areaRatio - 1.0) > kAreaTolerance)
+        {
+            printf("  LOD %u: %u -> %u segments, projected area %.1f%% of LOD0\n", level,
+                static_cast<uint32_t>(lod0.lineSegments.size()), static_cast<uint32_t>(lineSegments.size()), 100.0 * areaRatio);
+        }
+        CHECK(std::abs(areaRatio - 1.0) <= kAreaTolerance);
+    }
+}
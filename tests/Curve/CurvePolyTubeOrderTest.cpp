@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationKernels.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+namespace
+{
+    struct KernelOutput
+    {
+        std::vector<uint32_t> indices;
+        std::vector<float3> positions;
+        std::vector<uint32_t> normals;
+        std::vector<uint32_t> tangents;
+        std::vector<float2> texCoords;
+        std::vector<float> radius;
+
+        explicit KernelOutput(const uint32_t numVertices)
+            : indices(numVertices), positions(numVertices), normals(numVertices), tangents(numVertices), texCoords(numVertices), radius(numVertices)
+        {
+        }
+
+        CurveTessellationOutput get()
+        {
+            return { indices.data(), positions.data(), normals.data(), tangents.data(), texCoords.data(), radius.data() };
+        }
+    };
+
+    SyntheticGroomDesc getGroomDesc(const std::string& name, const uint32_t seed)
+    {
+        SyntheticGroomDesc desc;
+        desc.name = name;
+        desc.numGeometries = 3;
+        desc.strandsPerGeometry = 40;
+        desc.minPointsPerStrand = 2;
+        desc.maxPointsPerStrand = 14;
+        desc.seed = seed;
+        return desc;
+    }
+}
+
+// Every order gives order faces of 2 triangles per segment, an identity index buffer and, with the SIMD kernels, the scalar reference.
+// The geometry library only builds the default order, the other orders always use the local kernels.
+TEST(CurvePolyTubeOrder, VertexAndIndexCounts)
+{
+    using namespace CurveTessellationKernels;
+
+    const SyntheticGroomDesc desc = getGroomDesc("orderGroom", 111);
+    for (const bool isSimd : { false, true })
+    {
+        for (uint32_t order = kMinPolyTubeOrder; order <= kMaxPolyTubeOrder; ++order)
+        {
+            CurveTessellationSettings settings;
+            settings.hairPolyTubeOrder = order;
+            settings.enableSimdHairTessellation = isSimd;
+            settings.hairTessellationThreadCount = 2;
+            settings.hairTessellationSegmentsPerTask = 37;
+
+            const std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(desc) };
+            CurveTessellation curveTessellation(meshInstances, settings);
+            curveTessellation.selectPolyTubeOrders(meshInstances, {}, float3(0.0f), 0.0f);
+            REQUIRE(curveTessellation.GetCurvePolyTubeOrder(desc.name) == order);
+            curveTessellation.requestTessellation(TessellationType::Polytube, meshInstances);
+
+            const BufferGroup* buffers = curveTessellation.getCurveMeshLod0Buffers(TessellationType::Polytube, meshInstances, 0);
+            REQUIRE(buffers != nullptr);
+            const auto& lineSegments = curveTessellation.GetCurvesLineSegments(desc.name);
+            const uint32_t numLineSegments = static_cast<uint32_t>(lineSegments.size());
+            // order faces of 2 triangles per segment, without vertex sharing
+            const uint32_t numVertices = numLineSegments * order * 2 * 3;
+            CHECK(buffers->positionData.size() == numVertices);
+            CHECK(buffers->radiusData.size() == numVertices);
+            REQUIRE(buffers->indexData.size() == numVertices);
+
+            uint32_t numIndexMismatches = 0;
+            for (uint32_t vertexIndex = 0; vertexIndex < numVertices; ++vertexIndex)
+            {
+                numIndexMismatches += (buffers->indexData[vertexIndex] != vertexIndex) ? 1 : 0;
+            }
+            CHECK(numIndexMismatches == 0);
+
+            if (isSimd || order != RTXCR_CURVE_POLYTUBE_ORDER)
+            {
+                KernelOutput reference(numVertices);
+                CHECK(tessellatePolyTubesScalar(lineSegments.data(), numLineSegments, order, reference.get(), 0) == numVertices);
+
+                BufferGroup result = *buffers;
+                const CurveTessellationOutput resultOutput = { result.indexData.data(), result.positionData.data(), result.normalData.data(),
+                    result.tangentData.data(), result.texcoord1Data.data(), result.radiusData.data() };
+                CHECK(compareTessellation(reference.get(), resultOutput, 0, numVertices, true) == 0);
+            }
+        }
+    }
+}
+
+// An order from the scene metadata wins over the setting and is clamped to the supported range
+TEST(CurvePolyTubeOrder, SceneOrderWins)
+{
+    using namespace CurveTessellationKernels;
+
+    const std::vector<std::shared_ptr<MeshInstance>> meshInstances = {
+        createSyntheticGroom(getGroomDesc("fixed", 112)),
+        createSyntheticGroom(getGroomDesc("scene", 113)),
+        createSyntheticGroom(getGroomDesc("tooLow", 114)),
+        createSyntheticGroom(getGroomDesc("tooHigh", 115)) };
+
+    CurveTessellationSettings settings;
+    settings.hairPolyTubeOrder = 5;
+    CurveTessellation curveTessellation(meshInstances, settings);
+    curveTessellation.selectPolyTubeOrders(meshInstances, { { "scene", 7 }, { "tooLow", 1 }, { "tooHigh", 20 } }, float3(0.0f), 0.0f);
+
+    CHECK(curveTessellation.GetCurvePolyTubeOrder("fixed") == 5);
+    CHECK(curveTessellation.GetCurvePolyTubeOrder("scene") == 7);
+    CHECK(curveTessellation.GetCurvePolyTubeOrder("tooLow") == kMinPolyTubeOrder);
+    CHECK(curveTessellation.GetCurvePolyTubeOrder("tooHigh") == kMaxPolyTubeOrder);
+
+    // Without a camera the automatic order falls back to the default one
+    settings.hairPolyTubeOrder = 0;
+    curveTessellation.selectPolyTubeOrders(meshInstances, {}, float3(0.0f), 0.0f);
+    CHECK(curveTessellation.GetCurvePolyTubeOrder("fixed") == RTXCR_CURVE_POLYTUBE_ORDER);
+}
+
+// Triangle budget of a groom at every order, 2 triangles per segment and side
+TEST(CurvePolyTubeOrder, TriangleBudget)
+{
+    using namespace CurveTessellationKernels;
+
+    SyntheticGroomDesc desc = getGroomDesc("budgetGroom", 116);
+    desc.strandsPerGeometry = 1000;
+    const std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(desc) };
+
+    for (uint32_t order = kMinPolyTubeOrder; order <= kMaxPolyTubeOrder; ++order)
+    {
+        CurveTessellationSettings settings;
+        settings.hairPolyTubeOrder = order;
+        CurveTessellation curveTessellation(meshInstances, settings);
+        const uint64_t numLineSegments = curveTessellation.GetCurvesLineSegments(desc.name).size();
+
+        curveTessellation.selectPolyTubeOrders(meshInstances, {}, float3(0.0f), 0.0f);
+        curveTessellation.requestTessellation(TessellationType::Polytube, meshInstances);
+
+        const BufferGroup* buffers = curveTessellation.getCurveMeshLod0Buffers(TessellationType::Polytube, meshInstances, 0);
+        REQUIRE(buffers != nullptr);
+        const uint64_t numTriangles = buffers->indexData.size() / 3;
+        if (numTriangles != numLineSegments * order * 2)
+        {
+            printf("  order %u: %llu triangles for %llu segments\n", order, (unsigned long long)numTriangles, (unsigned long long)numLineSegments);
+        }
+        CHECK(numTriangles == numLineSegments * order * 2);
+    }
+}
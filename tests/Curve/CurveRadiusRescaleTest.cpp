@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <cmath>
+
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationKernels.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+namespace
+{
+    constexpr uint32_t kLodLevels = 3;
+
+    SyntheticGroomSceneDesc getGroomSceneDesc()
+    {
+        SyntheticGroomSceneDesc desc;
+        desc.lineListStrandsPerGeometry = 300;
+        desc.numLineStrips = 40;
+        desc.minPointsPerStrand = 4;
+        desc.maxPointsPerStrand = 12;
+        desc.numMorphStrands = 0;
+        desc.seed = 101;
+        return desc;
+    }
+
+    CurveTessellationOutput getTessellationOutput(const BufferGroup& buffers)
+    {
+        BufferGroup& mutableBuffers = const_cast<BufferGroup&>(buffers);
+        return { mutableBuffers.indexData.data(), mutableBuffers.positionData.data(), mutableBuffers.normalData.data(),
+            mutableBuffers.tangentData.data(), mutableBuffers.texcoord1Data.data(), mutableBuffers.radiusData.data() };
+    }
+
+    void requestEveryTessellation(CurveTessellation& curveTessellation, const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
+    {
+        for (uint32_t type = 0; type < (uint32_t)TessellationType::Count; ++type)
+        {
+            curveTessellation.requestTessellation((TessellationType)type, meshInstances);
+        }
+    }
+}
+
+// Rescaling every cached representation in place gives the buffers of a fresh tessellation at the new scale, for every LOD,
+// for the representation the scene displays, and again when scaling from an already rescaled state.
+// Both the geometry library and the SIMD kernels build the triangle representations, with either LSS layout.
+// The tessellation starts at scale 1 so the kept base radii are the asset radii and LOD0 radii match bit for bit.
+// Coarser LODs widen their strands, their radii only commute with power of two scales.
+TEST(CurveRadiusRescale, MatchesFreshTessellation)
+{
+    for (const uint32_t variant : { 0, 1, 2, 3 })
+    {
+        CurveTessellationSettings settings;
+        settings.hairRadiusScale = 1.0f;
+        settings.hairLodLevels = kLodLevels;
+        settings.enableSimdHairTessellation = (variant & 1) != 0;
+        settings.enableLssSuccessiveImplicit = (variant & 2) != 0;
+        settings.hairTessellationThreadCount = 2;
+        settings.hairTessellationSegmentsPerTask = 500;
+
+        const std::vector<std::shared_ptr<MeshInstance>> meshInstances = createGrooms(getGroomSceneDesc());
+        CurveTessellation curveTessellation(meshInstances, settings);
+        requestEveryTessellation(curveTessellation, meshInstances);
+        curveTessellation.replacingSceneMesh(nullptr, nullptr, TessellationType::Polytube, meshInstances);
+
+        for (const float radiusScale : { 1.7f, 0.5f, 2.0f })
+        {
+            settings.hairRadiusScale = radiusScale;
+            CHECK(curveTessellation.rescaleCurveRadius(meshInstances));
+
+            const std::vector<std::shared_ptr<MeshInstance>> freshMeshInstances = createGrooms(getGroomSceneDesc());
+            CurveTessellation freshCurveTessellation(freshMeshInstances, settings);
+            requestEveryTessellation(freshCurveTessellation, freshMeshInstances);
+            REQUIRE(freshCurveTessellation.getCurveLodLevelCount() == kLodLevels);
+            const uint32_t numLods = (std::exp2(std::round(std::log2(radiusScale))) == radiusScale) ? kLodLevels : 1;
+
+            for (uint32_t type = 0; type < (uint32_t)TessellationType::Count; ++type)
+            {
+                const TessellationType tessellationType = (TessellationType)type;
+                for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
+                {
+                    for (uint32_t lod = 0; lod < numLods; ++lod)
+                    {
+                        const BufferGroup* buffers = curveTessellation.getCurveMeshLodBuffers(tessellationType, meshInstances, meshIndex, lod);
+                        const BufferGroup* freshBuffers = freshCurveTessellation.getCurveMeshLodBuffers(tessellationType, freshMeshInstances, meshIndex, lod);
+                        REQUIRE(buffers != nullptr && freshBuffers != nullptr);
+                        REQUIRE(buffers->positionData.size() == freshBuffers->positionData.size());
+                        CHECK(isBitwiseEqual(buffers->indexData, freshBuffers->indexData));
+
+                        const uint32_t numMismatches = CurveTessellationKernels::compareTessellation(getTessellationOutput(*freshBuffers),
+                            getTessellationOutput(*buffers), 0, static_cast<uint32_t>(buffers->positionData.size()),
+                            tessellationType != TessellationType::LinearSweptSphere);
+                        if (numMismatches > 0)
+                        {
+                            printf("  %s, variant %u, scale %g, mesh %u, LOD %u: %u of %u vertices differ\n", getTessellationTypeName(tessellationType),
+                                variant, radiusScale, meshIndex, lod, numMismatches, static_cast<uint32_t>(buffers->positionData.size()));
+                        }
+                        CHECK(numMismatches == 0);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// The same scale leaves every representation alone
+TEST(CurveRadiusRescale, UnchangedScaleDoesNothing)
+{
+    CurveTessellationSettings settings;
+    const std::vector<std::shared_ptr<MeshInstance>> meshInstances = createGrooms(getGroomSceneDesc());
+    CurveTessellation curveTessellation(meshInstances, settings);
+    requestEveryTessellation(curveTessellation, meshInstances);
+    CHECK(!curveTessellation.rescaleCurveRadius(meshInstances));
+
+    settings.hairRadiusScale = 2.0f;
+    CHECK(curveTessellation.rescaleCurveRadius(meshInstances));
+    CHECK(!curveTessellation.rescaleCurveRadius(meshInstances));
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+namespace
+{
+    // Long strands without a morph target animated mesh, resegmentation skips those
+    SyntheticGroomSceneDesc getGroomSceneDesc()
+    {
+        SyntheticGroomSceneDesc desc;
+        desc.lineListStrandsPerGeometry = 60;
+        desc.numLineStrips = 20;
+        desc.minPointsPerStrand = 2;
+        desc.maxPointsPerStrand = 60;
+        desc.numMorphStrands = 0;
+        desc.seed = 61;
+        return desc;
+    }
+
+    std::vector<std::vector<rtxcr::geometry::LineSegment>> getLineSegments(const float maxError, const uint32_t threadCount, const int segmentsPerTask)
+    {
+        const std::vector<std::shared_ptr<MeshInstance>> meshInstances = createGrooms(getGroomSceneDesc());
+
+        CurveTessellationSettings settings;
+        settings.hairResegmentationError = maxError;
+        settings.hairTessellationThreadCount = threadCount;
+        settings.hairTessellationSegmentsPerTask = segmentsPerTask;
+        CurveTessellation curveTessellation(meshInstances, settings);
+
+        std::vector<std::vector<rtxcr::geometry::LineSegment>> lineSegments;
+        for (const auto& meshInstance : meshInstances)
+        {
+            lineSegments.push_back(curveTessellation.GetCurvesLineSegments(meshInstance->GetMesh()->name));
+        }
+        return lineSegments;
+    }
+
+    bool isSamePosition(const rtxcr::geometry::LineVertex& lhs, const rtxcr::geometry::LineVertex& rhs)
+    {
+        return memcmp(lhs.position, rhs.position, sizeof(lhs.position)) == 0;
+    }
+
+    // Surface deviation of the strand point from the swept sphere of the segment (v0, v1), evaluated in double precision:
+    // distance to the closest point of the axis plus the radius difference there
+    double getSurfaceDeviation(const rtxcr::geometry::LineVertex& point, const rtxcr::geometry::LineVertex& v0, const rtxcr::geometry::LineVertex& v1)
+    {
+        double axis[3], offset[3];
+        double axisLengthSquared = 0.0;
+        double projection = 0.0;
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            axis[i] = double(v1.position[i]) - double(v0.position[i]);
+            offset[i] = double(point.position[i]) - double(v0.position[i]);
+            axisLengthSquared += axis[i] * axis[i];
+            projection += offset[i] * axis[i];
+        }
+        const double t = (axisLengthSquared > 0.0) ? std::clamp(projection / axisLengthSquared, 0.0, 1.0) : 0.0;
+
+        double distanceSquared = 0.0;
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            const double d = offset[i] - t * axis[i];
+            distanceSquared += d * d;
+        }
+        const double radius = double(v0.radius) + t * (double(v1.radius) - double(v0.radius));
+        return std::sqrt(distanceSquared) + std::abs(double(point.radius) - radius);
+    }
+}
+
+// Every merged segment spans consecutive original segments of one strand, and every strand point it skips stays within
+// the error bound of it. The deviation is convex along each original segment, so this bounds the one-sided Hausdorff
+// distance of the original strands to the resegmented ones; the other side is bounded because both share their end points.
+TEST(CurveResegmentation, HausdorffDistanceWithinBound)
+{
+    const std::vector<std::vector<rtxcr::geometry::LineSegment>> originalLineSegments = getLineSegments(0.0f, 1, 16384);
+
+    for (const float maxError : { 0.0005f, 0.002f, 0.01f })
+    {
+        const std::vector<std::vector<rtxcr::geometry::LineSegment>> resegmentedLineSegments = getLineSegments(maxError, 2, 16384);
+        REQUIRE(resegmentedLineSegments.size() == originalLineSegments.size());
+
+        for (size_t meshIndex = 0; meshIndex < originalLineSegments.size(); ++meshIndex)
+        {
+            const auto& original = originalLineSegments[meshIndex];
+            const auto& resegmented = resegmentedLineSegments[meshIndex];
+            CHECK(resegmented.size() < original.size());
+
+            uint32_t numViolations = 0;
+            uint32_t numCoverageErrors = 0;
+            double maxDeviation = 0.0;
+            size_t originalIndex = 0;
+            for (const auto& segment : resegmented)
+            {
+                // The merged segment starts where an original segment starts and ends where a later one of the same strand ends
+                REQUIRE(originalIndex < original.size());
+                if (!isSamePosition(original[originalIndex].vertices[0], segment.vertices[0]) ||
+                    original[originalIndex].geometryIndex != segment.geometryIndex)
+                {
+                    ++numCoverageErrors;
+                }
+
+                while (!isSamePosition(original[originalIndex].vertices[1], segment.vertices[1]))
+                {
+                    REQUIRE(originalIndex + 1 < original.size());
+                    if (!isSamePosition(original[originalIndex].vertices[1], original[originalIndex + 1].vertices[0]))
+                    {
+                        // Crossed a strand boundary
+                        ++numCoverageErrors;
+                    }
+                    ++originalIndex;
+
+                    const double deviation = getSurfaceDeviation(original[originalIndex].vertices[0], segment.vertices[0], segment.vertices[1]);
+                    maxDeviation = std::max(maxDeviation, deviation);
+                    // The resegmentation evaluates the bound in single precision, a few ulps of the groom's coordinates (up to 5) apart
+                    if (deviation > maxError + 1e-5)
+                    {
+                        ++numViolations;
+                    }
+                }
+                ++originalIndex;
+            }
+
+            if (originalIndex != original.size() || numCoverageErrors != 0 || numViolations != 0)
+            {
+                printf("  error bound %g, mesh %u: %u coverage errors, %u violations, max deviation %g\n", maxError,
+                    static_cast<uint32_t>(meshIndex), numCoverageErrors, numViolations, maxDeviation);
+            }
+            CHECK(originalIndex == original.size());
+            CHECK(numCoverageErrors == 0);
+            CHECK(numViolations == 0);
+        }
+    }
+}
+
+// The merged segments don't depend on how the strands are split into tasks
+TEST(CurveResegmentation, IndependentOfTaskSize)
+{
+    const std::vector<std::vector<rtxcr::geometry::LineSegment>> reference = getLineSegments(0.002f, 1, 16384);
+    for (const int segmentsPerTask : { 1, 7, 64 })
+    {
+        const std::vector<std::vector<rtxcr::geometry::LineSegment>> lineSegments = getLineSegments(0.002f, 4, segmentsPerTask);
+        REQUIRE(lineSegments.size() == reference.size());
+        for (size_t meshIndex = 0; meshIndex < reference.size(); ++meshIndex)
+        {
+            CHECK(isBitwiseEqual(lineSegments[meshIndex], reference[meshIndex]));
+        }
+    }
+}
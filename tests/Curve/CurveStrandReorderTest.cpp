@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <cfloat>
+#include <map>
+#include <tuple>
+
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+namespace
+{
+    struct Strand
+    {
+        uint32_t firstSegment = 0;
+        uint32_t numSegments = 0;
+        uint32_t groupIndex = 0;
+        uint32_t geometry = 0;
+    };
+
+    // Strands of a mesh in segment order, a strand ends where the segment group index or the mesh geometry changes
+    std::vector<Strand> getStrands(const std::vector<rtxcr::geometry::LineSegment>& lineSegments, const MeshInfo& mesh)
+    {
+        std::vector<Strand> strands;
+        uint32_t geometryStart = 0;
+        for (uint32_t geometry = 0; geometry < mesh.geometries.size(); ++geometry)
+        {
+            const uint32_t geometryEnd = geometryStart + mesh.geometries[geometry]->numIndices / 2;
+            for (uint32_t segmentIndex = geometryStart; segmentIndex < geometryEnd; ++segmentIndex)
+            {
+                if (segmentIndex == geometryStart || lineSegments[segmentIndex].geometryIndex != lineSegments[segmentIndex - 1].geometryIndex)
+                {
+                    strands.push_back({ segmentIndex, 0, lineSegments[segmentIndex].geometryIndex, geometry });
+                }
+                ++strands.back().numSegments;
+            }
+            geometryStart = geometryEnd;
+        }
+        return strands;
+    }
+
+    std::tuple<float, float, float, uint32_t> getStrandKey(const std::vector<rtxcr::geometry::LineSegment>& lineSegments, const Strand& strand)
+    {
+        const float* root = lineSegments[strand.firstSegment].vertices[0].position;
+        return { root[0], root[1], root[2], strand.numSegments };
+    }
+
+    float3 getStrandCenter(const std::vector<rtxcr::geometry::LineSegment>& lineSegments, const Strand& strand)
+    {
+        float3 boundsMin = float3(FLT_MAX);
+        float3 boundsMax = float3(-FLT_MAX);
+        for (uint32_t segmentIndex = strand.firstSegment; segmentIndex < strand.firstSegment + strand.numSegments; ++segmentIndex)
+        {
+            for (const auto& vertex : lineSegments[segmentIndex].vertices)
+            {
+                boundsMin = min(boundsMin, float3(vertex.position));
+                boundsMax = max(boundsMax, float3(vertex.position));
+            }
+        }
+        return (boundsMin + boundsMax) * 0.5f;
+    }
+
+    double getMeanStrandDistance(const std::vector<rtxcr::geometry::LineSegment>& lineSegments, const std::vector<Strand>& strands)
+    {
+        double distance = 0.0;
+        for (size_t strandIndex = 1; strandIndex < strands.size(); ++strandIndex)
+        {
+            distance += length(getStrandCenter(lineSegments, strands[strandIndex]) - getStrandCenter(lineSegments, strands[strandIndex - 1]));
+        }
+        return (strands.size() > 1) ? distance / double(strands.size() - 1) : 0.0;
+    }
+}
+
+// The reordered segments and morph target keyframes are a permutation of whole strands within their geometries:
+// moving every strand back to its asset order position restores the segments and the keyframes bit for bit.
+TEST(CurveStrandReorder, PermutationRoundTrip)
+{
+    SyntheticGroomDesc staticDesc;
+    staticDesc.name = "static";
+    staticDesc.numGeometries = 3;
+    staticDesc.strandsPerGeometry = 300;
+    staticDesc.minPointsPerStrand = 2;
+    staticDesc.maxPointsPerStrand = 16;
+    staticDesc.seed = 81;
+
+    SyntheticGroomDesc morphDesc;
+    morphDesc.name = "morph";
+    morphDesc.numGeometries = 2;
+    morphDesc.strandsPerGeometry = 200;
+    morphDesc.numKeyframes = 4;
+    morphDesc.seed = 82;
+
+    for (const SyntheticGroomDesc& desc : { staticDesc, morphDesc })
+    {
+        const std::shared_ptr<MeshInstance> originalMeshInstance = createSyntheticGroom(desc);
+        const std::vector<std::shared_ptr<MeshInstance>> meshInstances[2] = { { originalMeshInstance }, { createSyntheticGroom(desc) } };
+        std::vector<rtxcr::geometry::LineSegment> lineSegments[2];
+        for (uint32_t run = 0; run < 2; ++run)
+        {
+            CurveTessellationSettings settings;
+            settings.enableHairStrandReorder = (run == 1);
+            settings.hairTessellationThreadCount = 3;
+            CurveTessellation curveTessellation(meshInstances[run], settings);
+            lineSegments[run] = curveTessellation.GetCurvesLineSegments(desc.name);
+        }
+        const MeshInfo& mesh = *originalMeshInstance->GetMesh();
+        const std::vector<float4>& originalKeyframes = mesh.buffers->morphTargetData;
+        const std::vector<float4>& reorderedKeyframes = meshInstances[1][0]->GetMesh()->buffers->morphTargetData;
+        REQUIRE(lineSegments[0].size() == lineSegments[1].size());
+        REQUIRE(originalKeyframes.size() == reorderedKeyframes.size());
+        CHECK(!isBitwiseEqual(lineSegments[0], lineSegments[1]));
+
+        const std::vector<Strand> originalStrands = getStrands(lineSegments[0], mesh);
+        const std::vector<Strand> reorderedStrands = getStrands(lineSegments[1], mesh);
+        REQUIRE(originalStrands.size() == reorderedStrands.size());
+
+        std::map<std::tuple<float, float, float, uint32_t>, uint32_t> originalStrandIndices;
+        for (uint32_t strandIndex = 0; strandIndex < originalStrands.size(); ++strandIndex)
+        {
+            originalStrandIndices[getStrandKey(lineSegments[0], originalStrands[strandIndex])] = strandIndex;
+        }
+        REQUIRE(originalStrandIndices.size() == originalStrands.size());
+
+        // Move every strand and its keyframe points back, keyframe point p of a strand lives at (first segment + group index + p)
+        std::vector<rtxcr::geometry::LineSegment> restoredLineSegments(lineSegments[1].size());
+        std::vector<float4> restoredKeyframes(reorderedKeyframes.size());
+        std::vector<bool> isRestored(originalStrands.size(), false);
+        uint32_t numGeometryChanges = 0;
+        for (const Strand& strand : reorderedStrands)
+        {
+            const auto originalStrandIndex = originalStrandIndices.find(getStrandKey(lineSegments[1], strand));
+            REQUIRE(originalStrandIndex != originalStrandIndices.end());
+            REQUIRE(!isRestored[originalStrandIndex->second]);
+            isRestored[originalStrandIndex->second] = true;
+
+            const Strand& originalStrand = originalStrands[originalStrandIndex->second];
+            numGeometryChanges += (originalStrand.geometry != strand.geometry) ? 1 : 0;
+            for (uint32_t segmentOffset = 0; segmentOffset < strand.numSegments; ++segmentOffset)
+            {
+                rtxcr::geometry::LineSegment& segment = restoredLineSegments[originalStrand.firstSegment + segmentOffset];
+                segment = lineSegments[1][strand.firstSegment + segmentOffset];
+                segment.geometryIndex = originalStrand.groupIndex;
+            }
+
+            for (const auto& keyframeRange : mesh.buffers->morphTargetBufferRange)
+            {
+                const size_t keyframeOffset = keyframeRange.byteOffset / sizeof(float4);
+                for (uint32_t pointIndex = 0; pointIndex <= strand.numSegments; ++pointIndex)
+                {
+                    restoredKeyframes[keyframeOffset + originalStrand.firstSegment + originalStrand.groupIndex + pointIndex] =
+                        reorderedKeyframes[keyframeOffset + strand.firstSegment + strand.groupIndex + pointIndex];
+                }
+            }
+        }
+
+        CHECK(numGeometryChanges == 0);
+        CHECK(isBitwiseEqual(restoredLineSegments, lineSegments[0]));
+        CHECK(isBitwiseEqual(restoredKeyframes, originalKeyframes));
+
+        // The first keyframe is the rest pose, it must still line up with the reordered segments
+        if (!mesh.buffers->morphTargetBufferRange.empty())
+        {
+            uint32_t numMismatches = 0;
+            for (const Strand& strand : reorderedStrands)
+            {
+                for (uint32_t segmentOffset = 0; segmentOffset < strand.numSegments; ++segmentOffset)
+                {
+                    const float4& point = reorderedKeyframes[strand.firstSegment + strand.groupIndex + segmentOffset];
+                    numMismatches += all(point.xyz() == float3(lineSegments[1][strand.firstSegment + segmentOffset].vertices[0].position)) ? 0 : 1;
+                }
+            }
+            CHECK(numMismatches == 0);
+        }
+
+        const double distanceBefore = getMeanStrandDistance(lineSegments[0], originalStrands);
+        const double distanceAfter = getMeanStrandDistance(lineSegments[1], reorderedStrands);
+        if (distanceAfter >= distanceBefore)
+        {
+            printf("  %s: mean distance between consecutive strands %.4f -> %.4f\n", desc.name.c_str(), distanceBefore, distanceAfter);
+        }
+        CHECK(distanceAfter < distanceBefore);
+    }
+}
+
+// The order doesn't depend on how the geometries are spread over threads
+TEST(CurveStrandReorder, IndependentOfThreadCount)
+{
+    SyntheticGroomDesc desc;
+    desc.name = "groom";
+    desc.numGeometries = 5;
+    desc.strandsPerGeometry = 100;
+    desc.seed = 83;
+
+    std::vector<rtxcr::geometry::LineSegment> reference;
+    for (const int threadCount : { 1, 2, 4 })
+    {
+        const std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(desc) };
+        CurveTessellationSettings settings;
+        settings.enableHairStrandReorder = true;
+        settings.hairTessellationThreadCount = threadCount;
+        CurveTessellation curveTessellation(meshInstances, settings);
+
+        const std::vector<rtxcr::geometry::LineSegment>& lineSegments = curveTessellation.GetCurvesLineSegments(desc.name);
+        if (reference.empty())
+        {
+            reference = lineSegments;
+        }
+        CHECK(isBitwiseEqual(lineSegments, reference));
+    }
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <array>
+
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+namespace
+{
+    constexpr size_t kBytesPerMB = 1024 * 1024;
+
+    constexpr std::array<TessellationType, 3> kTessellationTypes =
+    {
+        TessellationType::Polytube,
+        TessellationType::DisjointOrthogonalTriangleStrip,
+        TessellationType::LinearSweptSphere
+    };
+
+    // Large enough for every representation to take a few MB, the budget is set in MB
+    std::vector<std::shared_ptr<MeshInstance>> createGroom()
+    {
+        SyntheticGroomSceneDesc desc;
+        desc.lineListStrandsPerGeometry = 3000;
+        desc.minPointsPerStrand = 8;
+        desc.maxPointsPerStrand = 16;
+        desc.numMorphStrands = 0;
+        desc.seed = 21;
+        return createGrooms(desc);
+    }
+
+    CurveTessellationSettings getLazySettings(const int budgetMB)
+    {
+        CurveTessellationSettings settings;
+        settings.enableLazyHairTessellation = true;
+        settings.hairTessellationCacheBudgetMB = budgetMB;
+        return settings;
+    }
+
+    // Cached bytes of every representation of the groom when nothing is evicted
+    std::array<size_t, 3> getRepresentationBytes()
+    {
+        const std::vector<std::shared_ptr<MeshInstance>> meshInstances = createGroom();
+        CurveTessellation curveTessellation(meshInstances, getLazySettings(0));
+
+        std::array<size_t, 3> representationBytes = {};
+        for (const TessellationType tessellationType : kTessellationTypes)
+        {
+            curveTessellation.requestTessellation(tessellationType, meshInstances);
+            representationBytes[(uint32_t)tessellationType] = curveTessellation.getTessellationCacheBytes(tessellationType);
+        }
+        return representationBytes;
+    }
+
+    // Switches the scene through the representations the way the UI does, returns the peak cache bytes
+    size_t switchRepresentations(const int budgetMB, const std::array<size_t, 3>& representationBytes, const uint32_t numSwitches)
+    {
+        const std::vector<std::shared_ptr<MeshInstance>> meshInstances = createGroom();
+        CurveTessellation curveTessellation(meshInstances, getLazySettings(budgetMB));
+
+        const size_t budgetBytes = static_cast<size_t>(budgetMB) * kBytesPerMB;
+        for (uint32_t switchIndex = 0; switchIndex < numSwitches; ++switchIndex)
+        {
+            // Back and forth between two representations every fourth switch, so the LRU order isn't the switch order
+            const uint32_t typeIndex = (switchIndex % 4 == 3) ? ((switchIndex - 2) % 3) : (switchIndex % 3);
+            const TessellationType tessellationType = kTessellationTypes[typeIndex];
+
+            curveTessellation.requestTessellation(tessellationType, meshInstances);
+            curveTessellation.replacingSceneMesh(nullptr, nullptr, tessellationType, meshInstances);
+
+            REQUIRE(curveTessellation.isTessellationCached(tessellationType));
+            CHECK(curveTessellation.getTessellationCacheBytes(tessellationType) == representationBytes[typeIndex]);
+            CHECK(meshInstances[0]->GetMesh()->buffers->positionData.size() > 0);
+
+            // Only the active representation may stay above the budget
+            if (budgetBytes > 0)
+            {
+                CHECK(curveTessellation.getTessellationCacheTotalBytes() <= std::max(budgetBytes, representationBytes[typeIndex]));
+            }
+
+            for (const TessellationType otherType : kTessellationTypes)
+            {
+                if (!curveTessellation.isTessellationCached(otherType))
+                {
+                    CHECK(curveTessellation.getTessellationCacheBytes(otherType) == 0);
+                }
+            }
+        }
+
+        return curveTessellation.getTessellationCachePeakBytes();
+    }
+}
+
+// With no budget every representation stays cached, the peak is their sum
+TEST(CurveTessellationCache, UnlimitedBudgetKeepsEveryRepresentation)
+{
+    const std::array<size_t, 3> representationBytes = getRepresentationBytes();
+    for (const size_t bytes : representationBytes)
+    {
+        REQUIRE(bytes > kBytesPerMB);
+    }
+
+    const size_t peakBytes = switchRepresentations(0, representationBytes, 12);
+    CHECK(peakBytes == representationBytes[0] + representationBytes[1] + representationBytes[2]);
+}
+
+// Eviction runs after the new representation is committed, while the previous one is still displayed,
+// so the peak is bounded by what the budget keeps plus the largest representation
+TEST(CurveTessellationCache, PeakBytesStayWithinBudget)
+{
+    const std::array<size_t, 3> representationBytes = getRepresentationBytes();
+    std::array<size_t, 3> sortedBytes = representationBytes;
+    std::sort(sortedBytes.begin(), sortedBytes.end());
+    const size_t largestBytes = sortedBytes[2];
+    const size_t allBytes = sortedBytes[0] + sortedBytes[1] + sortedBytes[2];
+
+    // Budgets below every representation, holding the largest one and holding the two largest ones
+    const int oneBudgetMB = static_cast<int>((largestBytes + kBytesPerMB - 1) / kBytesPerMB);
+    const int twoBudgetMB = static_cast<int>((sortedBytes[1] + sortedBytes[2] + kBytesPerMB - 1) / kBytesPerMB);
+    for (const int budgetMB : { 1, oneBudgetMB, twoBudgetMB })
+    {
+        const size_t budgetBytes = static_cast<size_t>(budgetMB) * kBytesPerMB;
+        const size_t peakBytes = switchRepresentations(budgetMB, representationBytes, 24);
+        CHECK(peakBytes <= std::max(budgetBytes, largestBytes) + largestBytes);
+
+        // All three are only resident at once if the budget keeps two of them
+        if (budgetBytes < sortedBytes[0] + sortedBytes[1])
+        {
+            CHECK(peakBytes < allBytes);
+        }
+
+        // The same switches of the same groom reach the same peak
+        CHECK(peakBytes == switchRepresentations(budgetMB, representationBytes, 24));
+    }
+}
+
+// The least recently requested representation goes first, the active one never
+TEST(CurveTessellationCache, EvictsLeastRecentlyUsed)
+{
+    const std::array<size_t, 3> representationBytes = getRepresentationBytes();
+    const size_t largestBytes = *std::max_element(representationBytes.begin(), representationBytes.end());
+
+    // Room for any two representations but not for all three
+    const size_t allBytes = representationBytes[0] + representationBytes[1] + representationBytes[2];
+    const int budgetMB = static_cast<int>((allBytes - 1) / kBytesPerMB);
+    REQUIRE(static_cast<size_t>(budgetMB) * kBytesPerMB >= allBytes - *std::min_element(representationBytes.begin(), representationBytes.end()));
+    REQUIRE(static_cast<size_t>(budgetMB) * kBytesPerMB >= largestBytes);
+
+    const std::vector<std::shared_ptr<MeshInstance>> meshInstances = createGroom();
+    CurveTessellation curveTessellation(meshInstances, getLazySettings(budgetMB));
+
+    curveTessellation.requestTessellation(TessellationType::Polytube, meshInstances);
+    curveTessellation.requestTessellation(TessellationType::DisjointOrthogonalTriangleStrip, meshInstances);
+    curveTessellation.requestTessellation(TessellationType::Polytube, meshInstances);
+    curveTessellation.requestTessellation(TessellationType::LinearSweptSphere, meshInstances);
+
+    CHECK(curveTessellation.isTessellationCached(TessellationType::Polytube));
+    CHECK(!curveTessellation.isTessellationCached(TessellationType::DisjointOrthogonalTriangleStrip));
+    CHECK(curveTessellation.isTessellationCached(TessellationType::LinearSweptSphere));
+}
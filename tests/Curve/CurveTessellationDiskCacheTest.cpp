@@ -0,0 +1,415 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationDiskCache.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+namespace
+{
+    // Empty directory of its own for every test, removed again when the test ends
+    class TempDirectory
+    {
+    public:
+        explicit TempDirectory(const char* name)
+        : m_path(std::filesystem::temp_directory_path() / (std::string("rtxcr_tests_") + name))
+        {
+            std::filesystem::remove_all(m_path);
+            std::filesystem::create_directories(m_path);
+        }
+
+        ~TempDirectory()
+        {
+            std::error_code error;
+            std::filesystem::remove_all(m_path, error);
+        }
+
+        inline const std::filesystem::path& get() const { return m_path; }
+
+    private:
+        std::filesystem::path m_path;
+    };
+
+    // Streams of a small made up mesh, the cache stores whatever it is given
+    struct MeshStreams
+    {
+        std::vector<CurveTessellationDiskCache::GeometryRecord> geometries;
+        std::vector<uint32_t> indices;
+        std::vector<float3> positions;
+        std::vector<float> radius;
+        std::vector<uint32_t> normals;
+        std::vector<uint32_t> tangents;
+        std::vector<float2> texCoords;
+
+        MeshStreams(const uint32_t numVertices, const uint32_t seed)
+        {
+            geometries.push_back({ numVertices / 2, numVertices / 2, 0, 0 });
+            geometries.push_back({ numVertices - numVertices / 2, numVertices - numVertices / 2, numVertices / 2, numVertices / 2 });
+            for (uint32_t vertexIndex = 0; vertexIndex < numVertices; ++vertexIndex)
+            {
+                const float value = float(vertexIndex + seed);
+                indices.push_back(vertexIndex);
+                positions.push_back(float3(value, -value, 0.5f * value));
+                radius.push_back(0.001f * value);
+                normals.push_back(vertexIndex * 31 + seed);
+                tangents.push_back(vertexIndex * 17 + seed);
+                texCoords.push_back(float2(value, 1.0f / (1.0f + value)));
+            }
+        }
+
+        CurveTessellationDiskCache::MeshView getView() const
+        {
+            CurveTessellationDiskCache::MeshView view;
+            view.geometries = geometries.data();
+            view.numGeometries = static_cast<uint32_t>(geometries.size());
+            view.indices = indices.data();
+            view.numIndices = static_cast<uint32_t>(indices.size());
+            view.positions = positions.data();
+            view.radius = radius.data();
+            view.numVertices = static_cast<uint32_t>(positions.size());
+            view.normals = normals.data();
+            view.tangents = tangents.data();
+            view.texCoords = texCoords.data();
+            view.numAttributes = static_cast<uint32_t>(normals.size());
+            return view;
+        }
+    };
+
+    template <typename T>
+    bool isViewEqual(const T* view, const uint32_t count, const std::vector<T>& data)
+    {
+        return count == data.size() && (count == 0 || memcmp(view, data.data(), count * sizeof(T)) == 0);
+    }
+
+    bool isMeshEqual(const CurveTessellationDiskCache::MeshView& view, const MeshStreams& streams)
+    {
+        return isViewEqual(view.geometries, view.numGeometries, streams.geometries) &&
+               isViewEqual(view.indices, view.numIndices, streams.indices) &&
+               isViewEqual(view.positions, view.numVertices, streams.positions) &&
+               isViewEqual(view.radius, view.numVertices, streams.radius) &&
+               isViewEqual(view.normals, view.numAttributes, streams.normals) &&
+               isViewEqual(view.tangents, view.numAttributes, streams.tangents) &&
+               isViewEqual(view.texCoords, view.numAttributes, streams.texCoords);
+    }
+
+    CurveTessellationDiskCache::Key getTestKey()
+    {
+        CurveTessellationDiskCache::Key key;
+        key.sourceGeometryHash = 0x0123456789abcdefull;
+        key.tessellationType = (uint32_t)TessellationType::Polytube;
+        key.polyTubeOrders = 3;
+        key.radiusScale = 0.618f;
+        return key;
+    }
+
+    std::vector<char> readFile(const std::filesystem::path& path)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+
+    void writeFile(const std::filesystem::path& path, const std::vector<char>& bytes)
+    {
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        stream.write(bytes.data(), bytes.size());
+    }
+
+    // The cache file header is 64 bytes: magic, version, key fields, mesh count, payload size and hash
+    constexpr size_t kHeaderBytes = 64;
+    constexpr size_t kVersionOffset = 4;
+    constexpr size_t kNumMeshesOffset = 32;
+}
+
+TEST(CurveTessellationDiskCache, StoreThenLoadHits)
+{
+    const TempDirectory directory("diskcache_hit");
+    const CurveTessellationDiskCache diskCache(directory.get());
+    const MeshStreams meshes[2] = { MeshStreams(37, 1), MeshStreams(5, 2) };
+
+    REQUIRE(diskCache.store(getTestKey(), { meshes[0].getView(), meshes[1].getView() }));
+    CHECK(std::filesystem::is_regular_file(diskCache.getEntryPath(getTestKey())));
+
+    // No temporary file is left behind
+    uint32_t numFiles = 0;
+    for (const auto& file : std::filesystem::directory_iterator(directory.get()))
+    {
+        numFiles += file.is_regular_file() ? 1 : 0;
+    }
+    CHECK(numFiles == 1);
+
+    const std::unique_ptr<CurveTessellationDiskCache::Entry> entry = diskCache.load(getTestKey());
+    REQUIRE(entry != nullptr);
+    REQUIRE(entry->getMeshes().size() == 2);
+    CHECK(isMeshEqual(entry->getMeshes()[0], meshes[0]));
+    CHECK(isMeshEqual(entry->getMeshes()[1], meshes[1]));
+
+    // The views point into the mapping, not at the source streams
+    CHECK(entry->getMeshes()[0].positions != meshes[0].positions.data());
+
+    // A second mapping of the same file is independent of the first
+    const std::unique_ptr<CurveTessellationDiskCache::Entry> otherEntry = diskCache.load(getTestKey());
+    REQUIRE(otherEntry != nullptr);
+    CHECK(isMeshEqual(otherEntry->getMeshes()[1], meshes[1]));
+}
+
+TEST(CurveTessellationDiskCache, MissingEntryMisses)
+{
+    const TempDirectory directory("diskcache_miss");
+    CHECK(CurveTessellationDiskCache(directory.get()).load(getTestKey()) == nullptr);
+    CHECK(CurveTessellationDiskCache(directory.get() / "absent").load(getTestKey()) == nullptr);
+
+    // Store creates the cache directory
+    const CurveTessellationDiskCache nestedCache(directory.get() / "nested");
+    const MeshStreams mesh(8, 3);
+    CHECK(nestedCache.store(getTestKey(), { mesh.getView() }));
+    CHECK(nestedCache.load(getTestKey()) != nullptr);
+}
+
+// Every key field selects its own entry, and an entry found under the wrong name is stale
+TEST(CurveTessellationDiskCache, StaleKeyMisses)
+{
+    const TempDirectory directory("diskcache_stale");
+    const CurveTessellationDiskCache diskCache(directory.get());
+    const MeshStreams mesh(16, 4);
+    const CurveTessellationDiskCache::Key key = getTestKey();
+    REQUIRE(diskCache.store(key, { mesh.getView() }));
+
+    std::vector<CurveTessellationDiskCache::Key> staleKeys(8, key);
+    staleKeys[0].sourceGeometryHash ^= 1;
+    staleKeys[1].tessellationType = (uint32_t)TessellationType::LinearSweptSphere;
+    staleKeys[2].polyTubeOrders = 4;
+    staleKeys[3].radiusScale = 0.619f;
+    staleKeys[4].lssSuccessiveImplicit = 1;
+    staleKeys[5].resegmentationError = 0.001f;
+    staleKeys[6].strandOrder = 1;
+    staleKeys[7].kernels = 1;
+
+    const std::vector<char> entryBytes = readFile(diskCache.getEntryPath(key));
+    for (const CurveTessellationDiskCache::Key& staleKey : staleKeys)
+    {
+        CHECK(diskCache.getEntryPath(staleKey) != diskCache.getEntryPath(key));
+        CHECK(diskCache.load(staleKey) == nullptr);
+
+        // Even with the file in place the header doesn't match the key
+        writeFile(diskCache.getEntryPath(staleKey), entryBytes);
+        CHECK(diskCache.load(staleKey) == nullptr);
+    }
+
+    // An entry of another file format version is stale as well
+    std::vector<char> otherVersionBytes = entryBytes;
+    const uint32_t otherVersion = CurveTessellationDiskCache::kVersion - 1;
+    memcpy(otherVersionBytes.data() + kVersionOffset, &otherVersion, sizeof(otherVersion));
+    writeFile(diskCache.getEntryPath(key), otherVersionBytes);
+    CHECK(diskCache.load(key) == nullptr);
+}
+
+// A flipped bit anywhere in the file, including the mesh count of the header, is a miss
+TEST(CurveTessellationDiskCache, CorruptedEntryMisses)
+{
+    const TempDirectory directory("diskcache_corrupt");
+    const CurveTessellationDiskCache diskCache(directory.get());
+    const MeshStreams mesh(24, 5);
+    const CurveTessellationDiskCache::Key key = getTestKey();
+    REQUIRE(diskCache.store(key, { mesh.getView() }));
+
+    const std::filesystem::path path = diskCache.getEntryPath(key);
+    const std::vector<char> entryBytes = readFile(path);
+    REQUIRE(entryBytes.size() > kHeaderBytes);
+
+    for (size_t byteIndex = 0; byteIndex < entryBytes.size(); ++byteIndex)
+    {
+        std::vector<char> corruptedBytes = entryBytes;
+        corruptedBytes[byteIndex] ^= 0x10;
+        writeFile(path, corruptedBytes);
+
+        // Every header field is part of the key or checked, every payload byte is hashed
+        CHECK(diskCache.load(key) == nullptr);
+    }
+
+    // A mesh count far beyond the payload must not be trusted
+    for (const uint32_t numMeshes : { 2u, 0x10000u, 0xffffffffu })
+    {
+        std::vector<char> corruptedBytes = entryBytes;
+        memcpy(corruptedBytes.data() + kNumMeshesOffset, &numMeshes, sizeof(numMeshes));
+        writeFile(path, corruptedBytes);
+        CHECK(diskCache.load(key) == nullptr);
+    }
+
+    writeFile(path, entryBytes);
+    CHECK(diskCache.load(key) != nullptr);
+}
+
+TEST(CurveTessellationDiskCache, TruncatedEntryMisses)
+{
+    const TempDirectory directory("diskcache_truncated");
+    const CurveTessellationDiskCache diskCache(directory.get());
+    const MeshStreams mesh(24, 6);
+    const CurveTessellationDiskCache::Key key = getTestKey();
+    REQUIRE(diskCache.store(key, { mesh.getView() }));
+
+    const std::filesystem::path path = diskCache.getEntryPath(key);
+    const std::vector<char> entryBytes = readFile(path);
+    for (const size_t size : { size_t(0), size_t(1), kHeaderBytes - 1, kHeaderBytes, kHeaderBytes + 1, entryBytes.size() / 2, entryBytes.size() - 1 })
+    {
+        writeFile(path, std::vector<char>(entryBytes.begin(), entryBytes.begin() + size));
+        CHECK(diskCache.load(key) == nullptr);
+    }
+
+    // Trailing bytes are as wrong as missing ones
+    std::vector<char> extendedBytes = entryBytes;
+    extendedBytes.push_back(0);
+    writeFile(path, extendedBytes);
+    CHECK(diskCache.load(key) == nullptr);
+}
+
+// The tessellator loads its own entries on the next launch and rebuilds over a broken one, with identical buffers either way
+TEST(CurveTessellationDiskCache, TessellationRoundTrip)
+{
+    const TempDirectory directory("diskcache_tessellation");
+
+    SyntheticGroomDesc desc;
+    desc.name = "diskCacheGroom";
+    desc.numGeometries = 2;
+    desc.strandsPerGeometry = 30;
+    desc.seed = 41;
+
+    CurveTessellationSettings settings;
+    settings.enableHairTessellationDiskCache = true;
+    settings.hairTessellationDiskCacheDirectory = directory.get();
+
+    auto tessellate = [&](const TessellationType tessellationType)
+    {
+        const std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(desc) };
+        CurveTessellation curveTessellation(meshInstances, settings);
+        curveTessellation.requestTessellation(tessellationType, meshInstances);
+        const BufferGroup* const buffers = curveTessellation.getCurveMeshLod0Buffers(tessellationType, meshInstances, 0);
+        REQUIRE(buffers != nullptr);
+        return *buffers;
+    };
+
+    auto isBufferGroupEqual = [](const BufferGroup& lhs, const BufferGroup& rhs)
+    {
+        return isBitwiseEqual(lhs.indexData, rhs.indexData) && isBitwiseEqual(lhs.positionData, rhs.positionData) &&
+               isBitwiseEqual(lhs.normalData, rhs.normalData) && isBitwiseEqual(lhs.tangentData, rhs.tangentData) &&
+               isBitwiseEqual(lhs.texcoord1Data, rhs.texcoord1Data) && isBitwiseEqual(lhs.radiusData, rhs.radiusData);
+    };
+
+    // An entry's write time is set back a day, it only moves again if the entry is rewritten
+    auto setBackWriteTime = [](const std::filesystem::path& path)
+    {
+        std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now() - std::chrono::hours(24));
+        return std::filesystem::last_write_time(path);
+    };
+    auto getEntryPath = [&]()
+    {
+        std::vector<std::filesystem::path> paths;
+        for (const auto& file : std::filesystem::directory_iterator(directory.get()))
+        {
+            paths.push_back(file.path());
+        }
+        REQUIRE(paths.size() == 1);
+        return paths[0];
+    };
+
+    for (const TessellationType tessellationType : { TessellationType::Polytube, TessellationType::DisjointOrthogonalTriangleStrip, TessellationType::LinearSweptSphere })
+    {
+        for (const auto& file : std::filesystem::directory_iterator(directory.get()))
+        {
+            std::filesystem::remove(file.path());
+        }
+
+        // Cold: tessellate and store
+        const BufferGroup coldBuffers = tessellate(tessellationType);
+        const std::filesystem::path path = getEntryPath();
+        std::filesystem::file_time_type oldWriteTime = setBackWriteTime(path);
+
+        // Warm: loaded, the entry isn't rewritten
+        CHECK(isBufferGroupEqual(coldBuffers, tessellate(tessellationType)));
+        CHECK(std::filesystem::last_write_time(path) == oldWriteTime);
+
+        // Corrupted: rebuilt and stored again
+        std::vector<char> entryBytes = readFile(path);
+        entryBytes[entryBytes.size() / 2] ^= 0x01;
+        writeFile(path, entryBytes);
+        oldWriteTime = setBackWriteTime(path);
+        CHECK(isBufferGroupEqual(coldBuffers, tessellate(tessellationType)));
+        CHECK(std::filesystem::last_write_time(path) != oldWriteTime);
+
+        // Truncated: rebuilt as well
+        entryBytes = readFile(path);
+        entryBytes.resize(entryBytes.size() - 4);
+        writeFile(path, entryBytes);
+        oldWriteTime = setBackWriteTime(path);
+        CHECK(isBufferGroupEqual(coldBuffers, tessellate(tessellationType)));
+        CHECK(std::filesystem::last_write_time(path) != oldWriteTime);
+        CHECK(getEntryPath() == path);
+    }
+
+    // A changed radius scale is a miss next to the existing entry
+    settings.hairRadiusScale *= 2.0f;
+    tessellate(TessellationType::LinearSweptSphere);
+    uint32_t numFiles = 0;
+    for (const auto& file : std::filesystem::directory_iterator(directory.get()))
+    {
+        numFiles += file.is_regular_file() ? 1 : 0;
+    }
+    CHECK(numFiles == 2);
+}
+
+// The SIMD kernels and the geometry library don't produce bit-identical vertices, switching -hairSimdTessellation must not load
+// the other one's Polytube and DOTS entries. LSS has no SIMD kernels and shares its entry.
+TEST(CurveTessellationDiskCache, KernelChangeMisses)
+{
+    const TempDirectory directory("diskcache_kernels");
+
+    SyntheticGroomDesc desc;
+    desc.name = "diskCacheKernelGroom";
+    desc.strandsPerGeometry = 30;
+    desc.seed = 43;
+
+    CurveTessellationSettings settings;
+    settings.enableHairTessellationDiskCache = true;
+    settings.hairTessellationDiskCacheDirectory = directory.get();
+
+    auto tessellate = [&](const TessellationType tessellationType, const bool enableSimdKernels)
+    {
+        settings.enableSimdHairTessellation = enableSimdKernels;
+        const std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(desc) };
+        CurveTessellation curveTessellation(meshInstances, settings);
+        curveTessellation.requestTessellation(tessellationType, meshInstances);
+    };
+    auto getFileCount = [&]()
+    {
+        uint32_t numFiles = 0;
+        for (const auto& file : std::filesystem::directory_iterator(directory.get()))
+        {
+            numFiles += file.is_regular_file() ? 1 : 0;
+        }
+        return numFiles;
+    };
+
+    tessellate(TessellationType::Polytube, false);
+    tessellate(TessellationType::Polytube, true);
+    CHECK(getFileCount() == 2);
+    tessellate(TessellationType::DisjointOrthogonalTriangleStrip, false);
+    tessellate(TessellationType::DisjointOrthogonalTriangleStrip, true);
+    CHECK(getFileCount() == 4);
+
+    tessellate(TessellationType::LinearSweptSphere, false);
+    tessellate(TessellationType::LinearSweptSphere, true);
+    CHECK(getFileCount() == 5);
+}
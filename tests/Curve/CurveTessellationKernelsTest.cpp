@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <random>
+
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationKernels.h"
+#include "Curve/CurveTessellationKernelsSimd.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+namespace
+{
+    // Random segments, a few of them along the axes where perpStark() switches its helper vector
+    std::vector<rtxcr::geometry::LineSegment> createRandomSegments(const uint32_t numLineSegments, const uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(-2.0f, 2.0f);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+        std::vector<rtxcr::geometry::LineSegment> lineSegments(numLineSegments);
+        for (uint32_t segmentIndex = 0; segmentIndex < numLineSegments; ++segmentIndex)
+        {
+            auto& segment = lineSegments[segmentIndex];
+            segment.geometryIndex = segmentIndex / 16;
+            for (uint32_t endPoint = 0; endPoint < 2; ++endPoint)
+            {
+                for (uint32_t axis = 0; axis < 3; ++axis)
+                {
+                    segment.vertices[endPoint].position[axis] = position(rng);
+                }
+                segment.vertices[endPoint].radius = 0.001f + 0.01f * unit(rng);
+                segment.vertices[endPoint].texCoord[0] = unit(rng);
+                segment.vertices[endPoint].texCoord[1] = unit(rng);
+            }
+
+            if (segmentIndex % 5 == 0)
+            {
+                const uint32_t axis = (segmentIndex / 5) % 3;
+                for (uint32_t otherAxis = 0; otherAxis < 3; ++otherAxis)
+                {
+                    segment.vertices[1].position[otherAxis] = segment.vertices[0].position[otherAxis] + ((otherAxis == axis) ? 0.5f : 0.0f);
+                }
+            }
+        }
+        return lineSegments;
+    }
+
+    struct KernelOutput
+    {
+        std::vector<uint32_t> indices;
+        std::vector<float3> positions;
+        std::vector<uint32_t> normals;
+        std::vector<uint32_t> tangents;
+        std::vector<float2> texCoords;
+        std::vector<float> radius;
+
+        explicit KernelOutput(const uint32_t numVertices)
+            : indices(numVertices), positions(numVertices), normals(numVertices), tangents(numVertices), texCoords(numVertices), radius(numVertices)
+        {
+        }
+
+        CurveTessellationOutput get()
+        {
+            return { indices.data(), positions.data(), normals.data(), tangents.data(), texCoords.data(), radius.data() };
+        }
+    };
+
+    using PolyTubeKernel = uint32_t (*)(const rtxcr::geometry::LineSegment*, const uint32_t, const uint32_t, const CurveTessellationOutput&, const uint32_t);
+    using DotsKernel = uint32_t (*)(const rtxcr::geometry::LineSegment*, const uint32_t, const CurveTessellationOutput&, const uint32_t);
+
+    struct KernelIsa
+    {
+        CurveTessellationKernelIsa isa;
+        PolyTubeKernel polyTubes;
+        DotsKernel dots;
+    };
+
+    // Every batched kernel the build has and the running CPU supports
+    std::vector<KernelIsa> getSimdKernels()
+    {
+        std::vector<KernelIsa> kernels;
+#if defined(_M_X64) || defined(__x86_64__)
+        kernels.push_back({ CurveTessellationKernelIsa::Sse2,
+            CurveTessellationKernels::sse2::tessellatePolyTubes, CurveTessellationKernels::sse2::tessellateDisjointOrthogonalTriangleStrips });
+#if RTXCR_CURVE_TESSELLATION_AVX2
+        if (CurveTessellationKernels::getSupportedIsa() == CurveTessellationKernelIsa::Avx2)
+        {
+            kernels.push_back({ CurveTessellationKernelIsa::Avx2,
+                CurveTessellationKernels::avx2::tessellatePolyTubes, CurveTessellationKernels::avx2::tessellateDisjointOrthogonalTriangleStrips });
+        }
+#endif
+#endif
+        return kernels;
+    }
+}
+
+// Every instruction set against the scalar reference, with segment counts that leave every possible batch tail and a non zero global index
+TEST(CurveTessellationKernels, SimdMatchesScalarReference)
+{
+    using namespace CurveTessellationKernels;
+
+    const std::vector<KernelIsa> kernels = getSimdKernels();
+    if (kernels.empty())
+    {
+        printf("  no SIMD kernels in this build\n");
+        return;
+    }
+
+    constexpr uint32_t kGlobalIndex = 5;
+    for (const uint32_t numLineSegments : { 1u, 3u, 4u, 7u, 8u, 9u, 15u, 16u, 17u, 1001u })
+    {
+        const std::vector<rtxcr::geometry::LineSegment> lineSegments = createRandomSegments(numLineSegments, numLineSegments);
+        for (const KernelIsa& kernel : kernels)
+        {
+            for (uint32_t order = kMinPolyTubeOrder; order <= kMaxPolyTubeOrder + 1; ++order)
+            {
+                // kMaxPolyTubeOrder + 1 stands for DOTS
+                const bool isDots = (order > kMaxPolyTubeOrder);
+                const uint32_t numVertices = kGlobalIndex + numLineSegments * (isDots ? kDotsVerticesPerSegment : getPolyTubeVerticesPerSegment(order));
+
+                KernelOutput reference(numVertices);
+                KernelOutput result(numVertices);
+                const uint32_t referenceEnd = isDots ?
+                    tessellateDisjointOrthogonalTriangleStripsScalar(lineSegments.data(), numLineSegments, reference.get(), kGlobalIndex) :
+                    tessellatePolyTubesScalar(lineSegments.data(), numLineSegments, order, reference.get(), kGlobalIndex);
+                const uint32_t resultEnd = isDots ?
+                    kernel.dots(lineSegments.data(), numLineSegments, result.get(), kGlobalIndex) :
+                    kernel.polyTubes(lineSegments.data(), numLineSegments, order, result.get(), kGlobalIndex);
+
+                CHECK(referenceEnd == numVertices);
+                CHECK(resultEnd == numVertices);
+
+                const uint32_t numMismatches = compareTessellation(reference.get(), result.get(), kGlobalIndex, numVertices - kGlobalIndex, true);
+                if (numMismatches > 0)
+                {
+                    printf("  %s, %s order %u, %u segments: %u vertices differ\n", getCurveTessellationKernelIsaName(kernel.isa),
+                        isDots ? "DOTS" : "Polytube", order, numLineSegments, numMismatches);
+                }
+                CHECK(numMismatches == 0);
+
+                // The scalar index buffer is the identity, starting at the global index
+                for (uint32_t vertexIndex = kGlobalIndex; vertexIndex < numVertices; ++vertexIndex)
+                {
+                    CHECK(reference.indices[vertexIndex] == vertexIndex);
+                }
+            }
+        }
+    }
+}
+
+// The tessellator's SIMD path against the scalar reference over whole extracted meshes
+TEST(CurveTessellationKernels, SimdTessellationMatchesScalarReference)
+{
+    SyntheticGroomDesc desc;
+    desc.name = "simdGroom";
+    desc.numGeometries = 3;
+    desc.strandsPerGeometry = 50;
+    desc.minPointsPerStrand = 3;
+    desc.maxPointsPerStrand = 20;
+    desc.seed = 31;
+    const std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(desc) };
+
+    CurveTessellationSettings settings;
+    settings.enableSimdHairTessellation = true;
+    settings.hairTessellationThreadCount = 2;
+    settings.hairTessellationSegmentsPerTask = 37;
+    CurveTessellation curveTessellation(meshInstances, settings);
+
+    const auto& lineSegments = curveTessellation.GetCurvesLineSegments(desc.name);
+    const uint32_t numLineSegments = static_cast<uint32_t>(lineSegments.size());
+    for (const TessellationType tessellationType : { TessellationType::Polytube, TessellationType::DisjointOrthogonalTriangleStrip })
+    {
+        curveTessellation.requestTessellation(tessellationType, meshInstances);
+        const BufferGroup* const cachedBuffers = curveTessellation.getCurveMeshLod0Buffers(tessellationType, meshInstances, 0);
+        REQUIRE(cachedBuffers != nullptr);
+        BufferGroup buffers = *cachedBuffers;
+
+        const uint32_t numVertices = static_cast<uint32_t>(buffers.positionData.size());
+        KernelOutput reference(numVertices);
+        const uint32_t referenceEnd = (tessellationType == TessellationType::Polytube) ?
+            CurveTessellationKernels::tessellatePolyTubesScalar(lineSegments.data(), numLineSegments, curveTessellation.GetCurvePolyTubeOrder(desc.name), reference.get(), 0) :
+            CurveTessellationKernels::tessellateDisjointOrthogonalTriangleStripsScalar(lineSegments.data(), numLineSegments, reference.get(), 0);
+        REQUIRE(referenceEnd == numVertices);
+
+        const CurveTessellationOutput result = { buffers.indexData.data(), buffers.positionData.data(), buffers.normalData.data(),
+            buffers.tangentData.data(), buffers.texcoord1Data.data(), buffers.radiusData.data() };
+        CHECK(CurveTessellationKernels::compareTessellation(reference.get(), result, 0, numVertices, true) == 0);
+    }
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <array>
+
+#include "AllocationCounter.h"
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+namespace
+{
+    using DataPointers = std::array<const void*, 6>;
+
+    // Addresses of the tessellated attribute vectors of a buffer group, the ones swapCurveMeshData hands over
+    DataPointers getDataPointers(const BufferGroup& buffers)
+    {
+        return { buffers.indexData.data(), buffers.positionData.data(), buffers.normalData.data(),
+            buffers.tangentData.data(), buffers.texcoord1Data.data(), buffers.radiusData.data() };
+    }
+
+    uint32_t getNonEmptyVectorCount(const BufferGroup& buffers)
+    {
+        return (buffers.indexData.empty() ? 0 : 1) + (buffers.positionData.empty() ? 0 : 1) + (buffers.normalData.empty() ? 0 : 1) +
+            (buffers.tangentData.empty() ? 0 : 1) + (buffers.texcoord1Data.empty() ? 0 : 1) + (buffers.radiusData.empty() ? 0 : 1);
+    }
+
+    // Without the morph target animated mesh, its dynamic vertex buffer needs a device
+    std::vector<std::shared_ptr<MeshInstance>> createStaticGrooms(const uint32_t lineListStrandsPerGeometry)
+    {
+        SyntheticGroomSceneDesc desc;
+        desc.lineListStrandsPerGeometry = lineListStrandsPerGeometry;
+        desc.numMorphStrands = 0;
+        desc.seed = 31;
+        return createGrooms(desc);
+    }
+
+    // Cache slot vectors of a representation for every mesh, or the scene's vectors while the scene displays it
+    std::vector<DataPointers> getRepresentationPointers(
+        const CurveTessellation& curveTessellation,
+        const TessellationType tessellationType,
+        const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
+    {
+        std::vector<DataPointers> pointers;
+        for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
+        {
+            const BufferGroup* const buffers = curveTessellation.getCurveMeshLod0Buffers(tessellationType, meshInstances, meshIndex);
+            REQUIRE(buffers != nullptr);
+            pointers.push_back(getDataPointers(*buffers));
+        }
+        return pointers;
+    }
+
+    std::vector<DataPointers> getScenePointers(const std::vector<std::shared_ptr<MeshInstance>>& meshInstances)
+    {
+        std::vector<DataPointers> pointers;
+        for (const auto& meshInstance : meshInstances)
+        {
+            pointers.push_back(getDataPointers(*meshInstance->GetMesh()->buffers));
+        }
+        return pointers;
+    }
+}
+
+// Switching A to B and back to A hands the same vectors to the scene, nothing is copied or reallocated,
+// and the representation the scene stops displaying gets its own vectors back in its cache slot
+TEST(CurveTessellationSwitch, HandsOverWithoutCopying)
+{
+    const std::vector<std::shared_ptr<MeshInstance>> meshInstances = createStaticGrooms(40);
+    CurveTessellationSettings settings;
+    settings.enableLazyHairTessellation = true;
+    CurveTessellation curveTessellation(meshInstances, settings);
+
+    curveTessellation.requestTessellation(TessellationType::Polytube, meshInstances);
+    curveTessellation.requestTessellation(TessellationType::LinearSweptSphere, meshInstances);
+    const std::vector<DataPointers> polytubePointers = getRepresentationPointers(curveTessellation, TessellationType::Polytube, meshInstances);
+    const std::vector<DataPointers> lssPointers = getRepresentationPointers(curveTessellation, TessellationType::LinearSweptSphere, meshInstances);
+    for (size_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
+    {
+        CHECK(polytubePointers[meshIndex][1] != lssPointers[meshIndex][1]);
+    }
+
+    curveTessellation.replacingSceneMesh(nullptr, nullptr, TessellationType::Polytube, meshInstances);
+    CHECK(getScenePointers(meshInstances) == polytubePointers);
+    CHECK(meshInstances[0]->GetMesh()->type == MeshType::CurvePolytubes);
+    CHECK(curveTessellation.getCurveMeshLod0Buffers(TessellationType::Polytube, meshInstances, 0) == meshInstances[0]->GetMesh()->buffers.get());
+
+    curveTessellation.replacingSceneMesh(nullptr, nullptr, TessellationType::LinearSweptSphere, meshInstances);
+    CHECK(getScenePointers(meshInstances) == lssPointers);
+    CHECK(getRepresentationPointers(curveTessellation, TessellationType::Polytube, meshInstances) == polytubePointers);
+    CHECK(meshInstances[0]->GetMesh()->type == MeshType::CurveLinearSweptSpheres);
+
+    curveTessellation.replacingSceneMesh(nullptr, nullptr, TessellationType::Polytube, meshInstances);
+    CHECK(getScenePointers(meshInstances) == polytubePointers);
+    CHECK(getRepresentationPointers(curveTessellation, TessellationType::LinearSweptSphere, meshInstances) == lssPointers);
+    CHECK(meshInstances[0]->GetMesh()->type == MeshType::CurvePolytubes);
+
+    // Switching to the displayed representation changes nothing
+    curveTessellation.replacingSceneMesh(nullptr, nullptr, TessellationType::Polytube, meshInstances);
+    CHECK(getScenePointers(meshInstances) == polytubePointers);
+    CHECK(curveTessellation.isTessellationCached(TessellationType::Polytube));
+    CHECK(curveTessellation.isTessellationCached(TessellationType::LinearSweptSphere));
+}
+
+// A representation evicted while the scene displays it has no slot to go back to, switching away releases its vectors
+TEST(CurveTessellationSwitch, ReleasesEvictedRepresentation)
+{
+    // Every representation is larger than the budget, so requesting one evicts the other
+    const std::vector<std::shared_ptr<MeshInstance>> meshInstances = createStaticGrooms(3000);
+    CurveTessellationSettings settings;
+    settings.enableLazyHairTessellation = true;
+    settings.hairTessellationCacheBudgetMB = 1;
+    CurveTessellation curveTessellation(meshInstances, settings);
+
+    curveTessellation.requestTessellation(TessellationType::Polytube, meshInstances);
+    curveTessellation.replacingSceneMesh(nullptr, nullptr, TessellationType::Polytube, meshInstances);
+    const std::vector<DataPointers> polytubePointers = getScenePointers(meshInstances);
+
+    curveTessellation.requestTessellation(TessellationType::LinearSweptSphere, meshInstances);
+    REQUIRE(!curveTessellation.isTessellationCached(TessellationType::Polytube));
+    const std::vector<DataPointers> lssPointers = getRepresentationPointers(curveTessellation, TessellationType::LinearSweptSphere, meshInstances);
+    // The scene keeps displaying the evicted representation until the switch
+    CHECK(getScenePointers(meshInstances) == polytubePointers);
+
+    uint32_t numPolytubeVectors = 0;
+    for (const auto& meshInstance : meshInstances)
+    {
+        numPolytubeVectors += getNonEmptyVectorCount(*meshInstance->GetMesh()->buffers);
+    }
+    REQUIRE(numPolytubeVectors > 0);
+
+    const AllocationCounter::Counts startCounts = AllocationCounter::get();
+    curveTessellation.replacingSceneMesh(nullptr, nullptr, TessellationType::LinearSweptSphere, meshInstances);
+    const AllocationCounter::Counts switchCounts = AllocationCounter::getDifference(startCounts, AllocationCounter::get());
+
+    CHECK(getScenePointers(meshInstances) == lssPointers);
+    CHECK(switchCounts.numFrees >= numPolytubeVectors);
+    CHECK(curveTessellation.getCurveMeshLod0Buffers(TessellationType::Polytube, meshInstances, 0) == nullptr);
+    CHECK(curveTessellation.getTessellationCacheTotalBytes() == curveTessellation.getTessellationCacheBytes(TessellationType::LinearSweptSphere));
+
+    // Tessellated again on request, the scene gets the new vectors and the evicted LSS slot releases the displayed ones
+    curveTessellation.requestTessellation(TessellationType::Polytube, meshInstances);
+    REQUIRE(!curveTessellation.isTessellationCached(TessellationType::LinearSweptSphere));
+    const std::vector<DataPointers> newPolytubePointers = getRepresentationPointers(curveTessellation, TessellationType::Polytube, meshInstances);
+    curveTessellation.replacingSceneMesh(nullptr, nullptr, TessellationType::Polytube, meshInstances);
+    CHECK(getScenePointers(meshInstances) == newPolytubePointers);
+    CHECK(curveTessellation.getCurveMeshLod0Buffers(TessellationType::LinearSweptSphere, meshInstances, 0) == nullptr);
+}
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationKernels.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+namespace
+{
+    // LOD0 of every curve mesh in one representation
+    struct TessellationSnapshot
+    {
+        std::vector<std::vector<rtxcr::geometry::LineSegment>> lineSegments;
+        std::vector<BufferGroup> buffers;
+    };
+
+    TessellationSnapshot tessellate(const CurveTessellationSettings& settings, const TessellationType tessellationType)
+    {
+        const std::vector<std::shared_ptr<MeshInstance>> meshInstances = createGrooms();
+        CurveTessellation curveTessellation(meshInstances, settings);
+        curveTessellation.requestTessellation(tessellationType, meshInstances);
+
+        TessellationSnapshot snapshot;
+        for (uint32_t meshIndex = 0; meshIndex < meshInstances.size(); ++meshIndex)
+        {
+            snapshot.lineSegments.push_back(curveTessellation.GetCurvesLineSegments(meshInstances[meshIndex]->GetMesh()->name));
+
+            const BufferGroup* const buffers = curveTessellation.getCurveMeshLod0Buffers(tessellationType, meshInstances, meshIndex);
+            REQUIRE(buffers != nullptr);
+            snapshot.buffers.push_back(*buffers);
+        }
+        return snapshot;
+    }
+
+    bool isSnapshotEqual(const TessellationSnapshot& lhs, const TessellationSnapshot& rhs)
+    {
+        if (lhs.lineSegments.size() != rhs.lineSegments.size() || lhs.buffers.size() != rhs.buffers.size())
+        {
+            return false;
+        }
+
+        for (size_t meshIndex = 0; meshIndex < lhs.buffers.size(); ++meshIndex)
+        {
+            const BufferGroup& lhsBuffers = lhs.buffers[meshIndex];
+            const BufferGroup& rhsBuffers = rhs.buffers[meshIndex];
+            if (!isBitwiseEqual(lhs.lineSegments[meshIndex], rhs.lineSegments[meshIndex]) ||
+                !isBitwiseEqual(lhsBuffers.indexData, rhsBuffers.indexData) ||
+                !isBitwiseEqual(lhsBuffers.positionData, rhsBuffers.positionData) ||
+                !isBitwiseEqual(lhsBuffers.normalData, rhsBuffers.normalData) ||
+                !isBitwiseEqual(lhsBuffers.tangentData, rhsBuffers.tangentData) ||
+                !isBitwiseEqual(lhsBuffers.texcoord1Data, rhsBuffers.texcoord1Data) ||
+                !isBitwiseEqual(lhsBuffers.radiusData, rhsBuffers.radiusData))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Tessellates numLineSegments segments of the list with the geometry library, the first output vertex is globalIndex
+    void tessellateWithGeometryLibrary(
+        const TessellationType tessellationType,
+        const std::vector<rtxcr::geometry::LineSegment>& lineSegments,
+        const uint32_t numLineSegments,
+        BufferGroup& buffers,
+        const uint32_t globalIndex)
+    {
+        if (tessellationType == TessellationType::Polytube)
+        {
+            rtxcr::geometry::convertToTrianglePolyTubes(lineSegments, numLineSegments, buffers.indexData.data(), (float*)buffers.positionData.data(),
+                buffers.normalData.data(), buffers.tangentData.data(), (float*)buffers.texcoord1Data.data(), buffers.radiusData.data(), globalIndex);
+        }
+        else if (tessellationType == TessellationType::DisjointOrthogonalTriangleStrip)
+        {
+            rtxcr::geometry::convertToDisjointOrthogonalTriangleStrips(lineSegments, numLineSegments, buffers.indexData.data(),
+                (float*)buffers.positionData.data(), buffers.normalData.data(), buffers.tangentData.data(), (float*)buffers.texcoord1Data.data(),
+                buffers.radiusData.data(), globalIndex);
+        }
+        else
+        {
+            rtxcr::geometry::convertToLinearSweptSpheres(lineSegments, numLineSegments, (float*)buffers.positionData.data(),
+                (float*)buffers.radiusData.data(), globalIndex);
+        }
+    }
+
+    template <typename T>
+    bool isRangeEqual(const std::vector<T>& lhs, const std::vector<T>& rhs, const size_t first, const size_t count)
+    {
+        return lhs.size() == rhs.size() && (lhs.size() < first + count || memcmp(lhs.data() + first, rhs.data() + first, count * sizeof(T)) == 0);
+    }
+
+    uint32_t getManyThreadCount()
+    {
+        return std::max(std::thread::hardware_concurrency(), 4u);
+    }
+}
+
+// Serial tessellation with one task per geometry against 1, 2 and N threads with tasks splitting strands, byte for byte
+TEST(CurveTessellation, ParallelMatchesSerial)
+{
+    for (const TessellationType tessellationType : { TessellationType::Polytube, TessellationType::DisjointOrthogonalTriangleStrip, TessellationType::LinearSweptSphere })
+    {
+        // The geometry library, the SIMD kernels and the successive implicit LSS have their own task splits
+        for (const uint32_t variant : { 0u, 1u })
+        {
+            CurveTessellationSettings settings;
+            settings.enableSimdHairTessellation = (variant == 1) && (tessellationType != TessellationType::LinearSweptSphere);
+            settings.enableLssSuccessiveImplicit = (variant == 1) && (tessellationType == TessellationType::LinearSweptSphere);
+            settings.hairTessellationThreadCount = 1;
+            settings.hairTessellationSegmentsPerTask = 1 << 30;
+            const TessellationSnapshot serial = tessellate(settings, tessellationType);
+            REQUIRE(!serial.buffers.empty() && !serial.buffers[0].positionData.empty());
+
+            for (const uint32_t threadCount : { 1u, 2u, getManyThreadCount() })
+            {
+                for (const int segmentsPerTask : { 7, 16384 })
+                {
+                    settings.hairTessellationThreadCount = static_cast<int>(threadCount);
+                    settings.hairTessellationSegmentsPerTask = segmentsPerTask;
+                    const bool isEqual = isSnapshotEqual(serial, tessellate(settings, tessellationType));
+                    if (!isEqual)
+                    {
+                        printf("  %s, variant %u, %u threads, %d segments per task\n",
+                            getTessellationTypeName(tessellationType), variant, threadCount, segmentsPerTask);
+                    }
+                    CHECK(isEqual);
+                }
+            }
+        }
+    }
+}
+
+// The chunked library path hands the library the full segment list, a task of a single segment has to land where a whole geometry call puts it
+TEST(CurveTessellation, LibraryTasksOfOneSegment)
+{
+    for (const TessellationType tessellationType : { TessellationType::Polytube, TessellationType::DisjointOrthogonalTriangleStrip, TessellationType::LinearSweptSphere })
+    {
+        CurveTessellationSettings settings;
+        settings.hairTessellationThreadCount = 1;
+        settings.hairTessellationSegmentsPerTask = 1 << 30;
+        const TessellationSnapshot serial = tessellate(settings, tessellationType);
+
+        settings.hairTessellationThreadCount = 2;
+        settings.hairTessellationSegmentsPerTask = 1;
+        CHECK(isSnapshotEqual(serial, tessellate(settings, tessellationType)));
+    }
+}
+
+// The tessellation tasks hand the geometry library the mesh's full segment list and their first output vertex, the library has
+// to read segment globalIndex / numVerticesPerSegment of the list: tessellating the second of 2 segments alone, at its output
+// vertex, gives the vertices of tessellating both
+TEST(CurveTessellation, GeometryLibraryIndexesSegments)
+{
+    std::vector<rtxcr::geometry::LineSegment> lineSegments(2);
+    for (uint32_t segmentIndex = 0; segmentIndex < 2; ++segmentIndex)
+    {
+        for (uint32_t vertexIndex = 0; vertexIndex < 2; ++vertexIndex)
+        {
+            rtxcr::geometry::LineVertex& vertex = lineSegments[segmentIndex].vertices[vertexIndex];
+            const float offset = (float)(segmentIndex + vertexIndex);
+            vertex.position[0] = offset;
+            vertex.position[1] = 2.0f * offset + 1.0f;
+            vertex.position[2] = -offset;
+            vertex.radius = 0.1f * (offset + 1.0f);
+            vertex.texCoord[0] = (float)segmentIndex;
+            vertex.texCoord[1] = (float)vertexIndex;
+        }
+        lineSegments[segmentIndex].geometryIndex = 0;
+    }
+
+    for (const TessellationType tessellationType : { TessellationType::Polytube, TessellationType::DisjointOrthogonalTriangleStrip, TessellationType::LinearSweptSphere })
+    {
+        // The geometry library only builds the default polytube order
+        const uint32_t numVerticesPerSegment = (tessellationType == TessellationType::Polytube) ?
+            CurveTessellationKernels::getPolyTubeVerticesPerSegment(RTXCR_CURVE_POLYTUBE_ORDER) :
+            (tessellationType == TessellationType::DisjointOrthogonalTriangleStrip) ? CurveTessellationKernels::kDotsVerticesPerSegment : 2;
+        const bool hasIndexBuffer = (tessellationType != TessellationType::LinearSweptSphere);
+        const uint32_t numVertices = 2 * numVerticesPerSegment;
+        BufferGroup buffers[2];
+        for (BufferGroup& meshBuffers : buffers)
+        {
+            meshBuffers.indexData.resize(hasIndexBuffer ? numVertices : 0);
+            meshBuffers.positionData.resize(numVertices);
+            meshBuffers.normalData.resize(hasIndexBuffer ? numVertices : 0);
+            meshBuffers.tangentData.resize(hasIndexBuffer ? numVertices : 0);
+            meshBuffers.texcoord1Data.resize(hasIndexBuffer ? numVertices : 0);
+            meshBuffers.radiusData.resize(numVertices);
+        }
+
+        tessellateWithGeometryLibrary(tessellationType, lineSegments, 2, buffers[0], 0);
+        tessellateWithGeometryLibrary(tessellationType, lineSegments, 1, buffers[1], numVerticesPerSegment);
+
+        const bool isIndexingSegments =
+            isRangeEqual(buffers[0].indexData, buffers[1].indexData, numVerticesPerSegment, numVerticesPerSegment) &&
+            isRangeEqual(buffers[0].positionData, buffers[1].positionData, numVerticesPerSegment, numVerticesPerSegment) &&
+            isRangeEqual(buffers[0].normalData, buffers[1].normalData, numVerticesPerSegment, numVerticesPerSegment) &&
+            isRangeEqual(buffers[0].tangentData, buffers[1].tangentData, numVerticesPerSegment, numVerticesPerSegment) &&
+            isRangeEqual(buffers[0].texcoord1Data, buffers[1].texcoord1Data, numVerticesPerSegment, numVerticesPerSegment) &&
+            isRangeEqual(buffers[0].radiusData, buffers[1].radiusData, numVerticesPerSegment, numVerticesPerSegment);
+        if (!isIndexingSegments)
+        {
+            printf("  %s\n", getTessellationTypeName(tessellationType));
+        }
+        CHECK(isIndexingSegments);
+    }
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <random>
+
+#include "Curve/CurveTessellation.h"
+#include "Curve/CurveTessellationKernels.h"
+#include "Curve/CurveTessellationSettings.h"
+#include "Curve/MorphTargetKernelEmulation.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+namespace
+{
+    // Line segments and keyframe offsets of an animated groom, in the layout the morph target pass uploads
+    struct MorphGroom
+    {
+        std::vector<rtxcr::geometry::LineSegment> curveLineSegments;
+        std::vector<LineSegment> lineSegments;
+        std::vector<float4> keyframes[2];
+    };
+
+    MorphGroom createMorphGroom(const float offsetScale)
+    {
+        SyntheticGroomDesc desc;
+        desc.name = "morphGroom";
+        desc.numGeometries = 2;
+        desc.strandsPerGeometry = 150;
+        desc.minPointsPerStrand = 2;
+        desc.maxPointsPerStrand = 12;
+        desc.seed = 131;
+        const std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(desc) };
+        // The tessellator keeps a reference to its settings
+        const CurveTessellationSettings settings;
+        CurveTessellation curveTessellation(meshInstances, settings);
+
+        MorphGroom groom;
+        groom.curveLineSegments = curveTessellation.GetCurvesLineSegments(desc.name);
+        uint32_t numStrandPoints = 0;
+        for (uint32_t segmentIndex = 0; segmentIndex < groom.curveLineSegments.size(); ++segmentIndex)
+        {
+            const auto& segment = groom.curveLineSegments[segmentIndex];
+            LineSegment& lineSegment = groom.lineSegments.emplace_back();
+            lineSegment.geometryIndex = segment.geometryIndex;
+            lineSegment.pad0 = float3(0.0f);
+            lineSegment.point0 = float3(segment.vertices[0].position);
+            lineSegment.radius0 = segment.vertices[0].radius;
+            lineSegment.point1 = float3(segment.vertices[1].position);
+            lineSegment.radius1 = segment.vertices[1].radius;
+            // Keyframe point p of a strand lives at (first segment + group index + p)
+            numStrandPoints = std::max(numStrandPoints, segmentIndex + segment.geometryIndex + 2);
+        }
+
+        std::mt19937 rng(132);
+        std::uniform_real_distribution<float> offset(-offsetScale, offsetScale);
+        for (std::vector<float4>& keyframe : groom.keyframes)
+        {
+            keyframe.resize(numStrandPoints);
+            for (float4& point : keyframe)
+            {
+                point = float4(offset(rng), offset(rng), offset(rng), 0.0f);
+            }
+        }
+        return groom;
+    }
+
+    struct EmulationOutput
+    {
+        std::vector<float3> positions;
+        std::vector<uint32_t> normals;
+        std::vector<uint32_t> tangents;
+
+        explicit EmulationOutput(const uint32_t numVertices) : positions(numVertices), normals(numVertices), tangents(numVertices) {}
+
+        MorphTargetKernelEmulation::Output get() { return { positions.data(), normals.data(), tangents.data() }; }
+    };
+
+    MorphTargetKernelEmulation::Input getInput(const MorphGroom& groom, const float lerpWeight, const uint32_t polyTubeOrder)
+    {
+        MorphTargetKernelEmulation::Input input;
+        input.lineSegments = groom.lineSegments.data();
+        input.numLineSegments = static_cast<uint32_t>(groom.lineSegments.size());
+        input.keyframe = groom.keyframes[0].data();
+        input.nextKeyframe = groom.keyframes[1].data();
+        input.lerpWeight = lerpWeight;
+        input.polyTubeOrder = polyTubeOrder;
+        return input;
+    }
+}
+
+// The one thread per segment layout writes the same vertices bit for bit as the one thread per vertex layout, for DOTS and every polytube order
+TEST(MorphTargetKernelEmulation, PerSegmentMatchesPerVertex)
+{
+    using namespace CurveTessellationKernels;
+
+    const MorphGroom groom = createMorphGroom(0.02f);
+    for (uint32_t order = kMinPolyTubeOrder; order <= kMaxPolyTubeOrder + 1; ++order)
+    {
+        // kMaxPolyTubeOrder + 1 stands for DOTS
+        const bool isDots = (order > kMaxPolyTubeOrder);
+        const uint32_t tessellationType = isDots ? RTXCR_CURVE_TESSELLATION_TYPE_DOTS : RTXCR_CURVE_TESSELLATION_TYPE_POLYTUBE;
+        for (const float lerpWeight : { 0.0f, 0.37f, 1.0f })
+        {
+            const MorphTargetKernelEmulation::Input input = getInput(groom, lerpWeight, isDots ? RTXCR_CURVE_POLYTUBE_ORDER : order);
+            const uint32_t numVertices = MorphTargetKernelEmulation::getVertexCount(tessellationType, input);
+            CHECK(numVertices == input.numLineSegments * (isDots ? kDotsVerticesPerSegment : getPolyTubeVerticesPerSegment(order)));
+
+            EmulationOutput perVertex(numVertices);
+            EmulationOutput perSegment(numVertices);
+            MorphTargetKernelEmulation::dispatchPerVertex(tessellationType, input, perVertex.get());
+            MorphTargetKernelEmulation::dispatchPerSegment(tessellationType, input, perSegment.get());
+
+            CHECK(isBitwiseEqual(perVertex.positions, perSegment.positions));
+            CHECK(isBitwiseEqual(perVertex.normals, perSegment.normals));
+            CHECK(isBitwiseEqual(perVertex.tangents, perSegment.tangents));
+        }
+    }
+}
+
+// Without keyframe offsets the morph kernels rebuild the CPU tessellation of the rest pose
+TEST(MorphTargetKernelEmulation, RestPoseMatchesCpuTessellation)
+{
+    using namespace CurveTessellationKernels;
+
+    const MorphGroom groom = createMorphGroom(0.0f);
+    const uint32_t numLineSegments = static_cast<uint32_t>(groom.lineSegments.size());
+    for (uint32_t order = kMinPolyTubeOrder; order <= kMaxPolyTubeOrder + 1; ++order)
+    {
+        const bool isDots = (order > kMaxPolyTubeOrder);
+        const uint32_t tessellationType = isDots ? RTXCR_CURVE_TESSELLATION_TYPE_DOTS : RTXCR_CURVE_TESSELLATION_TYPE_POLYTUBE;
+        const MorphTargetKernelEmulation::Input input = getInput(groom, 0.5f, isDots ? RTXCR_CURVE_POLYTUBE_ORDER : order);
+        const uint32_t numVertices = MorphTargetKernelEmulation::getVertexCount(tessellationType, input);
+
+        EmulationOutput emulation(numVertices);
+        MorphTargetKernelEmulation::dispatchPerSegment(tessellationType, input, emulation.get());
+
+        std::vector<uint32_t> indices(numVertices);
+        std::vector<float3> positions(numVertices);
+        std::vector<uint32_t> normals(numVertices);
+        std::vector<uint32_t> tangents(numVertices);
+        std::vector<float2> texCoords(numVertices);
+        std::vector<float> radius(numVertices);
+        const CurveTessellationOutput reference = { indices.data(), positions.data(), normals.data(), tangents.data(), texCoords.data(), radius.data() };
+        if (isDots)
+        {
+            tessellateDisjointOrthogonalTriangleStripsScalar(groom.curveLineSegments.data(), numLineSegments, reference, 0);
+        }
+        else
+        {
+            tessellatePolyTubesScalar(groom.curveLineSegments.data(), numLineSegments, order, reference, 0);
+        }
+
+        // Only positions, normals and tangents are animated, the rest of the emulated vertex comes from the reference
+        const CurveTessellationOutput result = { indices.data(), emulation.positions.data(), emulation.normals.data(), emulation.tangents.data(),
+            texCoords.data(), radius.data() };
+        const uint32_t numMismatches = compareTessellation(reference, result, 0, numVertices, true);
+        if (numMismatches > 0)
+        {
+            printf("  %s order %u: %u of %u vertices differ\n", isDots ? "DOTS" : "Polytube", order, numMismatches, numVertices);
+        }
+        CHECK(numMismatches == 0);
+    }
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <random>
+
+#include "Curve/MorphTargetKeyframeEncoder.h"
+#include "TestFramework.h"
+
+namespace
+{
+    // Keyframes of different scales and centers, with a gap between them so every keyframe has to be read through its own range
+    struct KeyframeSequence
+    {
+        std::vector<float4> data;
+        std::vector<nvrhi::BufferRange> ranges;
+    };
+
+    KeyframeSequence createKeyframes(const std::vector<uint32_t>& keyframeVertexCounts, const uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> random(-1.0f, 1.0f);
+
+        KeyframeSequence keyframes;
+        for (uint32_t keyframeIndex = 0; keyframeIndex < keyframeVertexCounts.size(); ++keyframeIndex)
+        {
+            keyframes.data.insert(keyframes.data.end(), 3, float4(1e6f));
+
+            nvrhi::BufferRange range;
+            range.byteOffset = keyframes.data.size() * sizeof(float4);
+            range.byteSize = keyframeVertexCounts[keyframeIndex] * sizeof(float4);
+            keyframes.ranges.push_back(range);
+
+            const float3 center = float3(random(rng), random(rng), random(rng)) * 10.0f;
+            const float scale = 0.001f * float(1u << (keyframeIndex % 12));
+            for (uint32_t pointIndex = 0; pointIndex < keyframeVertexCounts[keyframeIndex]; ++pointIndex)
+            {
+                keyframes.data.push_back(float4(center + float3(random(rng), random(rng), random(rng)) * scale, 0.0f));
+            }
+        }
+        return keyframes;
+    }
+
+    const float4& getKeyframePoint(const KeyframeSequence& keyframes, const uint32_t keyframeIndex, const uint32_t pointIndex)
+    {
+        return keyframes.data[keyframes.ranges[keyframeIndex].byteOffset / sizeof(float4) + pointIndex];
+    }
+}
+
+// The full format copies the keyframes into contiguous ranges and decodes them bit for bit
+TEST(MorphTargetKeyframeEncoder, FullFormatIsLossless)
+{
+    const KeyframeSequence keyframes = createKeyframes({ 100, 100, 37, 0, 100 }, 181);
+    MorphTargetKeyframeEncoder::EncodedKeyframes encodedKeyframes;
+    MorphTargetKeyframeEncoder::encode(keyframes.data, keyframes.ranges, RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_FULL, encodedKeyframes);
+
+    REQUIRE(encodedKeyframes.format == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_FULL);
+    REQUIRE(encodedKeyframes.keyframeRanges.size() == keyframes.ranges.size());
+    CHECK(encodedKeyframes.keyframeVertexCount == 100);
+    CHECK(encodedKeyframes.quantization.empty());
+    CHECK(encodedKeyframes.getByteSize() == (100 + 100 + 37 + 100) * sizeof(float4));
+    CHECK(encodedKeyframes.maxPositionError == 0.0f);
+
+    uint64_t nextByteOffset = 0;
+    uint32_t numMismatches = 0;
+    for (uint32_t keyframeIndex = 0; keyframeIndex < keyframes.ranges.size(); ++keyframeIndex)
+    {
+        CHECK(encodedKeyframes.keyframeRanges[keyframeIndex].byteOffset == nextByteOffset);
+        CHECK(encodedKeyframes.keyframeRanges[keyframeIndex].byteSize == keyframes.ranges[keyframeIndex].byteSize);
+        nextByteOffset += encodedKeyframes.keyframeRanges[keyframeIndex].byteSize;
+
+        for (uint32_t pointIndex = 0; pointIndex < keyframes.ranges[keyframeIndex].byteSize / sizeof(float4); ++pointIndex)
+        {
+            const float3 decodedOffset = MorphTargetKeyframeEncoder::decode(encodedKeyframes, keyframeIndex, pointIndex);
+            const float3 offset = getKeyframePoint(keyframes, keyframeIndex, pointIndex).xyz();
+            numMismatches += (decodedOffset.x != offset.x || decodedOffset.y != offset.y || decodedOffset.z != offset.z) ? 1 : 0;
+        }
+    }
+    CHECK(numMismatches == 0);
+}
+
+// Every strand point of the half and unorm10 formats decodes, as the shader does, within the error bound of its own keyframe
+TEST(MorphTargetKeyframeEncoder, QuantizedFormatsStayWithinErrorBound)
+{
+    const KeyframeSequence keyframes = createKeyframes({ 500, 500, 500, 1, 0, 213, 500, 500, 500, 500, 500, 500, 500, 500 }, 182);
+
+    for (const uint32_t format : { RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_HALF, RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_UNORM10 })
+    {
+        MorphTargetKeyframeEncoder::EncodedKeyframes encodedKeyframes;
+        MorphTargetKeyframeEncoder::encode(keyframes.data, keyframes.ranges, format, encodedKeyframes);
+
+        REQUIRE(encodedKeyframes.format == format);
+        REQUIRE(encodedKeyframes.keyframeRanges.size() == keyframes.ranges.size());
+        REQUIRE(encodedKeyframes.quantization.size() == keyframes.ranges.size());
+
+        const uint32_t stride = getKeyframeStride(format);
+        uint64_t nextByteOffset = 0;
+        uint32_t numErrors = 0;
+        float maxPositionError = 0.0f;
+        for (uint32_t keyframeIndex = 0; keyframeIndex < keyframes.ranges.size(); ++keyframeIndex)
+        {
+            const uint32_t keyframeVertexCount = (uint32_t)(keyframes.ranges[keyframeIndex].byteSize / sizeof(float4));
+            CHECK(encodedKeyframes.keyframeRanges[keyframeIndex].byteOffset == nextByteOffset);
+            CHECK(encodedKeyframes.keyframeRanges[keyframeIndex].byteSize == (uint64_t)keyframeVertexCount * stride);
+            nextByteOffset += encodedKeyframes.keyframeRanges[keyframeIndex].byteSize;
+
+            const float errorBound = MorphTargetKeyframeEncoder::getComponentErrorBound(format, encodedKeyframes.quantization[keyframeIndex]);
+            for (uint32_t pointIndex = 0; pointIndex < keyframeVertexCount; ++pointIndex)
+            {
+                const float3 error = abs(MorphTargetKeyframeEncoder::decode(encodedKeyframes, keyframeIndex, pointIndex) -
+                                         getKeyframePoint(keyframes, keyframeIndex, pointIndex).xyz());
+                numErrors += (error.x > errorBound || error.y > errorBound || error.z > errorBound) ? 1 : 0;
+                maxPositionError = std::max(maxPositionError, length(error));
+            }
+        }
+        CHECK(numErrors == 0);
+        CHECK(encodedKeyframes.getByteSize() == nextByteOffset);
+        CHECK(encodedKeyframes.maxPositionError == maxPositionError);
+        CHECK(encodedKeyframes.rmsPositionError <= encodedKeyframes.maxPositionError);
+    }
+}
+
+// A keyframe whose strand points don't move has no extent and must decode exactly, without dividing by zero
+TEST(MorphTargetKeyframeEncoder, FlatKeyframes)
+{
+    KeyframeSequence keyframes;
+    keyframes.data = { float4(0.25f, -3.0f, 0.0f, 0.0f), float4(0.25f, -3.0f, 0.0f, 0.0f), float4(0.25f, -3.0f, 0.0f, 0.0f),
+                       float4(0.0f), float4(0.0f), float4(0.0f) };
+    keyframes.ranges = { { 0, 3 * sizeof(float4) }, { 3 * sizeof(float4), 3 * sizeof(float4) } };
+
+    for (const uint32_t format : { RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_HALF, RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_UNORM10 })
+    {
+        MorphTargetKeyframeEncoder::EncodedKeyframes encodedKeyframes;
+        MorphTargetKeyframeEncoder::encode(keyframes.data, keyframes.ranges, format, encodedKeyframes);
+
+        for (uint32_t keyframeIndex = 0; keyframeIndex < 2; ++keyframeIndex)
+        {
+            for (uint32_t pointIndex = 0; pointIndex < 3; ++pointIndex)
+            {
+                const float3 decodedOffset = MorphTargetKeyframeEncoder::decode(encodedKeyframes, keyframeIndex, pointIndex);
+                const float3 offset = getKeyframePoint(keyframes, keyframeIndex, pointIndex).xyz();
+                CHECK(decodedOffset.x == offset.x && decodedOffset.y == offset.y && decodedOffset.z == offset.z);
+            }
+        }
+        CHECK(encodedKeyframes.maxPositionError == 0.0f);
+    }
+}
+
+// Keyframes of different sizes can't share a PCA basis and are stored in the full format
+TEST(MorphTargetKeyframeEncoder, PcaFallsBackToFullFormat)
+{
+    const KeyframeSequence keyframes = createKeyframes({ 64, 64, 63 }, 183);
+    MorphTargetKeyframeEncoder::EncodedKeyframes encodedKeyframes;
+    MorphTargetKeyframeEncoder::encode(keyframes.data, keyframes.ranges, RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_PCA, encodedKeyframes);
+
+    CHECK(encodedKeyframes.format == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_FULL);
+    CHECK(encodedKeyframes.componentCount == 0);
+    CHECK(encodedKeyframes.coefficients.empty());
+    CHECK(encodedKeyframes.getByteSize() == (64 + 64 + 63) * sizeof(float4));
+}
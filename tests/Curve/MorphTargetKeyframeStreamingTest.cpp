@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <random>
+
+#include "Curve/MorphTargetKeyframeStreaming.h"
+#include "Curve/MorphTargetKeyframeStreamingSimulation.h"
+#include "TestFramework.h"
+
+namespace
+{
+    // Empty directory of its own for every test, removed again when the test ends
+    class TempDirectory
+    {
+    public:
+        explicit TempDirectory(const char* name)
+        : m_path(std::filesystem::temp_directory_path() / (std::string("rtxcr_tests_") + name))
+        {
+            std::filesystem::remove_all(m_path);
+            std::filesystem::create_directories(m_path);
+        }
+
+        ~TempDirectory()
+        {
+            std::error_code error;
+            std::filesystem::remove_all(m_path, error);
+        }
+
+        inline const std::filesystem::path& get() const { return m_path; }
+
+    private:
+        std::filesystem::path m_path;
+    };
+
+    MorphTargetKeyframeEncoder::EncodedKeyframes encodeKeyframes(const uint32_t numKeyframes, const uint32_t numPoints, const uint32_t format)
+    {
+        std::mt19937 rng(201);
+        std::uniform_real_distribution<float> random(-0.01f, 0.01f);
+        std::vector<float4> keyframeData((size_t)numKeyframes * numPoints);
+        for (float4& offset : keyframeData)
+        {
+            offset = float4(random(rng), random(rng), random(rng), 0.0f);
+        }
+        std::vector<nvrhi::BufferRange> keyframeRanges;
+        for (uint32_t keyframeIndex = 0; keyframeIndex < numKeyframes; ++keyframeIndex)
+        {
+            keyframeRanges.push_back({ (uint64_t)keyframeIndex * numPoints * sizeof(float4), (uint64_t)numPoints * sizeof(float4) });
+        }
+
+        MorphTargetKeyframeEncoder::EncodedKeyframes encodedKeyframes;
+        MorphTargetKeyframeEncoder::encode(keyframeData, keyframeRanges, format, encodedKeyframes);
+        return encodedKeyframes;
+    }
+
+    bool isKeyframeEqual(const MorphTargetKeyframeEncoder::EncodedKeyframes& encodedKeyframes, const uint32_t keyframeIndex, const uint8_t* const data)
+    {
+        const nvrhi::BufferRange& range = encodedKeyframes.keyframeRanges[keyframeIndex];
+        return memcmp(reinterpret_cast<const uint8_t*>(encodedKeyframes.data.data()) + range.byteOffset, data, range.byteSize) == 0;
+    }
+
+    // Both keyframes the animation reads are resident, and no two resident keyframes share a slot
+    bool isWindowConsistent(const MorphTargetKeyframeWindow& window, const uint32_t keyframe, const uint32_t nextKeyframe)
+    {
+        if (window.getResidentSlot(keyframe) == MorphTargetKeyframeWindow::kInvalid ||
+            window.getResidentSlot(nextKeyframe) == MorphTargetKeyframeWindow::kInvalid)
+        {
+            return false;
+        }
+
+        std::vector<bool> usedSlots(window.getSlotCount(), false);
+        for (uint32_t residentKeyframe = 0; residentKeyframe < window.getKeyframeCount(); ++residentKeyframe)
+        {
+            const uint32_t slot = window.getResidentSlot(residentKeyframe);
+            if (slot == MorphTargetKeyframeWindow::kInvalid)
+            {
+                continue;
+            }
+            if (slot >= window.getSlotCount() || usedSlots[slot])
+            {
+                return false;
+            }
+            usedSlots[slot] = true;
+        }
+        return true;
+    }
+}
+
+// Every keyframe reads back from the mapping as encoded, files that can't be streamed aren't written
+TEST(MorphTargetKeyframeStreaming, FileRoundTrip)
+{
+    const TempDirectory directory("MorphTargetKeyframeStreaming_FileRoundTrip");
+
+    for (const uint32_t format : { RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_FULL, RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_HALF, RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_UNORM10 })
+    {
+        const MorphTargetKeyframeEncoder::EncodedKeyframes encodedKeyframes = encodeKeyframes(12, 333, format);
+        const std::filesystem::path path = directory.get() / ("keyframes" + std::to_string(format) + ".bin");
+        REQUIRE(MorphTargetKeyframeFile::store(path, encodedKeyframes));
+        CHECK(!std::filesystem::exists(std::filesystem::path(path).concat(".tmp")));
+
+        const std::unique_ptr<MorphTargetKeyframeFile> file = MorphTargetKeyframeFile::load(path);
+        REQUIRE(file);
+        CHECK(file->getFormat() == format);
+        CHECK(file->getKeyframeCount() == 12);
+        CHECK(file->getKeyframeByteSize() == 333ull * getKeyframeStride(format));
+
+        uint32_t numMismatches = 0;
+        for (uint32_t keyframeIndex = 0; keyframeIndex < file->getKeyframeCount(); ++keyframeIndex)
+        {
+            numMismatches += isKeyframeEqual(encodedKeyframes, keyframeIndex, file->getKeyframe(keyframeIndex)) ? 0 : 1;
+        }
+        CHECK(numMismatches == 0);
+    }
+
+    MorphTargetKeyframeEncoder::EncodedKeyframes pcaKeyframes = encodeKeyframes(12, 333, RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_PCA);
+    REQUIRE(pcaKeyframes.format == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_PCA);
+    CHECK(!MorphTargetKeyframeFile::store(directory.get() / "pca.bin", pcaKeyframes));
+
+    MorphTargetKeyframeEncoder::EncodedKeyframes unevenKeyframes = encodeKeyframes(4, 100, RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_HALF);
+    unevenKeyframes.keyframeRanges[1].byteSize -= getKeyframeStride(RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_HALF);
+    CHECK(!MorphTargetKeyframeFile::store(directory.get() / "uneven.bin", unevenKeyframes));
+    CHECK(!MorphTargetKeyframeFile::load(directory.get() / "missing.bin"));
+}
+
+// Truncated files and files of another layout are rejected instead of read past their end
+TEST(MorphTargetKeyframeStreaming, RejectsBrokenFiles)
+{
+    const TempDirectory directory("MorphTargetKeyframeStreaming_RejectsBrokenFiles");
+    const std::filesystem::path path = directory.get() / "keyframes.bin";
+    REQUIRE(MorphTargetKeyframeFile::store(path, encodeKeyframes(6, 50, RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_UNORM10)));
+
+    std::vector<char> contents(std::filesystem::file_size(path));
+    {
+        std::ifstream stream(path, std::ios::binary);
+        stream.read(contents.data(), (std::streamsize)contents.size());
+    }
+
+    const auto writeVariant = [&](const char* name, const std::vector<char>& variant)
+    {
+        const std::filesystem::path variantPath = directory.get() / name;
+        std::ofstream stream(variantPath, std::ios::binary | std::ios::trunc);
+        stream.write(variant.data(), (std::streamsize)variant.size());
+        return variantPath;
+    };
+
+    std::vector<char> truncated(contents.begin(), contents.end() - 1);
+    std::vector<char> headerOnly(contents.begin(), contents.begin() + 16);
+    std::vector<char> wrongMagic = contents;
+    wrongMagic[0] ^= 0x1;
+    std::vector<char> wrongVersion = contents;
+    wrongVersion[4] ^= 0x1;
+    std::vector<char> padded = contents;
+    padded.push_back(0);
+
+    CHECK(!MorphTargetKeyframeFile::load(writeVariant("truncated.bin", truncated)));
+    CHECK(!MorphTargetKeyframeFile::load(writeVariant("headerOnly.bin", headerOnly)));
+    CHECK(!MorphTargetKeyframeFile::load(writeVariant("wrongMagic.bin", wrongMagic)));
+    CHECK(!MorphTargetKeyframeFile::load(writeVariant("wrongVersion.bin", wrongVersion)));
+    CHECK(!MorphTargetKeyframeFile::load(writeVariant("padded.bin", padded)));
+    CHECK(MorphTargetKeyframeFile::load(writeVariant("copy.bin", contents)));
+}
+
+// The keyframes the animation reads are resident in distinct slots after their required loads, also when playback
+// jumps around, and background loads of slots that were reassigned in the meantime are rejected
+TEST(MorphTargetKeyframeStreaming, WindowKeepsRequiredKeyframesResident)
+{
+    std::mt19937 rng(202);
+    for (const uint32_t slotCount : { 2u, 3u, 8u, 40u })
+    {
+        MorphTargetKeyframeWindow window;
+        window.reset(30, slotCount);
+        CHECK(window.getSlotCount() == std::min(slotCount, 30u));
+
+        std::vector<MorphTargetKeyframeWindow::Load> pendingLoads;
+        std::vector<MorphTargetKeyframeWindow::Load> loads;
+        uint32_t keyframe = 0;
+        uint32_t numInconsistentFrames = 0;
+        for (uint32_t frame = 0; frame < 500; ++frame)
+        {
+            // Mostly playback, sometimes a seek or an interpolation towards a keyframe further away
+            const uint32_t jump = rng() % 10;
+            keyframe = (jump == 0) ? rng() % 30 : (keyframe + (jump < 5 ? 1 : 0)) % 30;
+            const uint32_t nextKeyframe = (jump == 1) ? rng() % 30 : (keyframe + 1) % 30;
+
+            loads.clear();
+            window.update(keyframe, nextKeyframe, loads);
+            for (const MorphTargetKeyframeWindow::Load& load : loads)
+            {
+                CHECK(load.keyframe < 30 && load.slot < window.getSlotCount());
+                if (load.required)
+                {
+                    // With keyframe == nextKeyframe the keyframe is required twice, the second load finds it resident
+                    CHECK(window.complete(load) || window.getResidentSlot(load.keyframe) == load.slot);
+                }
+                else
+                {
+                    pendingLoads.push_back(load);
+                }
+            }
+
+            // Some of the background loads finish, in any order
+            std::shuffle(pendingLoads.begin(), pendingLoads.end(), rng);
+            const size_t numFinished = pendingLoads.size() / 2;
+            for (size_t loadIndex = 0; loadIndex < numFinished; ++loadIndex)
+            {
+                window.complete(pendingLoads.back());
+                pendingLoads.pop_back();
+            }
+
+            numInconsistentFrames += isWindowConsistent(window, keyframe, nextKeyframe) ? 0 : 1;
+        }
+        CHECK(numInconsistentFrames == 0);
+    }
+
+    // Keyframes 2 and 3 lose their slots to the window of keyframe 5 before their loads finish
+    MorphTargetKeyframeWindow window;
+    window.reset(10, 4);
+    std::vector<MorphTargetKeyframeWindow::Load> loads;
+    window.update(0, 1, loads);
+    REQUIRE(loads.size() == 4);
+    CHECK(loads[0].keyframe == 0 && loads[0].required);
+    CHECK(loads[1].keyframe == 1 && loads[1].required);
+    CHECK(loads[2].keyframe == 2 && !loads[2].required);
+    CHECK(loads[3].keyframe == 3 && !loads[3].required);
+    CHECK(window.complete(loads[0]) && window.complete(loads[1]));
+    CHECK(!window.complete(loads[0]));
+
+    std::vector<MorphTargetKeyframeWindow::Load> nextLoads;
+    window.update(5, 6, nextLoads);
+    CHECK(!window.complete(loads[2]));
+    CHECK(!window.complete(loads[3]));
+    CHECK(window.getResidentSlot(0) == MorphTargetKeyframeWindow::kInvalid);
+    CHECK(window.getResidentSlot(2) == MorphTargetKeyframeWindow::kInvalid);
+    for (const MorphTargetKeyframeWindow::Load& load : nextLoads)
+    {
+        CHECK(load.keyframe >= 5 && load.keyframe <= 8);
+        CHECK(window.complete(load));
+    }
+    for (uint32_t keyframe = 5; keyframe <= 8; ++keyframe)
+    {
+        CHECK(window.getResidentSlot(keyframe) != MorphTargetKeyframeWindow::kInvalid);
+    }
+}
+
+// Playback with background reads that take a few frames keeps the window valid. With as many slots as keyframes
+// every keyframe is loaded once.
+TEST(MorphTargetKeyframeStreaming, SimulatedPlayback)
+{
+    for (const uint32_t slotCount : { 2u, 4u, 8u, 16u })
+    {
+        for (const float keyframesPerFrame : { 0.25f, 0.5f, 1.0f, 3.0f })
+        {
+            for (const uint32_t readLatencyFrames : { 0u, 1u, 4u })
+            {
+                MorphTargetKeyframeStreamingSimulationSettings settings;
+                settings.keyframeCount = 120;
+                settings.slotCount = slotCount;
+                settings.frameCount = 1000;
+                settings.keyframesPerFrame = keyframesPerFrame;
+                settings.readLatencyFrames = readLatencyFrames;
+                const MorphTargetKeyframeStreamingSimulationStats stats = MorphTargetKeyframeStreaming::simulate(settings);
+                CHECK(stats.valid);
+                CHECK(stats.numRequiredLoads <= stats.numLoads);
+
+                // Reads that arrive before playback reaches their keyframe only stall while the first window fills.
+                // A read completes at the earliest the frame after its request.
+                if (std::max(readLatencyFrames, 1u) * keyframesPerFrame + 2 < slotCount - 1)
+                {
+                    CHECK(stats.numRequiredLoads <= 3 + readLatencyFrames * keyframesPerFrame);
+                }
+            }
+        }
+    }
+
+    MorphTargetKeyframeStreamingSimulationSettings settings;
+    settings.keyframeCount = 50;
+    settings.slotCount = 50;
+    settings.frameCount = 1000;
+    const MorphTargetKeyframeStreamingSimulationStats stats = MorphTargetKeyframeStreaming::simulate(settings);
+    CHECK(stats.valid);
+    CHECK(stats.numLoads == 50);
+}
+
+// The background reader delivers every requested keyframe, the destructor drops queued reads without waiting for them
+TEST(MorphTargetKeyframeStreaming, ReaderDeliversKeyframes)
+{
+    const TempDirectory directory("MorphTargetKeyframeStreaming_ReaderDeliversKeyframes");
+    const std::filesystem::path path = directory.get() / "keyframes.bin";
+    const MorphTargetKeyframeEncoder::EncodedKeyframes encodedKeyframes = encodeKeyframes(40, 1000, RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_HALF);
+    REQUIRE(MorphTargetKeyframeFile::store(path, encodedKeyframes));
+    const std::shared_ptr<const MorphTargetKeyframeFile> file = MorphTargetKeyframeFile::load(path);
+    REQUIRE(file);
+
+    {
+        MorphTargetKeyframeReader reader(file);
+        for (uint32_t keyframe = 0; keyframe < 40; ++keyframe)
+        {
+            reader.request({ keyframe, keyframe % 8, keyframe + 1, false });
+        }
+
+        std::vector<MorphTargetKeyframeReader::Completed> completed;
+        const auto startTime = std::chrono::steady_clock::now();
+        while (completed.size() < 40 && std::chrono::steady_clock::now() - startTime < std::chrono::seconds(30))
+        {
+            reader.collect(completed);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        REQUIRE(completed.size() == 40);
+        CHECK(reader.getPendingCount() == 0);
+
+        // One worker reads the requests in order
+        uint32_t numMismatches = 0;
+        for (uint32_t readIndex = 0; readIndex < completed.size(); ++readIndex)
+        {
+            const MorphTargetKeyframeReader::Completed& read = completed[readIndex];
+            numMismatches += (read.load.keyframe != readIndex || read.load.ticket != readIndex + 1 ||
+                              read.data.size() != file->getKeyframeByteSize() || !isKeyframeEqual(encodedKeyframes, readIndex, read.data.data())) ? 1 : 0;
+        }
+        CHECK(numMismatches == 0);
+
+        std::vector<uint8_t> data;
+        reader.read(17, data);
+        CHECK(data.size() == file->getKeyframeByteSize() && isKeyframeEqual(encodedKeyframes, 17, data.data()));
+    }
+
+    {
+        MorphTargetKeyframeReader reader(file);
+        for (uint32_t request = 0; request < 10000; ++request)
+        {
+            reader.request({ request % 40, 0, request + 1, false });
+        }
+    }
+}
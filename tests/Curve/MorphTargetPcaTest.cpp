@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <random>
+
+#include "Curve/MorphTargetKeyframeEncoder.h"
+#include "Curve/MorphTargetPca.h"
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+namespace
+{
+    struct KeyframeSequence
+    {
+        std::vector<float4> data;
+        std::vector<nvrhi::BufferRange> ranges;
+    };
+
+    // Keyframes of numPoints strand points: a rest offset plus numModes random modes with random weights per keyframe, plus noise
+    KeyframeSequence createKeyframes(const uint32_t numKeyframes, const uint32_t numPoints, const uint32_t numModes, const float noise, const uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> random(-1.0f, 1.0f);
+
+        std::vector<float3> modes((size_t)(numModes + 1) * numPoints);
+        for (float3& mode : modes)
+        {
+            mode = float3(random(rng), random(rng), random(rng)) * 0.01f;
+        }
+
+        KeyframeSequence keyframes;
+        keyframes.data.resize((size_t)numKeyframes * numPoints);
+        for (uint32_t keyframeIndex = 0; keyframeIndex < numKeyframes; ++keyframeIndex)
+        {
+            keyframes.ranges.push_back({ (uint64_t)keyframeIndex * numPoints * sizeof(float4), (uint64_t)numPoints * sizeof(float4) });
+
+            std::vector<float> weights(numModes);
+            for (uint32_t mode = 0; mode < numModes; ++mode)
+            {
+                // Later modes are weaker, like the principal components of real motion
+                weights[mode] = random(rng) / float(mode + 1);
+            }
+            for (uint32_t pointIndex = 0; pointIndex < numPoints; ++pointIndex)
+            {
+                float3 offset = modes[pointIndex];
+                for (uint32_t mode = 0; mode < numModes; ++mode)
+                {
+                    offset += weights[mode] * modes[(size_t)(mode + 1) * numPoints + pointIndex];
+                }
+                offset += float3(random(rng), random(rng), random(rng)) * noise;
+                keyframes.data[(size_t)keyframeIndex * numPoints + pointIndex] = float4(offset, 0.0f);
+            }
+        }
+        return keyframes;
+    }
+
+    // Largest distance between a reconstructed and its original offset
+    float getMaxReconstructionError(const KeyframeSequence& keyframes, const MorphTargetPcaBasis& basis)
+    {
+        float maxError = 0.0f;
+        for (uint32_t keyframeIndex = 0; keyframeIndex < basis.keyframeCount; ++keyframeIndex)
+        {
+            const float4* const keyframe = keyframes.data.data() + keyframes.ranges[keyframeIndex].byteOffset / sizeof(float4);
+            for (uint32_t pointIndex = 0; pointIndex < basis.keyframeVertexCount; ++pointIndex)
+            {
+                maxError = std::max(maxError, length(MorphTargetPca::reconstruct(basis, keyframeIndex, pointIndex) - keyframe[pointIndex].xyz()));
+            }
+        }
+        return maxError;
+    }
+}
+
+// A sequence spanned by a few modes is rebuilt from that many components, up to float rounding
+TEST(MorphTargetPca, LowRankSequenceIsExact)
+{
+    const KeyframeSequence keyframes = createKeyframes(40, 3000, 3, 0.0f, 191);
+    ThreadPool threadPool(0);
+    MorphTargetPcaBasis basis;
+    REQUIRE(MorphTargetPca::decompose(keyframes.data, keyframes.ranges, threadPool, basis));
+
+    CHECK(basis.keyframeCount == 40);
+    CHECK(basis.keyframeVertexCount == 3000);
+    CHECK(basis.componentCount == 3 + 1);
+    CHECK(basis.basis.size() == 3000 * basis.componentCount);
+    CHECK(basis.coefficients.size() == 40 * basis.componentCount);
+    CHECK(basis.rmsDeviation > 0.0f);
+    CHECK(basis.rmsError <= 1e-4f * basis.rmsDeviation);
+
+    // The mean has a coefficient of 1 in every keyframe, the other coefficients are eigenvector entries
+    uint32_t numBadCoefficients = 0;
+    for (uint32_t keyframeIndex = 0; keyframeIndex < basis.keyframeCount; ++keyframeIndex)
+    {
+        numBadCoefficients += (basis.coefficients[(size_t)keyframeIndex * basis.componentCount] != 1.0f) ? 1 : 0;
+        for (uint32_t component = 1; component < basis.componentCount; ++component)
+        {
+            numBadCoefficients += (std::abs(basis.coefficients[(size_t)keyframeIndex * basis.componentCount + component]) > 1.0f) ? 1 : 0;
+        }
+    }
+    CHECK(numBadCoefficients == 0);
+
+    const float maxError = getMaxReconstructionError(keyframes, basis);
+    CHECK(basis.maxPositionError == maxError);
+    CHECK(maxError <= 1e-3f * basis.rmsDeviation);
+}
+
+// The component count is the smallest one meeting the error target, and maxComponents caps it
+TEST(MorphTargetPca, ErrorTargetAndComponentCap)
+{
+    const KeyframeSequence keyframes = createKeyframes(24, 2000, 12, 0.001f, 192);
+    ThreadPool threadPool(0);
+
+    uint32_t previousComponentCount = 0;
+    for (const float maxRelativeError : { 0.5f, 0.2f, 0.05f, 0.01f })
+    {
+        MorphTargetPcaSettings settings;
+        settings.maxRelativeError = maxRelativeError;
+        MorphTargetPcaBasis basis;
+        REQUIRE(MorphTargetPca::decompose(keyframes.data, keyframes.ranges, threadPool, basis, settings));
+
+        // The discarded eigenvalues are the squared error, measured on float data
+        CHECK(basis.rmsError <= maxRelativeError * basis.rmsDeviation * 1.001f);
+        CHECK(basis.componentCount >= previousComponentCount);
+        CHECK(basis.componentCount <= 24);
+        previousComponentCount = basis.componentCount;
+
+        if (basis.componentCount > 2)
+        {
+            // One component fewer misses the target
+            settings.maxComponents = basis.componentCount - 2;
+            MorphTargetPcaBasis cappedBasis;
+            REQUIRE(MorphTargetPca::decompose(keyframes.data, keyframes.ranges, threadPool, cappedBasis, settings));
+            CHECK(cappedBasis.componentCount == basis.componentCount - 1);
+            CHECK(cappedBasis.rmsError > maxRelativeError * cappedBasis.rmsDeviation * 0.999f);
+        }
+    }
+    CHECK(previousComponentCount > 1);
+
+    MorphTargetPcaSettings settings;
+    settings.maxRelativeError = 0.0f;
+    settings.maxComponents = 100;
+    MorphTargetPcaBasis basis;
+    REQUIRE(MorphTargetPca::decompose(keyframes.data, keyframes.ranges, threadPool, basis, settings));
+    // At most one component per keyframe besides the mean, the offsets around the mean have rank numKeyframes - 1
+    CHECK(basis.componentCount == 24);
+    CHECK(basis.rmsError <= 1e-4f * basis.rmsDeviation);
+}
+
+// The basis, coefficients and error are the same bits on one and on several threads
+TEST(MorphTargetPca, IndependentOfThreadCount)
+{
+    // More strand points than a chunk, so the work is split
+    const KeyframeSequence keyframes = createKeyframes(9, 40000, 4, 0.0005f, 193);
+
+    MorphTargetPcaBasis bases[2];
+    for (uint32_t basisIndex = 0; basisIndex < 2; ++basisIndex)
+    {
+        ThreadPool threadPool(basisIndex == 0 ? 1 : 4);
+        REQUIRE(MorphTargetPca::decompose(keyframes.data, keyframes.ranges, threadPool, bases[basisIndex]));
+    }
+
+    CHECK(bases[0].componentCount == bases[1].componentCount);
+    CHECK(isBitwiseEqual(bases[0].basis, bases[1].basis));
+    CHECK(isBitwiseEqual(bases[0].coefficients, bases[1].coefficients));
+    CHECK(bases[0].rmsError == bases[1].rmsError);
+    CHECK(bases[0].maxPositionError == bases[1].maxPositionError);
+}
+
+// The PCA keyframe format decodes, as the shader does, to the reconstruction its error was measured on
+TEST(MorphTargetPca, EncoderDecodesReconstruction)
+{
+    const KeyframeSequence keyframes = createKeyframes(16, 1500, 5, 0.0002f, 194);
+    ThreadPool threadPool(1);
+    MorphTargetPcaBasis basis;
+    REQUIRE(MorphTargetPca::decompose(keyframes.data, keyframes.ranges, threadPool, basis));
+
+    MorphTargetKeyframeEncoder::EncodedKeyframes encodedKeyframes;
+    MorphTargetKeyframeEncoder::encode(keyframes.data, keyframes.ranges, RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_PCA, encodedKeyframes);
+    REQUIRE(encodedKeyframes.format == RTXCR_MORPH_TARGET_KEYFRAME_FORMAT_PCA);
+    REQUIRE(encodedKeyframes.componentCount == basis.componentCount);
+    CHECK(encodedKeyframes.keyframeVertexCount == basis.keyframeVertexCount);
+    CHECK(encodedKeyframes.getByteSize() == basis.basis.size() * sizeof(float4));
+    CHECK(encodedKeyframes.maxPositionError == basis.maxPositionError);
+
+    // Every keyframe range is the whole basis
+    REQUIRE(encodedKeyframes.keyframeRanges.size() == keyframes.ranges.size());
+    for (const nvrhi::BufferRange& range : encodedKeyframes.keyframeRanges)
+    {
+        CHECK(range.byteOffset == 0 && range.byteSize == encodedKeyframes.getByteSize());
+    }
+
+    uint32_t numMismatches = 0;
+    for (uint32_t keyframeIndex = 0; keyframeIndex < basis.keyframeCount; ++keyframeIndex)
+    {
+        for (uint32_t pointIndex = 0; pointIndex < basis.keyframeVertexCount; ++pointIndex)
+        {
+            const float3 decodedOffset = MorphTargetKeyframeEncoder::decode(encodedKeyframes, keyframeIndex, pointIndex);
+            const float3 reconstructedOffset = MorphTargetPca::reconstruct(basis, keyframeIndex, pointIndex);
+            numMismatches += (decodedOffset.x != reconstructedOffset.x || decodedOffset.y != reconstructedOffset.y ||
+                              decodedOffset.z != reconstructedOffset.z) ? 1 : 0;
+        }
+    }
+    CHECK(numMismatches == 0);
+}
+
+// A single keyframe is its own mean, keyframes of different sizes or outside the data are rejected
+TEST(MorphTargetPca, DegenerateSequences)
+{
+    ThreadPool threadPool(1);
+    MorphTargetPcaBasis basis;
+
+    const KeyframeSequence singleKeyframe = createKeyframes(1, 100, 2, 0.001f, 195);
+    REQUIRE(MorphTargetPca::decompose(singleKeyframe.data, singleKeyframe.ranges, threadPool, basis));
+    CHECK(basis.componentCount == 1);
+    CHECK(basis.rmsDeviation == 0.0f);
+    CHECK(getMaxReconstructionError(singleKeyframe, basis) == 0.0f);
+
+    CHECK(!MorphTargetPca::decompose(singleKeyframe.data, {}, threadPool, basis));
+
+    KeyframeSequence keyframes = createKeyframes(4, 100, 2, 0.001f, 196);
+    keyframes.ranges[2].byteSize -= sizeof(float4);
+    CHECK(!MorphTargetPca::decompose(keyframes.data, keyframes.ranges, threadPool, basis));
+
+    keyframes = createKeyframes(4, 100, 2, 0.001f, 196);
+    keyframes.ranges[3].byteOffset += sizeof(float4);
+    CHECK(!MorphTargetPca::decompose(keyframes.data, keyframes.ranges, threadPool, basis));
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <atomic>
+#include <stdexcept>
+
+#include "Curve/ThreadPool.h"
+#include "TestFramework.h"
+
+TEST(ThreadPool, RunsEveryTaskOnce)
+{
+    for (const uint32_t threadCount : { 1u, 2u, 4u })
+    {
+        ThreadPool threadPool(threadCount);
+        CHECK(threadPool.GetThreadCount() == threadCount);
+
+        for (const uint32_t taskCount : { 0u, 1u, 3u, 1000u })
+        {
+            std::vector<std::atomic<uint32_t>> runCounts(taskCount);
+            threadPool.ParallelFor(taskCount, [&](const uint32_t taskIndex) { ++runCounts[taskIndex]; });
+
+            for (const auto& runCount : runCounts)
+            {
+                CHECK(runCount == 1);
+            }
+        }
+    }
+}
+
+TEST(ThreadPool, RethrowsTaskExceptionOnCaller)
+{
+    for (const uint32_t threadCount : { 1u, 2u, 4u })
+    {
+        ThreadPool threadPool(threadCount);
+
+        std::atomic<uint32_t> runCount = 0;
+        bool isThrown = false;
+        try
+        {
+            threadPool.ParallelFor(1000, [&](const uint32_t taskIndex)
+            {
+                ++runCount;
+                if (taskIndex == 10)
+                {
+                    throw std::runtime_error("task 10");
+                }
+            });
+        }
+        catch (const std::runtime_error& exception)
+        {
+            isThrown = (std::string(exception.what()) == "task 10");
+        }
+        CHECK(isThrown);
+        // The tasks after the failing one are skipped, except the ones already running
+        CHECK(runCount < 1000);
+
+        // The pool stays usable and the exception doesn't leak into the next call
+        std::atomic<uint32_t> nextRunCount = 0;
+        threadPool.ParallelFor(100, [&](const uint32_t) { ++nextRunCount; });
+        CHECK(nextRunCount == 100);
+    }
+}
+
+TEST(ThreadPool, NestedParallelForRunsOnCallingWorker)
+{
+    ThreadPool threadPool(4);
+
+    std::vector<std::atomic<uint32_t>> runCounts(16 * 16);
+    threadPool.ParallelFor(16, [&](const uint32_t outerIndex)
+    {
+        threadPool.ParallelFor(16, [&](const uint32_t innerIndex) { ++runCounts[outerIndex * 16 + innerIndex]; });
+    });
+
+    for (const auto& runCount : runCounts)
+    {
+        CHECK(runCount == 1);
+    }
+}
+
+TEST(ThreadPool, NestedExceptionReachesOuterCaller)
+{
+    ThreadPool threadPool(2);
+
+    bool isThrown = false;
+    try
+    {
+        threadPool.ParallelFor(8, [&](const uint32_t outerIndex)
+        {
+            threadPool.ParallelFor(8, [&](const uint32_t innerIndex)
+            {
+                if (outerIndex == 3 && innerIndex == 5)
+                {
+                    throw std::runtime_error("nested");
+                }
+            });
+        });
+    }
+    catch (const std::runtime_error&)
+    {
+        isThrown = true;
+    }
+    CHECK(isThrown);
+}
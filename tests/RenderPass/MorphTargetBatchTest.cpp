@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <functional>
+
+#include "RenderPass/MorphTargetBatch.h"
+#include "TestFramework.h"
+
+namespace
+{
+    uint32_t getVerticesPerLineSegment(const uint32_t tessellationType, const uint32_t polyTubeOrder)
+    {
+        return (tessellationType == RTXCR_CURVE_TESSELLATION_TYPE_POLYTUBE) ? polyTubeOrder * 6 :
+            (tessellationType == RTXCR_CURVE_TESSELLATION_TYPE_DOTS) ? 2 * 6 : 2;
+    }
+
+    // A mesh with two full precision keyframes and a vertex buffer of positions, normals and tangents, laid out like ResourceManager does
+    void addMesh(
+        std::vector<MorphTargetBatchMesh>& meshes,
+        std::vector<MorphTargetBatch::MeshResourceSizes>& meshResourceSizes,
+        const uint32_t numLineSegments,
+        const uint32_t polyTubeOrder,
+        const uint32_t tessellationType,
+        const bool perSegment)
+    {
+        const uint32_t numVertices = numLineSegments * getVerticesPerLineSegment(tessellationType, polyTubeOrder);
+
+        MorphTargetBatch::MeshResourceSizes sizes;
+        sizes.keyframeVertexCount = numLineSegments + 1;
+        sizes.keyframeElementCount = 2 * sizes.keyframeVertexCount;
+        sizes.lineSegmentCount = numLineSegments;
+        sizes.vertexBufferByteSize = numVertices * (3 * sizeof(float) + 2 * sizeof(uint32_t));
+
+        MorphTargetBatchMesh mesh = {};
+        mesh.vertexCount = (int)numVertices;
+        mesh.polyTubeOrder = polyTubeOrder;
+        mesh.keyframeOffset = 0;
+        mesh.nextKeyframeOffset = sizes.keyframeVertexCount;
+        mesh.lerpWeight = 0.5f;
+        mesh.positionByteOffset = 0;
+        mesh.normalByteOffset = numVertices * 3 * sizeof(float);
+        mesh.tangentByteOffset = mesh.normalByteOffset + numVertices * sizeof(uint32_t);
+        mesh.nextKeyframeIndex = 1;
+        mesh.numThreads = MorphTargetBatch::getMeshThreadCount(mesh, tessellationType, perSegment);
+
+        meshes.push_back(mesh);
+        meshResourceSizes.push_back(sizes);
+    }
+}
+
+// One thread per vertex, or per line segment with the per segment kernel of the triangle representations
+TEST(MorphTargetBatch, MeshThreadCounts)
+{
+    for (uint32_t order = RTXCR_CURVE_POLYTUBE_MIN_ORDER; order <= RTXCR_CURVE_POLYTUBE_MAX_ORDER; ++order)
+    {
+        MorphTargetBatchMesh mesh = {};
+        mesh.polyTubeOrder = order;
+        mesh.vertexCount = 100 * order * 6;
+        CHECK(MorphTargetBatch::getMeshThreadCount(mesh, RTXCR_CURVE_TESSELLATION_TYPE_POLYTUBE, false) == 100 * order * 6);
+        CHECK(MorphTargetBatch::getMeshThreadCount(mesh, RTXCR_CURVE_TESSELLATION_TYPE_POLYTUBE, true) == 100);
+    }
+
+    MorphTargetBatchMesh mesh = {};
+    mesh.polyTubeOrder = RTXCR_CURVE_POLYTUBE_ORDER;
+    mesh.vertexCount = 100 * 12;
+    CHECK(MorphTargetBatch::getMeshThreadCount(mesh, RTXCR_CURVE_TESSELLATION_TYPE_DOTS, false) == 100 * 12);
+    CHECK(MorphTargetBatch::getMeshThreadCount(mesh, RTXCR_CURVE_TESSELLATION_TYPE_DOTS, true) == 100);
+
+    // LSS always runs one thread per vertex
+    mesh.vertexCount = 200;
+    CHECK(MorphTargetBatch::getMeshThreadCount(mesh, RTXCR_CURVE_TESSELLATION_TYPE_LSS, false) == 200);
+    CHECK(MorphTargetBatch::getMeshThreadCount(mesh, RTXCR_CURVE_TESSELLATION_TYPE_LSS, true) == 200);
+
+    mesh.vertexCount = 0;
+    CHECK(MorphTargetBatch::getMeshThreadCount(mesh, RTXCR_CURVE_TESSELLATION_TYPE_POLYTUBE, true) == 0);
+    mesh.vertexCount = -1;
+    CHECK(MorphTargetBatch::getMeshThreadCount(mesh, RTXCR_CURVE_TESSELLATION_TYPE_LSS, false) == 0);
+}
+
+// The thread ranges are contiguous in table order and every thread finds the mesh owning it, meshes without threads are skipped
+TEST(MorphTargetBatch, ThreadRangesAndLookup)
+{
+    std::vector<MorphTargetBatchMesh> meshes;
+    CHECK(MorphTargetBatch::assignThreadRanges(meshes) == 0);
+    CHECK(MorphTargetBatch::findMesh(meshes, 0) == 0);
+
+    for (const uint32_t numThreads : { 0u, 5u, 0u, 64u, 0u, 0u, 1u, 130u, 0u })
+    {
+        MorphTargetBatchMesh& mesh = meshes.emplace_back();
+        mesh = {};
+        mesh.numThreads = numThreads;
+    }
+    const uint32_t numThreads = MorphTargetBatch::assignThreadRanges(meshes);
+    CHECK(numThreads == 5 + 64 + 1 + 130);
+
+    uint32_t nextThread = 0;
+    std::vector<uint32_t> threadMeshes;
+    for (uint32_t meshIndex = 0; meshIndex < meshes.size(); ++meshIndex)
+    {
+        CHECK(meshes[meshIndex].firstThread == nextThread);
+        nextThread += meshes[meshIndex].numThreads;
+        threadMeshes.insert(threadMeshes.end(), meshes[meshIndex].numThreads, meshIndex);
+    }
+
+    uint32_t numLookupMismatches = 0;
+    for (uint32_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+    {
+        numLookupMismatches += (MorphTargetBatch::findMesh(meshes, threadIndex) != threadMeshes[threadIndex]) ? 1 : 0;
+    }
+    CHECK(numLookupMismatches == 0);
+
+    // Threads of the last, partially filled thread group
+    CHECK(MorphTargetBatch::findMesh(meshes, numThreads) == meshes.size());
+    CHECK(MorphTargetBatch::findMesh(meshes, numThreads + RTXCR_MORPH_TARGET_THREAD_GROUP_SIZE - 1) == meshes.size());
+}
+
+// Tables built like DispatchBatched builds them pass validation for every representation and kernel
+TEST(MorphTargetBatch, ValidTables)
+{
+    for (const uint32_t tessellationType : { RTXCR_CURVE_TESSELLATION_TYPE_POLYTUBE, RTXCR_CURVE_TESSELLATION_TYPE_DOTS, RTXCR_CURVE_TESSELLATION_TYPE_LSS })
+    {
+        for (const bool perSegment : { false, true })
+        {
+            std::vector<MorphTargetBatchMesh> meshes;
+            std::vector<MorphTargetBatch::MeshResourceSizes> meshResourceSizes;
+            for (uint32_t order = RTXCR_CURVE_POLYTUBE_MIN_ORDER; order <= RTXCR_CURVE_POLYTUBE_MAX_ORDER; ++order)
+            {
+                addMesh(meshes, meshResourceSizes, 37 * order, order, tessellationType, perSegment);
+            }
+            addMesh(meshes, meshResourceSizes, 0, RTXCR_CURVE_POLYTUBE_ORDER, tessellationType, perSegment);
+
+            const uint32_t numThreads = MorphTargetBatch::assignThreadRanges(meshes);
+            CHECK(MorphTargetBatch::validate(meshes, meshResourceSizes, numThreads, tessellationType, perSegment));
+        }
+    }
+}
+
+// Every broken thread range, lookup, read or write is rejected
+TEST(MorphTargetBatch, RejectsBrokenTables)
+{
+    const uint32_t tessellationType = RTXCR_CURVE_TESSELLATION_TYPE_POLYTUBE;
+    const bool perSegment = true;
+    std::vector<MorphTargetBatchMesh> validMeshes;
+    std::vector<MorphTargetBatch::MeshResourceSizes> validSizes;
+    for (const uint32_t numLineSegments : { 10u, 200u, 3u })
+    {
+        addMesh(validMeshes, validSizes, numLineSegments, RTXCR_CURVE_POLYTUBE_ORDER, tessellationType, perSegment);
+    }
+    const uint32_t validNumThreads = MorphTargetBatch::assignThreadRanges(validMeshes);
+    REQUIRE(MorphTargetBatch::validate(validMeshes, validSizes, validNumThreads, tessellationType, perSegment));
+
+    using BreakTable = std::function<void(std::vector<MorphTargetBatchMesh>&, std::vector<MorphTargetBatch::MeshResourceSizes>&, uint32_t&)>;
+    const BreakTable breakTables[] = {
+        [](auto& meshes, auto&, auto&) { meshes[1].firstThread += 1; },
+        [](auto& meshes, auto&, auto&) { meshes[1].numThreads -= 1; },
+        [](auto&, auto&, auto& numThreads) { numThreads += 1; },
+        [](auto&, auto& sizes, auto&) { sizes.pop_back(); },
+        [](auto& meshes, auto& sizes, auto&) { meshes[0].keyframeOffset = sizes[0].keyframeVertexCount + 1; },
+        [](auto& meshes, auto& sizes, auto&) { meshes[2].nextKeyframeOffset = sizes[2].keyframeElementCount; },
+        [](auto&, auto& sizes, auto&) { sizes[1].keyframeParameterCount = 1; },
+        [](auto&, auto& sizes, auto&) { sizes[1].lineSegmentCount -= 1; },
+        [](auto& meshes, auto&, auto&) { meshes[0].compactLineSegments = 1; },
+        [](auto& meshes, auto&, auto&) { meshes[2].positionByteOffset = meshes[2].normalByteOffset + 4; },
+        [](auto& meshes, auto&, auto&) { meshes[1].tangentByteOffset += 4; },
+        [](auto&, auto& sizes, auto&) { sizes[0].vertexBufferByteSize -= 1; } };
+
+    for (const BreakTable& breakTable : breakTables)
+    {
+        std::vector<MorphTargetBatchMesh> meshes = validMeshes;
+        std::vector<MorphTargetBatch::MeshResourceSizes> sizes = validSizes;
+        uint32_t numThreads = validNumThreads;
+        breakTable(meshes, sizes, numThreads);
+        CHECK(!MorphTargetBatch::validate(meshes, sizes, numThreads, tessellationType, perSegment));
+    }
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <algorithm>
+#include <random>
+
+#include "SyntheticGroom.h"
+#include "TestFramework.h"
+
+using namespace donut::math;
+using namespace donut::engine;
+
+std::shared_ptr<MeshInstance> createSyntheticGroom(const SyntheticGroomDesc& desc)
+{
+    std::mt19937 rng(desc.seed);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::uniform_int_distribution<uint32_t> pointCount(std::max(desc.minPointsPerStrand, 2u), std::max(desc.maxPointsPerStrand, desc.minPointsPerStrand));
+
+    auto mesh = std::make_shared<MeshInfo>();
+    mesh->name = desc.name;
+    mesh->type = MeshType::CurvePolytubes;
+    mesh->isMorphTargetAnimationMesh = (desc.numKeyframes > 0);
+    mesh->buffers = std::make_shared<BufferGroup>();
+    BufferGroup& buffers = *mesh->buffers;
+
+    const auto material = std::make_shared<Material>();
+
+    // Every strand point in order, the keyframes hold one entry per strand point
+    std::vector<float3> strandPoints;
+
+    float3 prevStrandEnd = float3(0.0f);
+    for (uint32_t geometryIndex = 0; geometryIndex < desc.numGeometries; ++geometryIndex)
+    {
+        auto geometry = std::make_shared<MeshGeometry>();
+        geometry->material = material;
+        geometry->type = desc.isLineStrip ? MeshGeometryPrimitiveType::LineStrip : MeshGeometryPrimitiveType::Lines;
+        // Geometries are indexed relative to their first index, every index has its own vertex, so both offsets match
+        geometry->indexOffsetInMesh = static_cast<uint32_t>(buffers.indexData.size());
+        geometry->vertexOffsetInMesh = static_cast<uint32_t>(buffers.positionData.size());
+
+        const uint32_t numStrands = desc.isLineStrip ? 1 : desc.strandsPerGeometry;
+        for (uint32_t strandIndex = 0; strandIndex < numStrands; ++strandIndex)
+        {
+            const float joinedRandom = (!desc.isLineStrip && (strandIndex > 0)) ? unit(rng) : 1.0f;
+            const bool isJoined = (joinedRandom < desc.joinedStrandRatio);
+            const bool isNear = !isJoined && (joinedRandom < desc.joinedStrandRatio + desc.nearStrandRatio);
+            // Below and just above the isnear() tolerance of the segment group detection, in one axis only for the near strands
+            const float3 root = isJoined ? prevStrandEnd + float3(4e-6f, -3e-6f, 2e-6f) :
+                isNear ? prevStrandEnd + float3(0.0f, 2e-5f, 0.0f) :
+                float3(unit(rng) * 10.0f - 5.0f, unit(rng) * 2.0f, unit(rng) * 10.0f - 5.0f);
+            const float3 direction = normalize(float3(unit(rng) - 0.5f, -1.0f, unit(rng) - 0.5f));
+            const float rootRadius = 0.002f + 0.002f * unit(rng);
+            const float curl = unit(rng) * 0.2f;
+
+            const uint32_t numPoints = pointCount(rng);
+            std::vector<float3> points(numPoints);
+            std::vector<float> radius(numPoints);
+            std::vector<float2> texCoords(numPoints);
+            for (uint32_t pointIndex = 0; pointIndex < numPoints; ++pointIndex)
+            {
+                const float t = (float)pointIndex / (float)(numPoints - 1);
+                points[pointIndex] = (pointIndex == 0) ? root :
+                    root + direction * (t * 0.5f) + float3(std::sin(t * 7.0f) * curl, 0.0f, std::cos(t * 5.0f) * curl - curl);
+                radius[pointIndex] = rootRadius * (1.0f - 0.8f * t);
+                texCoords[pointIndex] = float2((float)strandIndex / (float)numStrands, t);
+                strandPoints.push_back(points[pointIndex]);
+            }
+            prevStrandEnd = points.back();
+
+            const uint32_t firstIndex = static_cast<uint32_t>(buffers.indexData.size()) - geometry->indexOffsetInMesh;
+            if (desc.isLineStrip)
+            {
+                for (uint32_t pointIndex = 0; pointIndex < numPoints; ++pointIndex)
+                {
+                    buffers.indexData.push_back(firstIndex + pointIndex);
+                    buffers.positionData.push_back(points[pointIndex]);
+                    buffers.radiusData.push_back(radius[pointIndex]);
+                    buffers.texcoord1Data.push_back(texCoords[pointIndex]);
+                }
+            }
+            else
+            {
+                for (uint32_t pointIndex = 0; pointIndex + 1 < numPoints; ++pointIndex)
+                {
+                    for (uint32_t endIndex = 0; endIndex < 2; ++endIndex)
+                    {
+                        buffers.indexData.push_back(firstIndex + 2 * pointIndex + endIndex);
+                        buffers.positionData.push_back(points[pointIndex + endIndex]);
+                        buffers.radiusData.push_back(radius[pointIndex + endIndex]);
+                        buffers.texcoord1Data.push_back(texCoords[pointIndex + endIndex]);
+                    }
+                }
+            }
+        }
+
+        geometry->numIndices = static_cast<uint32_t>(buffers.indexData.size()) - geometry->indexOffsetInMesh;
+        geometry->numVertices = static_cast<uint32_t>(buffers.positionData.size()) - geometry->vertexOffsetInMesh;
+        mesh->geometries.push_back(geometry);
+    }
+
+    // Every keyframe sways the strand points by a growing offset
+    for (uint32_t keyframeIndex = 0; keyframeIndex < desc.numKeyframes; ++keyframeIndex)
+    {
+        nvrhi::BufferRange range;
+        range.byteOffset = buffers.morphTargetData.size() * sizeof(float4);
+        range.byteSize = strandPoints.size() * sizeof(float4);
+        buffers.morphTargetBufferRange.push_back(range);
+
+        const float sway = 0.01f * (float)keyframeIndex;
+        for (const float3& point : strandPoints)
+        {
+            buffers.morphTargetData.push_back(float4(point + float3(sway * point.y, 0.0f, -sway), 0.0f));
+        }
+    }
+
+    return std::make_shared<MeshInstance>(mesh);
+}
+
+std::vector<std::shared_ptr<MeshInstance>> createGrooms(const SyntheticGroomSceneDesc& desc)
+{
+    SyntheticGroomDesc lineListDesc;
+    lineListDesc.name = "lineList";
+    lineListDesc.numGeometries = 3;
+    lineListDesc.strandsPerGeometry = desc.lineListStrandsPerGeometry;
+    lineListDesc.minPointsPerStrand = desc.minPointsPerStrand;
+    lineListDesc.maxPointsPerStrand = desc.maxPointsPerStrand;
+    lineListDesc.seed = desc.seed;
+
+    SyntheticGroomDesc lineStripDesc = lineListDesc;
+    lineStripDesc.name = "lineStrip";
+    lineStripDesc.numGeometries = desc.numLineStrips;
+    lineStripDesc.isLineStrip = true;
+    lineStripDesc.seed = desc.seed + 1;
+
+    std::vector<std::shared_ptr<MeshInstance>> meshInstances = { createSyntheticGroom(lineListDesc), createSyntheticGroom(lineStripDesc) };
+    if (desc.numMorphStrands > 0)
+    {
+        SyntheticGroomDesc morphDesc = lineListDesc;
+        morphDesc.name = "morph";
+        morphDesc.numGeometries = 1;
+        morphDesc.strandsPerGeometry = desc.numMorphStrands;
+        morphDesc.numKeyframes = desc.numMorphKeyframes;
+        morphDesc.seed = desc.seed + 2;
+        meshInstances.push_back(createSyntheticGroom(morphDesc));
+    }
+    return meshInstances;
+}
+
+SyntheticGroomDesc getBenchmarkGroomDesc(const std::vector<std::string>& args, const uint32_t defaultStrands, const uint32_t defaultPointsPerStrand)
+{
+    SyntheticGroomDesc desc;
+    desc.numGeometries = 16;
+    desc.strandsPerGeometry = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 0, defaultStrands)) / desc.numGeometries, 1u);
+    desc.minPointsPerStrand = std::max(static_cast<uint32_t>(TestFramework::getBenchmarkArg(args, 1, defaultPointsPerStrand)), 2u);
+    desc.maxPointsPerStrand = desc.minPointsPerStrand;
+    return desc;
+}
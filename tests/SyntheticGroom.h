@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include <donut/engine/SceneGraph.h>
+
+// Curve mesh in the layout of the glTF hair of the sample scenes, with random strands
+struct SyntheticGroomDesc
+{
+    std::string name = "groom";
+    uint32_t numGeometries = 1;
+    uint32_t strandsPerGeometry = 64;   // Line lists only, a line strip geometry is one strand
+    uint32_t minPointsPerStrand = 4;
+    uint32_t maxPointsPerStrand = 12;
+    bool isLineStrip = false;
+    // Fraction of line list strands starting within isnear() of the end of the previous strand, they join its segment group
+    float joinedStrandRatio = 0.0f;
+    // Fraction of line list strands starting just beyond isnear() of the end of the previous strand, they start a new group
+    float nearStrandRatio = 0.0f;
+    uint32_t numKeyframes = 0;          // Morph target keyframes, 0: a static mesh
+    uint32_t seed = 1;
+};
+
+std::shared_ptr<donut::engine::MeshInstance> createSyntheticGroom(const SyntheticGroomDesc& desc);
+
+// Mixed curve scene of the tests: line lists over three geometries, line strips of one strand per geometry and, with numMorphStrands > 0,
+// a morph target animated line list. The meshes are named lineList, lineStrip and morph and use seed, seed + 1 and seed + 2.
+struct SyntheticGroomSceneDesc
+{
+    uint32_t lineListStrandsPerGeometry = 40;
+    uint32_t numLineStrips = 25;
+    uint32_t minPointsPerStrand = 3;
+    uint32_t maxPointsPerStrand = 20;
+    uint32_t numMorphStrands = 30;
+    uint32_t numMorphKeyframes = 3;
+    uint32_t seed = 11;
+};
+
+std::vector<std::shared_ptr<donut::engine::MeshInstance>> createGrooms(const SyntheticGroomSceneDesc& desc = {});
+
+// Groom of the curve benchmarks: the strands of benchmark argument 0 over 16 line list geometries, every strand with the points of argument 1
+SyntheticGroomDesc getBenchmarkGroomDesc(const std::vector<std::string>& args, const uint32_t defaultStrands, const uint32_t defaultPointsPerStrand = 32);
+
+// Byte wise equality of two vectors
+template <typename T>
+bool isBitwiseEqual(const std::vector<T>& lhs, const std::vector<T>& rhs)
+{
+    return lhs.size() == rhs.size() && (lhs.empty() || memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(T)) == 0);
+}
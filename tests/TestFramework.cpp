@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "TestFramework.h"
+
+namespace TestFramework
+{
+    namespace
+    {
+        uint32_t g_failureCount = 0;
+    }
+
+    std::vector<TestCase>& getTestCases()
+    {
+        static std::vector<TestCase> testCases;
+        return testCases;
+    }
+
+    std::vector<Benchmark>& getBenchmarks()
+    {
+        static std::vector<Benchmark> benchmarks;
+        return benchmarks;
+    }
+
+    void reportFailure(const char* file, const int line, const char* expression)
+    {
+        ++g_failureCount;
+        printf("  %s(%d): failed: %s\n", file, line, expression);
+    }
+
+    uint32_t getFailureCount()
+    {
+        return g_failureCount;
+    }
+
+    double getBenchmarkArg(const std::vector<std::string>& args, const size_t index, const double defaultValue)
+    {
+        return (index < args.size()) ? atof(args[index].c_str()) : defaultValue;
+    }
+}
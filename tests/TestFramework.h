@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Minimal test and benchmark registry of rtxcr_tests and rtxcr_benchmarks.
+// TEST(Suite, Name) registers "Suite.Name", CTest runs every suite as its own test through a name prefix.
+namespace TestFramework
+{
+    using TestFunction = void (*)();
+    using BenchmarkFunction = void (*)(const std::vector<std::string>& args);
+
+    struct TestCase
+    {
+        std::string name;
+        TestFunction function = nullptr;
+    };
+
+    struct Benchmark
+    {
+        std::string name;
+        std::string usage;
+        BenchmarkFunction function = nullptr;
+    };
+
+    std::vector<TestCase>& getTestCases();
+    std::vector<Benchmark>& getBenchmarks();
+
+    struct TestRegistration
+    {
+        TestRegistration(const char* name, const TestFunction function) { getTestCases().push_back({ name, function }); }
+    };
+
+    struct BenchmarkRegistration
+    {
+        BenchmarkRegistration(const char* name, const char* usage, const BenchmarkFunction function) { getBenchmarks().push_back({ name, usage, function }); }
+    };
+
+    // Thrown by REQUIRE to abandon the current test
+    struct RequireFailure {};
+
+    void reportFailure(const char* file, const int line, const char* expression);
+
+    // Number of CHECK and REQUIRE failures of the current test
+    uint32_t getFailureCount();
+
+    // Integer or floating point argument of a benchmark, defaultValue if it isn't given
+    double getBenchmarkArg(const std::vector<std::string>& args, const size_t index, const double defaultValue);
+}
+
+#define TEST(suite, name) \
+    static void suite##_##name(); \
+    static const TestFramework::TestRegistration suite##_##name##_registration(#suite "." #name, suite##_##name); \
+    static void suite##_##name()
+
+#define BENCHMARK(name, usage) \
+    static void name##_benchmark(const std::vector<std::string>& args); \
+    static const TestFramework::BenchmarkRegistration name##_registration(#name, usage, name##_benchmark); \
+    static void name##_benchmark(const std::vector<std::string>& args)
+
+#define CHECK(expression) \
+    do { if (!(expression)) { TestFramework::reportFailure(__FILE__, __LINE__, #expression); } } while (false)
+
+#define REQUIRE(expression) \
+    do { if (!(expression)) { TestFramework::reportFailure(__FILE__, __LINE__, #expression); throw TestFramework::RequireFailure(); } } while (false)
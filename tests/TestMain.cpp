@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * NVIDIA CORPORATION and its licensors retain all intellectual property
+ * and proprietary rights in and to this software, related documentation
+ * and any modifications thereto.  Any use, reproduction, disclosure or
+ * distribution of this software and related documentation without an express
+ * license agreement from NVIDIA CORPORATION is strictly prohibited.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <donut/core/log.h>
+
+#include "TestFramework.h"
+
+// rtxcr_tests [name prefix]: runs every test whose name starts with the prefix, all of them without one
+int main(int argc, const char* const* argv)
+{
+    donut::log::SetMinSeverity(donut::log::Severity::Warning);
+
+    const std::string prefix = (argc > 1) ? argv[1] : "";
+
+    uint32_t numTests = 0;
+    uint32_t numFailedTests = 0;
+    for (const TestFramework::TestCase& testCase : TestFramework::getTestCases())
+    {
+        if (testCase.name.compare(0, prefix.size(), prefix) != 0)
+        {
+            continue;
+        }
+
+        printf("[ RUN  ] %s\n", testCase.name.c_str());
+        fflush(stdout);
+
+        const uint32_t failureCount = TestFramework::getFailureCount();
+        const auto startTime = std::chrono::high_resolution_clock::now();
+        bool isFailed = false;
+        try
+        {
+            testCase.function();
+        }
+        catch (const TestFramework::RequireFailure&)
+        {
+            isFailed = true;
+        }
+        catch (const std::exception& exception)
+        {
+            printf("  unexpected exception: %s\n", exception.what());
+            isFailed = true;
+        }
+        isFailed = isFailed || (TestFramework::getFailureCount() != failureCount);
+
+        const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::high_resolution_clock::now() - startTime;
+        printf("[ %s ] %s (%.1f ms)\n", isFailed ? "FAIL" : " OK ", testCase.name.c_str(), elapsedTime.count());
+
+        ++numTests;
+        numFailedTests += isFailed ? 1 : 0;
+    }
+
+    printf("%u of %u tests passed\n", numTests - numFailedTests, numTests);
+    return (numTests == 0 || numFailedTests > 0) ? 1 : 0;
+}